@@ -0,0 +1,56 @@
+# EmbedShaders.cmake - generate a C++ include with SPIR-V as constexpr arrays
+#
+# Run in script mode:
+#   cmake -DSPV_DIR=<dir with *.spv> -DOUTPUT=<file.inc> -P EmbedShaders.cmake
+#
+# Each <name>.<stage>.spv becomes a uint32_t array, and EMBEDDED_SHADERS lists
+# them sorted by "<name>.<stage>" so ShaderBundle can binary-search by name.
+
+if(NOT SPV_DIR OR NOT OUTPUT)
+    message(FATAL_ERROR "EmbedShaders.cmake requires SPV_DIR and OUTPUT")
+endif()
+
+file(GLOB SPV_FILES "${SPV_DIR}/*.spv")
+if(NOT SPV_FILES)
+    message(FATAL_ERROR "EmbedShaders.cmake: no .spv files in ${SPV_DIR}")
+endif()
+
+# Sort by shader name (not file name) so the table order matches lookups
+set(SHADER_NAMES "")
+foreach(SPV_FILE IN LISTS SPV_FILES)
+    get_filename_component(FILE_NAME "${SPV_FILE}" NAME)
+    string(REGEX REPLACE "\\.spv$" "" SHADER_NAME "${FILE_NAME}")
+    list(APPEND SHADER_NAMES "${SHADER_NAME}")
+endforeach()
+list(SORT SHADER_NAMES)
+
+set(ARRAYS "")
+set(TABLE "")
+foreach(SHADER_NAME IN LISTS SHADER_NAMES)
+    set(SPV_FILE "${SPV_DIR}/${SHADER_NAME}.spv")
+    string(MAKE_C_IDENTIFIER "${SHADER_NAME}" ARRAY_NAME)
+
+    # SPIR-V is a stream of little-endian 32-bit words
+    file(READ "${SPV_FILE}" HEX_CONTENT HEX)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])([0-9a-f][0-9a-f])([0-9a-f][0-9a-f])([0-9a-f][0-9a-f])"
+                         "0x\\4\\3\\2\\1," WORDS "${HEX_CONTENT}")
+    # Eight words per line (CMake regexes have no {n} repetition)
+    string(REPEAT "0x[0-9a-f]+," 8 EIGHT_WORDS)
+    string(REGEX REPLACE "(${EIGHT_WORDS})" "\\1\n    " WORDS "${WORDS}")
+
+    string(APPEND ARRAYS "constexpr uint32_t SPV_${ARRAY_NAME}[] = {\n    ${WORDS}\n};\n\n")
+    string(APPEND TABLE
+           "    {\"${SHADER_NAME}\", SPV_${ARRAY_NAME}, std::size(SPV_${ARRAY_NAME})},\n")
+endforeach()
+
+set(CONTENT "// Generated by cmake/EmbedShaders.cmake - do not edit\n\n")
+string(APPEND CONTENT "${ARRAYS}")
+string(APPEND CONTENT "constexpr EmbeddedShader EMBEDDED_SHADERS[] = {\n${TABLE}};\n")
+
+# Only touch the output when it changes, to avoid needless rebuilds
+if(EXISTS "${OUTPUT}")
+    file(READ "${OUTPUT}" OLD_CONTENT)
+endif()
+if(NOT "${OLD_CONTENT}" STREQUAL "${CONTENT}")
+    file(WRITE "${OUTPUT}" "${CONTENT}")
+endif()
@@ -0,0 +1,233 @@
+/**
+ * @file main.cpp
+ * @brief Shader cache hashing and loading benchmark (console only)
+ *
+ * This example measures:
+ * - Byte-at-a-time FNV-1a against ShaderHash (XXH64) over shader sources
+ * - Stream-based file hashing against ShaderHash::hashFile (memory mapped)
+ * - ShaderCache::hotReload() when size/write-time stamps let it skip hashing,
+ *   and after every source has been touched so each one is rehashed
+ * - Loading cached SPIR-V through ShaderCache::loadShaders()
+ *
+ * Usage: vde_shader_cache_benchmark [shader_dir] [iterations]
+ *
+ * Without a directory, 64 synthetic 256 KiB shaders are generated in a
+ * temporary directory.  Cache entries are written directly, so no shader
+ * is actually compiled.
+ */
+
+#include <vde/ShaderCache.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// The previous ShaderHash implementation, kept here as the baseline
+uint64_t fnv1a(const std::string& content) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (char c : content) {
+        h ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
+        h *= 0x00000100000001B3ULL;
+    }
+    return h;
+}
+
+std::string readViaStream(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+bool isShaderSource(const fs::path& path) {
+    static const char* extensions[] = {".vert", ".frag", ".comp", ".geom", ".tesc", ".tese"};
+    for (const char* ext : extensions) {
+        if (path.extension() == ext) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::string> generateShaders(const fs::path& dir, size_t count, size_t bytes) {
+    fs::create_directories(dir);
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < count; ++i) {
+        std::string source = "#version 450\n";
+        size_t line = 0;
+        while (source.size() < bytes) {
+            source += "float f" + std::to_string(line) + " = " + std::to_string(line * i) +
+                      ".0; // padding to make a large shader\n";
+            line++;
+        }
+        fs::path path = dir / ("shader_" + std::to_string(i) + (i % 2 ? ".frag" : ".vert"));
+        std::ofstream(path, std::ios::binary) << source;
+        paths.push_back(path.generic_string());
+    }
+    return paths;
+}
+
+// Write one fake .spv per source plus a manifest, as if each had been compiled
+void seedCache(const std::string& cacheDir, const std::vector<std::string>& sources) {
+    fs::create_directories(cacheDir);
+    std::ofstream manifest(cacheDir + "/manifest.json");
+    manifest << "{\n  \"version\": 1,\n  \"entries\": [\n";
+    for (size_t i = 0; i < sources.size(); ++i) {
+        std::string content = readViaStream(sources[i]);
+        uint64_t hash = vde::ShaderHash::hash(content);
+        std::string spvFile = vde::ShaderHash::toHexString(hash) + ".spv";
+
+        // SPIR-V is typically a few times smaller than its source
+        std::vector<uint32_t> words(content.size() / 16 + 1, 0);
+        words[0] = 0x07230203;
+        std::ofstream spv(cacheDir + "/" + spvFile, std::ios::binary);
+        spv.write(reinterpret_cast<const char*>(words.data()),
+                  static_cast<std::streamsize>(words.size() * sizeof(uint32_t)));
+
+        auto mtime = fs::last_write_time(sources[i]).time_since_epoch().count();
+        manifest << (i ? ",\n" : "") << "    {\n"
+                 << "      \"sourcePath\": \"" << fs::path(sources[i]).generic_string()
+                 << "\",\n"
+                 << "      \"sourceHash\": \"" << vde::ShaderHash::toHexString(hash) << "\",\n"
+                 << "      \"sourceSize\": \"" << content.size() << "\",\n"
+                 << "      \"sourceMtime\": \"" << mtime << "\",\n"
+                 << "      \"spvFile\": \"" << spvFile << "\",\n"
+                 << "      \"stage\": \"vertex\"\n    }";
+    }
+    manifest << "\n  ]\n}\n";
+}
+
+void report(const char* name, double ms, int iterations, double megabytes) {
+    double perIteration = ms / iterations;
+    std::cout << "  " << std::left << std::setw(40) << name << std::right << std::fixed
+              << std::setprecision(3) << std::setw(10) << perIteration << " ms";
+    if (megabytes > 0.0) {
+        std::cout << std::setw(10) << std::setprecision(0) << megabytes / (perIteration / 1000.0)
+                  << " MB/s";
+    }
+    std::cout << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    fs::path workDir = fs::temp_directory_path() / "vde_shader_cache_benchmark";
+    fs::remove_all(workDir);
+    int iterations = argc > 2 ? std::max(1, std::stoi(argv[2])) : 10;
+
+    std::vector<std::string> sources;
+    if (argc > 1) {
+        for (const auto& file : fs::recursive_directory_iterator(argv[1])) {
+            if (file.is_regular_file() && isShaderSource(file.path())) {
+                sources.push_back(fs::path(file.path()).generic_string());
+            }
+        }
+    } else {
+        sources = generateShaders(workDir / "sources", 64, 256 * 1024);
+    }
+    if (sources.empty()) {
+        std::cerr << "No shader sources found" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> contents;
+    double totalMB = 0.0;
+    for (const auto& path : sources) {
+        contents.push_back(readViaStream(path));
+        totalMB += static_cast<double>(contents.back().size()) / (1024.0 * 1024.0);
+    }
+    std::cout << "Shader cache benchmark: " << sources.size() << " sources, " << std::fixed
+              << std::setprecision(1) << totalMB << " MB, " << iterations << " iterations"
+              << std::endl;
+
+    // Defeat dead-code elimination
+    uint64_t sink = 0;
+
+    std::cout << "Hashing in memory:" << std::endl;
+    auto start = Clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        for (const auto& content : contents) {
+            sink += fnv1a(content);
+        }
+    }
+    report("FNV-1a (byte at a time)", elapsedMs(start), iterations, totalMB);
+
+    start = Clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        for (const auto& content : contents) {
+            sink += vde::ShaderHash::hash(content);
+        }
+    }
+    report("ShaderHash::hash (XXH64)", elapsedMs(start), iterations, totalMB);
+
+    std::cout << "Hashing files:" << std::endl;
+    start = Clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        for (const auto& path : sources) {
+            sink += fnv1a(readViaStream(path));
+        }
+    }
+    report("ifstream + stringstream + FNV-1a", elapsedMs(start), iterations, totalMB);
+
+    start = Clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        for (const auto& path : sources) {
+            sink += vde::ShaderHash::hashFile(path);
+        }
+    }
+    report("ShaderHash::hashFile (mmap + XXH64)", elapsedMs(start), iterations, totalMB);
+
+    std::string cacheDir = (workDir / "cache").generic_string();
+    seedCache(cacheDir, sources);
+
+    std::cout << "ShaderCache:" << std::endl;
+    {
+        vde::ShaderCache cache(cacheDir);
+        cache.initialize();
+
+        start = Clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            sink += cache.hotReload().size();
+        }
+        report("hotReload (stamps unchanged)", elapsedMs(start), iterations, 0.0);
+
+        // Touch every source: stamps no longer match, so each is rehashed once
+        for (const auto& path : sources) {
+            fs::last_write_time(path, fs::last_write_time(path) + std::chrono::seconds(1));
+        }
+        start = Clock::now();
+        sink += cache.hotReload().size();
+        report("hotReload (all touched, rehashed)", elapsedMs(start), 1, totalMB);
+
+        start = Clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            for (const auto& spirv : cache.loadShaders(sources)) {
+                sink += spirv.size();
+            }
+        }
+        report("loadShaders (all hits, mmap .spv)", elapsedMs(start), iterations, 0.0);
+        std::cout << "  cache hits: " << cache.getCacheHits()
+                  << ", misses: " << cache.getCacheMisses() << std::endl;
+    }
+
+    std::cout << "(checksum " << std::hex << sink << std::dec << ")" << std::endl;
+    fs::remove_all(workDir);
+    return 0;
+}
@@ -147,10 +147,11 @@ class TriangleApp {
             // Bind index buffer
             vkCmdBindIndexBuffer(commandBuffer, m_indexBuffer, 0, VK_INDEX_TYPE_UINT16);
 
-            // Bind descriptor sets (UBO with matrices)
+            // Bind descriptor sets (UBO with matrices, at the current view's slot)
             VkDescriptorSet descriptorSet = m_context.getCurrentUBODescriptorSet();
+            uint32_t uboOffset = m_context.getCurrentUBOOffset();
             vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                    m_pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+                                    m_pipelineLayout, 0, 1, &descriptorSet, 1, &uboOffset);
 
             // Draw triangle
             vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(triangleIndices.size()), 1, 0, 0,
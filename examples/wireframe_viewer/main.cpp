@@ -8,8 +8,9 @@
  * - Mouse wheel zoom
  * - Click-and-drag to rotate the object (only when clicking on the object)
  *
- * The wireframe is built via Mesh::createWireframe() which generates thin
- * tube geometry so it renders through the standard mesh pipeline.
+ * The wireframe is drawn with MeshEntity::setWireframe(), which instances a
+ * single unit tube once per unique edge of the solid mesh instead of
+ * generating tube geometry.
  *
  * Press 'F' to fail the test, ESC to exit early.
  */
@@ -181,11 +182,6 @@ class WireframeViewerScene : public vde::examples::BaseExampleScene {
         m_cubeSolid = vde::Mesh::createCube(1.0f);
         m_sphereSolid = vde::Mesh::createSphere(0.5f, 32, 16);
 
-        // --- Create wireframe meshes from solids ---
-        m_pyramidWireframe = vde::Mesh::createWireframe(m_pyramidSolid, kWireframeThickness);
-        m_cubeWireframe = vde::Mesh::createWireframe(m_cubeSolid, kWireframeThickness);
-        m_sphereWireframe = vde::Mesh::createWireframe(m_sphereSolid, kWireframeThickness);
-
         // Pre-create materials
         m_solidMaterial =
             std::make_shared<vde::Material>(vde::Color::fromHex(0x4a90d9), 0.4f, 0.0f);
@@ -204,6 +200,8 @@ class WireframeViewerScene : public vde::examples::BaseExampleScene {
         m_wireframeEntity->setName("WireframeShape");
         m_wireframeEntity->setPosition(0.0f, 0.0f, 0.0f);
         m_wireframeEntity->setMaterial(m_wireframeBrightMaterial);
+        m_wireframeEntity->setWireframe(true);
+        m_wireframeEntity->setWireframeThickness(kWireframeThickness);
 
         // Show initial shape (pyramid in wireframe mode)
         switchShape(ShapeType::Pyramid);
@@ -287,11 +285,8 @@ class WireframeViewerScene : public vde::examples::BaseExampleScene {
   private:
     // Pre-built meshes
     std::shared_ptr<vde::Mesh> m_pyramidSolid;
-    std::shared_ptr<vde::Mesh> m_pyramidWireframe;
     std::shared_ptr<vde::Mesh> m_cubeSolid;
-    std::shared_ptr<vde::Mesh> m_cubeWireframe;
     std::shared_ptr<vde::Mesh> m_sphereSolid;
-    std::shared_ptr<vde::Mesh> m_sphereWireframe;
 
     // Materials
     std::shared_ptr<vde::Material> m_solidMaterial;
@@ -316,15 +311,15 @@ class WireframeViewerScene : public vde::examples::BaseExampleScene {
         switch (shape) {
         case ShapeType::Pyramid:
             m_solidEntity->setMesh(m_pyramidSolid);
-            m_wireframeEntity->setMesh(m_pyramidWireframe);
+            m_wireframeEntity->setMesh(m_pyramidSolid);
             break;
         case ShapeType::Cube:
             m_solidEntity->setMesh(m_cubeSolid);
-            m_wireframeEntity->setMesh(m_cubeWireframe);
+            m_wireframeEntity->setMesh(m_cubeSolid);
             break;
         case ShapeType::Sphere:
             m_solidEntity->setMesh(m_sphereSolid);
-            m_wireframeEntity->setMesh(m_sphereWireframe);
+            m_wireframeEntity->setMesh(m_sphereSolid);
             break;
         }
 
@@ -384,21 +379,18 @@ class WireframeViewerScene : public vde::examples::BaseExampleScene {
     }
 
     bool performHitTest(double mouseX, double mouseY) {
-        auto* cam = getCamera();
         auto* game = getGame();
-        if (!cam || !game || !game->getWindow())
+        if (!game || !game->getWindow())
             return false;
 
         float w = static_cast<float>(game->getWindow()->getWidth());
         float h = static_cast<float>(game->getWindow()->getHeight());
 
-        // Use camera's screenToWorldRay + the solid mesh's bounding radius
-        vde::Ray ray =
-            cam->screenToWorldRay(static_cast<float>(mouseX), static_cast<float>(mouseY), w, h);
-
-        auto solidMesh = m_solidEntity->getMesh();
-        float radius = solidMesh ? solidMesh->getBoundingRadius() : 0.5f;
-        return ray.hitsSphere(glm::vec3(0.0f), radius);
+        // Exact triangle pick against whichever representation is visible
+        vde::SceneRayHit hit;
+        if (!pick(static_cast<float>(mouseX), static_cast<float>(mouseY), w, h, hit))
+            return false;
+        return hit.entity == m_solidEntity.get() || hit.entity == m_wireframeEntity.get();
     }
 };
 
@@ -0,0 +1,166 @@
+#pragma once
+
+/**
+ * @file BindlessTextureTable.h
+ * @brief Descriptor-indexed texture array shared by all draws
+ *
+ * With VK_EXT_descriptor_indexing (core in Vulkan 1.2) every texture lives
+ * in one large update-after-bind sampler array.  A texture is written into
+ * the array once when it is uploaded and shaders select it through an
+ * index passed in push constants, so draws never allocate or switch
+ * per-texture descriptor sets.
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
+namespace vde {
+
+/**
+ * @brief Hands out array slots and recycles them once the GPU is done.
+ *
+ * A released slot may still be referenced by command buffers in flight,
+ * so it only becomes reusable after @c retireFrames calls to nextFrame().
+ * Pure CPU bookkeeping; owned by BindlessTextureTable.
+ */
+class BindlessSlotAllocator {
+  public:
+    static constexpr uint32_t INVALID_SLOT = std::numeric_limits<uint32_t>::max();
+
+    BindlessSlotAllocator() = default;
+    BindlessSlotAllocator(uint32_t capacity, uint32_t retireFrames) {
+        reset(capacity, retireFrames);
+    }
+
+    /**
+     * @brief Forget every slot and set a new capacity.
+     */
+    void reset(uint32_t capacity, uint32_t retireFrames);
+
+    /**
+     * @brief Take a free slot.
+     * @return Slot index, or INVALID_SLOT if the table is full
+     */
+    uint32_t allocate();
+
+    /**
+     * @brief Return a slot; it is reused after the retire delay.
+     * @return false (and nothing changes) if the slot is not allocated,
+     *         e.g. when it was already released
+     */
+    bool release(uint32_t slot);
+
+    /**
+     * @brief Advance the frame counter, making retired slots reusable.
+     */
+    void nextFrame();
+
+    uint32_t getCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Number of slots currently allocated (excludes retiring slots).
+     */
+    uint32_t getUsedCount() const { return m_used; }
+
+    /**
+     * @brief Highest slot index ever handed out plus one.
+     */
+    uint32_t getHighWaterMark() const { return m_next; }
+
+  private:
+    struct Retired {
+        uint32_t slot;
+        uint64_t frame;
+    };
+
+    uint32_t m_capacity = 0;
+    uint32_t m_retireFrames = 0;
+    uint32_t m_next = 0;  ///< Slots [m_next, capacity) have never been used
+    uint32_t m_used = 0;
+    uint64_t m_frame = 0;
+    std::vector<bool> m_allocated;  ///< Per slot below m_next: handed out and not released
+    std::vector<uint32_t> m_free;
+    std::deque<Retired> m_retired;
+};
+
+/**
+ * @brief One update-after-bind descriptor set holding every texture.
+ *
+ * Layout: binding 0 is a partially bound array of combined image samplers
+ * visible to the fragment stage.  Shaders declare it as
+ * @code
+ * #extension GL_EXT_nonuniform_qualifier : require
+ * layout(set = N, binding = 0) uniform sampler2D textures[];
+ * ... texture(textures[nonuniformEXT(index)], uv)
+ * @endcode
+ *
+ * Only initialized when the device supports descriptor indexing (see
+ * VulkanContext::isDescriptorIndexingSupported()); otherwise callers keep
+ * using per-texture descriptor sets.
+ */
+class BindlessTextureTable {
+  public:
+    static constexpr uint32_t INVALID_INDEX = BindlessSlotAllocator::INVALID_SLOT;
+    static constexpr uint32_t DEFAULT_CAPACITY = 4096;
+    static constexpr uint32_t TEXTURE_BINDING = 0;
+
+    BindlessTextureTable() = default;
+    ~BindlessTextureTable();
+
+    BindlessTextureTable(const BindlessTextureTable&) = delete;
+    BindlessTextureTable& operator=(const BindlessTextureTable&) = delete;
+
+    /**
+     * @brief Create the layout, pool and the single descriptor set.
+     * @param device Logical device created with descriptor indexing enabled
+     * @param capacity Array size (clamp to the device's update-after-bind limits)
+     * @param framesInFlight Frames a released slot must wait before reuse
+     */
+    void init(VkDevice device, uint32_t capacity, uint32_t framesInFlight);
+
+    /**
+     * @brief Destroy the descriptor objects.
+     */
+    void cleanup();
+
+    bool isInitialized() const { return m_descriptorSet != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Write a texture into a free slot.
+     * @return Slot index for shaders, or INVALID_INDEX if the table is full
+     */
+    uint32_t add(VkImageView imageView, VkSampler sampler);
+
+    /**
+     * @brief Overwrite an existing slot (e.g. after a texture reload).
+     */
+    void update(uint32_t index, VkImageView imageView, VkSampler sampler);
+
+    /**
+     * @brief Release a slot.  Safe to call after cleanup().
+     */
+    void remove(uint32_t index);
+
+    /**
+     * @brief Advance slot recycling; call once per submitted frame.
+     */
+    void nextFrame() { m_slots.nextFrame(); }
+
+    VkDescriptorSetLayout getLayout() const { return m_layout; }
+    VkDescriptorSet getDescriptorSet() const { return m_descriptorSet; }
+    uint32_t getCapacity() const { return m_slots.getCapacity(); }
+    uint32_t getTextureCount() const { return m_slots.getUsedCount(); }
+
+  private:
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkDescriptorSetLayout m_layout = VK_NULL_HANDLE;
+    VkDescriptorPool m_pool = VK_NULL_HANDLE;
+    VkDescriptorSet m_descriptorSet = VK_NULL_HANDLE;
+    BindlessSlotAllocator m_slots;
+};
+
+}  // namespace vde
@@ -13,6 +13,9 @@
 #include <cstdint>
 #include <stdexcept>
 
+#include "GpuAllocator.h"
+#include "UploadManager.h"
+
 namespace vde {
 
 /**
@@ -24,6 +27,10 @@ namespace vde {
  * - Device-local buffer creation with staging
  * - Persistently mapped buffer creation
  * - Buffer-to-buffer copy
+ *
+ * Overloads taking a GpuAllocation sub-allocate from the shared
+ * GpuAllocator instead of creating one VkDeviceMemory per buffer, and
+ * upload through the shared UploadManager when it is initialized.
  */
 class BufferUtils {
   public:
@@ -35,9 +42,10 @@ class BufferUtils {
      * @param physicalDevice Physical device handle
      * @param commandPool Command pool for transfer operations
      * @param graphicsQueue Queue for submitting transfer commands
+     * @param memoryBudgetSupported Whether VK_EXT_memory_budget is enabled on the device
      */
     static void init(VkDevice device, VkPhysicalDevice physicalDevice, VkCommandPool commandPool,
-                     VkQueue graphicsQueue);
+                     VkQueue graphicsQueue, bool memoryBudgetSupported = false);
 
     /**
      * @brief Check if BufferUtils has been initialized.
@@ -47,9 +55,26 @@ class BufferUtils {
 
     /**
      * @brief Reset BufferUtils state (for cleanup/testing).
+     *
+     * Also shuts down the shared UploadManager and GpuAllocator, releasing
+     * all of their resources.
      */
     static void reset();
 
+    /**
+     * @brief Get the shared device memory allocator.
+     *
+     * Initialized by init() and shut down by reset().
+     */
+    static GpuAllocator& getAllocator() { return s_allocator; }
+
+    /**
+     * @brief Get the shared asynchronous upload manager.
+     *
+     * Initialized by VulkanContext after init(); shut down by reset().
+     */
+    static UploadManager& getUploadManager() { return s_uploads; }
+
     /**
      * @brief Find a memory type that satisfies the given requirements.
      *
@@ -74,6 +99,30 @@ class BufferUtils {
                              VkMemoryPropertyFlags properties, VkBuffer& buffer,
                              VkDeviceMemory& bufferMemory);
 
+    /**
+     * @brief Create a buffer backed by a GpuAllocator sub-allocation.
+     *
+     * If the UploadManager transfers on a dedicated queue family, the buffer
+     * is created with concurrent sharing so both families can access it.
+     *
+     * @param size Size of the buffer in bytes
+     * @param usage Buffer usage flags (VK_BUFFER_USAGE_*)
+     * @param properties Memory property flags (VK_MEMORY_PROPERTY_*)
+     * @param buffer Output buffer handle
+     * @param allocation Output allocation (host-visible memory is already mapped)
+     * @throws std::runtime_error on failure
+     */
+    static void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
+                             VkMemoryPropertyFlags properties, VkBuffer& buffer,
+                             GpuAllocation& allocation);
+
+    /**
+     * @brief Destroy a buffer and return its allocation to the GpuAllocator.
+     *
+     * Safe to call with null handles / invalid allocations.
+     */
+    static void destroyBuffer(VkBuffer& buffer, GpuAllocation& allocation);
+
     /**
      * @brief Copy data between buffers using a one-time command buffer.
      *
@@ -121,6 +170,25 @@ class BufferUtils {
                                         VkBufferUsageFlags usage, VkBuffer& buffer,
                                         VkDeviceMemory& bufferMemory);
 
+    /**
+     * @brief Create a sub-allocated device-local buffer and upload data via staging.
+     *
+     * When the UploadManager is initialized the copy is queued
+     * asynchronously and the returned handle tracks it; otherwise the copy
+     * completes before returning and the handle is empty.
+     *
+     * @param data Pointer to data to upload
+     * @param size Size of data in bytes
+     * @param usage Buffer usage flags (TRANSFER_DST is added automatically)
+     * @param buffer Output buffer handle
+     * @param allocation Output allocation
+     * @return Handle of the pending upload
+     * @throws std::runtime_error on failure
+     */
+    static UploadHandle createDeviceLocalBuffer(const void* data, VkDeviceSize size,
+                                                VkBufferUsageFlags usage, VkBuffer& buffer,
+                                                GpuAllocation& allocation);
+
     /**
      * @brief Create a host-visible buffer with persistent mapping.
      *
@@ -148,6 +216,8 @@ class BufferUtils {
     static VkPhysicalDevice s_physicalDevice;
     static VkCommandPool s_commandPool;
     static VkQueue s_graphicsQueue;
+    static GpuAllocator s_allocator;
+    static UploadManager s_uploads;
 };
 
 }  // namespace vde
@@ -11,6 +11,8 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <cstdint>
+
 namespace vde {
 
 /**
@@ -192,6 +194,16 @@ class Camera {
                                              float aspectRatio = 16.0f / 9.0f,
                                              float padding = 1.1f);
 
+    /**
+     * @brief Change counter for the view and projection.
+     *
+     * Bumped by every setter that actually changes a value (setting the
+     * same value again keeps the version), so uploads of the matrices can
+     * be skipped while it is unchanged.  Versions come from one counter
+     * shared by all cameras and are never 0.
+     */
+    uint64_t getVersion() const { return m_version; }
+
   private:
     glm::vec3 m_position;
     glm::vec3 m_target;
@@ -215,6 +227,8 @@ class Camera {
     float m_orthoBottom = -1.0f;
     float m_orthoTop = 1.0f;
 
+    uint64_t m_version;
+
     /**
      * @brief Update position from orbital parameters.
      */
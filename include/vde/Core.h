@@ -37,11 +37,18 @@
 #include <vde/Types.h>
 
 // Buffer management
+#include <vde/BindlessTextureTable.h>
 #include <vde/BufferUtils.h>
 #include <vde/DescriptorManager.h>
+#include <vde/GpuAllocator.h>
 #include <vde/UniformBuffer.h>
+#include <vde/UploadManager.h>
 
 // Shader system
+#include <vde/MappedFile.h>
+#include <vde/PipelineCache.h>
+#include <vde/PipelineDiskCache.h>
+#include <vde/ShaderBundle.h>
 #include <vde/ShaderCache.h>
 #include <vde/ShaderCompiler.h>
 #include <vde/ShaderStage.h>
@@ -49,6 +56,11 @@
 // Geometry
 #include <vde/HexGeometry.h>
 #include <vde/HexPrismMesh.h>
+#include <vde/MeshCache.h>
+#include <vde/MeshOptimizer.h>
+#include <vde/MeshSimplifier.h>
+#include <vde/ObjLoader.h>
+#include <vde/VertexQuantization.h>
 
 // Vulkan helpers
 #include <vde/QueueFamilyIndices.h>
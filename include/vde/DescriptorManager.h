@@ -5,6 +5,8 @@
  * @brief Vulkan descriptor set layouts, pools, and sets management
  */
 
+#include <vde/FrameContext.h>
+
 #include <vulkan/vulkan.h>
 
 #include <vector>
@@ -24,8 +26,7 @@ namespace vde {
 class DescriptorManager {
   public:
     // Configuration constants
-    static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 2;
-    static constexpr uint32_t MAX_TEXTURES = 16;
+    static constexpr uint32_t MAX_TEXTURES = 16;  ///< Per-texture sets; see BindlessTextureTable
 
     DescriptorManager() = default;
     ~DescriptorManager();
@@ -41,8 +42,11 @@ class DescriptorManager {
     /**
      * @brief Initialize descriptor set layouts.
      * @param device Vulkan logical device handle.
+     * @param framesInFlight Number of per-frame UBO sets the pool must hold.
      */
-    void init(VkDevice device);
+    void init(VkDevice device, uint32_t framesInFlight = DEFAULT_FRAMES_IN_FLIGHT);
+
+    uint32_t getFramesInFlight() const { return m_framesInFlight; }
 
     /**
      * @brief Clean up all descriptor resources.
@@ -62,6 +66,10 @@ class DescriptorManager {
 
     /**
      * @brief Get the uniform buffer descriptor set layout (Set 0).
+     *
+     * Binding 0 is a dynamic uniform buffer: one set per frame covers every
+     * view's camera slot, selected by the dynamic offset at bind time.
+     *
      * @return VkDescriptorSetLayout for camera/MVP matrices.
      */
     VkDescriptorSetLayout getUniformBufferLayout() const { return m_uboLayout; }
@@ -104,7 +112,7 @@ class DescriptorManager {
      * @brief Update a UBO descriptor set with buffer information.
      * @param descriptorSet The descriptor set to update
      * @param buffer The uniform buffer handle
-     * @param bufferSize Size of the buffer data
+     * @param bufferSize Size of one view's data (the range seen at each dynamic offset)
      */
     void updateUBODescriptor(VkDescriptorSet descriptorSet, VkBuffer buffer,
                              VkDeviceSize bufferSize);
@@ -120,6 +128,7 @@ class DescriptorManager {
 
   private:
     VkDevice m_device = VK_NULL_HANDLE;
+    uint32_t m_framesInFlight = DEFAULT_FRAMES_IN_FLIGHT;
 
     // Descriptor set layouts
     VkDescriptorSetLayout m_uboLayout = VK_NULL_HANDLE;      // Set 0: Uniform buffers
@@ -0,0 +1,226 @@
+#pragma once
+
+/**
+ * @file FrameAllocator.h
+ * @brief Per-frame linear allocator for transient GPU data
+ *
+ * Data that lives for one frame (per-draw uniforms, per-view constants,
+ * small storage arrays) is bump-allocated from a persistently mapped
+ * buffer owned by the frame in flight.  Nothing is freed individually:
+ * the whole buffer is recycled once the frame's fence has signalled.
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "GpuAllocator.h"
+
+namespace vde {
+
+/**
+ * @brief Bump allocator over a fixed-size region.
+ *
+ * Manages offsets only (no Vulkan objects), so it can be used and tested
+ * without a GPU.  Requests that do not fit fail but still count towards
+ * the high-water mark, which therefore reports the capacity a frame
+ * actually needed.
+ */
+class LinearAllocator {
+  public:
+    static constexpr uint64_t INVALID_OFFSET = UINT64_MAX;
+
+    /**
+     * @brief Create an allocator over [0, capacity).
+     */
+    explicit LinearAllocator(uint64_t capacity = 0) : m_capacity(capacity) {}
+
+    /**
+     * @brief Allocate a range.
+     * @param size Size in bytes
+     * @param alignment Required alignment (power of two; 0 means 1)
+     * @return Offset of the range, or INVALID_OFFSET if it does not fit
+     */
+    uint64_t allocate(uint64_t size, uint64_t alignment);
+
+    /**
+     * @brief Release every range at once.
+     */
+    void reset();
+
+    uint64_t getCapacity() const { return m_capacity; }
+    uint64_t getUsedBytes() const { return m_used; }
+
+    /**
+     * @brief Bytes requested since the last reset, including failed requests.
+     */
+    uint64_t getRequestedBytes() const { return m_requested; }
+
+    /**
+     * @brief Largest getRequestedBytes() seen in any reset period.
+     */
+    uint64_t getHighWaterMark() const { return m_highWaterMark; }
+
+    /**
+     * @brief Failed allocations since the last reset.
+     */
+    uint32_t getFailedCount() const { return m_failed; }
+
+  private:
+    uint64_t m_capacity = 0;
+    uint64_t m_used = 0;
+    uint64_t m_requested = 0;
+    uint64_t m_highWaterMark = 0;
+    uint32_t m_failed = 0;
+};
+
+/**
+ * @brief A range of transient data returned by FrameAllocator.
+ */
+struct FrameAllocation {
+    VkBuffer buffer = VK_NULL_HANDLE;  ///< The current frame's buffer
+    uint32_t offset = 0;               ///< Byte offset; the dynamic offset when bound
+    VkDeviceSize size = 0;
+    void* mapped = nullptr;  ///< Host pointer to the range (coherent, no flush needed)
+
+    bool isValid() const { return mapped != nullptr; }
+};
+
+/**
+ * @brief Persistently mapped linear allocator per frame in flight.
+ *
+ * Each frame in flight owns one host-visible buffer usable as a uniform
+ * or storage buffer.  Allocations are aligned to the device's offset
+ * alignment for their use, so the returned offset can be passed straight
+ * to vkCmdBindDescriptorSets as a dynamic offset into a
+ * *_BUFFER_DYNAMIC binding of that buffer.
+ *
+ * VulkanContext calls beginFrame() right after the frame's fence has
+ * signalled, which recycles everything allocated for that frame slot.
+ *
+ * @code
+ * FrameAllocation slot = context->getFrameAllocator().allocateUniform(sizeof(MyData));
+ * if (slot.isValid()) {
+ *     memcpy(slot.mapped, &data, sizeof(MyData));
+ *     // bind slot.buffer's descriptor set with slot.offset
+ * }
+ * @endcode
+ */
+class FrameAllocator {
+  public:
+    /// Default buffer size per frame in flight
+    static constexpr VkDeviceSize DEFAULT_CAPACITY = 4 * 1024 * 1024;
+
+    FrameAllocator() = default;
+    ~FrameAllocator();
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    /**
+     * @brief Create one buffer per frame in flight.
+     * @param frameCount Number of frames in flight
+     * @param capacity Bytes per frame
+     * @param uniformAlignment minUniformBufferOffsetAlignment
+     * @param storageAlignment minStorageBufferOffsetAlignment
+     * @throws std::runtime_error if a buffer cannot be created or mapped
+     */
+    void create(uint32_t frameCount, VkDeviceSize capacity, VkDeviceSize uniformAlignment,
+                VkDeviceSize storageAlignment);
+
+    /**
+     * @brief Destroy the buffers.  The GPU must be done with them.
+     */
+    void destroy();
+
+    bool isCreated() const { return !m_frames.empty(); }
+
+    /**
+     * @brief Make a frame slot current and recycle its memory.
+     *
+     * Only call once the GPU has finished the frame that last used @p frame.
+     */
+    void beginFrame(uint32_t frame);
+
+    /**
+     * @brief Allocate from the current frame's buffer.
+     * @param size Size in bytes
+     * @param alignment Required alignment (power of two)
+     * @return The range, or an invalid allocation if the frame is out of space
+     */
+    FrameAllocation allocate(VkDeviceSize size, VkDeviceSize alignment);
+
+    /**
+     * @brief Allocate a range that can be bound as a dynamic uniform buffer.
+     */
+    FrameAllocation allocateUniform(VkDeviceSize size) {
+        return allocate(size, m_uniformAlignment);
+    }
+
+    /**
+     * @brief Allocate a range that can be bound as a dynamic storage buffer.
+     */
+    FrameAllocation allocateStorage(VkDeviceSize size) {
+        return allocate(size, m_storageAlignment);
+    }
+
+    /**
+     * @brief Allocate a uniform range and copy @p data into it.
+     */
+    template <typename T>
+    FrameAllocation pushUniform(const T& data) {
+        FrameAllocation allocation = allocateUniform(sizeof(T));
+        if (allocation.isValid()) {
+            std::memcpy(allocation.mapped, &data, sizeof(T));
+        }
+        return allocation;
+    }
+
+    /**
+     * @brief Get a frame slot's buffer (for writing descriptor sets).
+     */
+    VkBuffer getBuffer(uint32_t frame) const {
+        return frame < m_frames.size() ? m_frames[frame].buffer : VK_NULL_HANDLE;
+    }
+
+    uint32_t getCurrentFrame() const { return m_currentFrame; }
+    uint32_t getFrameCount() const { return static_cast<uint32_t>(m_frames.size()); }
+    VkDeviceSize getCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Bytes allocated so far in the current frame.
+     */
+    VkDeviceSize getUsedBytes() const;
+
+    /**
+     * @brief Most bytes any frame has requested (size the capacity from this).
+     */
+    VkDeviceSize getHighWaterMark() const;
+
+    /**
+     * @brief High-water mark of a single frame slot.
+     */
+    VkDeviceSize getHighWaterMark(uint32_t frame) const;
+
+    /**
+     * @brief Allocations that did not fit in the current frame.
+     */
+    uint32_t getFailedCount() const;
+
+  private:
+    struct Frame {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        GpuAllocation allocation;
+        LinearAllocator ranges;
+    };
+
+    std::vector<Frame> m_frames;
+    uint32_t m_currentFrame = 0;
+    VkDeviceSize m_capacity = 0;
+    VkDeviceSize m_uniformAlignment = 256;
+    VkDeviceSize m_storageAlignment = 256;
+};
+
+}  // namespace vde
@@ -0,0 +1,168 @@
+#pragma once
+
+/**
+ * @file FrameContext.h
+ * @brief Per-frame-in-flight resources and timeline-semaphore frame pacing
+ *
+ * Every resource the CPU writes while the GPU may still be reading an
+ * earlier frame is replicated once per frame in flight.  FrameContext
+ * groups those copies for one frame slot, and FramePacer decides which
+ * slot the CPU records into next and which GPU progress it must wait for.
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace vde {
+
+/// Fewest frames in flight (the CPU records one frame while the GPU renders another)
+inline constexpr uint32_t MIN_FRAMES_IN_FLIGHT = 2;
+
+/// Most frames in flight; per-frame arrays sized at compile time use this
+inline constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 3;
+
+/// Frames in flight unless configured otherwise (favours latency)
+inline constexpr uint32_t DEFAULT_FRAMES_IN_FLIGHT = 2;
+
+/**
+ * @brief A command pool and the secondary command buffer allocated from it.
+ *
+ * Each recording task gets its own pool so no pool is ever used from two
+ * threads at once.
+ */
+struct SecondaryCommandSlot {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer buffer = VK_NULL_HANDLE;
+};
+
+/**
+ * @brief Resources owned by one frame in flight.
+ *
+ * Everything here may only be rewritten once the GPU has finished the
+ * previous frame recorded into the same slot (see
+ * VulkanContext::waitForCurrentFrame()).
+ */
+struct FrameContext {
+    uint32_t index = 0;  ///< Slot index (0 .. frames in flight - 1)
+
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;  ///< Primary command buffer
+    std::vector<SecondaryCommandSlot> secondarySlots;
+
+    /// Signalled by vkAcquireNextImageKHR for this slot's image
+    VkSemaphore imageAvailable = VK_NULL_HANDLE;
+
+    /// Signalled by this slot's submission; only used without timeline semaphores
+    VkFence inFlightFence = VK_NULL_HANDLE;
+
+    VkBuffer uniformBuffer = VK_NULL_HANDLE;  ///< Camera UBO (MAX_VIEWS slots)
+    VkDescriptorSet uboDescriptorSet = VK_NULL_HANDLE;
+
+    /// Camera version last written to each UBO slot (0: unknown, always rewrite)
+    std::vector<uint64_t> cameraVersions;
+
+    /**
+     * @brief Descriptor sets that reference this frame's buffers.
+     *
+     * Keyed by the other resource they bind (e.g. a texture), or nullptr
+     * for a set that binds only this frame's buffers.  The sets belong to
+     * the pool they were allocated from; clearing the cache frees nothing.
+     */
+    std::unordered_map<const void*, VkDescriptorSet> descriptorCache;
+};
+
+/**
+ * @brief Bytes written to GPU-visible buffers for one frame, and the writes
+ * skipped because the source had not changed.
+ *
+ * Reset when the frame slot is reused (VulkanContext::waitForCurrentFrame()).
+ */
+struct FrameUploadStats {
+    uint64_t cameraBytes = 0;           ///< Camera UBO bytes written
+    uint32_t cameraSlotsWritten = 0;    ///< View slots rewritten
+    uint32_t cameraSlotsSkipped = 0;    ///< View slots still holding the same camera
+    uint64_t lightingBytes = 0;         ///< Lighting UBO, light and cluster bytes written
+    uint32_t lightingRebuilds = 0;      ///< Views whose lights were repacked or rebinned
+    uint32_t lightingReuses = 0;        ///< Views that reused the previous packing and clusters
+    uint32_t lightingSlotsWritten = 0;  ///< View regions rewritten (some data was stale)
+    uint32_t lightingSlotsSkipped = 0;  ///< View regions still holding the same lighting
+    uint64_t drawBytes = 0;             ///< Per-draw DrawUBO bytes pushed (Game::pushDrawData())
+    uint32_t drawsDropped = 0;          ///< Draws skipped because the frame allocator was full
+
+    uint64_t getTotalBytes() const { return cameraBytes + lightingBytes + drawBytes; }
+
+    void reset() { *this = FrameUploadStats{}; }
+};
+
+/**
+ * @brief Frame slot rotation and GPU progress tracking.
+ *
+ * Every graphics submission signals the next value of one timeline
+ * (1, 2, 3, ...).  Before the CPU reuses a slot it waits until the
+ * timeline reaches the value that slot's previous submission signalled,
+ * which lets it run at most getFramesInFlight() frames ahead.  Swapchain
+ * images are tracked the same way.
+ *
+ * Manages values only (no Vulkan objects), so it can be tested without a
+ * GPU; VulkanContext maps the values onto a timeline semaphore, or onto
+ * per-slot fences when timeline semaphores are unavailable.
+ */
+class FramePacer {
+  public:
+    explicit FramePacer(uint32_t framesInFlight = DEFAULT_FRAMES_IN_FLIGHT) {
+        reset(framesInFlight);
+    }
+
+    /**
+     * @brief Clamp a requested frame count to [MIN, MAX]_FRAMES_IN_FLIGHT.
+     */
+    static uint32_t clampFrameCount(uint32_t framesInFlight);
+
+    /**
+     * @brief Start over with no submissions and a (clamped) frame count.
+     */
+    void reset(uint32_t framesInFlight);
+
+    uint32_t getFramesInFlight() const { return m_framesInFlight; }
+    uint32_t getCurrentSlot() const { return m_currentSlot; }
+
+    /**
+     * @brief Timeline value to wait for before reusing the current slot.
+     * @return 0 if the slot has never been submitted
+     */
+    uint64_t getWaitValue() const { return m_slotValues[m_currentSlot]; }
+
+    /**
+     * @brief Timeline value signalled by the last submission that used a slot.
+     */
+    uint64_t getSlotValue(uint32_t slot) const {
+        return slot < m_framesInFlight ? m_slotValues[slot] : 0;
+    }
+
+    /**
+     * @brief Reserve the timeline value for the current slot's submission.
+     * @return The value the submission must signal
+     */
+    uint64_t submit();
+
+    /**
+     * @brief Move on to the next slot after presenting.
+     */
+    void advance() { m_currentSlot = (m_currentSlot + 1) % m_framesInFlight; }
+
+    /**
+     * @brief Highest value handed out by submit().
+     */
+    uint64_t getSubmittedValue() const { return m_submittedValue; }
+
+  private:
+    uint32_t m_framesInFlight = DEFAULT_FRAMES_IN_FLIGHT;
+    uint32_t m_currentSlot = 0;
+    uint64_t m_submittedValue = 0;
+    std::array<uint64_t, MAX_FRAMES_IN_FLIGHT> m_slotValues{};
+};
+
+}  // namespace vde
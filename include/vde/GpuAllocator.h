@@ -0,0 +1,304 @@
+#pragma once
+
+/**
+ * @file GpuAllocator.h
+ * @brief Block-based device memory sub-allocator
+ *
+ * Instead of calling vkAllocateMemory for every buffer and image, the
+ * allocator reserves large blocks per memory type and hands out aligned
+ * sub-ranges using a TLSF (two-level segregated fit) free list.  This
+ * keeps the number of live VkDeviceMemory objects far below
+ * maxMemoryAllocationCount and makes most allocations O(1).
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vde {
+
+/**
+ * @brief TLSF range allocator over a fixed-size region.
+ *
+ * Manages offsets only (no Vulkan objects), so it can be used and tested
+ * without a GPU.  Offsets and sizes are multiples of MIN_ALIGNMENT;
+ * larger power-of-two alignments are honoured by splitting off padding.
+ * Adjacent free ranges are always merged.
+ */
+class TlsfAllocator {
+  public:
+    static constexpr uint64_t MIN_ALIGNMENT = 16;
+    static constexpr uint32_t INVALID_HANDLE = UINT32_MAX;
+
+    /**
+     * @brief Create an allocator over [0, capacity).
+     * @param capacity Size of the managed region in bytes
+     */
+    explicit TlsfAllocator(uint64_t capacity);
+
+    /**
+     * @brief Allocate a range.
+     *
+     * @param size Requested size in bytes (rounded up to MIN_ALIGNMENT)
+     * @param alignment Required alignment (power of two)
+     * @param outOffset Receives the offset of the range
+     * @return Handle for free(), or INVALID_HANDLE if no range fits
+     */
+    uint32_t allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset);
+
+    /**
+     * @brief Release a range previously returned by allocate().
+     */
+    void free(uint32_t handle);
+
+    /**
+     * @brief Size of the range behind @p handle (after rounding).
+     */
+    uint64_t getAllocationSize(uint32_t handle) const;
+
+    uint64_t getCapacity() const { return m_capacity; }
+    uint64_t getUsedBytes() const { return m_usedBytes; }
+    uint64_t getFreeBytes() const { return m_capacity - m_usedBytes; }
+    uint32_t getAllocationCount() const { return m_allocationCount; }
+    bool isEmpty() const { return m_allocationCount == 0; }
+
+    /**
+     * @brief Number of distinct free ranges.
+     */
+    uint32_t getFreeRegionCount() const;
+
+    /**
+     * @brief Size of the largest free range.
+     */
+    uint64_t getLargestFreeRegion() const;
+
+  private:
+    static constexpr uint32_t SL_INDEX_COUNT_LOG2 = 4;
+    static constexpr uint32_t SL_INDEX_COUNT = 1u << SL_INDEX_COUNT_LOG2;
+    static constexpr uint32_t FL_INDEX_SHIFT = SL_INDEX_COUNT_LOG2 + 4;  // log2(MIN_ALIGNMENT)
+    static constexpr uint32_t FL_INDEX_COUNT = 64 - FL_INDEX_SHIFT + 1;
+    static constexpr uint64_t SMALL_BLOCK_SIZE = 1ull << FL_INDEX_SHIFT;
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    struct Node {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint32_t prevPhysical = NIL;
+        uint32_t nextPhysical = NIL;
+        uint32_t prevFree = NIL;
+        uint32_t nextFree = NIL;
+        bool free = false;
+    };
+
+    static void mapping(uint64_t size, uint32_t& fl, uint32_t& sl);
+    static void mappingSearch(uint64_t size, uint32_t& fl, uint32_t& sl);
+
+    uint32_t createNode();
+    void releaseNode(uint32_t index);
+    void insertFree(uint32_t index);
+    void removeFree(uint32_t index);
+    uint32_t findFree(uint64_t size);
+    uint32_t splitFront(uint32_t index, uint64_t frontSize);
+
+    uint64_t m_capacity = 0;
+    uint64_t m_usedBytes = 0;
+    uint32_t m_allocationCount = 0;
+
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_unusedNodes;
+
+    uint64_t m_flBitmap = 0;
+    std::array<uint32_t, FL_INDEX_COUNT> m_slBitmap{};
+    std::array<std::array<uint32_t, SL_INDEX_COUNT>, FL_INDEX_COUNT> m_freeHeads{};
+};
+
+/**
+ * @brief A sub-allocated (or dedicated) range of device memory.
+ *
+ * Bind resources with @c memory at @c offset.  For host-visible memory
+ * @c mapped points at the start of the range (blocks stay mapped).
+ */
+struct GpuAllocation {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void* mapped = nullptr;
+    uint32_t memoryTypeIndex = 0;
+    uint32_t blockIndex = UINT32_MAX;  ///< UINT32_MAX for dedicated allocations
+    uint32_t handle = TlsfAllocator::INVALID_HANDLE;
+    uint32_t generation = 0;
+
+    bool isValid() const { return memory != VK_NULL_HANDLE; }
+    bool isDedicated() const { return blockIndex == UINT32_MAX; }
+};
+
+/**
+ * @brief Allocator-wide usage and fragmentation statistics.
+ */
+struct GpuMemoryStats {
+    uint32_t blockCount = 0;                ///< Live pooled blocks
+    uint32_t dedicatedAllocationCount = 0;  ///< Resources with their own VkDeviceMemory
+    uint32_t allocationCount = 0;           ///< Live sub-allocations + dedicated allocations
+    uint32_t deviceMemoryObjects = 0;       ///< Live vkAllocateMemory results
+    VkDeviceSize reservedBytes = 0;         ///< Bytes obtained from the driver
+    VkDeviceSize usedBytes = 0;             ///< Bytes handed out to resources
+    uint32_t freeRegionCount = 0;           ///< Free ranges across all blocks
+    VkDeviceSize largestFreeRegion = 0;     ///< Largest free range in any block
+
+    /**
+     * @brief Fraction of free pooled memory not in the largest free range.
+     *
+     * 0 means all free space is contiguous; values near 1 indicate that a
+     * defragmentation pass would help large allocations.
+     */
+    float getFragmentation() const {
+        VkDeviceSize freeBytes = reservedBytes - usedBytes;
+        if (freeBytes == 0 || blockCount == 0) {
+            return 0.0f;
+        }
+        return 1.0f - static_cast<float>(largestFreeRegion) / static_cast<float>(freeBytes);
+    }
+};
+
+/**
+ * @brief Memory budget for one heap.
+ */
+struct GpuHeapBudget {
+    uint32_t heapIndex = 0;
+    VkDeviceSize heapSize = 0;
+    VkDeviceSize budget = 0;     ///< Bytes the process may use (driver estimate or 80% of heap)
+    VkDeviceSize usage = 0;      ///< Bytes in use (driver-reported, or allocator-reserved)
+    VkDeviceSize allocator = 0;  ///< Bytes reserved by this allocator on the heap
+};
+
+/**
+ * @brief Device memory allocator with per-memory-type block pools.
+ *
+ * Buffers and optimally tiled images are kept in separate pools so that
+ * bufferImageGranularity never has to be considered.  Requests larger
+ * than half a block get a dedicated VkDeviceMemory.  Empty blocks are
+ * released except for one spare per pool.  All methods are thread-safe.
+ */
+class GpuAllocator {
+  public:
+    static constexpr VkDeviceSize DEFAULT_BLOCK_SIZE = 64ull * 1024 * 1024;
+
+    GpuAllocator() = default;
+    ~GpuAllocator();
+
+    GpuAllocator(const GpuAllocator&) = delete;
+    GpuAllocator& operator=(const GpuAllocator&) = delete;
+
+    /**
+     * @brief Initialize for a device.
+     *
+     * @param device Logical device handle
+     * @param physicalDevice Physical device handle
+     * @param memoryBudgetSupported Whether VK_EXT_memory_budget is enabled
+     * @param preferredBlockSize Block size for large heaps (small heaps use heapSize / 8)
+     */
+    void init(VkDevice device, VkPhysicalDevice physicalDevice,
+              bool memoryBudgetSupported = false,
+              VkDeviceSize preferredBlockSize = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief Free every block and forget the device.
+     *
+     * Allocations still held by resources become stale and are ignored
+     * by a later free().
+     */
+    void shutdown();
+
+    bool isInitialized() const { return m_device != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Allocate memory for the given requirements.
+     *
+     * @param requirements Size, alignment and allowed memory types
+     * @param properties Required memory property flags
+     * @param linear true for buffers / linear images, false for optimal images
+     * @return The allocation
+     * @throws std::runtime_error if no suitable memory type exists or allocation fails
+     */
+    GpuAllocation allocate(const VkMemoryRequirements& requirements,
+                           VkMemoryPropertyFlags properties, bool linear = true);
+
+    /**
+     * @brief Allocate and bind memory for a buffer.
+     * @throws std::runtime_error on failure
+     */
+    GpuAllocation allocateForBuffer(VkBuffer buffer, VkMemoryPropertyFlags properties);
+
+    /**
+     * @brief Allocate and bind memory for an image.
+     * @throws std::runtime_error on failure
+     */
+    GpuAllocation allocateForImage(VkImage image, VkMemoryPropertyFlags properties,
+                                   VkImageTiling tiling = VK_IMAGE_TILING_OPTIMAL);
+
+    /**
+     * @brief Return an allocation to its pool and reset it.
+     */
+    void free(GpuAllocation& allocation);
+
+    /**
+     * @brief Get usage and fragmentation statistics.
+     */
+    GpuMemoryStats getStats() const;
+
+    /**
+     * @brief Query per-heap memory budgets.
+     *
+     * Uses VK_EXT_memory_budget when it was enabled; otherwise reports 80%
+     * of each heap as budget and the allocator's own reservation as usage.
+     */
+    std::vector<GpuHeapBudget> queryBudget() const;
+
+    /**
+     * @brief Block size used for a given memory type.
+     */
+    VkDeviceSize getBlockSize(uint32_t memoryTypeIndex) const;
+
+  private:
+    struct Block {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        void* mapped = nullptr;
+        uint32_t memoryTypeIndex = 0;
+        uint32_t poolIndex = 0;
+        std::unique_ptr<TlsfAllocator> ranges;
+    };
+
+    struct Dedicated {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkDeviceSize size = 0;
+        uint32_t memoryTypeIndex = 0;
+    };
+
+    uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+    bool allocateDeviceMemory(VkDeviceSize size, uint32_t memoryTypeIndex,
+                              VkDeviceMemory& memory, void*& mapped);
+    void freeDeviceMemory(VkDeviceMemory memory, VkDeviceSize size, uint32_t memoryTypeIndex);
+    uint32_t createBlock(uint32_t memoryTypeIndex, uint32_t poolIndex);
+    void releaseBlock(uint32_t blockIndex);
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+    bool m_memoryBudgetSupported = false;
+    VkDeviceSize m_preferredBlockSize = DEFAULT_BLOCK_SIZE;
+    uint32_t m_generation = 0;
+
+    std::vector<std::unique_ptr<Block>> m_blocks;  ///< Indexed by GpuAllocation::blockIndex
+    std::vector<uint32_t> m_freeBlockSlots;
+    std::vector<Dedicated> m_dedicated;
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> m_heapReserved{};
+    uint32_t m_deviceMemoryObjects = 0;
+
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace vde
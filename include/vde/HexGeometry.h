@@ -9,10 +9,15 @@
 
 #include <glm/glm.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace vde {
 
+// Forward declarations
+class ThreadPool;
+
 /**
  * @brief Hexagon orientation types.
  *
@@ -45,6 +50,11 @@ struct HexMesh {
  * For a pointy-top hex:
  * - Width (flat to flat) = sqrt(3) * size
  * - Height (tip to tip) = 2 * size
+ *
+ * Whole regions of cells can be written in one pass into a single
+ * pre-sized vertex/index buffer with generateRectRegion() and
+ * generateHexRegion(); each cell has the same 7 vertices and 18 indices
+ * as generateHex() would produce for its center.
  */
 class HexGeometry {
   public:
@@ -69,6 +79,92 @@ class HexGeometry {
      */
     std::vector<glm::vec3> getCornerPositions(const glm::vec3& center = glm::vec3(0.0f)) const;
 
+    // Bulk region generation
+
+    /// Vertices written per cell (center + 6 corners)
+    static constexpr uint32_t VERTICES_PER_HEX = 7;
+
+    /// Indices written per cell (6 triangles)
+    static constexpr uint32_t INDICES_PER_HEX = 18;
+
+    /// Cells generated per parallel task
+    static constexpr size_t CELLS_PER_TASK = 16384;
+
+    /**
+     * @brief Number of cells in a columns x rows rectangular region.
+     */
+    static size_t getRectRegionCellCount(uint32_t columns, uint32_t rows) {
+        return static_cast<size_t>(columns) * rows;
+    }
+
+    /**
+     * @brief Number of cells within a hexagonal region of the given radius.
+     */
+    static size_t getHexRegionCellCount(uint32_t radius) {
+        return 3 * static_cast<size_t>(radius) * (radius + 1) + 1;
+    }
+
+    /**
+     * @brief Center of the cell at offset coordinates in a rectangular region.
+     *
+     * Flat-top regions offset odd columns by half a hex in +z (odd-q);
+     * pointy-top regions offset odd rows by half a hex in +x (odd-r).
+     */
+    glm::vec3 offsetToWorld(uint32_t column, uint32_t row,
+                            const glm::vec3& origin = glm::vec3(0.0f)) const;
+
+    /**
+     * @brief Center of the cell at axial coordinates.
+     */
+    glm::vec3 axialToWorld(int q, int r, const glm::vec3& origin = glm::vec3(0.0f)) const;
+
+    /**
+     * @brief Write a rectangular region of cells into pre-sized buffers.
+     *
+     * Cells are written row by row (cell index = row * columns + column),
+     * split across threads by blocks of rows.  Vertex indices are relative
+     * to @p vertices, so the region must hold fewer than 2^32 / 7 cells.
+     *
+     * @param columns Cells per row
+     * @param rows Number of rows
+     * @param origin Center of cell (0, 0)
+     * @param vertices Output, getRectRegionCellCount() * VERTICES_PER_HEX elements
+     * @param indices Output, getRectRegionCellCount() * INDICES_PER_HEX elements
+     * @param workers Pool for parallel rows; a temporary pool is created for
+     *        large regions when null
+     */
+    void generateRectRegion(uint32_t columns, uint32_t rows, const glm::vec3& origin,
+                            Vertex* vertices, uint32_t* indices,
+                            ThreadPool* workers = nullptr) const;
+
+    /**
+     * @brief Generate a rectangular region of cells as one mesh.
+     */
+    HexMesh generateRectRegion(uint32_t columns, uint32_t rows,
+                               const glm::vec3& origin = glm::vec3(0.0f),
+                               ThreadPool* workers = nullptr) const;
+
+    /**
+     * @brief Write every cell within @p radius of a center cell into pre-sized buffers.
+     *
+     * Cells are written by axial row r = -radius..radius, q ascending within
+     * each row, split across threads by blocks of rows.
+     *
+     * @param radius Region radius in cells (0 = the center cell only)
+     * @param center Center of the middle cell
+     * @param vertices Output, getHexRegionCellCount() * VERTICES_PER_HEX elements
+     * @param indices Output, getHexRegionCellCount() * INDICES_PER_HEX elements
+     * @param workers Pool for parallel rows (see generateRectRegion())
+     */
+    void generateHexRegion(uint32_t radius, const glm::vec3& center, Vertex* vertices,
+                           uint32_t* indices, ThreadPool* workers = nullptr) const;
+
+    /**
+     * @brief Generate a hexagonal region of cells as one mesh.
+     */
+    HexMesh generateHexRegion(uint32_t radius, const glm::vec3& center = glm::vec3(0.0f),
+                              ThreadPool* workers = nullptr) const;
+
     // Dimension accessors
 
     /** @brief Get the size (outer radius) */
@@ -88,17 +184,14 @@ class HexGeometry {
     HexOrientation m_orientation;
 
     /**
-     * @brief Get the starting angle for corner 0.
-     * @return Angle in radians
-     */
-    float getStartAngle() const;
-
-    /**
-     * @brief Calculate UV coordinates for a point relative to center.
-     * @param localPos Position relative to hex center
-     * @return UV coordinates in [0, 1] range
+     * @brief Write one cell's vertices and indices.
+     * @param center Cell center
+     * @param vertices Output for VERTICES_PER_HEX vertices
+     * @param indices Output for INDICES_PER_HEX indices
+     * @param baseVertex Index of the cell's first vertex
      */
-    glm::vec2 calculateUV(const glm::vec2& localPos) const;
+    void writeHex(const glm::vec3& center, Vertex* vertices, uint32_t* indices,
+                  uint32_t baseVertex) const;
 };
 
 }  // namespace vde
@@ -9,6 +9,7 @@
 #include <vulkan/vulkan.h>
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -70,6 +71,72 @@ struct HexPrismVertex {
     }
 };
 
+/**
+ * @brief Per-instance data for one cell of an instanced hex prism map.
+ *
+ * The vertex shader places the shared unit prism at the cell's axial
+ * coordinate (flat-top layout, matching HexPrismMeshGenerator) and
+ * scales it to the cell height.  12 bytes per cell.
+ */
+struct HexPrismInstance {
+    int16_t q = 0;                ///< Axial column
+    int16_t r = 0;                ///< Axial row
+    float height = 1.0f;          ///< Prism height (scales the unit prism's y)
+    uint32_t color = 0xFFFFFFFF;  ///< RGBA8, red in the lowest byte
+
+    /**
+     * @brief Pack a [0, 1] RGBA color into the color field layout.
+     */
+    static uint32_t packColor(const glm::vec4& rgba) {
+        auto channel = [](float value) {
+            float clamped = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+            return static_cast<uint32_t>(clamped * 255.0f + 0.5f);
+        };
+        return channel(rgba.x) | (channel(rgba.y) << 8) | (channel(rgba.z) << 16) |
+               (channel(rgba.w) << 24);
+    }
+
+    /**
+     * @brief Per-instance binding description (binding 1).
+     */
+    static VkVertexInputBindingDescription getBindingDescription() {
+        VkVertexInputBindingDescription binding{};
+        binding.binding = 1;
+        binding.stride = sizeof(HexPrismInstance);
+        binding.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        return binding;
+    }
+
+    /**
+     * @brief Per-instance attributes (locations 3-5, after the Vertex attributes).
+     */
+    static std::array<VkVertexInputAttributeDescription, 3> getAttributeDescriptions() {
+        std::array<VkVertexInputAttributeDescription, 3> attributes{};
+
+        // Axial coordinate (location 3)
+        attributes[0].binding = 1;
+        attributes[0].location = 3;
+        attributes[0].format = VK_FORMAT_R16G16_SINT;
+        attributes[0].offset = offsetof(HexPrismInstance, q);
+
+        // Height (location 4)
+        attributes[1].binding = 1;
+        attributes[1].location = 4;
+        attributes[1].format = VK_FORMAT_R32_SFLOAT;
+        attributes[1].offset = offsetof(HexPrismInstance, height);
+
+        // Color (location 5)
+        attributes[2].binding = 1;
+        attributes[2].location = 5;
+        attributes[2].format = VK_FORMAT_R8G8B8A8_UNORM;
+        attributes[2].offset = offsetof(HexPrismInstance, color);
+
+        return attributes;
+    }
+};
+
+static_assert(sizeof(HexPrismInstance) == 12, "HexPrismInstance must be 12 bytes");
+
 /**
  * @brief Mesh data containing vertices and indices for a hex prism.
  */
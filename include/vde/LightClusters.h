@@ -0,0 +1,182 @@
+#pragma once
+
+/**
+ * @file LightClusters.h
+ * @brief Clustered light assignment for forward shading
+ *
+ * The view frustum is split into a grid of clusters: screen tiles in x/y
+ * and exponential depth slices in z.  Every point and spot light is binned
+ * into the clusters its range touches, so the fragment shader only loops
+ * over the lights of the cluster a fragment falls into.
+ */
+
+#include <vde/Types.h>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vde {
+
+class ThreadPool;
+
+/**
+ * @brief One cluster's range in the light index list.
+ *
+ * Laid out as a GLSL uvec2 (offset, count).
+ */
+struct LightCluster {
+    uint32_t offset = 0;  ///< First entry in getLightIndices()
+    uint32_t count = 0;   ///< Number of lights in the cluster
+};
+
+static_assert(sizeof(LightCluster) == 8, "LightCluster must be 8 bytes");
+
+/**
+ * @brief CPU light binning into a GRID_X x GRID_Y x GRID_Z cluster grid.
+ *
+ * Cluster bounds are view-space boxes derived from the projection, so
+ * perspective and orthographic cameras are both supported.  Perspective
+ * projections slice depth exponentially (slices get deeper with distance);
+ * orthographic ones slice it linearly.  Tile y runs from the top of the
+ * viewport, matching gl_FragCoord.
+ *
+ * Lights are bounded by a sphere (spot lights by the tightest sphere around
+ * their cone) and tested against every cluster box of the depth slices the
+ * sphere covers.  Slices are split into groups of SLICES_PER_TASK that are
+ * binned independently, on a ThreadPool when one is given.  The cluster
+ * boxes are kept as separate min/max arrays per axis so the per-tile test
+ * is a branch-free loop the compiler can vectorise.
+ *
+ * Directional lights light every cluster and are never binned; the shader
+ * loops over them separately.
+ *
+ * @code
+ * LightClusterGrid clusters;
+ * clusters.setProjection(camera.getProjectionMatrix(), camera.getNearPlane(),
+ *                        camera.getFarPlane());
+ * clusters.build(lights, camera.getViewMatrix());
+ * // upload getClusters() followed by getLightIndices()
+ * @endcode
+ */
+class LightClusterGrid {
+  public:
+    static constexpr uint32_t GRID_X = 16;  ///< Screen tiles across
+    static constexpr uint32_t GRID_Y = 9;   ///< Screen tiles down
+    static constexpr uint32_t GRID_Z = 24;  ///< Depth slices
+    static constexpr uint32_t TILE_COUNT = GRID_X * GRID_Y;
+    static constexpr uint32_t CLUSTER_COUNT = TILE_COUNT * GRID_Z;
+
+    /// Depth slices binned per parallel task
+    static constexpr uint32_t SLICES_PER_TASK = 4;
+
+    LightClusterGrid();
+
+    /**
+     * @brief Set the projection the clusters subdivide.
+     *
+     * Recomputes the cluster boxes only when the projection or depth range
+     * changed since the last call.
+     *
+     * @param projection Projection matrix (as used for rendering)
+     * @param nearPlane Near plane distance
+     * @param farPlane Far plane distance
+     */
+    void setProjection(const glm::mat4& projection, float nearPlane, float farPlane);
+
+    /**
+     * @brief Bin lights into the clusters, replacing the previous result.
+     * @param lights World-space lights (directional lights are skipped)
+     * @param view View matrix (world -> camera)
+     * @param workers Pool for parallel slice groups, or nullptr to bin on
+     *        the calling thread (this runs every frame, so no temporary
+     *        pool is created)
+     */
+    void build(std::span<const GPULight> lights, const glm::mat4& view,
+               ThreadPool* workers = nullptr);
+
+    /**
+     * @brief Per-cluster ranges, indexed by getClusterIndex().
+     */
+    const std::vector<LightCluster>& getClusters() const { return m_clusters; }
+
+    /**
+     * @brief Light indices (into the span passed to build()), grouped by cluster.
+     */
+    const std::vector<uint32_t>& getLightIndices() const { return m_lightIndices; }
+
+    /**
+     * @brief Index of the cluster at tile (x, y) and depth slice z.
+     */
+    static uint32_t getClusterIndex(uint32_t x, uint32_t y, uint32_t z) {
+        return x + GRID_X * (y + GRID_Y * z);
+    }
+
+    /**
+     * @brief Depth slice containing a view-space depth (clamped to the grid).
+     */
+    uint32_t getSlice(float depth) const;
+
+    /**
+     * @brief View-space depth where a slice starts (slice GRID_Z gives the far plane).
+     */
+    float getSliceStart(uint32_t slice) const;
+
+    /// True if depth slices are exponential (perspective projection)
+    bool isLogarithmic() const { return m_logarithmic; }
+
+    /**
+     * @brief Slice mapping for the shader.
+     *
+     * slice = floor(f(depth) * scale + bias), where f is log() when
+     * isLogarithmic() and the identity otherwise.
+     */
+    float getSliceScale() const { return m_sliceScale; }
+    float getSliceBias() const { return m_sliceBias; }
+
+    float getNearPlane() const { return m_nearPlane; }
+    float getFarPlane() const { return m_farPlane; }
+
+    /**
+     * @brief Lights binned into at least one cluster by the last build().
+     */
+    uint32_t getBinnedLightCount() const { return m_binnedLightCount; }
+
+  private:
+    // View-space light bounds, one entry per binned light
+    struct LightBounds {
+        std::vector<float> x, y, z, radius;
+        std::vector<uint32_t> index;  ///< Index in the span passed to build()
+        std::vector<uint32_t> firstSlice, lastSlice;
+    };
+
+    // Output of one slice group, in cluster order
+    struct TaskResult {
+        std::vector<uint32_t> counts;   ///< Per cluster of the group
+        std::vector<uint32_t> indices;  ///< Light indices grouped by cluster
+        std::vector<uint32_t> hits;     ///< Scratch: (light << 8 | tile) per slice
+        std::vector<uint8_t> mask;      ///< Scratch: per-tile test results
+    };
+
+    void binSlices(uint32_t firstSlice, uint32_t endSlice, TaskResult& result) const;
+
+    glm::mat4 m_projection{0.0f};
+    float m_nearPlane = 0.0f;
+    float m_farPlane = 0.0f;
+    bool m_logarithmic = true;
+    float m_sliceScale = 0.0f;
+    float m_sliceBias = 0.0f;
+
+    // View-space x/y extents of every cluster box; the depth extent is the slice's
+    std::vector<float> m_minX, m_minY, m_maxX, m_maxY;
+
+    LightBounds m_lights;
+    std::vector<TaskResult> m_tasks;
+    std::vector<LightCluster> m_clusters;
+    std::vector<uint32_t> m_lightIndices;
+    uint32_t m_binnedLightCount = 0;
+};
+
+}  // namespace vde
@@ -0,0 +1,65 @@
+#pragma once
+
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory-mapped file view
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace vde {
+
+/**
+ * @brief Maps a whole file read-only into memory.
+ *
+ * Lets callers hash or parse file contents straight from the page cache
+ * instead of copying them through a stream buffer first.  Empty files
+ * "open" successfully with a null data pointer and zero size.
+ *
+ * Usage:
+ * @code
+ * MappedFile file;
+ * if (file.open("cache/shaders/abcd.spv")) {
+ *     uint64_t hash = ShaderHash::hash(file.data(), file.size());
+ * }
+ * @endcode
+ */
+class MappedFile {
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // Non-copyable, movable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file, replacing any current mapping.
+     * @return true if the file was opened (and mapped, if non-empty)
+     */
+    bool open(const std::string& path);
+
+    /** @brief Unmap and close */
+    void close();
+
+    bool isOpen() const { return m_open; }
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+  private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_open = false;
+#ifdef _WIN32
+    void* m_file = nullptr;     ///< HANDLE
+    void* m_mapping = nullptr;  ///< HANDLE
+#else
+    int m_fd = -1;
+#endif
+};
+
+}  // namespace vde
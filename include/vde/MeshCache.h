@@ -0,0 +1,140 @@
+#pragma once
+
+/**
+ * @file MeshCache.h
+ * @brief Binary .vdemesh files caching imported meshes by source hash
+ */
+
+#include <vde/Types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vde {
+
+/**
+ * @brief One vertex attribute as recorded in a .vdemesh file.
+ */
+struct MeshFileAttribute {
+    uint32_t location;
+    uint32_t format;  ///< VkFormat
+    uint32_t offset;
+};
+
+/**
+ * @brief Fixed-size header at the start of a .vdemesh file.
+ *
+ * The vertex and index blobs follow at BLOB_ALIGNMENT-aligned offsets, so
+ * they can be copied straight into a mapped staging buffer.  A table of
+ * lodCount MeshFileLOD entries at lodOffset describes the simplified
+ * levels, whose blobs follow the base mesh's.  All fields are
+ * little-endian.
+ */
+struct MeshFileHeader {
+    uint32_t magic;    ///< MeshCache::MAGIC
+    uint32_t version;  ///< MeshCache::VERSION
+    uint64_t sourceHash;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t vertexStride;
+    uint32_t attributeCount;
+    MeshFileAttribute attributes[4];
+    float boundsMin[3];
+    float boundsMax[3];
+    uint64_t vertexOffset;  ///< Byte offset of the vertex blob
+    uint64_t indexOffset;   ///< Byte offset of the uint32_t index blob
+    uint32_t lodCount;      ///< Levels of detail after the base mesh
+    uint32_t reserved;
+    uint64_t lodOffset;  ///< Byte offset of the MeshFileLOD table
+};
+
+static_assert(sizeof(MeshFileHeader) == 136, "MeshFileHeader layout changed");
+
+/**
+ * @brief One level of detail in a .vdemesh file.
+ */
+struct MeshFileLOD {
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    float error;  ///< Accumulated simplification error
+    uint32_t reserved;
+    uint64_t vertexOffset;
+    uint64_t indexOffset;
+};
+
+static_assert(sizeof(MeshFileLOD) == 32, "MeshFileLOD layout changed");
+
+/**
+ * @brief A level of detail as stored in and loaded from the cache.
+ */
+struct MeshCacheLOD {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    float error = 0.0f;
+};
+
+/**
+ * @brief Stores imported meshes as binary .vdemesh files.
+ *
+ * Files are named after the XXH64 hash of the source (as with
+ * ShaderCache), so an edited source simply misses the cache and a stale
+ * file is never read.  A file is also rejected when its version or vertex
+ * layout differs from the running build.  Loading maps the file and
+ * copies the blobs out, so a cache hit costs little more than the I/O.
+ *
+ * Usage:
+ * @code
+ * MeshCache cache("cache/meshes");
+ * uint64_t hash = ShaderHash::hashFile("assets/ship.obj");
+ * if (!cache.load(hash, vertices, indices, boundsMin, boundsMax, &lods)) {
+ *     // import the source and build its LODs, then
+ *     cache.store(hash, vertices, indices, boundsMin, boundsMax, lods);
+ * }
+ * @endcode
+ */
+class MeshCache {
+  public:
+    /// Default location, alongside ShaderCache's "cache/shaders"
+    static constexpr const char* DEFAULT_DIRECTORY = "cache/meshes";
+
+    static constexpr uint32_t MAGIC = 0x4D454456;  ///< "VDEM"
+    static constexpr uint32_t VERSION = 3;  ///< 2: stored optimized; 3: LOD chain
+    static constexpr uint32_t MAX_LODS = 16;  ///< Files claiming more are rejected
+    static constexpr size_t BLOB_ALIGNMENT = 256;
+
+    explicit MeshCache(const std::string& cacheDirectory = DEFAULT_DIRECTORY);
+
+    /**
+     * @brief Load a cached mesh.
+     * @param lods Receives the stored levels of detail (may be nullptr)
+     * @return true if a valid file for this source hash was found; files with
+     *         an index outside their vertex range are rejected.  On failure
+     *         the output parameters are left unchanged.
+     */
+    bool load(uint64_t sourceHash, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+              glm::vec3& boundsMin, glm::vec3& boundsMax,
+              std::vector<MeshCacheLOD>* lods = nullptr);
+
+    /**
+     * @brief Write a mesh to the cache (atomically, via a temporary file).
+     * @param lods Levels of detail after the base mesh, finest first
+     * @return true if the file was written
+     */
+    bool store(uint64_t sourceHash, const std::vector<Vertex>& vertices,
+               const std::vector<uint32_t>& indices, const glm::vec3& boundsMin,
+               const glm::vec3& boundsMax, const std::vector<MeshCacheLOD>& lods = {});
+
+    /** @brief Path of the .vdemesh file for a source hash */
+    std::string getCachePath(uint64_t sourceHash) const;
+
+    const std::string& getCacheDirectory() const { return m_cacheDirectory; }
+    const std::string& getLastError() const { return m_lastError; }
+
+  private:
+    std::string m_cacheDirectory;
+    std::string m_lastError;
+};
+
+}  // namespace vde
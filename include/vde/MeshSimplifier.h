@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @file MeshSimplifier.h
+ * @brief Quadric error metric simplification for mesh LOD generation
+ */
+
+#include <vde/Types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vde {
+
+/**
+ * @brief Static utility class for reducing the triangle count of a mesh.
+ *
+ * Uses Garland-Heckbert quadric error metrics with half-edge collapses:
+ * every collapse moves one vertex onto a neighbour, so the simplified
+ * triangles index the original vertex array and no new vertices are
+ * created.  Vertices sharing a position (UV or normal seams) are welded
+ * while simplifying; each output corner keeps the original vertex at its
+ * new position whose attributes are closest to the one it replaced.
+ * Open borders are held in place by boundary quadrics and collapses that
+ * would flip a triangle are rejected.
+ *
+ * @code
+ * float error = 0.0f;
+ * auto lod = MeshSimplifier::simplify(vertices, indices, indices.size() / 2, 0.02f, &error);
+ * @endcode
+ */
+class MeshSimplifier {
+  public:
+    /// Scale of the boundary-preserving quadrics relative to surface quadrics
+    static constexpr float BOUNDARY_WEIGHT = 10.0f;
+
+    /**
+     * @brief Simplify a triangle list.
+     *
+     * Stops at targetIndexCount or when the next collapse would exceed
+     * targetError, whichever comes first.
+     *
+     * @param vertices Vertex data (positions drive the error metric)
+     * @param indices Triangle list
+     * @param targetIndexCount Desired index count (a multiple of 3)
+     * @param targetError Maximum error relative to the mesh bounds diagonal
+     * @param resultError Receives the largest relative error introduced
+     * @return Simplified triangle list into the same vertex array
+     */
+    static std::vector<uint32_t> simplify(std::span<const Vertex> vertices,
+                                          std::span<const uint32_t> indices,
+                                          size_t targetIndexCount, float targetError = 1.0f,
+                                          float* resultError = nullptr);
+};
+
+}  // namespace vde
@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file ObjLoader.h
+ * @brief Fast Wavefront OBJ parser producing indexed vertex data
+ */
+
+#include <vde/Types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vde {
+
+class ThreadPool;
+
+/**
+ * @brief Indexed geometry parsed from an OBJ file.
+ */
+struct ObjMeshData {
+    std::vector<Vertex> vertices;   ///< One vertex per unique (v, vt, vn) triple
+    std::vector<uint32_t> indices;  ///< Triangle list (polygons are fan-triangulated)
+
+    size_t positionCount = 0;  ///< Number of "v" records in the file
+    size_t normalCount = 0;    ///< Number of "vn" records
+    size_t texCoordCount = 0;  ///< Number of "vt" records
+    size_t cornerCount = 0;    ///< Face corners before deduplication
+
+    std::string error;  ///< Empty on success
+
+    /** @brief Check that parsing produced at least one triangle */
+    bool isValid() const { return error.empty() && !vertices.empty() && !indices.empty(); }
+};
+
+/**
+ * @brief Static utility class for loading OBJ meshes.
+ *
+ * The file is memory-mapped and tokenised with std::from_chars.  Files
+ * larger than a few megabytes are split at line boundaries and the chunks
+ * parsed in parallel; the chunk results are then merged in file order.
+ * Face corners are deduplicated on their (v, vt, vn) triple with a flat
+ * open-addressing hash, so shared corners become one indexed vertex.
+ *
+ * Supports v, vt, vn and f records (including negative, relative indices
+ * and the v, v/vt, v//vn and v/vt/vn forms).  Other records are ignored.
+ * As in Mesh, a vertex normal is stored as its absolute value in
+ * Vertex::color, or white when the corner has no normal.
+ */
+class ObjLoader {
+  public:
+    /**
+     * @brief Load and parse an OBJ file.
+     * @param path Path to the .obj file
+     * @param workers Pool for parallel chunk parsing; a temporary pool is
+     *        created for large files when null
+     * @return Parsed mesh data (check isValid())
+     */
+    static ObjMeshData load(const std::string& path, ThreadPool* workers = nullptr);
+
+    /**
+     * @brief Parse OBJ text already in memory.
+     * @param text Contents of an OBJ file
+     * @param workers Pool for parallel chunk parsing (see load())
+     * @param chunkSize Target bytes per parallel chunk; 0 uses the default
+     */
+    static ObjMeshData parse(std::string_view text, ThreadPool* workers = nullptr,
+                             size_t chunkSize = 0);
+
+    /// Default bytes per parallel chunk
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024;
+};
+
+}  // namespace vde
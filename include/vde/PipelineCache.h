@@ -0,0 +1,194 @@
+#pragma once
+
+/**
+ * @file PipelineCache.h
+ * @brief Graphics pipelines created on demand from hashed state descriptions
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace vde {
+
+class ThreadPool;
+
+/**
+ * @brief Color blending presets for pipeline variants.
+ */
+enum class PipelineBlendMode : uint8_t {
+    Opaque,    ///< No blending
+    Alpha,     ///< src * srcAlpha + dst * (1 - srcAlpha)
+    Additive,  ///< src * srcAlpha + dst
+};
+
+/**
+ * @brief Everything that distinguishes one graphics pipeline from another.
+ *
+ * Viewport and scissor are always dynamic, so they are not part of the
+ * state.  Two descriptions that compare equal produce the same pipeline.
+ */
+struct PipelineState {
+    // Shaders and layout
+    VkShaderModule vertexShader = VK_NULL_HANDLE;
+    VkShaderModule fragmentShader = VK_NULL_HANDLE;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    uint32_t subpass = 0;
+
+    // Vertex layout
+    std::vector<VkVertexInputBindingDescription> vertexBindings;
+    std::vector<VkVertexInputAttributeDescription> vertexAttributes;
+    VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    // Rasterization
+    VkPolygonMode polygonMode = VK_POLYGON_MODE_FILL;
+    VkCullModeFlags cullMode = VK_CULL_MODE_BACK_BIT;
+    VkFrontFace frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    float lineWidth = 1.0f;
+    VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+
+    // Depth and blending
+    bool depthTest = false;
+    bool depthWrite = false;
+    VkCompareOp depthCompareOp = VK_COMPARE_OP_LESS;
+    PipelineBlendMode blendMode = PipelineBlendMode::Opaque;
+
+    /**
+     * @brief 64-bit FNV-1a hash over every field.
+     */
+    uint64_t hash() const;
+
+    bool operator==(const PipelineState& other) const;
+    bool operator!=(const PipelineState& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Hash functor so PipelineState can key unordered containers.
+ */
+struct PipelineStateHash {
+    size_t operator()(const PipelineState& state) const {
+        return static_cast<size_t>(state.hash());
+    }
+};
+
+/**
+ * @brief Cumulative PipelineCache statistics.
+ */
+struct PipelineCacheStats {
+    uint64_t hits = 0;              ///< Lookups answered by an existing pipeline
+    uint64_t pipelinesCreated = 0;  ///< Successful vkCreateGraphicsPipelines calls
+    uint64_t asyncCompiles = 0;     ///< Pipelines compiled on a worker thread
+    uint64_t failures = 0;          ///< Pipeline creation failures
+};
+
+/**
+ * @brief Creates each pipeline variant on first use and returns it after that.
+ *
+ * get() blocks while a missing pipeline is compiled.  request() never
+ * blocks: it queues the compile on the worker pool (if one was given) and
+ * returns VK_NULL_HANDLE until the pipeline is ready, so callers can keep
+ * drawing with a base pipeline instead of stalling a frame.  All driver
+ * work goes through the shared VkPipelineCache.
+ *
+ * @code
+ * PipelineState state = baseState;
+ * state.polygonMode = VK_POLYGON_MODE_LINE;
+ * VkPipeline wireframe = cache.request(state);
+ * if (wireframe == VK_NULL_HANDLE) wireframe = cache.get(baseState);
+ * @endcode
+ *
+ * All methods are thread-safe.
+ */
+class PipelineCache {
+  public:
+    PipelineCache() = default;
+    ~PipelineCache();
+
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+
+    /**
+     * @brief Bind to a device.
+     * @param device Logical device
+     * @param driverCache VkPipelineCache passed to every creation (may be null)
+     * @param workers Pool for request() compiles; null compiles synchronously
+     */
+    void init(VkDevice device, VkPipelineCache driverCache, ThreadPool* workers = nullptr);
+
+    /**
+     * @brief Wait for pending compiles and destroy every pipeline.
+     */
+    void shutdown();
+
+    bool isInitialized() const { return m_device != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Replace the worker pool (waits for compiles on the old one first).
+     */
+    void setWorkers(ThreadPool* workers);
+
+    /**
+     * @brief Get the pipeline for @p state, creating it now if needed.
+     * @throws std::runtime_error if pipeline creation fails
+     */
+    VkPipeline get(const PipelineState& state);
+
+    /**
+     * @brief Get the pipeline for @p state without blocking.
+     * @return The pipeline, or VK_NULL_HANDLE while it is being compiled
+     */
+    VkPipeline request(const PipelineState& state);
+
+    /**
+     * @brief Queue compiles for states that will be needed later.
+     */
+    void prewarm(const std::vector<PipelineState>& states);
+
+    /**
+     * @brief Block until every queued compile has finished.
+     */
+    void waitIdle();
+
+    /**
+     * @brief Destroy every pipeline that uses @p module (before destroying it).
+     */
+    void evictShader(VkShaderModule module);
+
+    /** @brief Number of pipelines currently cached */
+    size_t size() const;
+
+    PipelineCacheStats getStats() const;
+
+    /**
+     * @brief Build a pipeline from a state description.
+     * @return VK_NULL_HANDLE on failure
+     */
+    static VkPipeline createPipeline(VkDevice device, VkPipelineCache driverCache,
+                                     const PipelineState& state);
+
+  private:
+    struct Entry {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        std::shared_future<VkPipeline> pending;
+        bool failed = false;
+    };
+
+    Entry& findOrQueueLocked(const PipelineState& state, bool& queued);
+    void resolveLocked(Entry& entry);
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPipelineCache m_driverCache = VK_NULL_HANDLE;
+    ThreadPool* m_workers = nullptr;
+
+    std::unordered_map<PipelineState, Entry, PipelineStateHash> m_entries;
+    PipelineCacheStats m_stats;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace vde
@@ -0,0 +1,110 @@
+#pragma once
+
+/**
+ * @file PipelineDiskCache.h
+ * @brief Persistent VkPipelineCache stored next to the shader cache
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vde {
+
+/**
+ * @brief Loads a VkPipelineCache blob at startup and writes it back on shutdown.
+ *
+ * The driver can skip most of its shader compilation when a pipeline is
+ * created with a cache that already contains it.  Blobs are only reused
+ * when their header matches the current device (header version, vendor ID,
+ * device ID and pipeline cache UUID); a driver update changes the UUID, so
+ * a stale blob is discarded and an empty cache is created instead.
+ *
+ * Usage:
+ * @code
+ * PipelineDiskCache cache("cache/pipeline_cache.bin");
+ * cache.init(device, physicalDevice);
+ * vkCreateGraphicsPipelines(device, cache.getHandle(), 1, &info, nullptr, &pipeline);
+ * cache.shutdown();  // saves and destroys
+ * @endcode
+ */
+class PipelineDiskCache {
+  public:
+    /// Default location, alongside ShaderCache's "cache/shaders"
+    static constexpr const char* DEFAULT_PATH = "cache/pipeline_cache.bin";
+
+    /// Size of the VkPipelineCacheHeaderVersionOne header
+    static constexpr size_t HEADER_SIZE = 16 + VK_UUID_SIZE;
+
+    explicit PipelineDiskCache(const std::string& path = DEFAULT_PATH);
+    ~PipelineDiskCache();
+
+    // Non-copyable
+    PipelineDiskCache(const PipelineDiskCache&) = delete;
+    PipelineDiskCache& operator=(const PipelineDiskCache&) = delete;
+
+    /**
+     * @brief Create the VkPipelineCache, seeded from disk when the blob is valid.
+     * @return true if the cache object was created (even if the file was unusable)
+     */
+    bool init(VkDevice device, VkPhysicalDevice physicalDevice);
+
+    /**
+     * @brief Write the current cache contents to disk.
+     * @return true if the file was written
+     */
+    bool save();
+
+    /**
+     * @brief Save (if enabled) and destroy the cache object.
+     */
+    void shutdown();
+
+    /**
+     * @brief Pipeline cache handle to pass to vkCreate*Pipelines.
+     * @return VK_NULL_HANDLE before init()
+     */
+    VkPipelineCache getHandle() const { return m_cache; }
+
+    /** @brief Check if a valid blob was loaded from disk */
+    bool wasLoadedFromDisk() const { return m_loadedBytes > 0; }
+
+    /** @brief Size of the blob loaded from disk (0 on a cold start) */
+    size_t getLoadedSize() const { return m_loadedBytes; }
+
+    /** @brief Get the cache file path */
+    const std::string& getPath() const { return m_path; }
+
+    /** @brief Enable or disable writing the cache on shutdown */
+    void setSaveOnShutdown(bool enabled) { m_saveOnShutdown = enabled; }
+
+    /** @brief Get last error message */
+    const std::string& getLastError() const { return m_lastError; }
+
+    /**
+     * @brief Check that a blob was produced by the given device and driver.
+     * @param data Cache blob (as returned by vkGetPipelineCacheData)
+     * @param size Blob size in bytes
+     * @param vendorID Expected VkPhysicalDeviceProperties::vendorID
+     * @param deviceID Expected VkPhysicalDeviceProperties::deviceID
+     * @param uuid Expected VkPhysicalDeviceProperties::pipelineCacheUUID
+     * @return true if the header matches
+     */
+    static bool validateHeader(const uint8_t* data, size_t size, uint32_t vendorID,
+                               uint32_t deviceID, const uint8_t uuid[VK_UUID_SIZE]);
+
+  private:
+    std::string m_path;
+    std::string m_lastError;
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPipelineCache m_cache = VK_NULL_HANDLE;
+    size_t m_loadedBytes = 0;
+    bool m_saveOnShutdown = true;
+
+    std::vector<uint8_t> loadValidatedBlob(VkPhysicalDevice physicalDevice);
+};
+
+}  // namespace vde
@@ -19,6 +19,7 @@ namespace vde {
 struct QueueFamilyIndices {
     std::optional<uint32_t> graphicsFamily;  ///< Graphics queue family index
     std::optional<uint32_t> presentFamily;   ///< Present queue family index
+    std::optional<uint32_t> transferFamily;  ///< Preferred transfer family (optional)
 
     /**
      * @brief Check if all required queue families have been found.
@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @file ShaderBundle.h
+ * @brief SPIR-V for the engine's shaders, compiled at build time
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace vde {
+
+/**
+ * @brief One embedded SPIR-V module.
+ */
+struct EmbeddedShader {
+    std::string_view name;  ///< Source file name in shaders/, e.g. "mesh.vert"
+    const uint32_t* code;   ///< SPIR-V words
+    size_t wordCount;       ///< Number of words in code
+};
+
+/**
+ * @brief Lookup table over shaders embedded into the library.
+ *
+ * Configuring with -DVDE_EMBED_SHADERS=ON compiles every file in shaders/
+ * with glslangValidator at build time and embeds the results as constexpr
+ * arrays.  Game then creates its pipelines from the bundle, without
+ * initializing glslang or reading shader files.  Without the option the
+ * bundle is empty and shaders are compiled at runtime as before.
+ *
+ * @code
+ * std::span<const uint32_t> spirv = ShaderBundle::find("mesh.vert");
+ * if (!spirv.empty()) {
+ *     VkShaderModule module = context->createShaderModule(spirv);
+ * }
+ * @endcode
+ */
+class ShaderBundle {
+  public:
+    /**
+     * @brief Find an embedded shader by source file name.
+     * @return SPIR-V words, or an empty span if the shader is not embedded
+     */
+    static std::span<const uint32_t> find(std::string_view name);
+
+    /** @brief Check whether a shader is embedded */
+    static bool contains(std::string_view name) { return !find(name).empty(); }
+
+    /** @brief All embedded shaders, sorted by name */
+    static std::span<const EmbeddedShader> getShaders();
+
+    /** @brief Check if the library was built with VDE_EMBED_SHADERS */
+    static bool isEmbedded() { return !getShaders().empty(); }
+};
+
+}  // namespace vde
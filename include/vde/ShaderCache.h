@@ -7,22 +7,35 @@
 
 #include <vde/ShaderCompiler.h>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace vde {
 
+class ThreadPool;
+
 /**
  * @brief Utility class for computing content hashes of shader source files
  *
- * Uses FNV-1a 64-bit hash algorithm for fast, reliable content hashing.
+ * Uses XXH64, which consumes 32 bytes per step across four independent
+ * lanes.  Files are hashed straight from a memory mapping.
  */
 class ShaderHash {
   public:
+    /**
+     * @brief Hash a block of memory
+     * @param data Bytes to hash
+     * @param size Number of bytes
+     * @return 64-bit hash value
+     */
+    static uint64_t hash(const void* data, size_t size);
+
     /**
      * @brief Hash a string (shader source content)
      * @param content The content to hash
@@ -58,6 +71,8 @@ class ShaderHash {
 struct ShaderCacheEntry {
     std::string sourcePath;                             ///< Original source file path
     uint64_t sourceHash = 0;                            ///< Hash of source content
+    uint64_t sourceSize = 0;                            ///< Source size when hashed
+    int64_t sourceMtime = 0;                            ///< Source write time when hashed
     std::string spvFileName;                            ///< Cached SPIR-V filename
     ShaderStage stage = ShaderStage::Vertex;            ///< Shader stage type
     std::chrono::system_clock::time_point compileTime;  ///< When compiled
@@ -67,6 +82,14 @@ struct ShaderCacheEntry {
      * @return true if entry is usable
      */
     bool isValid() const { return sourceHash != 0 && !spvFileName.empty(); }
+
+    /**
+     * @brief Check the recorded size and write time against the file's
+     * @return true if both match, so the source need not be rehashed
+     */
+    bool matchesStamp(uint64_t size, int64_t mtime) const {
+        return sourceMtime != 0 && sourceSize == size && sourceMtime == mtime;
+    }
 };
 
 /**
@@ -74,7 +97,8 @@ struct ShaderCacheEntry {
  *
  * The ShaderCache eliminates redundant shader compilation by:
  * - Caching compiled SPIR-V to disk
- * - Using content hashes to detect source changes
+ * - Using content hashes to detect source changes (skipped when the
+ *   source's size and write time are unchanged)
  * - Automatically recompiling when sources are modified
  *
  * This significantly reduces startup time and supports hot-reload
@@ -119,6 +143,23 @@ class ShaderCache {
     std::vector<uint32_t> loadShader(const std::string& sourcePath,
                                      std::optional<ShaderStage> stage = std::nullopt);
 
+    /**
+     * @brief Load many shaders at once, compiling cache misses in parallel
+     *
+     * Every source is hashed and checked against the manifest on a worker
+     * thread; misses are compiled there with a per-task ShaderCompiler.  The
+     * manifest is written once, after all workers finish.  Stages are inferred
+     * from file extensions, and a path listed twice is only loaded once.
+     *
+     * Must not be called from a task running on @p workers.
+     *
+     * @param sourcePaths Paths to GLSL source files
+     * @param workers Pool to run on; null uses a temporary pool sized to the batch
+     * @return SPIR-V per path, in input order (empty vector on failure)
+     */
+    std::vector<std::vector<uint32_t>> loadShaders(std::span<const std::string> sourcePaths,
+                                                   ThreadPool* workers = nullptr);
+
     /**
      * @brief Force recompilation of a shader
      * @param sourcePath Path to GLSL source file
@@ -190,9 +231,9 @@ class ShaderCache {
     bool m_enabled = true;
     bool m_initialized = false;
 
-    // Statistics
-    mutable size_t m_cacheHits = 0;
-    mutable size_t m_cacheMisses = 0;
+    // Statistics (updated from loadShaders() workers)
+    std::atomic<size_t> m_cacheHits{0};
+    std::atomic<size_t> m_cacheMisses{0};
 
     // Internal methods
     bool loadManifest();
@@ -201,10 +242,31 @@ class ShaderCache {
     std::string getSpvPath(const std::string& spvFileName) const;
     std::string generateSpvFileName(uint64_t hash) const;
 
+    /**
+     * @brief Check whether a source still matches its cache entry
+     * @param refreshed If non-null, receives the new size/write time when the
+     *        file was touched but its contents are unchanged
+     */
+    bool isSourceCurrent(const std::string& sourcePath, const ShaderCacheEntry& entry,
+                         ShaderCacheEntry* refreshed) const;
+
     std::vector<uint32_t> loadSpvFromDisk(const std::string& spvPath) const;
+    /**
+     * @brief Write SPIR-V through a unique temporary file renamed into place
+     *
+     * Safe to call from several workers for the same content hash.
+     */
     bool saveSpvToDisk(const std::string& spvPath, const std::vector<uint32_t>& spirv) const;
 
     std::vector<uint32_t> compileAndCache(const std::string& sourcePath, ShaderStage stage);
+
+    /**
+     * @brief Compile a shader and write its SPIR-V file (touches no shared state)
+     * @return false with @p error set if compilation failed
+     */
+    bool compileToDisk(ShaderCompiler& compiler, const std::string& sourcePath,
+                       ShaderStage stage, std::vector<uint32_t>& spirv,
+                       ShaderCacheEntry& entry, std::string& error) const;
 };
 
 }  // namespace vde
@@ -5,6 +5,9 @@
  * @brief Vulkan texture management including image, image view, and sampler.
  */
 
+#include <vde/BindlessTextureTable.h>
+#include <vde/GpuAllocator.h>
+#include <vde/UploadManager.h>
 #include <vde/api/Resource.h>
 
 #include <vulkan/vulkan.h>
@@ -76,7 +79,9 @@ class Texture : public Resource {
     /**
      * @brief Upload texture to GPU and create Vulkan objects.
      *
-     * Creates VkImage, VkImageView, VkSampler and uploads pixel data via staging buffer.
+     * Creates VkImage, VkImageView, VkSampler and queues the pixel upload on
+     * the shared UploadManager (see getUploadHandle()).  The texture may be
+     * bound immediately; the frame submission waits for the upload on the GPU.
      * Call this after loadFromFile() or loadFromData().
      *
      * @param context Vulkan context for device/queue access
@@ -89,6 +94,32 @@ class Texture : public Resource {
      */
     bool isOnGPU() const { return m_image != VK_NULL_HANDLE; }
 
+    /**
+     * @brief Handle of the pending pixel upload (empty for synchronous uploads).
+     */
+    UploadHandle getUploadHandle() const { return m_uploadHandle; }
+
+    /**
+     * @brief Check whether the pixel upload has finished executing.
+     */
+    bool isUploadComplete() const;
+
+    /**
+     * @brief Write this texture into a bindless table.
+     *
+     * uploadToGPU() does this automatically when the context's table is
+     * initialized.  The slot is released by freeGPUResources().
+     *
+     * @return true if the texture has a slot in @p table
+     */
+    bool registerBindless(BindlessTextureTable& table);
+
+    /**
+     * @brief Index of this texture in the bindless table.
+     * @return BindlessTextureTable::INVALID_INDEX if not registered
+     */
+    uint32_t getBindlessIndex() const { return m_bindlessIndex; }
+
     /**
      * @brief Free GPU resources (keeps CPU pixel data).
      */
@@ -154,9 +185,19 @@ class Texture : public Resource {
     VkQueue m_graphicsQueue = VK_NULL_HANDLE;
 
     VkImage m_image = VK_NULL_HANDLE;
-    VkDeviceMemory m_imageMemory = VK_NULL_HANDLE;
+    GpuAllocation m_imageAllocation;
     VkImageView m_imageView = VK_NULL_HANDLE;
     VkSampler m_sampler = VK_NULL_HANDLE;
+    UploadHandle m_uploadHandle;
+    BindlessTextureTable* m_bindlessTable = nullptr;
+    uint32_t m_bindlessIndex = BindlessTextureTable::INVALID_INDEX;
+
+    /**
+     * @brief Create the image and upload @p pixels into it.
+     *
+     * Uses the UploadManager when available, otherwise one blocking submission.
+     */
+    void uploadPixels(const void* pixels, VkDeviceSize imageSize);
 
     /**
      * @brief Create a VkImage with the specified properties.
@@ -175,14 +216,16 @@ class Texture : public Resource {
     void createSampler();
 
     /**
-     * @brief Transition image layout using a pipeline barrier.
+     * @brief Record an image layout transition using a pipeline barrier.
      */
-    void transitionImageLayout(VkImageLayout oldLayout, VkImageLayout newLayout);
+    void transitionImageLayout(VkCommandBuffer commandBuffer, VkImageLayout oldLayout,
+                               VkImageLayout newLayout);
 
     /**
-     * @brief Copy buffer contents to image.
+     * @brief Record a copy of buffer contents to the image.
      */
-    void copyBufferToImage(VkBuffer buffer, uint32_t width, uint32_t height);
+    void copyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer buffer, uint32_t width,
+                           uint32_t height);
 
     /**
      * @brief Begin a single-time command buffer.
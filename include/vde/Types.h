@@ -76,6 +76,110 @@ struct Vertex {
     }
 };
 
+/**
+ * @brief Vertex layout a mesh was uploaded with.
+ */
+enum class VertexFormat : uint8_t {
+    Full,     ///< Vertex: 32 bytes of floats
+    Compact,  ///< CompactVertex: 16 bytes of normalized integers
+};
+
+/**
+ * @brief Quantized 16-byte form of Vertex for GPU upload.
+ *
+ * Positions are 16-bit UNORM relative to the mesh bounds: the shader scales
+ * them by the bounds extent and the bounds minimum is folded into the model
+ * matrix.  Colors (which also carry the normal used for lighting) are 8-bit
+ * UNORM and texture coordinates 16-bit UNORM, so only meshes whose colors
+ * and UVs lie in [0, 1] can use this layout (see VertexQuantization).
+ */
+struct CompactVertex {
+    uint16_t position[4];  ///< xyz relative to bounds; w unused
+    uint8_t color[4];      ///< rgb; a unused
+    uint16_t texCoord[2];  ///< uv
+
+    /**
+     * @brief Gets the binding description for the vertex buffer.
+     */
+    static VkVertexInputBindingDescription getBindingDescription() {
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = 0;
+        bindingDescription.stride = sizeof(CompactVertex);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        return bindingDescription;
+    }
+
+    /**
+     * @brief Gets the attribute descriptions, at the same locations as Vertex.
+     */
+    static std::array<VkVertexInputAttributeDescription, 3> getAttributeDescriptions() {
+        std::array<VkVertexInputAttributeDescription, 3> attributeDescriptions{};
+
+        attributeDescriptions[0].binding = 0;
+        attributeDescriptions[0].location = 0;
+        attributeDescriptions[0].format = VK_FORMAT_R16G16B16A16_UNORM;
+        attributeDescriptions[0].offset = offsetof(CompactVertex, position);
+
+        attributeDescriptions[1].binding = 0;
+        attributeDescriptions[1].location = 1;
+        attributeDescriptions[1].format = VK_FORMAT_R8G8B8A8_UNORM;
+        attributeDescriptions[1].offset = offsetof(CompactVertex, color);
+
+        attributeDescriptions[2].binding = 0;
+        attributeDescriptions[2].location = 2;
+        attributeDescriptions[2].format = VK_FORMAT_R16G16_UNORM;
+        attributeDescriptions[2].offset = offsetof(CompactVertex, texCoord);
+
+        return attributeDescriptions;
+    }
+};
+
+static_assert(sizeof(CompactVertex) == 16, "CompactVertex must be 16 bytes");
+
+/**
+ * @brief Per-instance data for instanced wireframe edges.
+ *
+ * One instance per unique mesh edge, read at binding 1 alongside the unit
+ * edge tube mesh at binding 0 (see Mesh::createEdgeTube()).  The vertex
+ * shader stretches the tube from start to end.
+ */
+struct EdgeInstance {
+    glm::vec3 start;  ///< Object-space edge start
+    glm::vec3 end;    ///< Object-space edge end
+
+    /**
+     * @brief Gets the per-instance binding description.
+     */
+    static VkVertexInputBindingDescription getBindingDescription() {
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = 1;
+        bindingDescription.stride = sizeof(EdgeInstance);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        return bindingDescription;
+    }
+
+    /**
+     * @brief Gets the attribute descriptions (locations 3 and 4, after Vertex).
+     */
+    static std::array<VkVertexInputAttributeDescription, 2> getAttributeDescriptions() {
+        std::array<VkVertexInputAttributeDescription, 2> attributeDescriptions{};
+
+        attributeDescriptions[0].binding = 1;
+        attributeDescriptions[0].location = 3;
+        attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
+        attributeDescriptions[0].offset = offsetof(EdgeInstance, start);
+
+        attributeDescriptions[1].binding = 1;
+        attributeDescriptions[1].location = 4;
+        attributeDescriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
+        attributeDescriptions[1].offset = offsetof(EdgeInstance, end);
+
+        return attributeDescriptions;
+    }
+};
+
+static_assert(sizeof(EdgeInstance) == 24, "EdgeInstance must be 24 bytes");
+
 /**
  * @brief Uniform buffer object for shader data.
  *
@@ -96,14 +200,17 @@ static_assert(sizeof(UniformBufferObject) == 192,
               "UniformBufferObject size must be 192 bytes (3 aligned mat4)");
 
 /**
- * @brief Maximum number of lights supported in the lighting UBO.
+ * @brief Maximum number of lights uploaded per view.
+ *
+ * Lights live in a storage buffer and are culled per cluster (see
+ * LightClusterGrid), so this only bounds the per-frame upload.
  */
-constexpr uint32_t MAX_LIGHTS = 8;
+constexpr uint32_t MAX_LIGHTS = 1024;
 
 /**
  * @brief GPU representation of a single light source.
  *
- * Packed for GLSL std140 layout. Must match shader light struct exactly.
+ * Packed for GLSL std140/std430 layout. Must match shader light struct exactly.
  * Size: 64 bytes (4 x vec4)
  */
 struct GPULight {
@@ -120,24 +227,32 @@ static_assert(sizeof(GPULight) == 64, "GPULight must be 64 bytes");
 /**
  * @brief Lighting uniform buffer object for shader data.
  *
- * Contains ambient lighting parameters and an array of light sources.
- * Follows GLSL std140 layout rules for proper GPU alignment.
+ * Holds ambient lighting and the parameters of the view's light clusters.
+ * It starts the persistent lighting region of its frame slot and view
+ * (Game's LightingRegion); the lights follow at byte 128 and the cluster
+ * ranges and light indices after them, in storage bindings over the same
+ * buffer.  bufferOffsets locate that data in elements of each binding.
+ * Follows GLSL std140 layout rules.
  *
- * Total size: 16 (ambient) + 16 (counts) + 64*8 (lights) = 544 bytes
+ * Total size: 7 * 16 = 112 bytes
  */
 struct LightingUBO {
     alignas(16) glm::vec4 ambientColorAndIntensity;  ///< xyz = ambient color, w = intensity
-    alignas(16) glm::ivec4 lightCounts;              ///< x = num lights, yzw = reserved
-    GPULight lights[MAX_LIGHTS];                     ///< Array of light sources
+    alignas(16) glm::ivec4 lightCounts;  ///< x = lights, y = directional lights (listed first)
+    alignas(16) glm::uvec4 clusterGrid;  ///< xyz = cluster grid size, w = 1 if log depth slices
+    alignas(16) glm::uvec4 bufferOffsets;  ///< x = first light, y = first cluster word, zw = 0
+    alignas(16) glm::vec4 viewport;        ///< xy = viewport origin, zw = size (pixels)
+    alignas(16) glm::vec4 depthPlane;      ///< dot(vec4(worldPos, 1), depthPlane) = view depth
+    alignas(16) glm::vec4 sliceParams;     ///< x = slice scale, y = slice bias, zw = near/far
 };
 
-static_assert(sizeof(LightingUBO) == 544, "LightingUBO size must be 544 bytes");
+static_assert(sizeof(LightingUBO) == 112, "LightingUBO size must be 112 bytes");
 
 /**
- * @brief Material data packed for GPU push constants.
+ * @brief Material data packed for the GPU.
  *
- * This structure matches Material::GPUData and is used for push constants.
- * Size: 48 bytes (fits within typical 128-byte push constant limit)
+ * This structure matches Material::GPUData and is embedded in DrawUBO.
+ * Size: 48 bytes
  */
 struct MaterialPushConstants {
     alignas(16) glm::vec4 albedo;    ///< RGB albedo + opacity
@@ -150,4 +265,20 @@ struct MaterialPushConstants {
 
 static_assert(sizeof(MaterialPushConstants) == 48, "MaterialPushConstants size must be 48 bytes");
 
+/**
+ * @brief Per-draw data of the mesh pipelines (Set 2, binding 0).
+ *
+ * Pushed to the frame allocator for every mesh draw and selected with a
+ * dynamic offset (see Game::pushDrawData()).  The meaning of params
+ * depends on the vertex shader: dequantization scale (mesh_compact.vert),
+ * tube thickness (mesh_edge.vert) or hex radius (hex_prism.vert).
+ */
+struct DrawUBO {
+    alignas(16) glm::mat4 model;     ///< Model matrix
+    MaterialPushConstants material;  ///< Material properties
+    alignas(16) glm::vec4 params;    ///< Shader-specific, see above
+};
+
+static_assert(sizeof(DrawUBO) == 128, "DrawUBO size must be 128 bytes");
+
 }  // namespace vde
@@ -10,6 +10,8 @@
 #include <cstdint>
 #include <vector>
 
+#include "GpuAllocator.h"
+
 namespace vde {
 
 /**
@@ -64,9 +66,11 @@ class UniformBuffer {
      *
      * @param frameIndex Index of the frame to update
      * @param data Pointer to the source data
-     * @param size Size of data to copy (must not exceed bufferSize)
+     * @param size Size of data to copy
+     * @param offset Byte offset into the buffer (offset + size must not exceed bufferSize)
      */
-    void update(uint32_t frameIndex, const void* data, VkDeviceSize size);
+    void update(uint32_t frameIndex, const void* data, VkDeviceSize size,
+                VkDeviceSize offset = 0);
 
     /**
      * @brief Get the buffer for a specific frame.
@@ -93,12 +97,28 @@ class UniformBuffer {
      */
     VkDeviceSize getBufferSize() const { return m_bufferSize; }
 
+    /**
+     * @brief Round a size up to a multiple of an alignment.
+     *
+     * Used to lay out per-view slots at dynamic offsets, which must be
+     * multiples of minUniformBufferOffsetAlignment.
+     *
+     * @param size Size in bytes
+     * @param alignment Power-of-two alignment (0 or 1 leaves size unchanged)
+     */
+    static VkDeviceSize alignSize(VkDeviceSize size, VkDeviceSize alignment) {
+        if (alignment <= 1) {
+            return size;
+        }
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
   private:
     VkDevice m_device = VK_NULL_HANDLE;
     VkDeviceSize m_bufferSize = 0;
 
     std::vector<VkBuffer> m_buffers;
-    std::vector<VkDeviceMemory> m_buffersMemory;
+    std::vector<GpuAllocation> m_allocations;
     std::vector<void*> m_buffersMapped;  // Persistently mapped pointers
 };
 
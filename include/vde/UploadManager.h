@@ -0,0 +1,224 @@
+#pragma once
+
+/**
+ * @file UploadManager.h
+ * @brief Asynchronous buffer and image uploads through a staging ring
+ *
+ * Uploads are copied into a persistently mapped staging ring buffer and
+ * recorded into a batch command buffer.  Batches are submitted to the
+ * transfer queue (a dedicated transfer family when the device has one)
+ * once per frame, signalling a fence for CPU-side completion checks and a
+ * timeline semaphore that the graphics submission waits on.  Nothing on
+ * the upload path calls vkQueueWaitIdle.
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "GpuAllocator.h"
+
+namespace vde {
+
+/**
+ * @brief Identifies a queued upload.
+ *
+ * The upload is complete once the transfer batch with timeline value
+ * @c value has finished executing.  A default-constructed handle is
+ * always considered complete.
+ */
+struct UploadHandle {
+    uint64_t value = 0;
+
+    bool isValid() const { return value != 0; }
+};
+
+/**
+ * @brief Cumulative upload statistics.
+ */
+struct UploadStats {
+    uint64_t uploadCount = 0;              ///< Buffer and image uploads queued
+    uint64_t bytesUploaded = 0;            ///< Bytes copied through staging memory
+    uint32_t batchesSubmitted = 0;         ///< Transfer submissions
+    uint32_t ringStalls = 0;               ///< Times the CPU waited for ring space
+    uint32_t oversizedStagingBuffers = 0;  ///< Uploads too large for the ring
+};
+
+/**
+ * @brief Batches staging copies and submits them without stalling the GPU.
+ *
+ * Typical use:
+ * @code
+ * UploadHandle h = uploads.uploadBuffer(vertexBuffer, vertices, size);
+ * // ... later, VulkanContext submits the frame:
+ * uploads.flush();   // graphics submit waits on getTimelineSemaphore()
+ * @endcode
+ *
+ * If timeline semaphores are unavailable, flush() falls back to waiting on
+ * the batch fence, so there is still one wait per batch instead of one per
+ * asset.  All methods are thread-safe.
+ */
+class UploadManager {
+  public:
+    static constexpr VkDeviceSize DEFAULT_RING_SIZE = 16ull * 1024 * 1024;
+    static constexpr VkDeviceSize STAGING_ALIGNMENT = 16;
+
+    UploadManager() = default;
+    ~UploadManager();
+
+    UploadManager(const UploadManager&) = delete;
+    UploadManager& operator=(const UploadManager&) = delete;
+
+    /**
+     * @brief Create the staging ring and timeline semaphore.
+     *
+     * Requires BufferUtils to be initialized (the ring is allocated from
+     * its GpuAllocator).
+     *
+     * @param device Logical device handle
+     * @param queueFamily Queue family used for transfers
+     * @param queue Queue used for transfers
+     * @param graphicsQueueFamily Queue family that consumes the uploaded resources
+     * @param timelineSemaphoreSupported Whether the timelineSemaphore feature is enabled
+     * @param ringSize Size of the staging ring in bytes
+     */
+    void init(VkDevice device, uint32_t queueFamily, VkQueue queue, uint32_t graphicsQueueFamily,
+              bool timelineSemaphoreSupported, VkDeviceSize ringSize = DEFAULT_RING_SIZE);
+
+    /**
+     * @brief Wait for outstanding transfers and destroy all objects.
+     */
+    void shutdown();
+
+    bool isInitialized() const { return m_device != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Queue a copy of @p data into @p dstBuffer.
+     *
+     * The destination must have been created with TRANSFER_DST usage.
+     *
+     * @return Handle that becomes ready once the copy has executed
+     */
+    UploadHandle uploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size,
+                              VkDeviceSize dstOffset = 0);
+
+    /**
+     * @brief Queue a full upload of a single-mip 2D color image.
+     *
+     * The image is transitioned from UNDEFINED to SHADER_READ_ONLY_OPTIMAL.
+     *
+     * @return Handle that becomes ready once the copy has executed
+     */
+    UploadHandle uploadImage(VkImage image, uint32_t width, uint32_t height, const void* data,
+                             VkDeviceSize size);
+
+    /**
+     * @brief Submit the current batch (no-op if nothing is queued).
+     * @return Handle covering every upload queued so far
+     */
+    UploadHandle flush();
+
+    /**
+     * @brief Retire finished batches and recycle their staging space.
+     */
+    void poll();
+
+    /**
+     * @brief Check whether an upload has finished (never blocks).
+     */
+    bool isReady(UploadHandle handle);
+
+    /**
+     * @brief Block until an upload has finished, submitting it if needed.
+     */
+    void wait(UploadHandle handle);
+
+    /**
+     * @brief Submit and wait for every queued upload.
+     */
+    void waitIdle();
+
+    /**
+     * @brief Timeline semaphore signalled by each batch, or VK_NULL_HANDLE.
+     */
+    VkSemaphore getTimelineSemaphore() const { return m_timelineSemaphore; }
+
+    /**
+     * @brief Timeline value of the most recently submitted batch.
+     */
+    uint64_t getSubmittedValue() const;
+
+    uint32_t getQueueFamily() const { return m_queueFamily; }
+
+    /**
+     * @brief Check whether transfers run on a different queue family than graphics.
+     */
+    bool usesDedicatedQueue() const { return m_queueFamily != m_graphicsQueueFamily; }
+
+    /**
+     * @brief Queue families that must share uploaded resources.
+     *
+     * Empty when transfers use the graphics family.  Otherwise resources
+     * written by uploads should be created with VK_SHARING_MODE_CONCURRENT
+     * over these families.
+     */
+    const std::vector<uint32_t>& getSharedQueueFamilies() const { return m_sharedQueueFamilies; }
+
+    VkDeviceSize getRingSize() const { return m_ringSize; }
+
+    UploadStats getStats() const;
+
+  private:
+    struct Batch {
+        VkCommandPool commandPool = VK_NULL_HANDLE;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        uint64_t value = 0;
+        uint32_t uploadCount = 0;
+        bool usesRing = false;
+        VkDeviceSize ringEnd = 0;  ///< Ring head after this batch's last allocation
+        std::vector<std::pair<VkBuffer, GpuAllocation>> oversized;
+    };
+
+    Batch& beginBatchLocked();
+    UploadHandle flushLocked();
+    void pollLocked();
+    void waitLocked(uint64_t value);
+    void retireFrontLocked();
+    void destroyBatch(Batch& batch);
+
+    bool isRingIdle() const;
+    bool ringAllocate(VkDeviceSize size, VkDeviceSize& offset);
+    void stageLocked(const void* data, VkDeviceSize size, VkBuffer& buffer, VkDeviceSize& offset);
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkQueue m_queue = VK_NULL_HANDLE;
+    uint32_t m_queueFamily = 0;
+    uint32_t m_graphicsQueueFamily = 0;
+    std::vector<uint32_t> m_sharedQueueFamilies;
+    VkSemaphore m_timelineSemaphore = VK_NULL_HANDLE;
+
+    // Staging ring: live data occupies [tail, head) modulo m_ringSize
+    VkBuffer m_ringBuffer = VK_NULL_HANDLE;
+    GpuAllocation m_ringAllocation;
+    VkDeviceSize m_ringSize = 0;
+    VkDeviceSize m_ringHead = 0;
+    VkDeviceSize m_ringTail = 0;
+
+    std::unique_ptr<Batch> m_current;                   ///< Batch being recorded
+    std::deque<std::unique_ptr<Batch>> m_inFlight;      ///< Submitted, in submission order
+    std::vector<std::unique_ptr<Batch>> m_freeBatches;  ///< Retired, ready for reuse
+
+    uint64_t m_submittedValue = 0;
+    uint64_t m_completedValue = 0;
+    UploadStats m_stats;
+
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace vde
@@ -0,0 +1,73 @@
+#pragma once
+
+/**
+ * @file VertexQuantization.h
+ * @brief Conversion between Vertex and the quantized CompactVertex layout
+ */
+
+#include <vde/Types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vde {
+
+/**
+ * @brief Static utility class for quantizing vertex and index data at upload.
+ *
+ * Mesh::uploadToGPU() uses these to halve vertex memory and bandwidth when
+ * the data allows it:
+ * - positions become 16-bit UNORM fractions of the mesh bounds, which
+ *   keeps ~1/65535 of the bounds extent as precision,
+ * - colors become 8-bit UNORM and texture coordinates 16-bit UNORM,
+ * - index buffers drop to 16 bits when there are at most 65536 vertices.
+ *
+ * @code
+ * if (VertexQuantization::canCompact(vertices)) {
+ *     auto compact = VertexQuantization::compact(vertices, boundsMin, boundsMax);
+ * }
+ * @endcode
+ */
+class VertexQuantization {
+  public:
+    /// Largest vertex count addressable by a 16-bit index buffer
+    static constexpr size_t MAX_16BIT_VERTICES = 65536;
+
+    /**
+     * @brief Check whether vertices survive quantization.
+     * @return true if all positions are finite and all colors and
+     *         texture coordinates lie in [0, 1]
+     */
+    static bool canCompact(std::span<const Vertex> vertices);
+
+    /**
+     * @brief Quantize vertices relative to the given bounds.
+     *
+     * Out-of-range values are clamped; axes with zero extent store 0.
+     */
+    static std::vector<CompactVertex> compact(std::span<const Vertex> vertices,
+                                              const glm::vec3& boundsMin,
+                                              const glm::vec3& boundsMax);
+
+    /**
+     * @brief Reconstruct vertices as the compact vertex shader sees them.
+     */
+    static std::vector<Vertex> expand(std::span<const CompactVertex> vertices,
+                                      const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+    /**
+     * @brief Check whether a mesh can use a 16-bit index buffer.
+     */
+    static bool canUse16BitIndices(size_t vertexCount) {
+        return vertexCount <= MAX_16BIT_VERTICES;
+    }
+
+    /**
+     * @brief Narrow indices to 16 bits (caller checks canUse16BitIndices()).
+     */
+    static std::vector<uint16_t> narrowIndices(std::span<const uint32_t> indices);
+};
+
+}  // namespace vde
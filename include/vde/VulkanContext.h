@@ -16,8 +16,12 @@
  * rendering logic (pipelines, vertex buffers, descriptor sets, etc.)
  */
 
+#include <vde/BindlessTextureTable.h>
 #include <vde/Camera.h>
 #include <vde/DescriptorManager.h>
+#include <vde/FrameAllocator.h>
+#include <vde/FrameContext.h>
+#include <vde/PipelineDiskCache.h>
 #include <vde/QueueFamilyIndices.h>
 #include <vde/SwapChainSupportDetails.h>
 #include <vde/UniformBuffer.h>
@@ -25,12 +29,15 @@
 #include <glm/glm.hpp>
 #include <vulkan/vulkan.h>
 
+#include <algorithm>
 #include <functional>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace vde {
 
+class ThreadPool;
 class Window;
 
 /**
@@ -51,7 +58,7 @@ using RenderCallback = std::function<void(VkCommandBuffer)>;
  * - Swap chain creation and recreation
  * - Render pass and framebuffer management
  * - Command buffer recording and submission
- * - Frame synchronization (semaphores, fences)
+ * - Frame synchronization (per-frame FrameContexts paced by a timeline semaphore)
  *
  * Usage:
  * @code
@@ -87,6 +94,19 @@ class VulkanContext {
      */
     virtual void initialize(Window* window);
 
+    /**
+     * @brief Set how many frames the CPU may record ahead of the GPU.
+     *
+     * Two frames give the lowest latency; three keep the GPU fed when CPU
+     * frame times vary.  Takes effect at the next initialize().
+     *
+     * @param framesInFlight Clamped to [MIN_FRAMES_IN_FLIGHT, MAX_FRAMES_IN_FLIGHT]
+     */
+    void setFramesInFlight(uint32_t framesInFlight) {
+        m_framesInFlight = FramePacer::clampFrameCount(framesInFlight);
+    }
+    uint32_t getFramesInFlight() const { return m_framesInFlight; }
+
     /**
      * @brief Clean up all Vulkan resources.
      *
@@ -115,19 +135,47 @@ class VulkanContext {
     VkQueue getGraphicsQueue() const { return m_graphicsQueue; }
     VkQueue getPresentQueue() const { return m_presentQueue; }
     uint32_t getGraphicsQueueFamily() const { return m_graphicsQueueFamilyIndex; }
+    VkQueue getTransferQueue() const { return m_transferQueue; }
+    uint32_t getTransferQueueFamily() const { return m_transferQueueFamilyIndex; }
+    bool isTimelineSemaphoreSupported() const { return m_timelineSemaphoreSupported; }
+    bool isDescriptorIndexingSupported() const { return m_descriptorIndexingSupported; }
+    bool isMemoryBudgetSupported() const { return m_memoryBudgetSupported; }
+    bool isFillModeNonSolidSupported() const { return m_fillModeNonSolidSupported; }
     VkRenderPass getRenderPass() const { return m_renderPass; }
     VkCommandPool getCommandPool() const { return m_commandPool; }
     VkExtent2D getSwapChainExtent() const { return m_swapChainExtent; }
-    uint32_t getCurrentFrame() const { return m_currentFrame; }
+    uint32_t getCurrentFrame() const { return m_framePacer.getCurrentSlot(); }
 
-    const std::vector<VkCommandBuffer>& getCommandBuffers() const { return m_commandBuffers; }
-    const std::vector<VkSemaphore>& getImageAvailableSemaphores() const {
-        return m_imageAvailableSemaphores;
+    /**
+     * @brief Resources of every frame in flight, indexed by frame.
+     */
+    const std::vector<FrameContext>& getFrameContexts() const { return m_frames; }
+
+    /**
+     * @brief Resources of the frame being recorded.
+     */
+    FrameContext& getCurrentFrameContext() { return m_frames[getCurrentFrame()]; }
+    const FrameContext& getCurrentFrameContext() const { return m_frames[getCurrentFrame()]; }
+
+    /**
+     * @brief Forget every frame's cached descriptor sets (e.g. before their pool is destroyed).
+     */
+    void clearFrameDescriptorCaches() {
+        for (FrameContext& frame : m_frames) {
+            frame.descriptorCache.clear();
+        }
     }
+
+    /**
+     * @brief Timeline semaphore signalled with FramePacer values by each frame's
+     *        submission (VK_NULL_HANDLE without timeline semaphore support).
+     */
+    VkSemaphore getFrameTimelineSemaphore() const { return m_frameTimeline; }
+    const FramePacer& getFramePacer() const { return m_framePacer; }
+
     const std::vector<VkSemaphore>& getRenderFinishedSemaphores() const {
         return m_renderFinishedSemaphores;
     }
-    const std::vector<VkFence>& getInFlightFences() const { return m_inFlightFences; }
 
     Camera& getCamera() { return m_camera; }
     const Camera& getCamera() const { return m_camera; }
@@ -135,6 +183,23 @@ class VulkanContext {
     DescriptorManager& getDescriptorManager() { return m_descriptorManager; }
     const DescriptorManager& getDescriptorManager() const { return m_descriptorManager; }
 
+    /**
+     * @brief Get the bindless texture table.
+     *
+     * Only initialized when isDescriptorIndexingSupported() is true;
+     * otherwise textures must be bound through per-texture descriptor sets.
+     */
+    BindlessTextureTable& getBindlessTextures() { return m_bindlessTextures; }
+
+    /**
+     * @brief Pipeline cache to pass to every vkCreate*Pipelines call.
+     *
+     * Loaded from PipelineDiskCache::DEFAULT_PATH at initialize() and saved
+     * back in cleanup().
+     */
+    VkPipelineCache getPipelineCache() const { return m_pipelineCache.getHandle(); }
+    PipelineDiskCache& getPipelineDiskCache() { return m_pipelineCache; }
+
     /**
      * @brief Get the current frame's command buffer.
      * @return Command buffer for current frame, or VK_NULL_HANDLE if none
@@ -149,14 +214,79 @@ class VulkanContext {
 
     /**
      * @brief Get the current frame's UBO descriptor set.
+     *
+     * The UBO binding is a dynamic uniform buffer; bind it with
+     * getCurrentUBOOffset() as its dynamic offset.
+     *
      * @return Descriptor set for current frame's uniform buffer
      */
     VkDescriptorSet getCurrentUBODescriptorSet() const {
-        if (m_uboDescriptorSets.empty())
+        if (m_frames.empty())
             return VK_NULL_HANDLE;
-        return m_uboDescriptorSets[m_currentFrame];
+        return getCurrentFrameContext().uboDescriptorSet;
+    }
+
+    /// Views (camera slots) per frame; drawFrameMultiScene() takes at most this many scenes
+    static constexpr uint32_t MAX_VIEWS = 8;
+
+    /**
+     * @brief Select the view whose camera slot draws are recorded against.
+     *
+     * drawFrameMultiScene() selects each scene's view before its callback
+     * runs; set it yourself when recording a view's draws ahead of time.
+     */
+    void setCurrentView(uint32_t view) { m_currentView = std::min(view, MAX_VIEWS - 1); }
+    uint32_t getCurrentView() const { return m_currentView; }
+
+    /**
+     * @brief Dynamic offset of the current view's slot in the UBO.
+     */
+    uint32_t getCurrentUBOOffset() const {
+        return static_cast<uint32_t>(m_currentView * m_uboStride);
     }
 
+    /**
+     * @brief Device alignment for dynamic uniform buffer offsets.
+     */
+    VkDeviceSize getMinUniformBufferOffsetAlignment() const {
+        return m_minUniformBufferOffsetAlignment;
+    }
+
+    /**
+     * @brief Device alignment for dynamic storage buffer offsets.
+     */
+    VkDeviceSize getMinStorageBufferOffsetAlignment() const {
+        return m_minStorageBufferOffsetAlignment;
+    }
+
+    /**
+     * @brief Per-frame linear allocator for transient uniform/storage data.
+     *
+     * Allocations stay valid until this frame slot comes round again;
+     * bind them with their offset as a dynamic offset.
+     */
+    FrameAllocator& getFrameAllocator() { return m_frameAllocator; }
+    const FrameAllocator& getFrameAllocator() const { return m_frameAllocator; }
+
+    /**
+     * @brief Wait until the GPU has finished with the current frame slot.
+     *
+     * Recycles the slot's FrameAllocator memory.  drawFrame() and
+     * drawFrameMultiScene() call this themselves; call it earlier to write
+     * per-frame buffers (or allocate transient data) before drawing.
+     * Only the first call per frame waits.
+     */
+    void waitForCurrentFrame();
+
+    /**
+     * @brief Upload byte counts for the frame being recorded.
+     *
+     * Reset by waitForCurrentFrame(); code that writes other per-frame
+     * buffers (such as Game's lighting) adds its own counts.
+     */
+    FrameUploadStats& getUploadStats() { return m_uploadStats; }
+    const FrameUploadStats& getUploadStats() const { return m_uploadStats; }
+
     // =========================================================================
     // Rendering
     // =========================================================================
@@ -180,11 +310,14 @@ class VulkanContext {
     virtual void drawFrame();
 
     /**
-     * @brief Draw a frame with per-scene rendering passes.
+     * @brief Draw a frame with one view per scene.
      *
      * This supports multi-viewport rendering where each scene has its own
-     * camera and viewport.  Each scene gets its own render pass with
-     * appropriate UBO (view/projection) updates between passes.
+     * camera and viewport.  Scene i is view i: its camera is written to
+     * slot i of the frame's UBO and selected by dynamic offset, so every
+     * scene is recorded in a single render pass with only viewport and
+     * scissor changes between them.  A new pass is started only to switch
+     * between secondary command buffers and inline commands.
      *
      * @param sceneRenderInfos Vector of per-scene render data
      */
@@ -199,11 +332,37 @@ class VulkanContext {
         VkRect2D scissor;
         /// Render callback for this scene
         RenderCallback renderCallback;
+        /// Optional recorders executed before renderCallback.  With a
+        /// recording thread pool each one records its own secondary command
+        /// buffer on a worker thread; otherwise they run inline.  Recorders
+        /// must set their own viewport/scissor and be thread-safe.
+        std::vector<RenderCallback> secondaryRecorders;
         /// Whether this is the first scene (uses CLEAR; others use LOAD)
         bool clearPass = false;
+        /// Version of the camera the matrices came from (see Camera::getVersion());
+        /// the view's UBO slot is only rewritten when it changes.  0 always writes.
+        uint64_t cameraVersion = 0;
     };
+    /// @throws std::runtime_error if given more than MAX_VIEWS scenes
     void drawFrameMultiScene(const std::vector<SceneRenderInfo>& sceneRenderInfos);
 
+    /**
+     * @brief Set the thread pool used to record secondary command buffers.
+     *
+     * When set (and the pool has worker threads), drawFrameMultiScene()
+     * records every SceneRenderInfo::secondaryRecorders entry in parallel,
+     * each into a secondary command buffer from its own command pool, and
+     * executes them in order from the primary buffer.
+     *
+     * @param pool Thread pool (not owned), or nullptr to record inline
+     */
+    void setRecordingThreadPool(ThreadPool* pool) { m_recordingThreadPool = pool; }
+
+    /**
+     * @brief Get the thread pool used for secondary command buffer recording.
+     */
+    ThreadPool* getRecordingThreadPool() const { return m_recordingThreadPool; }
+
     // =========================================================================
     // Viewport Override
     // =========================================================================
@@ -281,6 +440,14 @@ class VulkanContext {
      */
     VkShaderModule createShaderModule(const std::vector<char>& code);
 
+    /**
+     * @brief Create a shader module from SPIR-V words (e.g. from ShaderBundle).
+     * @param code SPIR-V words
+     * @return Shader module handle
+     * @throws std::runtime_error if creation fails
+     */
+    VkShaderModule createShaderModule(std::span<const uint32_t> code);
+
   protected:
     // Protected for testing subclasses
     struct MockTag {};  ///< Tag for test constructor
@@ -298,6 +465,13 @@ class VulkanContext {
     VkQueue m_graphicsQueue = VK_NULL_HANDLE;
     VkQueue m_presentQueue = VK_NULL_HANDLE;
     uint32_t m_graphicsQueueFamilyIndex = 0;
+    bool m_memoryBudgetSupported = false;  ///< VK_EXT_memory_budget enabled on m_device
+    VkQueue m_transferQueue = VK_NULL_HANDLE;  ///< Upload queue (graphics queue if no DMA family)
+    uint32_t m_transferQueueFamilyIndex = 0;
+    bool m_timelineSemaphoreSupported = false;  ///< timelineSemaphore feature enabled
+    bool m_descriptorIndexingSupported = false;  ///< Bindless descriptor features enabled
+    bool m_fillModeNonSolidSupported = false;    ///< Line polygon mode (wireframe) enabled
+    uint32_t m_maxBindlessTextures = 0;
 
     Window* m_window = nullptr;
 
@@ -315,29 +489,39 @@ class VulkanContext {
 
     // Descriptor management
     DescriptorManager m_descriptorManager;
+    BindlessTextureTable m_bindlessTextures;
+    PipelineDiskCache m_pipelineCache;
 
-    // Uniform buffers
+    // Uniform buffers: MAX_VIEWS camera slots of m_uboStride bytes per frame
     UniformBuffer m_uniformBuffer;
-    std::vector<VkDescriptorSet> m_uboDescriptorSets;
+    VkDeviceSize m_uboStride = 0;
+    VkDeviceSize m_minUniformBufferOffsetAlignment = 256;
+    VkDeviceSize m_minStorageBufferOffsetAlignment = 256;
+    uint32_t m_currentView = 0;
+
+    // Transient per-frame data, recycled by waitForCurrentFrame()
+    FrameAllocator m_frameAllocator;
+    FrameUploadStats m_uploadStats;
 
     // Camera
     Camera m_camera;
 
-    // Command pool and buffers
+    // Command pool for primary buffers; secondaries use per-slot pools
     VkCommandPool m_commandPool = VK_NULL_HANDLE;
-    std::vector<VkCommandBuffer> m_commandBuffers;
+    ThreadPool* m_recordingThreadPool = nullptr;
+
+    // Frames in flight: command buffers, acquire semaphores, UBO sets and
+    // descriptor caches per frame, rotated and paced by m_framePacer
+    uint32_t m_framesInFlight = DEFAULT_FRAMES_IN_FLIGHT;
+    std::vector<FrameContext> m_frames;
+    FramePacer m_framePacer;
+    VkSemaphore m_frameTimeline = VK_NULL_HANDLE;  // Signalled with FramePacer values
+    bool m_frameWaited = false;  // waitForCurrentFrame() already ran this frame
 
-    // Synchronization
-    // Per-frame semaphores for image acquisition
-    std::vector<VkSemaphore> m_imageAvailableSemaphores;
     // Per-swapchain-image semaphores for render completion
     std::vector<VkSemaphore> m_renderFinishedSemaphores;
-    std::vector<VkFence> m_inFlightFences;
-    std::vector<VkFence>
-        m_imagesInFlight;  // Track which fence is associated with each swapchain image
-    uint32_t m_currentFrame = 0;
-
-    static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
+    // FramePacer value of the submission that last rendered each swapchain image
+    std::vector<uint64_t> m_imageFrameValues;
 
     // Timing
     double m_startTime = 0.0;
@@ -419,13 +603,19 @@ class VulkanContext {
 
     void createDescriptorSetLayouts();
     void createUniformBuffers();
-    void updateUniformBuffer(uint32_t currentFrame);
+    void updateUniformBuffer();
+    void writeCameraSlot(uint32_t view, const glm::mat4& viewMatrix, const glm::mat4& projMatrix,
+                         uint64_t cameraVersion);
 
     void createCommandPool();
     void createCommandBuffers();
     void recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+    void submitFrameCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+    VkCommandBuffer acquireSecondaryCommandBuffer(uint32_t slot);
+    void destroySecondaryCommandBuffers();
 
     void createSyncObjects();
+    void waitForFrameValue(uint64_t value);
 
     void cleanupSwapChain();
 };
@@ -19,6 +19,8 @@ namespace vde {
 // Forward declarations
 class Scene;
 class Mesh;
+class VulkanContext;
+struct RenderCommand;
 class Material;
 class Texture;
 
@@ -138,6 +140,13 @@ class Entity {
     virtual void render() {}
 
   protected:
+    /**
+     * @brief Hand a draw to the scene's render queue.
+     *
+     * Records it immediately when the queue is not collecting.
+     */
+    void submitRenderCommand(VulkanContext* context, const RenderCommand& command);
+
     EntityId m_id;
     std::string m_name;
     Transform m_transform;
@@ -232,6 +241,133 @@ class MeshEntity : public Entity {
      */
     bool hasMaterial() const { return m_material != nullptr; }
 
+    /**
+     * @brief Mark the entity as static scenery for Scene::buildStaticBatches().
+     *
+     * Entities with a black albedo fall back to vertex colors in the mesh
+     * shader and are never batched; they keep drawing individually.
+     */
+    void setStatic(bool isStatic) { m_static = isStatic; }
+
+    /**
+     * @brief Check whether the entity is marked static.
+     */
+    bool isStatic() const { return m_static; }
+
+    /**
+     * @brief Check whether the entity is drawn as part of a StaticBatch chunk.
+     *
+     * Batched entities stay in the scene but do not draw themselves.
+     */
+    bool isStaticBatched() const { return m_staticBatched; }
+
+    /**
+     * @brief Draw the mesh's edges as tubes instead of its faces.
+     *
+     * Each unique edge is one instance of a shared unit tube (see
+     * Mesh::createEdgeTube()), so no tube geometry is generated and the
+     * cost scales with the edge count alone.  Wireframe entities are not
+     * merged by Scene::buildStaticBatches().
+     */
+    void setWireframe(bool wireframe) { m_wireframe = wireframe; }
+
+    /**
+     * @brief Check whether the entity draws as a wireframe.
+     */
+    bool isWireframe() const { return m_wireframe; }
+
+    /**
+     * @brief Set the diameter of the wireframe tubes in object space.
+     */
+    void setWireframeThickness(float thickness) { m_wireframeThickness = thickness; }
+
+    /**
+     * @brief Get the diameter of the wireframe tubes.
+     */
+    float getWireframeThickness() const { return m_wireframeThickness; }
+
+    /**
+     * @brief Enable or disable level-of-detail selection (enabled by default).
+     *
+     * When enabled and the mesh has levels (Mesh::generateLODs()), each
+     * frame draws the level matching the mesh's projected size.
+     */
+    void setLODEnabled(bool enabled) { m_lodEnabled = enabled; }
+
+    /**
+     * @brief Check whether level-of-detail selection is enabled.
+     */
+    bool isLODEnabled() const { return m_lodEnabled; }
+
+    /**
+     * @brief Set the projected size below which LOD 1 is drawn.
+     *
+     * Sizes are the bounding sphere's projected diameter as a fraction of
+     * the viewport height; each further level starts at half the size of
+     * the previous one.
+     */
+    void setLODThreshold(float screenSize) { m_lodThreshold = screenSize; }
+
+    /**
+     * @brief Get the projected size below which LOD 1 is drawn.
+     */
+    float getLODThreshold() const { return m_lodThreshold; }
+
+    /**
+     * @brief Set the relative dead band around each threshold that prevents
+     * popping back and forth at a boundary.
+     */
+    void setLODHysteresis(float hysteresis) { m_lodHysteresis = hysteresis; }
+
+    /**
+     * @brief Get the LOD hysteresis.
+     */
+    float getLODHysteresis() const { return m_lodHysteresis; }
+
+    /**
+     * @brief Get the level drawn in the last frame.
+     */
+    size_t getCurrentLOD() const { return m_currentLOD; }
+
+    /**
+     * @brief Get the number of triangles drawn in the last frame.
+     */
+    size_t getRenderedTriangleCount() const { return m_renderedTriangles; }
+
+    /**
+     * @brief Projected diameter of a bounding sphere as a fraction of the viewport height.
+     * @param radius World-space sphere radius
+     * @param distance Distance from the camera to the sphere centre
+     * @param fovY Vertical field of view in degrees
+     */
+    static float computeScreenSize(float radius, float distance, float fovY);
+
+    /**
+     * @brief Choose a level of detail for a projected size.
+     *
+     * Level l is ideal below threshold / 2^(l-1).  A switch to a coarser
+     * level needs the size to drop a further `hysteresis` fraction below
+     * its boundary, and a switch back needs it to rise the same fraction
+     * above, so a mesh sitting on a boundary keeps its current level.
+     *
+     * @param screenSize Result of computeScreenSize()
+     * @param currentLOD Level drawn in the previous frame
+     * @param lodCount Number of available levels
+     * @return The level to draw
+     */
+    static size_t selectLOD(float screenSize, size_t currentLOD, size_t lodCount,
+                            float threshold = DEFAULT_LOD_THRESHOLD,
+                            float hysteresis = DEFAULT_LOD_HYSTERESIS);
+
+    /// Default projected size below which LOD 1 is drawn
+    static constexpr float DEFAULT_LOD_THRESHOLD = 0.25f;
+
+    /// Default relative dead band around LOD thresholds
+    static constexpr float DEFAULT_LOD_HYSTERESIS = 0.1f;
+
+    /// Default wireframe tube diameter (matches Mesh::createWireframe())
+    static constexpr float DEFAULT_WIREFRAME_THICKNESS = 0.015f;
+
     void render() override;
 
   protected:
@@ -245,6 +381,22 @@ class MeshEntity : public Entity {
     ResourceId m_textureId = INVALID_RESOURCE_ID;
 
     Color m_color = Color::white();
+
+    // Static batching (m_staticBatched is managed by StaticBatch)
+    bool m_static = false;
+    bool m_staticBatched = false;
+    friend class StaticBatch;
+
+    // Instanced wireframe
+    bool m_wireframe = false;
+    float m_wireframeThickness = DEFAULT_WIREFRAME_THICKNESS;
+
+    // Level of detail
+    bool m_lodEnabled = true;
+    float m_lodThreshold = DEFAULT_LOD_THRESHOLD;
+    float m_lodHysteresis = DEFAULT_LOD_HYSTERESIS;
+    size_t m_currentLOD = 0;
+    size_t m_renderedTriangles = 0;
 };
 
 /**
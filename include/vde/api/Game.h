@@ -8,10 +8,17 @@
  * scenes, input, and all engine subsystems.
  */
 
+#include <vde/GpuAllocator.h>
+#include <vde/LightClusters.h>
+#include <vde/PipelineCache.h>
 #include <vde/Texture.h>
+#include <vde/Types.h>
 
 #include <vulkan/vulkan.h>
 
+#include <array>
+#include <chrono>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <string>
@@ -24,6 +31,7 @@
 #include "Scene.h"
 #include "SceneGroup.h"
 #include "Scheduler.h"
+#include "ThreadPool.h"
 #include "ViewportRect.h"
 
 namespace vde {
@@ -31,6 +39,7 @@ namespace vde {
 // Forward declarations
 class Window;
 class VulkanContext;
+class Material;
 
 /**
  * @brief Main game class that manages the game loop and scenes.
@@ -256,6 +265,20 @@ class Game {
      */
     uint64_t getFrameCount() const { return m_frameCount; }
 
+    /**
+     * @brief Get the time from the start of initialize() to the end of the first frame.
+     * @return Milliseconds, or 0 before the first frame has been rendered
+     */
+    double getTimeToFirstFrameMs() const { return m_timeToFirstFrameMs; }
+
+    /**
+     * @brief Get render queue statistics for the last rendered frame.
+     *
+     * Summed over every scene rendered in the frame; compare
+     * getBindsIssued() with getBindsSkipped() to gauge state sorting.
+     */
+    const RenderQueueStats& getRenderStats() const { return m_renderStats; }
+
     // Window access
 
     /**
@@ -300,6 +323,15 @@ class Game {
      */
     void applyGraphicsSettings(const GraphicsSettings& settings);
 
+    /**
+     * @brief Apply new debug settings.
+     *
+     * Toggling DebugSettings::wireframe takes effect without a stall: the
+     * wireframe pipelines are compiled in the background and meshes keep
+     * drawing filled until they are ready.
+     */
+    void applyDebugSettings(const DebugSettings& settings);
+
     // Events/callbacks
 
     /**
@@ -316,14 +348,59 @@ class Game {
 
     /**
      * @brief Get the mesh rendering pipeline.
+     *
+     * Selects the variant for the material (alpha blended when transparent),
+     * for DebugSettings::wireframe and for the mesh's vertex layout.  Falls
+     * back to the base pipeline of that layout while a variant is still
+     * compiling.
+     *
+     * @param material Material being drawn, or nullptr for the default
+     * @param format Mesh::getGPUVertexFormat() of the mesh being drawn
+     */
+    VkPipeline getMeshPipeline(const Material* material = nullptr,
+                               VertexFormat format = VertexFormat::Full);
+
+    /**
+     * @brief Get the instanced wireframe edge pipeline.
+     *
+     * Draws Mesh::createEdgeTube() once per EdgeInstance bound at binding 1,
+     * using the mesh pipeline layout and per-draw data (see
+     * MeshEntity::setWireframe()).
      */
-    VkPipeline getMeshPipeline() const { return m_meshPipeline; }
+    VkPipeline getMeshEdgePipeline() const { return m_meshEdgePipeline; }
+
+    /**
+     * @brief Get the instanced hex prism pipeline.
+     *
+     * Draws a shared hex prism once per HexPrismInstance bound at binding 1,
+     * using the mesh pipeline layout and per-draw data (see HexMapEntity).
+     */
+    VkPipeline getHexPrismPipeline() const { return m_hexPrismPipeline; }
 
     /**
      * @brief Get the mesh pipeline layout.
+     *
+     * Set 0: camera UBO, set 1: lighting, set 2: per-draw DrawUBO.  All
+     * three use one dynamic offset each.
      */
     VkPipelineLayout getMeshPipelineLayout() const { return m_meshPipelineLayout; }
 
+    /**
+     * @brief Copy a mesh draw's DrawUBO into the current frame's allocator.
+     *
+     * Bind the returned set as set 2 of the mesh pipeline layout with
+     * @p offset as its dynamic offset.  The data is recycled with the frame
+     * slot, so push it again every frame the draw is recorded.
+     *
+     * @param data Per-draw model and material data
+     * @param offset Receives the dynamic offset of the data
+     * @return The current frame's draw set, or VK_NULL_HANDLE if the frame
+     *         allocator is out of space (skip the draw).  Skipped draws are
+     *         counted in FrameUploadStats::drawsDropped and the first one in
+     *         a frame is logged.
+     */
+    VkDescriptorSet pushDrawData(const DrawUBO& data, uint32_t& offset);
+
     /**
      * @brief Get the sprite rendering pipeline.
      */
@@ -339,6 +416,11 @@ class Game {
      */
     VkSampler getSpriteSampler() const { return m_spriteSampler; }
 
+    /**
+     * @brief Get the cache of pipeline variants.
+     */
+    PipelineCache& getPipelineCache() { return m_pipelineCache; }
+
     /**
      * @brief Get the default white texture for sprites without textures.
      */
@@ -351,8 +433,20 @@ class Game {
         return m_spriteDescriptorSetLayout;
     }
 
+    /**
+     * @brief Check whether sprites sample textures through the bindless table.
+     *
+     * When true, the sprite descriptor set holds only the UBO (set 0), the
+     * bindless table is bound as set 1 and the texture index follows the
+     * model/tint/uvRect push constants.  Otherwise each texture needs its
+     * own set from allocateSpriteDescriptorSet().
+     */
+    bool isSpriteBindless() const { return m_spriteBindless; }
+
     /**
      * @brief Allocate a sprite descriptor set with both UBO and texture.
+     *
+     * In bindless mode the set contains only the UBO binding.
      */
     VkDescriptorSet allocateSpriteDescriptorSet();
 
@@ -360,8 +454,8 @@ class Game {
      * @brief Update a sprite descriptor set with UBO and texture bindings.
      * @param descriptorSet The descriptor set to update
      * @param uboBuffer The uniform buffer for view/projection matrices
-     * @param uboSize Size of the UBO
-     * @param imageView The texture image view
+     * @param uboSize Size of one view's UBO (the binding is dynamic)
+     * @param imageView The texture image view (ignored in bindless mode)
      * @param sampler The texture sampler
      */
     void updateSpriteDescriptor(VkDescriptorSet descriptorSet, VkBuffer uboBuffer,
@@ -379,15 +473,41 @@ class Game {
     }
 
     /**
-     * @brief Get the current frame's lighting descriptor set.
+     * @brief Get the lighting descriptor set of the current frame and view.
+     *
+     * Each frame in flight has one persistent lighting region per view; the
+     * set points at the current one.  VK_NULL_HANDLE until
+     * updateLightingUBO() has run for the view.
      */
     VkDescriptorSet getCurrentLightingDescriptorSet() const;
 
     /**
-     * @brief Update the lighting UBO with scene lighting data.
-     * @param scene Scene containing LightBox to upload
+     * @brief Update a view's lighting region with scene lighting data.
+     *
+     * Called once per view each frame, before the view's draws are recorded.
+     * Point and spot lights are binned into the clusters of the current
+     * VulkanContext camera's frustum (see LightClusterGrid).  The region
+     * belongs to the current frame slot, so this first waits for the GPU to
+     * release that slot.
+     *
+     * The packed lights are cached per view and rebuilt only when the
+     * LightBox version changes; the clusters are rebinned only when the
+     * lights or the view's camera version change.  Each frame slot's region
+     * remembers which lights and clusters it holds and is rewritten only
+     * when they are stale, so an unchanged view writes nothing.  Byte
+     * counts go to VulkanContext::getUploadStats().
+     *
+     * @param scene Scene containing LightBox to upload (nullptr for default lighting)
+     * @param view View slot (< VulkanContext::MAX_VIEWS)
+     * @param viewport The view's viewport (cluster tiles are relative to it)
      */
-    void updateLightingUBO(const Scene* scene);
+    void updateLightingUBO(const Scene* scene, uint32_t view, const VkViewport& viewport);
+
+    /**
+     * @brief Get the light clusters last built for a view.
+     * @return An empty grid if the view has no lighting yet
+     */
+    const LightClusterGrid& getLightClusters(uint32_t view = 0) const;
 
   protected:
     // Virtual methods for subclassing
@@ -416,6 +536,7 @@ class Game {
     // Initialization
     bool m_initialized = false;
     bool m_running = false;
+    bool m_glslangInitialized = false;  // Only needed when shaders aren't embedded
     GameSettings m_settings;
 
     // Core systems
@@ -423,17 +544,36 @@ class Game {
     std::unique_ptr<VulkanContext> m_vulkanContext;
     ResourceManager m_resourceManager;
 
+    // Pipeline variants, created on first use (owns every pipeline below)
+    PipelineCache m_pipelineCache;
+
     // Rendering infrastructure (Phase 2)
     VkPipelineLayout m_meshPipelineLayout = VK_NULL_HANDLE;
     VkPipeline m_meshPipeline = VK_NULL_HANDLE;
+    VkPipeline m_meshCompactPipeline = VK_NULL_HANDLE;
+    VkPipeline m_meshEdgePipeline = VK_NULL_HANDLE;
+    VkPipeline m_hexPrismPipeline = VK_NULL_HANDLE;
     VkDescriptorSetLayout m_meshDescriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorSetLayout m_drawDescriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_drawDescriptorPool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> m_drawDescriptorSets;  // One per frame-in-flight
+    VkShaderModule m_meshVertShader = VK_NULL_HANDLE;
+    VkShaderModule m_meshCompactVertShader = VK_NULL_HANDLE;
+    VkShaderModule m_meshEdgeVertShader = VK_NULL_HANDLE;
+    VkShaderModule m_hexPrismVertShader = VK_NULL_HANDLE;
+    VkShaderModule m_meshFragShader = VK_NULL_HANDLE;
+    /// [compact * 4 + wireframe * 2 + transparent]
+    std::array<PipelineState, 8> m_meshVariants;
 
     // Sprite rendering infrastructure (Phase 3)
     VkPipelineLayout m_spritePipelineLayout = VK_NULL_HANDLE;
     VkPipeline m_spritePipeline = VK_NULL_HANDLE;
     VkDescriptorSetLayout m_spriteDescriptorSetLayout = VK_NULL_HANDLE;
+    VkShaderModule m_spriteVertShader = VK_NULL_HANDLE;
+    VkShaderModule m_spriteFragShader = VK_NULL_HANDLE;
     VkSampler m_spriteSampler = VK_NULL_HANDLE;
     VkDescriptorPool m_spriteDescriptorPool = VK_NULL_HANDLE;
+    bool m_spriteBindless = false;  // Textures indexed from the bindless table
     std::unique_ptr<Texture> m_defaultWhiteTexture;  // 1x1 white texture for untextured sprites
 
     // Scene management
@@ -450,10 +590,33 @@ class Game {
     // Lighting infrastructure (Phase 4)
     VkDescriptorSetLayout m_lightingDescriptorSetLayout = VK_NULL_HANDLE;
     VkDescriptorPool m_lightingDescriptorPool = VK_NULL_HANDLE;
-    std::vector<VkDescriptorSet> m_lightingDescriptorSets;  // One per frame-in-flight
-    std::vector<VkBuffer> m_lightingUBOBuffers;             // One per frame-in-flight
-    std::vector<VkDeviceMemory> m_lightingUBOMemory;        // One per frame-in-flight
-    std::vector<void*> m_lightingUBOMapped;                 // Persistently mapped pointers
+
+    // Per-view lighting, reused while the LightBox and camera are unchanged
+    struct ViewLighting {
+        std::vector<GPULight> lights;  // Directional first
+        uint32_t directionalCount = 0;
+        glm::vec4 ambient{0.0f};
+        glm::vec4 viewport{0.0f};
+        bool packed = false;
+        uint64_t lightBoxVersion = 0;  // 0: default lighting (no scene)
+        uint64_t cameraVersion = 0;    // 0: not binned yet
+        uint64_t lightsVersion = 0;    // Bumped when the lights are repacked
+        uint64_t clustersVersion = 0;  // Bumped when the clusters or UBO change
+        LightClusterGrid clusters;
+    };
+    std::vector<ViewLighting> m_viewLighting;  // One per view
+
+    // Persistent lighting buffer of one frame slot and view:
+    // [LightingUBO | lights | cluster ranges + light indices]
+    struct LightingRegion {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        GpuAllocation allocation;
+        VkDeviceSize capacity = 0;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        uint64_t lightsVersion = 0;    // ViewLighting versions last written (0: none)
+        uint64_t clustersVersion = 0;
+    };
+    std::vector<LightingRegion> m_lightingRegions;  // [frame * MAX_VIEWS + view]
 
     // Scheduler
     Scheduler m_scheduler;
@@ -469,6 +632,16 @@ class Game {
     double m_lastFrameTime = 0.0;
     double m_fpsAccumulator = 0.0;
     int m_fpsFrameCount = 0;
+    std::chrono::steady_clock::time_point m_initializeStart;
+    double m_timeToFirstFrameMs = 0.0;
+
+    // Render statistics (last frame)
+    RenderQueueStats m_renderStats;
+
+    // Parallel command recording (GraphicsSettings::renderThreads > 0)
+    std::unique_ptr<ThreadPool> m_renderThreadPool;
+    std::vector<Scene*> m_deferredScenes;        ///< Scenes whose queues are recorded this frame
+    std::deque<RenderQueueStats> m_recordStats;  ///< One entry per recording chunk
 
     // Callbacks
     std::function<void(uint32_t, uint32_t)> m_resizeCallback;
@@ -478,17 +651,26 @@ class Game {
     void processInput();
     void pollGamepads();
     void updateTiming();
+    void logTimeToFirstFrame();
     void processPendingSceneChange();
     void setupInputCallbacks();
+    VkShaderModule createBuiltinShaderModule(const std::string& name);
     void createMeshRenderingPipeline();
+    void createDrawDescriptorSets();
     void destroyMeshRenderingPipeline();
+    void prewarmMeshVariants();
     void createSpriteRenderingPipeline();
     void destroySpriteRenderingPipeline();
     void createLightingResources();
+    LightingRegion* getCurrentLightingRegion();
+    bool reserveLightingRegion(LightingRegion& region, VkDeviceSize size);
     void destroyLightingResources();
     void rebuildSchedulerGraph();
     void renderSingleViewport();
     void renderMultiViewport();
+    void prepareDeferredScene(Scene* scene, const VkViewport& viewport, const VkRect2D& scissor,
+                              std::vector<std::function<void(VkCommandBuffer)>>& recorders);
+    void finishDeferredScenes();
 };
 
 }  // namespace vde
@@ -27,12 +27,15 @@
 // Scene and entity system
 #include "AudioEvent.h"
 #include "Entity.h"
+#include "HexMapEntity.h"
 #include "PhysicsEntity.h"
 #include "PhysicsScene.h"
 #include "PhysicsTypes.h"
+#include "RenderQueue.h"
 #include "Resource.h"
 #include "Scene.h"
 #include "SceneGroup.h"
+#include "StaticBatch.h"
 #include "ViewportRect.h"
 
 // Input handling
@@ -75,6 +75,14 @@ class GameCamera {
      */
     glm::mat4 getViewProjectionMatrix() const { return m_camera.getViewProjectionMatrix(); }
 
+    /**
+     * @brief Change counter for the matrices (see Camera::getVersion()).
+     *
+     * Every camera type derives its matrices from the wrapped Camera, so
+     * its version covers all of them.
+     */
+    uint64_t getVersion() const { return m_camera.getVersion(); }
+
     /**
      * @brief Set the camera's aspect ratio.
      */
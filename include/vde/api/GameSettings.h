@@ -57,6 +57,8 @@ struct GraphicsSettings {
     bool bloom = true;             ///< Enable bloom effect
     bool ambientOcclusion = true;  ///< Enable ambient occlusion
     int maxFPS = 0;                ///< Max frame rate (0 = unlimited)
+    uint32_t renderThreads = 0;    ///< Command recording threads (0 = main thread only)
+    uint32_t framesInFlight = 2;   ///< Frames the CPU runs ahead (2 = latency, 3 = throughput)
 };
 
 /**
@@ -0,0 +1,222 @@
+#pragma once
+
+/**
+ * @file HexMapEntity.h
+ * @brief Instanced, chunked renderer for large hex prism maps
+ *
+ * A hex map of tens of thousands of cells drawn as one MeshEntity per
+ * cell costs one draw and one per-draw data block apiece.  HexMapEntity
+ * draws a single shared prism once per cell through per-instance data
+ * (axial coordinate, height, color), grouped into rectangular chunks so
+ * off-screen parts of the map are culled a chunk at a time.
+ */
+
+#include <vde/GpuAllocator.h>
+#include <vde/HexPrismMesh.h>
+
+#include <vulkan/vulkan.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Entity.h"
+
+namespace vde {
+
+/**
+ * @brief Entity that renders a rectangular hex prism map with instancing.
+ *
+ * Cells are addressed by offset coordinates (column, row) in a flat-top,
+ * odd-q layout: odd columns sit half a hex lower in z.  Each cell stores a
+ * prism height and a color; the entity's transform places the whole map.
+ *
+ * Instances are stored chunk by chunk, so every chunk is one contiguous
+ * range of the instance buffer and draws with a single instanced call.
+ * Changing a cell rewrites only its 12-byte instance slot on the next
+ * frame, never the whole buffer.
+ *
+ * @code
+ * auto map = scene->addEntity<HexMapEntity>();
+ * map->create(256, 256, 1.0f);
+ * map->setCell(10, 20, 2.5f, Color(0.2f, 0.6f, 0.2f));
+ * @endcode
+ */
+class HexMapEntity : public Entity {
+  public:
+    using Ref = std::shared_ptr<HexMapEntity>;
+
+    /// Default chunk edge length, in cells
+    static constexpr uint32_t DEFAULT_CHUNK_SIZE = 32;
+
+    /// Largest map edge (axial coordinates are stored as int16)
+    static constexpr uint32_t MAX_DIMENSION = 32767;
+
+    /**
+     * @brief One instanced draw covering a rectangle of cells.
+     */
+    struct Chunk {
+        uint32_t firstInstance = 0;  ///< First slot in the instance buffer
+        uint32_t instanceCount = 0;  ///< Number of cells in the chunk
+        uint32_t firstColumn = 0;
+        uint32_t firstRow = 0;
+        uint32_t columns = 0;        ///< Width of the chunk in cells
+        glm::vec3 boundsMin{0.0f};   ///< Local-space bounds of every prism in the chunk
+        glm::vec3 boundsMax{0.0f};
+    };
+
+    HexMapEntity() = default;
+    ~HexMapEntity() override;
+
+    HexMapEntity(const HexMapEntity&) = delete;
+    HexMapEntity& operator=(const HexMapEntity&) = delete;
+
+    /**
+     * @brief (Re)build the map with every cell at height 1 and white.
+     * @param columns Number of columns (1..MAX_DIMENSION)
+     * @param rows Number of rows (1..MAX_DIMENSION)
+     * @param hexRadius Prism outer radius (center to corner)
+     * @param chunkSize Chunk edge length in cells
+     * @return false if a dimension is out of range
+     */
+    bool create(uint32_t columns, uint32_t rows, float hexRadius = 1.0f,
+                uint32_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    uint32_t getColumns() const { return m_columns; }
+    uint32_t getRows() const { return m_rows; }
+    float getHexRadius() const { return m_hexRadius; }
+    uint32_t getChunkSize() const { return m_chunkSize; }
+    size_t getCellCount() const { return m_instances.size(); }
+
+    // Cells
+
+    /**
+     * @brief Set a cell's height and color.  Out-of-range cells are ignored.
+     */
+    void setCell(uint32_t column, uint32_t row, float height, const Color& color);
+
+    /**
+     * @brief Set a cell's height, keeping its color.
+     */
+    void setCellHeight(uint32_t column, uint32_t row, float height);
+
+    /**
+     * @brief Set a cell's color, keeping its height.
+     */
+    void setCellColor(uint32_t column, uint32_t row, const Color& color);
+
+    /**
+     * @brief Get a cell's instance data, or nullptr if out of range.
+     */
+    const HexPrismInstance* getCell(uint32_t column, uint32_t row) const;
+
+    /**
+     * @brief Get the instance buffer slot of a cell.
+     * @return The slot, or UINT32_MAX if out of range
+     */
+    uint32_t getInstanceIndex(uint32_t column, uint32_t row) const;
+
+    /**
+     * @brief Get all instances in buffer order.
+     */
+    const std::vector<HexPrismInstance>& getInstances() const { return m_instances; }
+
+    // Layout helpers
+
+    /**
+     * @brief Convert odd-q offset coordinates to axial coordinates.
+     */
+    static glm::ivec2 offsetToAxial(uint32_t column, uint32_t row);
+
+    /**
+     * @brief Local-space center (y = 0) of the cell at an axial coordinate.
+     */
+    static glm::vec3 axialToLocal(int q, int r, float hexRadius);
+
+    // Chunks
+
+    const std::vector<Chunk>& getChunks() const { return m_chunks; }
+    size_t getChunkCount() const { return m_chunks.size(); }
+
+    /**
+     * @brief Number of chunks that passed frustum culling last frame.
+     */
+    size_t getVisibleChunkCount() const { return m_visibleChunks; }
+
+    /**
+     * @brief Size the per-frame instance buffers to the context's frames in flight.
+     *
+     * Called by render() with the frame pacer's slot count.  New slots
+     * start with a full upload pending; dropped slots retire their buffers,
+     * which are freed once the GPU has finished the frames that drew them.
+     */
+    void setFramesInFlight(uint32_t count);
+
+    /**
+     * @brief Number of per-frame instance buffers.
+     */
+    uint32_t getFramesInFlight() const { return static_cast<uint32_t>(m_frames.size()); }
+
+    /**
+     * @brief Number of instance slots waiting to be written for a frame slot.
+     *
+     * A pending full upload reports every cell; a frame slot that does not
+     * exist reports none.
+     */
+    size_t getPendingSlotCount(uint32_t frame) const;
+
+    /**
+     * @brief Copy a frame slot's pending instances into its buffer memory.
+     *
+     * Called by render() on the mapped instance buffer of the current frame;
+     * writes only the changed slots unless a full upload is pending.
+     *
+     * @param frame Frame slot index, below getFramesInFlight()
+     * @param destination Instance array of getCellCount() elements
+     * @return Number of slots written (0 for a frame slot that does not exist)
+     */
+    size_t writePendingInstances(uint32_t frame, HexPrismInstance* destination);
+
+    void render() override;
+
+  private:
+    struct FrameBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        GpuAllocation allocation;
+        std::vector<uint32_t> dirtySlots;
+        bool fullUpload = true;
+    };
+
+    /// An instance buffer that frames still on the GPU may be reading
+    struct RetiredBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        GpuAllocation allocation;
+        uint64_t frameValue = 0;  ///< Frame timeline value after which it is unused
+    };
+
+    uint32_t locate(uint32_t column, uint32_t row, uint32_t& chunkIndex) const;
+    void markDirty(uint32_t slot);
+    void growChunkBounds(Chunk& chunk, float height);
+    VkBuffer syncInstanceBuffer(uint32_t frame);
+    void retireBuffer(FrameBuffer& frame);
+    void freeRetiredBuffers(uint64_t completedValue);
+    void releaseGPUBuffers();
+
+    uint32_t m_columns = 0;
+    uint32_t m_rows = 0;
+    float m_hexRadius = 1.0f;
+    uint32_t m_chunkSize = DEFAULT_CHUNK_SIZE;
+    uint32_t m_chunkColumns = 0;
+
+    std::vector<HexPrismInstance> m_instances;  ///< Chunk-major
+    std::vector<Chunk> m_chunks;
+
+    std::shared_ptr<Mesh> m_prism;
+    std::vector<FrameBuffer> m_frames;  ///< One per frame in flight
+    std::vector<RetiredBuffer> m_retiredBuffers;
+    uint64_t m_lastFrameValue = 0;  ///< Timeline value of the last frame that drew the map
+    size_t m_visibleChunks = 0;
+};
+
+}  // namespace vde
@@ -10,6 +10,7 @@
 
 #include <glm/glm.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -79,15 +80,25 @@ struct Light {
  *
  * A LightBox defines the lighting environment for a scene,
  * including ambient light and individual light sources.
+ *
+ * Every change goes through the LightBox, which bumps getVersion() so the
+ * renderer only repacks the lights when they changed.  Lights are plain
+ * values; edit them through setLight() or the non-const accessors.
  */
 class LightBox {
   public:
+    LightBox();
     virtual ~LightBox() = default;
 
     /**
      * @brief Set the ambient light color.
      */
-    void setAmbientColor(const Color& color) { m_ambientColor = color; }
+    void setAmbientColor(const Color& color) {
+        if (color.toVec4() != m_ambientColor.toVec4()) {
+            m_ambientColor = color;
+            markChanged();
+        }
+    }
 
     /**
      * @brief Get the ambient light color.
@@ -97,7 +108,12 @@ class LightBox {
     /**
      * @brief Set the ambient light intensity.
      */
-    void setAmbientIntensity(float intensity) { m_ambientIntensity = intensity; }
+    void setAmbientIntensity(float intensity) {
+        if (intensity != m_ambientIntensity) {
+            m_ambientIntensity = intensity;
+            markChanged();
+        }
+    }
 
     /**
      * @brief Get the ambient light intensity.
@@ -123,10 +139,22 @@ class LightBox {
 
     /**
      * @brief Get a light by index.
-     */
-    Light& getLight(size_t index) { return m_lights[index]; }
+     *
+     * The non-const overload assumes the light is about to be edited and
+     * bumps the version; call markChanged() if a reference kept from an
+     * earlier frame is edited.
+     */
+    Light& getLight(size_t index) {
+        markChanged();
+        return m_lights[index];
+    }
     const Light& getLight(size_t index) const { return m_lights[index]; }
 
+    /**
+     * @brief Replace a light by index.
+     */
+    void setLight(size_t index, const Light& light);
+
     /**
      * @brief Get the number of lights.
      */
@@ -135,12 +163,31 @@ class LightBox {
     /**
      * @brief Clear all lights.
      */
-    void clearLights() { m_lights.clear(); }
+    void clearLights() {
+        m_lights.clear();
+        markChanged();
+    }
+
+    /**
+     * @brief Change counter for the ambient term and the lights.
+     *
+     * Versions come from one counter shared by all light boxes, so two
+     * boxes never report the same version.
+     */
+    uint64_t getVersion() const { return m_version; }
+
+    /**
+     * @brief Bump the version after editing a light through a kept reference.
+     */
+    void markChanged();
 
   protected:
     Color m_ambientColor = Color(0.1f, 0.1f, 0.1f);
     float m_ambientIntensity = 1.0f;
     std::vector<Light> m_lights;
+
+  private:
+    uint64_t m_version;
 };
 
 /**
@@ -191,17 +238,17 @@ class ThreePointLightBox : public LightBox {
     /**
      * @brief Get the key light.
      */
-    Light& getKeyLight() { return m_lights[0]; }
+    Light& getKeyLight() { return getLight(0); }
 
     /**
      * @brief Get the fill light.
      */
-    Light& getFillLight() { return m_lights[1]; }
+    Light& getFillLight() { return getLight(1); }
 
     /**
      * @brief Get the back light.
      */
-    Light& getBackLight() { return m_lights[2]; }
+    Light& getBackLight() { return getLight(2); }
 };
 
 }  // namespace vde
@@ -8,7 +8,11 @@
  * including static meshes and animated models.
  */
 
+#include <vde/GpuAllocator.h>
+#include <vde/MeshBVH.h>
+#include <vde/MeshOptimizer.h>
 #include <vde/Types.h>
+#include <vde/UploadManager.h>
 
 #include <vulkan/vulkan.h>
 
@@ -37,11 +41,29 @@ class Mesh : public Resource {
 
     /**
      * @brief Load mesh from a file.
+     *
+     * OBJ sources are imported once and cached as binary .vdemesh files
+     * keyed by the source's content hash (see MeshCache); later loads of
+     * an unchanged source read the cache file instead of parsing.  The LOD
+     * chain is generated on import (see generateLODs()) and stored in the
+     * cache file with the mesh, so a cache hit does no simplification.
+     *
      * @param path Path to the mesh file (.obj, .gltf, etc.)
      * @return true if loading succeeded
      */
     virtual bool loadFromFile(const std::string& path);
 
+    /**
+     * @brief Set where loadFromFile() caches imported meshes.
+     * @param directory Cache directory, or empty to disable the cache
+     */
+    static void setCacheDirectory(const std::string& directory);
+
+    /**
+     * @brief Get the mesh cache directory (MeshCache::DEFAULT_DIRECTORY by default).
+     */
+    static std::string getCacheDirectory();
+
     /**
      * @brief Create mesh from vertex and index data.
      * @param vertices Vertex data
@@ -49,6 +71,73 @@ class Mesh : public Resource {
      */
     virtual void setData(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
 
+    /**
+     * @brief Reorder indices and vertices for GPU efficiency.
+     *
+     * Orders triangles for the post-transform vertex cache (Tipsify),
+     * optionally sorts triangle clusters outside-in to reduce overdraw,
+     * then renumbers vertices in first-use order for fetch locality.
+     * Geometry is unchanged.  Runs automatically for loadFromFile() and
+     * the sphere, cylinder and plane generators; call before uploadToGPU().
+     *
+     * @param reduceOverdraw Also cluster triangles for overdraw
+     * @return ACMR before and after (also kept in getOptimizeStats())
+     */
+    MeshOptimizeStats optimize(bool reduceOverdraw = false);
+
+    /**
+     * @brief Get the result of the last optimize() call.
+     */
+    const MeshOptimizeStats& getOptimizeStats() const { return m_optimizeStats; }
+
+    /**
+     * @brief Build a chain of simplified levels of detail.
+     *
+     * Each level is simplified from the previous one with MeshSimplifier
+     * to `reduction` of its triangle count, and is its own Mesh with only
+     * the vertices it references.  Generation stops early when a level
+     * would exceed maxError (relative to the bounds diagonal), barely
+     * shrinks, or drops below MIN_LOD_TRIANGLES.  Runs automatically for
+     * loadFromFile(); setData() discards the chain.
+     *
+     * @param maxLevels Maximum number of levels, including this mesh
+     * @param reduction Triangle ratio between consecutive levels
+     * @param maxError Maximum simplification error per level
+     * @return Number of levels, including this mesh
+     */
+    size_t generateLODs(size_t maxLevels = DEFAULT_LOD_LEVELS, float reduction = 0.5f,
+                        float maxError = DEFAULT_LOD_ERROR);
+
+    /**
+     * @brief Discard generated levels of detail.
+     */
+    void clearLODs() { m_lods.clear(); }
+
+    /**
+     * @brief Get the number of levels of detail (1 if none were generated).
+     */
+    size_t getLODCount() const { return m_lods.size() + 1; }
+
+    /**
+     * @brief Get a level of detail.
+     * @param level 0 for this mesh; levels past the end give the coarsest
+     */
+    Mesh* getLOD(size_t level);
+
+    /**
+     * @brief Get the accumulated simplification error of a level (0 for level 0).
+     */
+    float getLODError(size_t level) const;
+
+    /// Default maximum number of levels built by generateLODs()
+    static constexpr size_t DEFAULT_LOD_LEVELS = 4;
+
+    /// Default error budget per level, relative to the bounds diagonal
+    static constexpr float DEFAULT_LOD_ERROR = 0.05f;
+
+    /// Levels below this triangle count are not generated
+    static constexpr size_t MIN_LOD_TRIANGLES = 16;
+
     /**
      * @brief Get the vertex data.
      */
@@ -160,6 +249,33 @@ class Mesh : public Resource {
                                              const std::vector<uint32_t>& indices,
                                              float thickness = 0.015f);
 
+    /**
+     * @brief Collect the unique edges of a triangle list.
+     *
+     * Edges are bucketed by their smaller vertex with a counting sort and
+     * deduplicated per vertex, which stays linear on meshes with millions
+     * of triangles.
+     *
+     * @param indices Triangle index data
+     * @return Unique (smaller, larger) vertex index pairs in ascending order
+     */
+    static std::vector<std::pair<uint32_t, uint32_t>>
+    extractEdges(const std::vector<uint32_t>& indices);
+
+    /**
+     * @brief Create the unit edge tube drawn once per EdgeInstance.
+     *
+     * Four-sided tube with corners at (+-1, +-1) in XY and ends at z = 0
+     * and z = 1; vertex colors hold the corner normals in the same frame.
+     * Uses the full Vertex layout (compact vertices are disabled).
+     */
+    static ResourcePtr<Mesh> createEdgeTube();
+
+    /**
+     * @brief Build one EdgeInstance per unique edge of this mesh.
+     */
+    std::vector<EdgeInstance> createEdgeInstances() const;
+
     // Bounding volume queries
 
     /**
@@ -175,13 +291,43 @@ class Mesh : public Resource {
      */
     float getBoundingRadius() const { return glm::length(m_boundsMax - getBoundsCenter()); }
 
+    /**
+     * @brief Get the triangle BVH used for exact ray queries.
+     *
+     * Built on first use and rebuilt after setData(), optimize() or
+     * loadFromFile() change the geometry.
+     */
+    const MeshBVH& getBVH() const;
+
     // GPU buffer management
 
     /**
      * @brief Upload mesh data to GPU.
+     *
+     * Buffers are created immediately; the copy is queued on the shared
+     * UploadManager and completes asynchronously.  The mesh may be drawn
+     * right away because the frame submission waits for pending uploads
+     * on the GPU.
+     *
+     * Vertices are uploaded as CompactVertex (half the size) when allowed
+     * and the colors and texture coordinates fit in [0, 1], and indices
+     * as 16 bits when there are at most 65536 vertices.  Check
+     * getGPUVertexFormat() to pick the matching pipeline.
+     *
      * @param context Vulkan context for buffer creation
+     * @return Handle of the pending upload (empty if nothing was uploaded)
+     */
+    UploadHandle uploadToGPU(VulkanContext* context);
+
+    /**
+     * @brief Check whether the last upload has finished executing.
+     */
+    bool isUploadComplete() const;
+
+    /**
+     * @brief Get the handle of the last upload.
      */
-    void uploadToGPU(VulkanContext* context);
+    UploadHandle getUploadHandle() const { return m_uploadHandle; }
 
     /**
      * @brief Free GPU buffers.
@@ -194,6 +340,65 @@ class Mesh : public Resource {
      */
     bool isOnGPU() const { return m_vertexBuffer != VK_NULL_HANDLE; }
 
+    /**
+     * @brief Allow or forbid the CompactVertex layout at upload (allowed by default).
+     *
+     * Disable for meshes drawn by pipelines that only accept Vertex.
+     */
+    void setCompactVerticesAllowed(bool allowed) { m_compactVerticesAllowed = allowed; }
+
+    /**
+     * @brief Check whether uploadToGPU() may use the CompactVertex layout.
+     */
+    bool isCompactVerticesAllowed() const { return m_compactVerticesAllowed; }
+
+    /**
+     * @brief Get the vertex layout of the GPU buffer.
+     */
+    VertexFormat getGPUVertexFormat() const { return m_gpuVertexFormat; }
+
+    /**
+     * @brief Get the index type of the GPU buffer.
+     */
+    VkIndexType getIndexType() const { return m_indexType; }
+
+    /**
+     * @brief Object-space origin of compact positions (the bounds minimum at upload).
+     */
+    const glm::vec3& getGPUPositionOffset() const { return m_gpuPositionOffset; }
+
+    /**
+     * @brief Object-space scale of compact positions (the bounds extent at upload).
+     */
+    const glm::vec3& getGPUPositionScale() const { return m_gpuPositionScale; }
+
+    /**
+     * @brief Upload this mesh's edges as an EdgeInstance buffer.
+     *
+     * Used by MeshEntity::setWireframe() to draw the mesh as instanced
+     * edge tubes without generating tube geometry.  The buffer is freed
+     * with the other GPU buffers.
+     *
+     * @param context Vulkan context for buffer creation
+     * @return Handle of the pending upload (empty if nothing was uploaded)
+     */
+    UploadHandle uploadEdgesToGPU(VulkanContext* context);
+
+    /**
+     * @brief Check if the edge instance buffer has been uploaded.
+     */
+    bool hasEdgesOnGPU() const { return m_edgeBuffer != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Get the edge instance buffer (VK_NULL_HANDLE if not uploaded).
+     */
+    VkBuffer getEdgeBuffer() const { return m_edgeBuffer; }
+
+    /**
+     * @brief Get the number of instances in the edge buffer.
+     */
+    uint32_t getEdgeCount() const { return m_edgeCount; }
+
     /**
      * @brief Bind vertex and index buffers for rendering.
      * @param commandBuffer Command buffer to bind to
@@ -205,12 +410,30 @@ class Mesh : public Resource {
     std::vector<uint32_t> m_indices;
     glm::vec3 m_boundsMin{0.0f};
     glm::vec3 m_boundsMax{0.0f};
+    MeshOptimizeStats m_optimizeStats;
+    mutable MeshBVH m_bvh;  ///< Lazily built by getBVH(); cleared on geometry changes
+
+    // Simplified levels 1..n (level 0 is this mesh)
+    struct LODLevel {
+        ResourcePtr<Mesh> mesh;
+        float error = 0.0f;
+    };
+    std::vector<LODLevel> m_lods;
 
     // GPU buffers (VK_NULL_HANDLE if not uploaded)
     VkBuffer m_vertexBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_vertexBufferMemory = VK_NULL_HANDLE;
+    GpuAllocation m_vertexAllocation;
     VkBuffer m_indexBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_indexBufferMemory = VK_NULL_HANDLE;
+    GpuAllocation m_indexAllocation;
+    UploadHandle m_uploadHandle;
+    bool m_compactVerticesAllowed = true;
+    VertexFormat m_gpuVertexFormat = VertexFormat::Full;
+    VkIndexType m_indexType = VK_INDEX_TYPE_UINT32;
+    glm::vec3 m_gpuPositionOffset{0.0f};
+    glm::vec3 m_gpuPositionScale{1.0f};
+    VkBuffer m_edgeBuffer = VK_NULL_HANDLE;
+    GpuAllocation m_edgeAllocation;
+    uint32_t m_edgeCount = 0;
 
     // Device used for GPU buffer creation (needed for cleanup in destructor)
     VkDevice m_device = VK_NULL_HANDLE;
@@ -0,0 +1,337 @@
+#pragma once
+
+/**
+ * @file RenderQueue.h
+ * @brief Sort-keyed render queue for VDE scenes
+ *
+ * Entities submit draw commands tagged with a packed 64-bit sort key
+ * instead of recording Vulkan commands directly.  The queue radix-sorts
+ * the keys once per flush and records the draws in key order, skipping
+ * pipeline, descriptor set and vertex/index buffer binds that would not
+ * change the bound state.
+ */
+
+#include <vulkan/vulkan.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vde {
+
+// Forward declarations
+class Mesh;
+
+/**
+ * @brief Coarse ordering bucket stored in the top bits of a sort key.
+ *
+ * Lower values are drawn first.
+ */
+enum class RenderPassBucket : uint8_t {
+    Opaque = 0,       ///< Geometry that may be freely reordered for state coherence
+    Ordered = 1,      ///< Geometry drawn in submission order (2D, UI, no depth test)
+    Transparent = 2,  ///< Alpha-blended geometry drawn after everything else
+    Overlay = 3       ///< Debug / HUD geometry drawn last
+};
+
+/**
+ * @brief Controls how a scene's mesh entities are keyed.
+ */
+enum class RenderSortMode {
+    Submission,  ///< Preserve entity insertion order; only redundant binds are skipped
+    StateSorted  ///< Group by pipeline, material and mesh, then front-to-back depth;
+                 ///< transparent materials are drawn afterwards, back to front
+};
+
+/**
+ * @brief Helpers for packing 64-bit render sort keys.
+ *
+ * State-sorted layout (Opaque bucket):
+ * @code
+ *  63..62  61........52  51........36  35........20  19.........0
+ *  bucket  pipeline(10)  material(16)  mesh(16)      depth(20)
+ * @endcode
+ *
+ * Depth-sorted layout (Transparent bucket, back-to-front depth):
+ * @code
+ *  63..62  61........42  41........32  31........16  15.........0
+ *  bucket  depth(20)     pipeline(10)  material(16)  mesh(16)
+ * @endcode
+ *
+ * Submission-ordered layout (any bucket):
+ * @code
+ *  63..62  61..................30  29........20  19.........0
+ *  bucket  sequence(32)            pipeline(10)  material(20)
+ * @endcode
+ *
+ * Pipeline, material and mesh fields are folded hashes of the object
+ * handles.  A collision only costs an extra bind, never a wrong draw,
+ * because emission compares the real handles.
+ */
+struct RenderSortKey {
+    static constexpr uint32_t BUCKET_BITS = 2;
+    static constexpr uint32_t PIPELINE_BITS = 10;
+    static constexpr uint32_t MATERIAL_BITS = 16;
+    static constexpr uint32_t MESH_BITS = 16;
+    static constexpr uint32_t DEPTH_BITS = 20;
+    static constexpr uint32_t SEQUENCE_BITS = 32;
+    static constexpr uint32_t ORDERED_MATERIAL_BITS = 20;
+
+    /**
+     * @brief Build a state-sorted key.
+     * @param bucket Pass bucket
+     * @param pipeline Pipeline identity (typically a handle)
+     * @param material Material / texture identity
+     * @param mesh Mesh identity
+     * @param depth Quantized depth (see quantizeDepth())
+     */
+    static uint64_t makeStateSorted(RenderPassBucket bucket, const void* pipeline,
+                                    const void* material, const void* mesh, uint32_t depth);
+
+    /**
+     * @brief Build a key ordered by depth first, then by state.
+     *
+     * Used for blended geometry, which must be drawn back to front
+     * regardless of how often that rebinds state.
+     *
+     * @param bucket Pass bucket
+     * @param depth Quantized depth (see quantizeDepth(), back-to-front)
+     * @param pipeline Pipeline identity
+     * @param material Material / texture identity
+     * @param mesh Mesh identity
+     */
+    static uint64_t makeDepthSorted(RenderPassBucket bucket, uint32_t depth, const void* pipeline,
+                                    const void* material, const void* mesh);
+
+    /**
+     * @brief Build a key that preserves submission order within its bucket.
+     * @param bucket Pass bucket
+     * @param sequence Monotonic submission index
+     * @param pipeline Pipeline identity
+     * @param material Material / texture identity
+     */
+    static uint64_t makeOrdered(RenderPassBucket bucket, uint32_t sequence, const void* pipeline,
+                                const void* material);
+
+    /**
+     * @brief Map a view distance to an unsigned depth field.
+     * @param distance Distance from the camera (clamped to [0, maxDistance])
+     * @param maxDistance Distance mapped to the largest depth value
+     * @param backToFront If true, farther objects get smaller values
+     */
+    static uint32_t quantizeDepth(float distance, float maxDistance, bool backToFront = false);
+
+    /**
+     * @brief Fold a pointer-sized handle down to @p bits bits.
+     */
+    static uint64_t foldHandle(const void* handle, uint32_t bits);
+
+    /**
+     * @brief Extract the bucket from a key.
+     */
+    static RenderPassBucket getBucket(uint64_t key) {
+        return static_cast<RenderPassBucket>(key >> (64 - BUCKET_BITS));
+    }
+};
+
+/**
+ * @brief A single deferred draw.
+ *
+ * Holds everything needed to record the draw so entities never touch the
+ * command buffer themselves.  Push constant data is copied by value.
+ */
+struct RenderCommand {
+    static constexpr uint32_t MAX_DESCRIPTOR_SETS = 3;
+    static constexpr uint32_t MAX_PUSH_CONSTANT_SIZE = 128;
+
+    uint64_t sortKey = 0;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+
+    std::array<VkDescriptorSet, MAX_DESCRIPTOR_SETS> descriptorSets{};
+    uint32_t descriptorSetCount = 0;
+
+    /// Bit N set: descriptor set N has one dynamic uniform buffer, bound at
+    /// dynamicOffsets[N] (the per-view camera slot, per-draw data)
+    uint32_t dynamicOffsetMask = 0;
+    std::array<uint32_t, MAX_DESCRIPTOR_SETS> dynamicOffsets{};
+
+    const Mesh* mesh = nullptr;
+
+    /// Optional per-instance vertex buffer, bound at binding 1
+    VkBuffer instanceBuffer = VK_NULL_HANDLE;
+    uint32_t instanceCount = 1;
+    uint32_t firstInstance = 0;  ///< First instance read from instanceBuffer
+
+    VkShaderStageFlags pushConstantStages = 0;
+    uint32_t pushConstantSize = 0;
+    std::array<uint8_t, MAX_PUSH_CONSTANT_SIZE> pushConstants{};
+
+    /**
+     * @brief Copy push constant data into the command.
+     * @return false if @p size exceeds MAX_PUSH_CONSTANT_SIZE
+     */
+    bool setPushConstants(VkShaderStageFlags stages, const void* data, uint32_t size);
+};
+
+/**
+ * @brief Per-flush bind statistics.
+ */
+struct RenderQueueStats {
+    uint32_t commandsSubmitted = 0;
+    uint32_t drawCalls = 0;
+    uint64_t triangles = 0;  ///< Triangles drawn (index or vertex count / 3, times instances)
+    uint32_t pipelineBinds = 0;
+    uint32_t pipelineBindsSkipped = 0;
+    uint32_t descriptorSetBinds = 0;
+    uint32_t descriptorSetBindsSkipped = 0;
+    uint32_t meshBinds = 0;
+    uint32_t meshBindsSkipped = 0;
+
+    /**
+     * @brief Total binds recorded into the command buffer.
+     */
+    uint32_t getBindsIssued() const { return pipelineBinds + descriptorSetBinds + meshBinds; }
+
+    /**
+     * @brief Total binds avoided because the state was already bound.
+     */
+    uint32_t getBindsSkipped() const {
+        return pipelineBindsSkipped + descriptorSetBindsSkipped + meshBindsSkipped;
+    }
+
+    void reset() { *this = RenderQueueStats{}; }
+
+    RenderQueueStats& operator+=(const RenderQueueStats& other);
+};
+
+/**
+ * @brief Collects draw commands and records them in sorted order.
+ *
+ * Typical per-frame usage (done by Scene::render()):
+ * @code
+ * queue.begin();
+ * for (auto& e : entities) e->render();   // entities call submit()
+ * queue.flush(cmd, viewport, scissor);
+ * @endcode
+ */
+class RenderQueue {
+  public:
+    RenderQueue() = default;
+
+    /**
+     * @brief Start collecting commands for a new flush.
+     *
+     * Clears previously submitted commands and resets the statistics.
+     */
+    void begin();
+
+    /**
+     * @brief Check whether begin() has been called without a matching flush().
+     */
+    bool isRecording() const { return m_recording; }
+
+    /**
+     * @brief Add a command to the queue.
+     */
+    void submit(const RenderCommand& command);
+
+    /**
+     * @brief Get the next submission sequence number (for makeOrdered()).
+     */
+    uint32_t nextSequence() { return m_sequence++; }
+
+    /**
+     * @brief Sort the submitted commands by key.
+     *
+     * Uses an LSD radix sort over the 64-bit keys; equal keys keep their
+     * submission order.  Called automatically by flush().
+     */
+    void sort();
+
+    /**
+     * @brief Stop collecting and sort the queue for recording.
+     *
+     * Use with record() when the queue is recorded in several chunks
+     * (e.g. into secondary command buffers on worker threads).
+     */
+    void end();
+
+    /**
+     * @brief Record a range of the sorted queue.
+     *
+     * Sets viewport and scissor, then records the draws in
+     * [first, first + count).  Bind tracking starts empty, so each range
+     * is self-contained and may be recorded into its own secondary
+     * command buffer.  Concurrent calls on disjoint ranges are safe as
+     * long as each writes to its own @p stats.  If @p commandBuffer is
+     * VK_NULL_HANDLE nothing is recorded, but @p stats is still updated.
+     *
+     * @param commandBuffer Command buffer in the recording state
+     * @param viewport Viewport for every draw in the range
+     * @param scissor Scissor for every draw in the range
+     * @param first Index of the first command
+     * @param count Number of commands to record
+     * @param stats Statistics to accumulate into
+     */
+    void record(VkCommandBuffer commandBuffer, const VkViewport& viewport,
+                const VkRect2D& scissor, size_t first, size_t count,
+                RenderQueueStats& stats) const;
+
+    /**
+     * @brief Sort and record all submitted commands, then clear the queue.
+     *
+     * Equivalent to end(), record() over the whole queue and clear().
+     *
+     * @param commandBuffer Command buffer in the recording state
+     * @param viewport Viewport for every draw in this flush
+     * @param scissor Scissor for every draw in this flush
+     */
+    void flush(VkCommandBuffer commandBuffer, const VkViewport& viewport,
+               const VkRect2D& scissor);
+
+    /**
+     * @brief Drop all queued commands without recording them.
+     */
+    void clear();
+
+    /**
+     * @brief Merge externally gathered statistics (e.g. from record()).
+     */
+    void addStats(const RenderQueueStats& stats) { m_stats += stats; }
+
+    /**
+     * @brief Number of commands currently queued.
+     */
+    size_t size() const { return m_commands.size(); }
+
+    /**
+     * @brief Access queued commands (in sorted order after sort()).
+     */
+    const std::vector<RenderCommand>& getCommands() const { return m_commands; }
+
+    /**
+     * @brief Statistics for the most recent flush.
+     */
+    const RenderQueueStats& getStats() const { return m_stats; }
+
+    /**
+     * @brief Radix-sort an index permutation of @p keys.
+     *
+     * @param keys Keys to sort by (not modified)
+     * @param order Output permutation; order[i] is the index of the i-th smallest key
+     */
+    static void radixSort(const std::vector<uint64_t>& keys, std::vector<uint32_t>& order);
+
+  private:
+    std::vector<RenderCommand> m_commands;
+    std::vector<uint64_t> m_keys;
+    std::vector<uint32_t> m_order;
+    RenderQueueStats m_stats;
+    uint32_t m_sequence = 0;
+    bool m_recording = false;
+};
+
+}  // namespace vde
@@ -10,6 +10,7 @@
 
 #include <vde/Texture.h>
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -24,7 +25,9 @@
 #include "InputHandler.h"
 #include "LightBox.h"
 #include "PhysicsTypes.h"
+#include "RenderQueue.h"
 #include "Resource.h"
+#include "StaticBatch.h"
 #include "ViewportRect.h"
 #include "WorldBounds.h"
 
@@ -36,6 +39,16 @@ class Mesh;
 class PhysicsScene;
 class Texture;
 
+/**
+ * @brief Closest mesh surface hit by Scene::raycast() or Scene::pick().
+ */
+struct SceneRayHit {
+    MeshEntity* entity = nullptr;  ///< Entity whose mesh was hit
+    uint32_t triangle = 0;         ///< Triangle index in the entity's mesh
+    glm::vec3 point{0.0f};         ///< World-space hit point
+    float distance = 0.0f;         ///< World-space distance along the ray
+};
+
 /**
  * @brief Represents a game scene/state.
  *
@@ -297,6 +310,62 @@ class Scene {
      */
     const std::vector<Entity::Ref>& getEntities() const { return m_entities; }
 
+    // Static batching
+
+    /**
+     * @brief Merge static mesh entities into chunked, pre-transformed meshes.
+     *
+     * Every visible MeshEntity marked with MeshEntity::setStatic(true) is
+     * merged with others sharing its material (or color) and spatial cell.
+     * The entities stay in the scene but are drawn by their chunk; chunks
+     * outside the camera frustum are skipped.  Call again after changing
+     * batched entities, and call clearStaticBatches() to undo.
+     *
+     * @param chunkSize Cell edge length in world units
+     * @return Number of chunks (draws) replacing the batched entities
+     */
+    size_t buildStaticBatches(float chunkSize = StaticBatch::DEFAULT_CHUNK_SIZE);
+
+    /**
+     * @brief Undo buildStaticBatches(); entities draw themselves again.
+     */
+    void clearStaticBatches() { m_staticBatch.clear(); }
+
+    /**
+     * @brief Get the scene's static batch.
+     */
+    const StaticBatch& getStaticBatch() const { return m_staticBatch; }
+
+    // Picking
+
+    /**
+     * @brief Find the closest mesh triangle hit by a world-space ray.
+     *
+     * Visible MeshEntities are first tested against their world bounding
+     * spheres, nearest-first pruning included; only the survivors are
+     * traced exactly through their mesh's BVH (Mesh::getBVH()) in the
+     * entity's local space.
+     *
+     * @param ray World-space ray (direction need not be normalized)
+     * @param hit Receives the closest hit
+     * @param maxDistance Ignore hits farther than this world-space distance
+     * @return true if any mesh was hit
+     */
+    bool raycast(const Ray& ray, SceneRayHit& hit,
+                 float maxDistance = std::numeric_limits<float>::max()) const;
+
+    /**
+     * @brief Raycast from a screen position through the scene's camera.
+     * @param screenX Cursor X in pixels (0 = left edge)
+     * @param screenY Cursor Y in pixels (0 = top edge)
+     * @param screenWidth Viewport width in pixels
+     * @param screenHeight Viewport height in pixels
+     * @param hit Receives the closest hit
+     * @return true if a mesh is under the cursor
+     */
+    bool pick(float screenX, float screenY, float screenWidth, float screenHeight,
+              SceneRayHit& hit) const;
+
     // Lighting
 
     /**
@@ -390,6 +459,34 @@ class Scene {
      */
     const ViewportRect& getViewportRect() const { return m_viewportRect; }
 
+    // Render queue
+
+    /**
+     * @brief Get the scene's render queue.
+     *
+     * Entities submit their draws here during render(); the queue is
+     * sorted and recorded once all entities have been visited.
+     */
+    RenderQueue& getRenderQueue() { return m_renderQueue; }
+    const RenderQueue& getRenderQueue() const { return m_renderQueue; }
+
+    /**
+     * @brief Set how mesh entities are ordered in the render queue.
+     *
+     * The default, RenderSortMode::Submission, keeps entity insertion
+     * order (the mesh pipeline has no depth test, so reordering
+     * overlapping meshes changes the image).  RenderSortMode::StateSorted
+     * groups meshes by pipeline, material and mesh to minimise binds.
+     *
+     * @param mode The sort mode
+     */
+    void setRenderSortMode(RenderSortMode mode) { m_renderSortMode = mode; }
+
+    /**
+     * @brief Get the mesh sort mode.
+     */
+    RenderSortMode getRenderSortMode() const { return m_renderSortMode; }
+
     // Physics
 
     /**
@@ -542,6 +639,14 @@ class Scene {
     int m_updatePriority = 0;
     ViewportRect m_viewportRect = ViewportRect::fullWindow();
 
+    // Render queue
+    RenderQueue m_renderQueue;
+    RenderSortMode m_renderSortMode = RenderSortMode::Submission;
+    bool m_deferRenderQueueFlush = false;  ///< Set by Game for parallel recording
+
+    // Static batching
+    StaticBatch m_staticBatch;
+
     // World bounds
     WorldBounds m_worldBounds;
     CameraBounds2D m_cameraBounds2D;
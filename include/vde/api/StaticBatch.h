@@ -0,0 +1,155 @@
+#pragma once
+
+/**
+ * @file StaticBatch.h
+ * @brief Merging of static mesh entities into pre-transformed chunk meshes
+ *
+ * Static props each carry their own vertex/index buffers and cost one
+ * draw apiece.  A StaticBatch merges every static MeshEntity that shares
+ * a material (or, without one, a color) and a spatial cell into a single
+ * world-space mesh, so a level renders in tens of draws instead of
+ * thousands and whole cells can be frustum culled at once.
+ */
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "GameTypes.h"
+
+namespace vde {
+
+// Forward declarations
+class MeshEntity;
+class Scene;
+
+/**
+ * @brief Combined geometry for static MeshEntities, split into spatial chunks.
+ *
+ * Merged entities keep their place in the scene (they can still be found
+ * by id or name, queried and removed) but no longer draw themselves; the
+ * chunk containing them does.  Their vertices are baked in world space,
+ * so moving, hiding or re-meshing a batched entity takes effect after the
+ * next build().
+ *
+ * Usually driven through Scene::buildStaticBatches():
+ * @code
+ * for (auto& prop : props) {
+ *     prop->setStatic(true);
+ * }
+ * scene->buildStaticBatches();
+ * @endcode
+ */
+class StaticBatch {
+  public:
+    /// Default edge length of the cubic cells entities are grouped into
+    static constexpr float DEFAULT_CHUNK_SIZE = 32.0f;
+
+    /**
+     * @brief One merged draw.
+     */
+    struct Chunk {
+        std::shared_ptr<MeshEntity> entity;  ///< Draws the merged mesh (identity transform)
+        glm::vec3 boundsMin{0.0f};           ///< World-space bounds
+        glm::vec3 boundsMax{0.0f};
+        std::vector<EntityId> sources;  ///< Entities merged into this chunk, in scene order
+        bool visible = true;            ///< Result of the last cull()
+    };
+
+    StaticBatch() = default;
+    ~StaticBatch();
+
+    StaticBatch(const StaticBatch&) = delete;
+    StaticBatch& operator=(const StaticBatch&) = delete;
+
+    /**
+     * @brief Merge entities into chunks, replacing any previous build.
+     *
+     * Entities without mesh data are skipped, as are entities whose albedo
+     * (material, or color without one) is black: the mesh shader then
+     * shades with the vertex color, which baking transforms as a normal.
+     * Each entity is assigned to the cell containing its world-space
+     * bounds centre.
+     *
+     * @param entities Entities to merge
+     * @param scene Scene the chunk entities render into
+     * @param chunkSize Cell edge length in world units
+     * @return Number of chunks built
+     */
+    size_t build(const std::vector<std::shared_ptr<MeshEntity>>& entities, Scene* scene,
+                 float chunkSize = DEFAULT_CHUNK_SIZE);
+
+    /**
+     * @brief Drop all chunks; the source entities draw themselves again.
+     */
+    void clear();
+
+    /**
+     * @brief Frustum cull the chunks and update getVisibleChunkCount().
+     * @param viewProjection Camera view-projection matrix, or nullptr to keep all
+     */
+    void cull(const glm::mat4* viewProjection);
+
+    /**
+     * @brief Cull, then submit every visible chunk.
+     *
+     * Chunks are submitted back to back, so this is only order-preserving
+     * when the render queue sorts draws by state.
+     *
+     * @param viewProjection Camera view-projection matrix, or nullptr to draw all
+     */
+    void render(const glm::mat4* viewProjection);
+
+    /**
+     * @brief Submit the chunk whose first source entity is @p id, if cull() kept it.
+     *
+     * Used for submission-ordered rendering: walking the scene's entities
+     * and calling this for each one draws every chunk where its earliest
+     * merged entity used to draw.
+     *
+     * @return true if a chunk was submitted
+     */
+    bool renderChunkLedBy(EntityId id);
+
+    /**
+     * @brief Find the chunk whose first source entity is @p id.
+     * @return The chunk, or nullptr if @p id does not lead one
+     */
+    const Chunk* findChunkLedBy(EntityId id) const;
+
+    /**
+     * @brief Check whether an entity was merged into a chunk.
+     */
+    bool contains(EntityId id) const { return m_sources.count(id) > 0; }
+
+    const std::vector<Chunk>& getChunks() const { return m_chunks; }
+    size_t getChunkCount() const { return m_chunks.size(); }
+    size_t getSourceCount() const { return m_sources.size(); }
+    float getChunkSize() const { return m_chunkSize; }
+
+    /**
+     * @brief Get the number of chunks kept by the last cull() or render().
+     */
+    size_t getVisibleChunkCount() const { return m_visibleChunks; }
+
+    /**
+     * @brief Conservative test of a world-space box against a view frustum.
+     * @return false only if the box is entirely outside one frustum plane
+     */
+    static bool intersectsFrustum(const glm::mat4& viewProjection, const glm::vec3& boundsMin,
+                                  const glm::vec3& boundsMax);
+
+  private:
+    std::vector<Chunk> m_chunks;
+    std::unordered_set<EntityId> m_sources;
+    std::unordered_map<EntityId, size_t> m_chunkByLeader;
+    std::vector<std::weak_ptr<MeshEntity>> m_sourceEntities;
+    float m_chunkSize = DEFAULT_CHUNK_SIZE;
+    size_t m_visibleChunks = 0;
+};
+
+}  // namespace vde
@@ -95,6 +95,21 @@ class ThreadPool {
      */
     std::vector<std::thread::id> getWorkerThreadIds() const;
 
+    /**
+     * @brief Run task(0) .. task(taskCount - 1) and wait for all of them.
+     *
+     * Tasks go to @p workers when given.  Otherwise a temporary pool of
+     * min(hardware_concurrency, taskCount) threads runs them; a single
+     * task runs inline on the calling thread.  If tasks throw, the first
+     * exception is rethrown once every task has finished.
+     *
+     * @param workers Pool to run on, or nullptr for a temporary one
+     * @param taskCount Number of tasks
+     * @param task Called once per task index, possibly concurrently
+     */
+    static void parallelFor(ThreadPool* workers, size_t taskCount,
+                            const std::function<void(size_t)>& task);
+
   private:
     void workerLoop();
 
@@ -0,0 +1,64 @@
+#version 450
+
+// Per-vertex input: shared unit-height hex prism (see HexMapEntity)
+layout(location = 0) in vec3 inPosition;  // y in [0, 1]
+layout(location = 1) in vec3 inColor;     // surface normal
+layout(location = 2) in vec2 inTexCoord;
+
+// Per-instance input: one map cell (see HexPrismInstance in HexPrismMesh.h)
+layout(location = 3) in ivec2 inAxial;
+layout(location = 4) in float inHeight;
+layout(location = 5) in vec4 inCellColor;
+
+// Per-draw model matrix and material (Set 2, Binding 0; must match DrawUBO in Types.h)
+layout(set = 2, binding = 0) uniform DrawUBO {
+    mat4 model;
+    vec4 albedo;        // RGB albedo + opacity (black: use the cell color)
+    vec4 emission;      // RGB emission + intensity
+    float roughness;
+    float metallic;
+    float normalStrength;
+    float padding;
+    vec4 hexParams;     // x: hex radius
+} draw;
+
+// Set 0, Binding 0: UBO with model/view/proj
+layout(set = 0, binding = 0) uniform UniformBufferObject {
+    mat4 model;  // Unused (we use draw.model instead)
+    mat4 view;
+    mat4 proj;
+} ubo;
+
+// Outputs to fragment shader
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) out vec3 fragWorldPos;
+layout(location = 3) out vec3 fragWorldNormal;
+layout(location = 4) out vec3 fragViewPos;
+
+void main() {
+    // Flat-top axial layout, as HexMapEntity::axialToLocal()
+    float radius = draw.hexParams.x;
+    vec2 axial = vec2(inAxial);
+    vec3 center = vec3(radius * 1.5 * axial.x, 0.0,
+                       radius * sqrt(3.0) * (axial.y + axial.x * 0.5));
+
+    // Scaling y leaves the top and side normals unchanged
+    vec3 position = center + vec3(inPosition.x, inPosition.y * inHeight, inPosition.z);
+
+    vec4 worldPos = draw.model * vec4(position, 1.0);
+    gl_Position = ubo.proj * ubo.view * worldPos;
+
+    // The cell color is the albedo fallback of mesh.frag
+    fragColor = inCellColor.rgb;
+    fragTexCoord = inTexCoord;
+    fragWorldPos = worldPos.xyz;
+
+    // Transform normal to world space (assuming uniform scale)
+    mat3 normalMatrix = mat3(draw.model);
+    fragWorldNormal = normalize(normalMatrix * inColor);
+
+    // Calculate view position (camera position in world space)
+    // This is a simplified approach - view matrix inverse would give exact position
+    fragViewPos = -vec3(ubo.view[3]);
+}
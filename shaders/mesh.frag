@@ -1,8 +1,5 @@
 #version 450
 
-// Maximum number of lights (must match Types.h MAX_LIGHTS)
-#define MAX_LIGHTS 8
-
 // Light types (must match LightType enum)
 #define LIGHT_DIRECTIONAL 0
 #define LIGHT_POINT 1
@@ -15,8 +12,8 @@ layout(location = 2) in vec3 fragWorldPos;
 layout(location = 3) in vec3 fragWorldNormal;
 layout(location = 4) in vec3 fragViewPos;
 
-// Push constants for material properties
-layout(push_constant) uniform PushConstants {
+// Per-draw material properties (Set 2, Binding 0; must match DrawUBO in Types.h)
+layout(set = 2, binding = 0) uniform DrawUBO {
     mat4 model;
     vec4 albedo;        // RGB albedo + opacity
     vec4 emission;      // RGB emission + intensity
@@ -24,6 +21,7 @@ layout(push_constant) uniform PushConstants {
     float metallic;
     float normalStrength;
     float padding;
+    vec4 params;        // Vertex shader parameter (unused here)
 } material;
 
 // GPU Light structure (must match GPULight in Types.h)
@@ -34,13 +32,28 @@ struct GPULight {
     vec4 spotParams;        // x = inner angle cos, y = outer angle cos
 };
 
-// Lighting UBO (Set 1, Binding 0)
+// Lighting UBO (Set 1, Binding 0; must match LightingUBO in Types.h)
 layout(set = 1, binding = 0) uniform LightingUBO {
     vec4 ambientColorAndIntensity;  // xyz = color, w = intensity
-    ivec4 lightCounts;              // x = num lights
-    GPULight lights[MAX_LIGHTS];
+    ivec4 lightCounts;              // x = num lights, y = directional lights (first)
+    uvec4 clusterGrid;              // xyz = grid size (0 = no clusters), w = log slices
+    uvec4 bufferOffsets;            // x = first light, y = first cluster word
+    vec4 viewport;                  // xy = origin, zw = size (pixels)
+    vec4 depthPlane;                // view depth = dot(vec4(worldPos, 1), depthPlane)
+    vec4 sliceParams;               // x = scale, y = bias, z = near, w = far
 } lighting;
 
+// All lights of the frame (Set 1, Binding 1)
+layout(std430, set = 1, binding = 1) readonly buffer LightBuffer {
+    GPULight lights[];
+} lightBuffer;
+
+// Per cluster (offset, count) pairs followed by the light index list
+// (Set 1, Binding 2; see LightClusterGrid)
+layout(std430, set = 1, binding = 2) readonly buffer ClusterBuffer {
+    uint words[];
+} clusterBuffer;
+
 // Output color
 layout(location = 0) out vec4 outColor;
 
@@ -58,10 +71,80 @@ float calculateSpotlight(vec3 lightDir, vec3 spotDir, float innerCos, float oute
     return clamp((theta - outerCos) / epsilon, 0.0, 1.0);
 }
 
-// Simple Blinn-Phong lighting calculation
+// Blinn-Phong contribution of one light
+void addLight(GPULight light, vec3 normal, vec3 viewDir, vec3 albedo,
+              inout vec3 totalDiffuse, inout vec3 totalSpecular) {
+    int lightType = int(light.positionAndType.w);
+    vec3 lightColor = light.colorAndIntensity.rgb;
+    float intensity = light.colorAndIntensity.w;
+
+    vec3 lightDir;
+    float attenuation = 1.0;
+
+    if (lightType == LIGHT_DIRECTIONAL) {
+        // Directional light - direction is stored in position field
+        lightDir = normalize(-light.positionAndType.xyz);
+    }
+    else if (lightType == LIGHT_POINT) {
+        // Point light
+        vec3 lightPos = light.positionAndType.xyz;
+        vec3 toLight = lightPos - fragWorldPos;
+        float distance = length(toLight);
+        lightDir = toLight / distance;
+        attenuation = calculateAttenuation(distance, light.directionAndRange.w);
+    }
+    else if (lightType == LIGHT_SPOT) {
+        // Spot light
+        vec3 lightPos = light.positionAndType.xyz;
+        vec3 toLight = lightPos - fragWorldPos;
+        float distance = length(toLight);
+        lightDir = toLight / distance;
+        attenuation = calculateAttenuation(distance, light.directionAndRange.w);
+
+        // Apply spotlight cone
+        float spotFactor = calculateSpotlight(lightDir, light.directionAndRange.xyz,
+                                              light.spotParams.x, light.spotParams.y);
+        attenuation *= spotFactor;
+    }
+
+    // Skip if attenuation is negligible
+    if (attenuation < 0.001) return;
+
+    // Diffuse (Lambertian)
+    float NdotL = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse = NdotL * lightColor * intensity * attenuation;
+
+    // Specular (Blinn-Phong)
+    vec3 halfDir = normalize(lightDir + viewDir);
+    float NdotH = max(dot(normal, halfDir), 0.0);
+    // Roughness affects specular power: rough = low power, smooth = high power
+    float shininess = mix(256.0, 8.0, material.roughness);
+    float spec = pow(NdotH, shininess);
+    // Metallic surfaces reflect light color, dielectrics reflect white
+    vec3 specularColor = mix(vec3(0.04), albedo, material.metallic);
+    vec3 specular = spec * specularColor * lightColor * intensity * attenuation;
+
+    totalDiffuse += diffuse;
+    totalSpecular += specular;
+}
+
+// Index of the cluster containing this fragment (must match LightClusterGrid)
+uint clusterIndex() {
+    uvec3 grid = lighting.clusterGrid.xyz;
+    vec2 tile = (gl_FragCoord.xy - lighting.viewport.xy) / lighting.viewport.zw * vec2(grid.xy);
+    uvec2 xy = uvec2(clamp(tile, vec2(0.0), vec2(grid.xy) - 1.0));
+
+    float depth = dot(vec4(fragWorldPos, 1.0), lighting.depthPlane);
+    float mapped = lighting.clusterGrid.w != 0u ? log(max(depth, lighting.sliceParams.z))
+                                                : depth;
+    float slice = floor(mapped * lighting.sliceParams.x + lighting.sliceParams.y);
+    uint z = uint(clamp(slice, 0.0, float(grid.z - 1u)));
+
+    return xy.x + grid.x * (xy.y + grid.y * z);
+}
+
+// Blinn-Phong lighting from the directional lights and this fragment's cluster
 vec3 calculateLighting(vec3 normal, vec3 viewDir, vec3 albedo) {
-    int numLights = lighting.lightCounts.x;
-    
     // Ambient contribution
     vec3 ambient = lighting.ambientColorAndIntensity.rgb * 
                    lighting.ambientColorAndIntensity.w * albedo;
@@ -69,61 +152,26 @@ vec3 calculateLighting(vec3 normal, vec3 viewDir, vec3 albedo) {
     vec3 totalDiffuse = vec3(0.0);
     vec3 totalSpecular = vec3(0.0);
     
-    // Calculate contribution from each light
-    for (int i = 0; i < numLights && i < MAX_LIGHTS; i++) {
-        GPULight light = lighting.lights[i];
-        int lightType = int(light.positionAndType.w);
-        vec3 lightColor = light.colorAndIntensity.rgb;
-        float intensity = light.colorAndIntensity.w;
-        
-        vec3 lightDir;
-        float attenuation = 1.0;
-        
-        if (lightType == LIGHT_DIRECTIONAL) {
-            // Directional light - direction is stored in position field
-            lightDir = normalize(-light.positionAndType.xyz);
-        }
-        else if (lightType == LIGHT_POINT) {
-            // Point light
-            vec3 lightPos = light.positionAndType.xyz;
-            vec3 toLight = lightPos - fragWorldPos;
-            float distance = length(toLight);
-            lightDir = toLight / distance;
-            attenuation = calculateAttenuation(distance, light.directionAndRange.w);
-        }
-        else if (lightType == LIGHT_SPOT) {
-            // Spot light
-            vec3 lightPos = light.positionAndType.xyz;
-            vec3 toLight = lightPos - fragWorldPos;
-            float distance = length(toLight);
-            lightDir = toLight / distance;
-            attenuation = calculateAttenuation(distance, light.directionAndRange.w);
-            
-            // Apply spotlight cone
-            float spotFactor = calculateSpotlight(lightDir, light.directionAndRange.xyz,
-                                                  light.spotParams.x, light.spotParams.y);
-            attenuation *= spotFactor;
+    // Directional lights reach every fragment
+    uint firstLight = lighting.bufferOffsets.x;
+    for (int i = 0; i < lighting.lightCounts.y; i++) {
+        addLight(lightBuffer.lights[firstLight + uint(i)], normal, viewDir, albedo,
+                 totalDiffuse, totalSpecular);
+    }
+
+    // Point and spot lights only from the fragment's cluster
+    if (lighting.clusterGrid.x != 0u) {
+        uint base = lighting.bufferOffsets.y;
+        uint cluster = clusterIndex();
+        uint offset = clusterBuffer.words[base + cluster * 2u];
+        uint count = clusterBuffer.words[base + cluster * 2u + 1u];
+        uint indexBase = base + lighting.clusterGrid.x * lighting.clusterGrid.y *
+                                lighting.clusterGrid.z * 2u + offset;
+        for (uint i = 0u; i < count; i++) {
+            uint lightIndex = clusterBuffer.words[indexBase + i];
+            addLight(lightBuffer.lights[firstLight + lightIndex], normal, viewDir, albedo,
+                     totalDiffuse, totalSpecular);
         }
-        
-        // Skip if attenuation is negligible
-        if (attenuation < 0.001) continue;
-        
-        // Diffuse (Lambertian)
-        float NdotL = max(dot(normal, lightDir), 0.0);
-        vec3 diffuse = NdotL * lightColor * intensity * attenuation;
-        
-        // Specular (Blinn-Phong)
-        vec3 halfDir = normalize(lightDir + viewDir);
-        float NdotH = max(dot(normal, halfDir), 0.0);
-        // Roughness affects specular power: rough = low power, smooth = high power
-        float shininess = mix(256.0, 8.0, material.roughness);
-        float spec = pow(NdotH, shininess);
-        // Metallic surfaces reflect light color, dielectrics reflect white
-        vec3 specularColor = mix(vec3(0.04), albedo, material.metallic);
-        vec3 specular = spec * specularColor * lightColor * intensity * attenuation;
-        
-        totalDiffuse += diffuse;
-        totalSpecular += specular;
     }
     
     // Combine all lighting
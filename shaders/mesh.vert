@@ -5,8 +5,8 @@ layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec3 inColor;
 layout(location = 2) in vec2 inTexCoord;
 
-// Push constants for model matrix and material properties
-layout(push_constant) uniform PushConstants {
+// Per-draw model matrix and material (Set 2, Binding 0; must match DrawUBO in Types.h)
+layout(set = 2, binding = 0) uniform DrawUBO {
     mat4 model;
     vec4 albedo;        // RGB albedo + opacity
     vec4 emission;      // RGB emission + intensity
@@ -14,11 +14,12 @@ layout(push_constant) uniform PushConstants {
     float metallic;
     float normalStrength;
     float padding;
-} push;
+    vec4 params;        // Unused by this shader
+} draw;
 
 // Set 0, Binding 0: UBO with model/view/proj
 layout(set = 0, binding = 0) uniform UniformBufferObject {
-    mat4 model;  // Unused (we use push.model instead)
+    mat4 model;  // Unused (we use draw.model instead)
     mat4 view;
     mat4 proj;
 } ubo;
@@ -31,7 +32,7 @@ layout(location = 3) out vec3 fragWorldNormal;
 layout(location = 4) out vec3 fragViewPos;
 
 void main() {
-    vec4 worldPos = push.model * vec4(inPosition, 1.0);
+    vec4 worldPos = draw.model * vec4(inPosition, 1.0);
     gl_Position = ubo.proj * ubo.view * worldPos;
     
     // Pass vertex color (may be used as base color fallback)
@@ -42,7 +43,7 @@ void main() {
     // Transform normal to world space (assuming uniform scale)
     // Note: For proper normal transformation with non-uniform scale,
     // use inverse transpose of model matrix
-    mat3 normalMatrix = mat3(push.model);
+    mat3 normalMatrix = mat3(draw.model);
     fragWorldNormal = normalize(normalMatrix * inColor); // Using color as normal for now
     
     // Calculate view position (camera position in world space)
@@ -0,0 +1,53 @@
+#version 450
+
+// Vertex input from a CompactVertex buffer (normalized integers, see Types.h)
+layout(location = 0) in vec3 inPosition;  // [0,1] fraction of the mesh bounds
+layout(location = 1) in vec3 inColor;
+layout(location = 2) in vec2 inTexCoord;
+
+// Per-draw model matrix and material (Set 2, Binding 0; must match DrawUBO in Types.h)
+layout(set = 2, binding = 0) uniform DrawUBO {
+    mat4 model;
+    vec4 albedo;        // RGB albedo + opacity
+    vec4 emission;      // RGB emission + intensity
+    float roughness;
+    float metallic;
+    float normalStrength;
+    float padding;
+    vec4 dequantScale;  // xyz: mesh bounds extent (bounds min is in model)
+} draw;
+
+// Set 0, Binding 0: UBO with model/view/proj
+layout(set = 0, binding = 0) uniform UniformBufferObject {
+    mat4 model;  // Unused (we use draw.model instead)
+    mat4 view;
+    mat4 proj;
+} ubo;
+
+// Outputs to fragment shader
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) out vec3 fragWorldPos;
+layout(location = 3) out vec3 fragWorldNormal;
+layout(location = 4) out vec3 fragViewPos;
+
+void main() {
+    vec3 position = inPosition * draw.dequantScale.xyz;
+    vec4 worldPos = draw.model * vec4(position, 1.0);
+    gl_Position = ubo.proj * ubo.view * worldPos;
+    
+    // Pass vertex color (may be used as base color fallback)
+    fragColor = inColor;
+    fragTexCoord = inTexCoord;
+    fragWorldPos = worldPos.xyz;
+    
+    // Transform normal to world space (assuming uniform scale)
+    // Note: For proper normal transformation with non-uniform scale,
+    // use inverse transpose of model matrix
+    mat3 normalMatrix = mat3(draw.model);
+    fragWorldNormal = normalize(normalMatrix * inColor); // Using color as normal for now
+    
+    // Calculate view position (camera position in world space)
+    // This is a simplified approach - view matrix inverse would give exact position
+    fragViewPos = -vec3(ubo.view[3]);
+}
@@ -0,0 +1,65 @@
+#version 450
+
+// Per-vertex input: unit edge tube (see Mesh::createEdgeTube())
+layout(location = 0) in vec3 inPosition;  // xy: corner in the edge frame, z: 0 start / 1 end
+layout(location = 1) in vec3 inColor;     // corner normal in the edge frame
+layout(location = 2) in vec2 inTexCoord;
+
+// Per-instance input: one mesh edge (see EdgeInstance in Types.h)
+layout(location = 3) in vec3 inEdgeStart;
+layout(location = 4) in vec3 inEdgeEnd;
+
+// Per-draw model matrix and material (Set 2, Binding 0; must match DrawUBO in Types.h)
+layout(set = 2, binding = 0) uniform DrawUBO {
+    mat4 model;
+    vec4 albedo;        // RGB albedo + opacity
+    vec4 emission;      // RGB emission + intensity
+    float roughness;
+    float metallic;
+    float normalStrength;
+    float padding;
+    vec4 edgeParams;    // x: tube thickness
+} draw;
+
+// Set 0, Binding 0: UBO with model/view/proj
+layout(set = 0, binding = 0) uniform UniformBufferObject {
+    mat4 model;  // Unused (we use draw.model instead)
+    mat4 view;
+    mat4 proj;
+} ubo;
+
+// Outputs to fragment shader
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) out vec3 fragWorldPos;
+layout(location = 3) out vec3 fragWorldNormal;
+layout(location = 4) out vec3 fragViewPos;
+
+void main() {
+    // Same perpendicular frame as the baked tubes of Mesh::createWireframe()
+    vec3 dir = normalize(inEdgeEnd - inEdgeStart);
+    vec3 up = (abs(dir.y) < 0.99) ? vec3(0.0, 1.0, 0.0) : vec3(1.0, 0.0, 0.0);
+    vec3 right = normalize(cross(dir, up));
+    vec3 forward = normalize(cross(right, dir));
+
+    float halfThickness = draw.edgeParams.x * 0.5;
+    vec3 position = mix(inEdgeStart, inEdgeEnd, inPosition.z) +
+                    (right * inPosition.x + forward * inPosition.y) * halfThickness;
+    vec3 normal = right * inColor.x + forward * inColor.y;
+
+    vec4 worldPos = draw.model * vec4(position, 1.0);
+    gl_Position = ubo.proj * ubo.view * worldPos;
+
+    // Pass the normal as the vertex color, as the baked tubes do
+    fragColor = normal;
+    fragTexCoord = inTexCoord;
+    fragWorldPos = worldPos.xyz;
+
+    // Transform normal to world space (assuming uniform scale)
+    mat3 normalMatrix = mat3(draw.model);
+    fragWorldNormal = normalize(normalMatrix * normal);
+
+    // Calculate view position (camera position in world space)
+    // This is a simplified approach - view matrix inverse would give exact position
+    fragViewPos = -vec3(ubo.view[3]);
+}
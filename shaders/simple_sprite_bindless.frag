@@ -0,0 +1,30 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+// Input from vertex shader
+layout(location = 0) in vec2 fragTexCoord;
+layout(location = 1) in vec4 fragTint;
+
+// Every texture, indexed by the per-sprite push constant
+layout(set = 1, binding = 0) uniform sampler2D textures[];
+
+// Follows model, tint and uvRect (used by the vertex shader)
+layout(push_constant) uniform PushConstants {
+    layout(offset = 96) uint textureIndex;
+} pc;
+
+// Output color
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    // Sample texture
+    vec4 texColor = texture(textures[nonuniformEXT(pc.textureIndex)], fragTexCoord);
+
+    // Apply tint (multiplicative blending)
+    outColor = texColor * fragTint;
+
+    // Discard fully transparent pixels
+    if (outColor.a < 0.01) {
+        discard;
+    }
+}
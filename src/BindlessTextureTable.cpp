@@ -0,0 +1,198 @@
+/**
+ * @file BindlessTextureTable.cpp
+ * @brief Implementation of the descriptor-indexed texture table
+ */
+
+#include <vde/BindlessTextureTable.h>
+
+#include <stdexcept>
+
+namespace vde {
+
+// ============================================================================
+// BindlessSlotAllocator
+// ============================================================================
+
+void BindlessSlotAllocator::reset(uint32_t capacity, uint32_t retireFrames) {
+    m_capacity = capacity;
+    m_retireFrames = retireFrames;
+    m_next = 0;
+    m_used = 0;
+    m_frame = 0;
+    m_allocated.clear();
+    m_free.clear();
+    m_retired.clear();
+}
+
+uint32_t BindlessSlotAllocator::allocate() {
+    uint32_t slot = INVALID_SLOT;
+    if (!m_free.empty()) {
+        slot = m_free.back();
+        m_free.pop_back();
+    } else if (m_next < m_capacity) {
+        slot = m_next++;
+        m_allocated.push_back(false);
+    } else {
+        return INVALID_SLOT;
+    }
+    m_allocated[slot] = true;
+    m_used++;
+    return slot;
+}
+
+bool BindlessSlotAllocator::release(uint32_t slot) {
+    // A second release would put the slot on the free list twice and hand
+    // it to two textures
+    if (slot >= m_next || !m_allocated[slot]) {
+        return false;
+    }
+    m_allocated[slot] = false;
+    m_used--;
+    if (m_retireFrames == 0) {
+        m_free.push_back(slot);
+    } else {
+        m_retired.push_back({slot, m_frame});
+    }
+    return true;
+}
+
+void BindlessSlotAllocator::nextFrame() {
+    m_frame++;
+    while (!m_retired.empty() && m_frame - m_retired.front().frame >= m_retireFrames) {
+        m_free.push_back(m_retired.front().slot);
+        m_retired.pop_front();
+    }
+}
+
+// ============================================================================
+// BindlessTextureTable
+// ============================================================================
+
+BindlessTextureTable::~BindlessTextureTable() {
+    cleanup();
+}
+
+void BindlessTextureTable::init(VkDevice device, uint32_t capacity, uint32_t framesInFlight) {
+    if (device == VK_NULL_HANDLE || capacity == 0) {
+        throw std::runtime_error("Cannot initialize BindlessTextureTable without a device!");
+    }
+
+    cleanup();
+    m_device = device;
+
+    VkDescriptorSetLayoutBinding binding{};
+    binding.binding = TEXTURE_BINDING;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    binding.descriptorCount = capacity;
+    binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    // Slots may be written while the set is bound and need not all be valid
+    VkDescriptorBindingFlags bindingFlags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                                            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo{};
+    flagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    flagsInfo.bindingCount = 1;
+    flagsInfo.pBindingFlags = &bindingFlags;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.pNext = &flagsInfo;
+    layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &binding;
+
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_layout) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create bindless texture descriptor set layout!");
+    }
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSize.descriptorCount = capacity;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = 1;
+
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_pool) != VK_SUCCESS) {
+        cleanup();
+        throw std::runtime_error("Failed to create bindless texture descriptor pool!");
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = m_pool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &m_layout;
+
+    if (vkAllocateDescriptorSets(m_device, &allocInfo, &m_descriptorSet) != VK_SUCCESS) {
+        cleanup();
+        throw std::runtime_error("Failed to allocate bindless texture descriptor set!");
+    }
+
+    m_slots.reset(capacity, framesInFlight);
+}
+
+void BindlessTextureTable::cleanup() {
+    if (m_device != VK_NULL_HANDLE) {
+        // Destroying the pool frees the set
+        if (m_pool != VK_NULL_HANDLE) {
+            vkDestroyDescriptorPool(m_device, m_pool, nullptr);
+            m_pool = VK_NULL_HANDLE;
+        }
+        if (m_layout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(m_device, m_layout, nullptr);
+            m_layout = VK_NULL_HANDLE;
+        }
+    }
+    m_descriptorSet = VK_NULL_HANDLE;
+    m_device = VK_NULL_HANDLE;
+    m_slots.reset(0, 0);
+}
+
+uint32_t BindlessTextureTable::add(VkImageView imageView, VkSampler sampler) {
+    if (!isInitialized()) {
+        return INVALID_INDEX;
+    }
+
+    uint32_t index = m_slots.allocate();
+    if (index != INVALID_INDEX) {
+        update(index, imageView, sampler);
+    }
+    return index;
+}
+
+void BindlessTextureTable::update(uint32_t index, VkImageView imageView, VkSampler sampler) {
+    if (!isInitialized() || index >= getCapacity()) {
+        return;
+    }
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    imageInfo.imageView = imageView;
+    imageInfo.sampler = sampler;
+
+    VkWriteDescriptorSet descriptorWrite{};
+    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptorWrite.dstSet = m_descriptorSet;
+    descriptorWrite.dstBinding = TEXTURE_BINDING;
+    descriptorWrite.dstArrayElement = index;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    descriptorWrite.descriptorCount = 1;
+    descriptorWrite.pImageInfo = &imageInfo;
+
+    vkUpdateDescriptorSets(m_device, 1, &descriptorWrite, 0, nullptr);
+}
+
+void BindlessTextureTable::remove(uint32_t index) {
+    if (!isInitialized() || index == INVALID_INDEX) {
+        return;
+    }
+    // The stale descriptor stays in place; partially bound arrays allow it
+    // as long as no new draw indexes the slot before it is rewritten
+    m_slots.release(index);
+}
+
+}  // namespace vde
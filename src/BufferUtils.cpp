@@ -9,9 +9,16 @@ VkDevice BufferUtils::s_device = VK_NULL_HANDLE;
 VkPhysicalDevice BufferUtils::s_physicalDevice = VK_NULL_HANDLE;
 VkCommandPool BufferUtils::s_commandPool = VK_NULL_HANDLE;
 VkQueue BufferUtils::s_graphicsQueue = VK_NULL_HANDLE;
+GpuAllocator BufferUtils::s_allocator;
+UploadManager BufferUtils::s_uploads;
 
 void BufferUtils::init(VkDevice device, VkPhysicalDevice physicalDevice, VkCommandPool commandPool,
-                       VkQueue graphicsQueue) {
+                       VkQueue graphicsQueue, bool memoryBudgetSupported) {
+    // Re-initializing for the same device must not drop live allocations
+    if (!s_allocator.isInitialized() || device != s_device) {
+        s_allocator.init(device, physicalDevice, memoryBudgetSupported);
+    }
+
     s_device = device;
     s_physicalDevice = physicalDevice;
     s_commandPool = commandPool;
@@ -24,6 +31,8 @@ bool BufferUtils::isInitialized() {
 }
 
 void BufferUtils::reset() {
+    s_uploads.shutdown();
+    s_allocator.shutdown();
     s_device = VK_NULL_HANDLE;
     s_physicalDevice = VK_NULL_HANDLE;
     s_commandPool = VK_NULL_HANDLE;
@@ -87,6 +96,48 @@ void BufferUtils::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
     vkBindBufferMemory(s_device, buffer, bufferMemory, 0);
 }
 
+void BufferUtils::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
+                               VkMemoryPropertyFlags properties, VkBuffer& buffer,
+                               GpuAllocation& allocation) {
+    if (s_device == VK_NULL_HANDLE) {
+        throw std::runtime_error("BufferUtils not initialized! Call BufferUtils::init() first.");
+    }
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    // Uploads on a dedicated transfer family write without ownership transfers
+    const std::vector<uint32_t>& sharedFamilies = s_uploads.getSharedQueueFamilies();
+    if (!sharedFamilies.empty()) {
+        bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        bufferInfo.queueFamilyIndexCount = static_cast<uint32_t>(sharedFamilies.size());
+        bufferInfo.pQueueFamilyIndices = sharedFamilies.data();
+    }
+
+    if (vkCreateBuffer(s_device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create buffer!");
+    }
+
+    try {
+        allocation = s_allocator.allocateForBuffer(buffer, properties);
+    } catch (...) {
+        vkDestroyBuffer(s_device, buffer, nullptr);
+        buffer = VK_NULL_HANDLE;
+        throw;
+    }
+}
+
+void BufferUtils::destroyBuffer(VkBuffer& buffer, GpuAllocation& allocation) {
+    if (buffer != VK_NULL_HANDLE && s_device != VK_NULL_HANDLE) {
+        vkDestroyBuffer(s_device, buffer, nullptr);
+    }
+    buffer = VK_NULL_HANDLE;
+    s_allocator.free(allocation);
+}
+
 void BufferUtils::copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size) {
     VkCommandBuffer commandBuffer = beginSingleTimeCommands();
 
@@ -127,14 +178,20 @@ VkCommandBuffer BufferUtils::beginSingleTimeCommands() {
 void BufferUtils::endSingleTimeCommands(VkCommandBuffer commandBuffer) {
     vkEndCommandBuffer(commandBuffer);
 
-    // Submit and wait
+    // Submit and wait for this submission only (not the whole queue)
     VkSubmitInfo submitInfo{};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &commandBuffer;
 
-    vkQueueSubmit(s_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(s_graphicsQueue);
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    VkFence fence = VK_NULL_HANDLE;
+    vkCreateFence(s_device, &fenceInfo, nullptr, &fence);
+
+    vkQueueSubmit(s_graphicsQueue, 1, &submitInfo, fence);
+    vkWaitForFences(s_device, 1, &fence, VK_TRUE, UINT64_MAX);
+    vkDestroyFence(s_device, fence, nullptr);
 
     // Free command buffer
     vkFreeCommandBuffers(s_device, s_commandPool, 1, &commandBuffer);
@@ -172,6 +229,36 @@ void BufferUtils::createDeviceLocalBuffer(const void* data, VkDeviceSize size,
     vkFreeMemory(s_device, stagingMemory, nullptr);
 }
 
+UploadHandle BufferUtils::createDeviceLocalBuffer(const void* data, VkDeviceSize size,
+                                                  VkBufferUsageFlags usage, VkBuffer& buffer,
+                                                  GpuAllocation& allocation) {
+    if (data == nullptr) {
+        throw std::runtime_error("Cannot create device-local buffer with null data!");
+    }
+
+    if (s_uploads.isInitialized()) {
+        createBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage,
+                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, buffer, allocation);
+        return s_uploads.uploadBuffer(buffer, data, size);
+    }
+
+    // Staging memory comes from the persistently mapped host-visible pool
+    VkBuffer stagingBuffer;
+    GpuAllocation stagingAllocation;
+    createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                 stagingBuffer, stagingAllocation);
+    memcpy(stagingAllocation.mapped, data, static_cast<size_t>(size));
+
+    createBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage,
+                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, buffer, allocation);
+
+    copyBuffer(stagingBuffer, buffer, size);
+
+    destroyBuffer(stagingBuffer, stagingAllocation);
+    return UploadHandle{};
+}
+
 void BufferUtils::createMappedBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer& buffer,
                                      VkDeviceMemory& bufferMemory, void** mappedMemory) {
     if (mappedMemory == nullptr) {
@@ -1,13 +1,23 @@
 #include <vde/Camera.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 namespace vde {
 
+namespace {
+// Shared by every camera so versions are unique across instances
+std::atomic<uint64_t> g_nextCameraVersion{1};
+
+uint64_t nextVersion() {
+    return g_nextCameraVersion.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace
+
 Camera::Camera()
     : m_position(0.0f, 10.0f, 10.0f), m_target(0.0f, 0.0f, 0.0f), m_up(0.0f, 1.0f, 0.0f),
-      m_pitch(45.0f), m_yaw(0.0f) {
+      m_pitch(45.0f), m_yaw(0.0f), m_version(nextVersion()) {
     // Default distance for typical use
     m_distance = 20.0f;
 
@@ -16,27 +26,45 @@ Camera::Camera()
 }
 
 void Camera::setPosition(const glm::vec3& position) {
+    if (position == m_position) {
+        return;
+    }
     m_position = position;
     // Update orbital parameters to match
     m_distance = glm::length(m_target - m_position);
+    m_version = nextVersion();
 }
 
 void Camera::setTarget(const glm::vec3& target) {
+    if (target == m_target) {
+        return;
+    }
     m_target = target;
     // Update orbital parameters to match
     m_distance = glm::length(m_target - m_position);
+    m_version = nextVersion();
 }
 
 void Camera::setUp(const glm::vec3& up) {
-    m_up = glm::normalize(up);
+    glm::vec3 normalized = glm::normalize(up);
+    if (normalized == m_up) {
+        return;
+    }
+    m_up = normalized;
+    m_version = nextVersion();
 }
 
 void Camera::setFromPitchYaw(float distance, float pitch, float yaw, const glm::vec3& target) {
+    const glm::vec3 oldPosition = m_position;
+    const glm::vec3 oldTarget = m_target;
     m_distance = std::clamp(distance, MIN_DISTANCE, MAX_DISTANCE);
     m_pitch = std::clamp(pitch, MIN_PITCH, MAX_PITCH);
     m_yaw = yaw;
     m_target = target;
     updatePositionFromOrbit();
+    if (m_position != oldPosition || m_target != oldTarget) {
+        m_version = nextVersion();
+    }
 }
 
 void Camera::updatePositionFromOrbit() {
@@ -52,8 +80,12 @@ void Camera::updatePositionFromOrbit() {
 }
 
 void Camera::translate(const glm::vec3& delta) {
+    if (delta == glm::vec3(0.0f)) {
+        return;
+    }
     m_position += delta;
     m_target += delta;
+    m_version = nextVersion();
 }
 
 void Camera::pan(float deltaX, float deltaY) {
@@ -75,7 +107,11 @@ void Camera::zoom(float delta) {
     m_distance = std::clamp(m_distance, MIN_DISTANCE, MAX_DISTANCE);
 
     // Recalculate position
+    const glm::vec3 oldPosition = m_position;
     m_position = m_target - forward * m_distance;
+    if (m_position != oldPosition) {
+        m_version = nextVersion();
+    }
 }
 
 glm::mat4 Camera::getViewMatrix() const {
@@ -91,22 +127,42 @@ glm::vec3 Camera::getRight() const {
 }
 
 void Camera::setPerspective(float fov, float aspectRatio, float nearPlane, float farPlane) {
-    m_fov = glm::clamp(fov, 10.0f, 120.0f);
+    fov = glm::clamp(fov, 10.0f, 120.0f);
+    if (fov == m_fov && aspectRatio == m_aspectRatio && nearPlane == m_nearPlane &&
+        farPlane == m_farPlane) {
+        return;
+    }
+    m_fov = fov;
     m_aspectRatio = aspectRatio;
     m_nearPlane = nearPlane;
     m_farPlane = farPlane;
+    m_version = nextVersion();
 }
 
 void Camera::setAspectRatio(float aspectRatio) {
+    if (aspectRatio == m_aspectRatio) {
+        return;
+    }
     m_aspectRatio = aspectRatio;
+    m_version = nextVersion();
 }
 
 void Camera::setFOV(float fov) {
-    m_fov = glm::clamp(fov, 10.0f, 120.0f);
+    fov = glm::clamp(fov, 10.0f, 120.0f);
+    if (fov == m_fov) {
+        return;
+    }
+    m_fov = fov;
+    m_version = nextVersion();
 }
 
 void Camera::setOrthographic(float left, float right, float bottom, float top, float nearPlane,
                              float farPlane) {
+    if (m_orthographic && left == m_orthoLeft && right == m_orthoRight &&
+        bottom == m_orthoBottom && top == m_orthoTop && nearPlane == m_nearPlane &&
+        farPlane == m_farPlane) {
+        return;
+    }
     m_orthographic = true;
     m_orthoLeft = left;
     m_orthoRight = right;
@@ -114,6 +170,7 @@ void Camera::setOrthographic(float left, float right, float bottom, float top, f
     m_orthoTop = top;
     m_nearPlane = nearPlane;
     m_farPlane = farPlane;
+    m_version = nextVersion();
 }
 
 glm::mat4 Camera::getProjectionMatrix() const {
@@ -10,8 +10,9 @@ DescriptorManager::~DescriptorManager() {
 }
 
 DescriptorManager::DescriptorManager(DescriptorManager&& other) noexcept
-    : m_device(other.m_device), m_uboLayout(other.m_uboLayout),
-      m_samplerLayout(other.m_samplerLayout), m_descriptorPool(other.m_descriptorPool) {
+    : m_device(other.m_device), m_framesInFlight(other.m_framesInFlight),
+      m_uboLayout(other.m_uboLayout), m_samplerLayout(other.m_samplerLayout),
+      m_descriptorPool(other.m_descriptorPool) {
     // Nullify source to prevent double cleanup
     other.m_device = VK_NULL_HANDLE;
     other.m_uboLayout = VK_NULL_HANDLE;
@@ -24,6 +25,7 @@ DescriptorManager& DescriptorManager::operator=(DescriptorManager&& other) noexc
         cleanup();
 
         m_device = other.m_device;
+        m_framesInFlight = other.m_framesInFlight;
         m_uboLayout = other.m_uboLayout;
         m_samplerLayout = other.m_samplerLayout;
         m_descriptorPool = other.m_descriptorPool;
@@ -36,12 +38,13 @@ DescriptorManager& DescriptorManager::operator=(DescriptorManager&& other) noexc
     return *this;
 }
 
-void DescriptorManager::init(VkDevice device) {
+void DescriptorManager::init(VkDevice device, uint32_t framesInFlight) {
     if (device == VK_NULL_HANDLE) {
         throw std::runtime_error("Cannot initialize DescriptorManager with null device!");
     }
 
     m_device = device;
+    m_framesInFlight = framesInFlight;
 
     createUBOLayout();
     createSamplerLayout();
@@ -71,7 +74,7 @@ void DescriptorManager::cleanup() {
 void DescriptorManager::createUBOLayout() {
     VkDescriptorSetLayoutBinding uboLayoutBinding{};
     uboLayoutBinding.binding = 0;
-    uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     uboLayoutBinding.descriptorCount = 1;
     uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
     uboLayoutBinding.pImmutableSamplers = nullptr;
@@ -108,9 +111,9 @@ void DescriptorManager::createSamplerLayout() {
 void DescriptorManager::createDescriptorPool() {
     std::array<VkDescriptorPoolSize, 2> poolSizes{};
 
-    // Uniform buffers (one per frame for camera data)
-    poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSizes[0].descriptorCount = MAX_FRAMES_IN_FLIGHT;
+    // Uniform buffers (one per frame for camera data, one slot per view)
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    poolSizes[0].descriptorCount = m_framesInFlight;
 
     // Combined image samplers (for textures)
     poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -120,7 +123,7 @@ void DescriptorManager::createDescriptorPool() {
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
     poolInfo.pPoolSizes = poolSizes.data();
-    poolInfo.maxSets = MAX_FRAMES_IN_FLIGHT + MAX_TEXTURES;
+    poolInfo.maxSets = m_framesInFlight + MAX_TEXTURES;
 
     if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create descriptor pool!");
@@ -132,7 +135,7 @@ std::vector<VkDescriptorSet> DescriptorManager::allocateUBODescriptorSets() {
         throw std::runtime_error("DescriptorManager not initialized!");
     }
 
-    std::vector<VkDescriptorSetLayout> layouts(MAX_FRAMES_IN_FLIGHT, m_uboLayout);
+    std::vector<VkDescriptorSetLayout> layouts(m_framesInFlight, m_uboLayout);
 
     VkDescriptorSetAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
@@ -140,7 +143,7 @@ std::vector<VkDescriptorSet> DescriptorManager::allocateUBODescriptorSets() {
     allocInfo.descriptorSetCount = static_cast<uint32_t>(layouts.size());
     allocInfo.pSetLayouts = layouts.data();
 
-    std::vector<VkDescriptorSet> descriptorSets(MAX_FRAMES_IN_FLIGHT);
+    std::vector<VkDescriptorSet> descriptorSets(m_framesInFlight);
     if (vkAllocateDescriptorSets(m_device, &allocInfo, descriptorSets.data()) != VK_SUCCESS) {
         throw std::runtime_error("Failed to allocate UBO descriptor sets!");
     }
@@ -183,7 +186,7 @@ void DescriptorManager::updateUBODescriptor(VkDescriptorSet descriptorSet, VkBuf
     descriptorWrite.dstSet = descriptorSet;
     descriptorWrite.dstBinding = 0;
     descriptorWrite.dstArrayElement = 0;
-    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     descriptorWrite.descriptorCount = 1;
     descriptorWrite.pBufferInfo = &bufferInfo;
 
@@ -0,0 +1,138 @@
+/**
+ * @file FrameAllocator.cpp
+ * @brief Implementation of the per-frame linear allocator
+ */
+
+#include <vde/BufferUtils.h>
+#include <vde/FrameAllocator.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace vde {
+
+// ============================================================================
+// LinearAllocator
+// ============================================================================
+
+uint64_t LinearAllocator::allocate(uint64_t size, uint64_t alignment) {
+    if (alignment == 0) {
+        alignment = 1;
+    }
+    uint64_t offset = (m_used + alignment - 1) & ~(alignment - 1);
+
+    // Track what the frame wanted even when it does not fit, so the
+    // high-water mark tells how big the region should have been
+    uint64_t requestedOffset = (m_requested + alignment - 1) & ~(alignment - 1);
+    m_requested = requestedOffset + size;
+    m_highWaterMark = std::max(m_highWaterMark, m_requested);
+
+    if (size == 0 || offset > m_capacity || size > m_capacity - offset) {
+        m_failed++;
+        return INVALID_OFFSET;
+    }
+    m_used = offset + size;
+    return offset;
+}
+
+void LinearAllocator::reset() {
+    m_used = 0;
+    m_requested = 0;
+    m_failed = 0;
+}
+
+// ============================================================================
+// FrameAllocator
+// ============================================================================
+
+FrameAllocator::~FrameAllocator() {
+    destroy();
+}
+
+void FrameAllocator::create(uint32_t frameCount, VkDeviceSize capacity,
+                            VkDeviceSize uniformAlignment, VkDeviceSize storageAlignment) {
+    destroy();
+    if (frameCount == 0 || capacity == 0) {
+        throw std::runtime_error("FrameAllocator requires at least one frame and a capacity");
+    }
+
+    m_capacity = capacity;
+    m_uniformAlignment = std::max<VkDeviceSize>(uniformAlignment, 1);
+    m_storageAlignment = std::max<VkDeviceSize>(storageAlignment, 1);
+    m_currentFrame = 0;
+
+    m_frames.resize(frameCount);
+    try {
+        for (Frame& frame : m_frames) {
+            BufferUtils::createBuffer(
+                capacity, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                frame.buffer, frame.allocation);
+            if (!frame.allocation.mapped) {
+                throw std::runtime_error("FrameAllocator buffer is not host-mapped");
+            }
+            frame.ranges = LinearAllocator(capacity);
+        }
+    } catch (...) {
+        destroy();
+        throw;
+    }
+}
+
+void FrameAllocator::destroy() {
+    for (Frame& frame : m_frames) {
+        BufferUtils::destroyBuffer(frame.buffer, frame.allocation);
+    }
+    m_frames.clear();
+    m_capacity = 0;
+    m_currentFrame = 0;
+}
+
+void FrameAllocator::beginFrame(uint32_t frame) {
+    if (frame >= m_frames.size()) {
+        return;
+    }
+    m_currentFrame = frame;
+    m_frames[frame].ranges.reset();
+}
+
+FrameAllocation FrameAllocator::allocate(VkDeviceSize size, VkDeviceSize alignment) {
+    FrameAllocation result;
+    if (m_frames.empty()) {
+        return result;
+    }
+
+    Frame& frame = m_frames[m_currentFrame];
+    uint64_t offset = frame.ranges.allocate(size, alignment);
+    if (offset == LinearAllocator::INVALID_OFFSET) {
+        return result;
+    }
+
+    result.buffer = frame.buffer;
+    result.offset = static_cast<uint32_t>(offset);
+    result.size = size;
+    result.mapped = static_cast<char*>(frame.allocation.mapped) + offset;
+    return result;
+}
+
+VkDeviceSize FrameAllocator::getUsedBytes() const {
+    return m_frames.empty() ? 0 : m_frames[m_currentFrame].ranges.getUsedBytes();
+}
+
+VkDeviceSize FrameAllocator::getHighWaterMark() const {
+    VkDeviceSize highWaterMark = 0;
+    for (const Frame& frame : m_frames) {
+        highWaterMark = std::max<VkDeviceSize>(highWaterMark, frame.ranges.getHighWaterMark());
+    }
+    return highWaterMark;
+}
+
+VkDeviceSize FrameAllocator::getHighWaterMark(uint32_t frame) const {
+    return frame < m_frames.size() ? m_frames[frame].ranges.getHighWaterMark() : 0;
+}
+
+uint32_t FrameAllocator::getFailedCount() const {
+    return m_frames.empty() ? 0 : m_frames[m_currentFrame].ranges.getFailedCount();
+}
+
+}  // namespace vde
@@ -0,0 +1,28 @@
+/**
+ * @file FrameContext.cpp
+ * @brief Implementation of FramePacer
+ */
+
+#include <vde/FrameContext.h>
+
+#include <algorithm>
+
+namespace vde {
+
+uint32_t FramePacer::clampFrameCount(uint32_t framesInFlight) {
+    return std::clamp(framesInFlight, MIN_FRAMES_IN_FLIGHT, MAX_FRAMES_IN_FLIGHT);
+}
+
+void FramePacer::reset(uint32_t framesInFlight) {
+    m_framesInFlight = clampFrameCount(framesInFlight);
+    m_currentSlot = 0;
+    m_submittedValue = 0;
+    m_slotValues.fill(0);
+}
+
+uint64_t FramePacer::submit() {
+    m_slotValues[m_currentSlot] = ++m_submittedValue;
+    return m_submittedValue;
+}
+
+}  // namespace vde
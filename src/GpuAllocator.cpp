@@ -0,0 +1,604 @@
+/**
+ * @file GpuAllocator.cpp
+ * @brief Implementation of the TLSF-based device memory allocator
+ */
+
+#include <vde/GpuAllocator.h>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace vde {
+
+namespace {
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+uint32_t mostSignificantBit(uint64_t value) {
+    return static_cast<uint32_t>(std::bit_width(value)) - 1;
+}
+
+}  // namespace
+
+// ============================================================================
+// TlsfAllocator
+// ============================================================================
+
+TlsfAllocator::TlsfAllocator(uint64_t capacity) : m_capacity(capacity & ~(MIN_ALIGNMENT - 1)) {
+    for (auto& row : m_freeHeads) {
+        row.fill(NIL);
+    }
+
+    if (m_capacity > 0) {
+        uint32_t root = createNode();
+        m_nodes[root].offset = 0;
+        m_nodes[root].size = m_capacity;
+        insertFree(root);
+    }
+}
+
+void TlsfAllocator::mapping(uint64_t size, uint32_t& fl, uint32_t& sl) {
+    if (size < SMALL_BLOCK_SIZE) {
+        fl = 0;
+        sl = static_cast<uint32_t>(size / (SMALL_BLOCK_SIZE / SL_INDEX_COUNT));
+    } else {
+        uint32_t msb = mostSignificantBit(size);
+        sl = static_cast<uint32_t>(size >> (msb - SL_INDEX_COUNT_LOG2)) ^ SL_INDEX_COUNT;
+        fl = msb - (FL_INDEX_SHIFT - 1);
+    }
+}
+
+void TlsfAllocator::mappingSearch(uint64_t size, uint32_t& fl, uint32_t& sl) {
+    // Round up to the next list boundary so any block found is large enough
+    if (size >= SMALL_BLOCK_SIZE) {
+        size += (1ull << (mostSignificantBit(size) - SL_INDEX_COUNT_LOG2)) - 1;
+    }
+    mapping(size, fl, sl);
+}
+
+uint32_t TlsfAllocator::createNode() {
+    if (!m_unusedNodes.empty()) {
+        uint32_t index = m_unusedNodes.back();
+        m_unusedNodes.pop_back();
+        m_nodes[index] = Node{};
+        return index;
+    }
+    m_nodes.emplace_back();
+    return static_cast<uint32_t>(m_nodes.size() - 1);
+}
+
+void TlsfAllocator::releaseNode(uint32_t index) {
+    m_nodes[index] = Node{};
+    m_unusedNodes.push_back(index);
+}
+
+void TlsfAllocator::insertFree(uint32_t index) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    mapping(m_nodes[index].size, fl, sl);
+
+    uint32_t head = m_freeHeads[fl][sl];
+    m_nodes[index].prevFree = NIL;
+    m_nodes[index].nextFree = head;
+    m_nodes[index].free = true;
+    if (head != NIL) {
+        m_nodes[head].prevFree = index;
+    }
+    m_freeHeads[fl][sl] = index;
+
+    m_flBitmap |= 1ull << fl;
+    m_slBitmap[fl] |= 1u << sl;
+}
+
+void TlsfAllocator::removeFree(uint32_t index) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    mapping(m_nodes[index].size, fl, sl);
+
+    Node& node = m_nodes[index];
+    if (node.prevFree != NIL) {
+        m_nodes[node.prevFree].nextFree = node.nextFree;
+    }
+    if (node.nextFree != NIL) {
+        m_nodes[node.nextFree].prevFree = node.prevFree;
+    }
+    if (m_freeHeads[fl][sl] == index) {
+        m_freeHeads[fl][sl] = node.nextFree;
+        if (node.nextFree == NIL) {
+            m_slBitmap[fl] &= ~(1u << sl);
+            if (m_slBitmap[fl] == 0) {
+                m_flBitmap &= ~(1ull << fl);
+            }
+        }
+    }
+    node.prevFree = NIL;
+    node.nextFree = NIL;
+    node.free = false;
+}
+
+uint32_t TlsfAllocator::findFree(uint64_t size) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    mappingSearch(size, fl, sl);
+    if (fl >= FL_INDEX_COUNT) {
+        return NIL;
+    }
+
+    uint32_t slMap = m_slBitmap[fl] & (~0u << sl);
+    if (slMap == 0) {
+        uint64_t flMap = (fl + 1 < 64) ? m_flBitmap & (~0ull << (fl + 1)) : 0;
+        if (flMap != 0) {
+            fl = static_cast<uint32_t>(std::countr_zero(flMap));
+            slMap = m_slBitmap[fl];
+        }
+    }
+    if (slMap != 0) {
+        sl = static_cast<uint32_t>(std::countr_zero(slMap));
+        return m_freeHeads[fl][sl];
+    }
+
+    // Nothing in a larger list: the exact list may still hold a block that
+    // fits (e.g. a request for the whole region)
+    mapping(size, fl, sl);
+    for (uint32_t index = m_freeHeads[fl][sl]; index != NIL; index = m_nodes[index].nextFree) {
+        if (m_nodes[index].size >= size) {
+            return index;
+        }
+    }
+    return NIL;
+}
+
+uint32_t TlsfAllocator::splitFront(uint32_t index, uint64_t frontSize) {
+    uint32_t front = createNode();  // may reallocate m_nodes
+
+    Node& node = m_nodes[index];
+    Node& piece = m_nodes[front];
+    piece.offset = node.offset;
+    piece.size = frontSize;
+    piece.prevPhysical = node.prevPhysical;
+    piece.nextPhysical = index;
+    if (node.prevPhysical != NIL) {
+        m_nodes[node.prevPhysical].nextPhysical = front;
+    }
+
+    node.offset += frontSize;
+    node.size -= frontSize;
+    node.prevPhysical = front;
+    return front;
+}
+
+uint32_t TlsfAllocator::allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset) {
+    if (size == 0) {
+        return INVALID_HANDLE;
+    }
+    alignment = std::max(alignment, MIN_ALIGNMENT);
+    if (!std::has_single_bit(alignment)) {
+        return INVALID_HANDLE;
+    }
+
+    size = alignUp(size, MIN_ALIGNMENT);
+    if (size > m_capacity) {
+        return INVALID_HANDLE;
+    }
+
+    // Offsets are always MIN_ALIGNMENT aligned, so only larger alignments
+    // need room for padding
+    uint64_t searchSize = size + (alignment - MIN_ALIGNMENT);
+    uint32_t index = findFree(searchSize);
+    if (index == NIL) {
+        return INVALID_HANDLE;
+    }
+    removeFree(index);
+
+    // Leading padding becomes its own free range
+    uint64_t padding = alignUp(m_nodes[index].offset, alignment) - m_nodes[index].offset;
+    if (padding > 0) {
+        uint32_t pad = splitFront(index, padding);
+        insertFree(pad);
+    }
+
+    // Trailing remainder stays free
+    if (m_nodes[index].size > size) {
+        uint32_t used = splitFront(index, size);
+        insertFree(index);
+        index = used;
+    }
+
+    m_usedBytes += m_nodes[index].size;
+    m_allocationCount++;
+    outOffset = m_nodes[index].offset;
+    return index;
+}
+
+void TlsfAllocator::free(uint32_t handle) {
+    if (handle >= m_nodes.size() || m_nodes[handle].free || m_nodes[handle].size == 0) {
+        return;
+    }
+
+    m_usedBytes -= m_nodes[handle].size;
+    m_allocationCount--;
+
+    // Merge with the previous range
+    uint32_t prev = m_nodes[handle].prevPhysical;
+    if (prev != NIL && m_nodes[prev].free) {
+        removeFree(prev);
+        m_nodes[prev].size += m_nodes[handle].size;
+        m_nodes[prev].nextPhysical = m_nodes[handle].nextPhysical;
+        if (m_nodes[handle].nextPhysical != NIL) {
+            m_nodes[m_nodes[handle].nextPhysical].prevPhysical = prev;
+        }
+        releaseNode(handle);
+        handle = prev;
+    }
+
+    // Merge with the next range
+    uint32_t next = m_nodes[handle].nextPhysical;
+    if (next != NIL && m_nodes[next].free) {
+        removeFree(next);
+        m_nodes[handle].size += m_nodes[next].size;
+        m_nodes[handle].nextPhysical = m_nodes[next].nextPhysical;
+        if (m_nodes[next].nextPhysical != NIL) {
+            m_nodes[m_nodes[next].nextPhysical].prevPhysical = handle;
+        }
+        releaseNode(next);
+    }
+
+    insertFree(handle);
+}
+
+uint64_t TlsfAllocator::getAllocationSize(uint32_t handle) const {
+    if (handle >= m_nodes.size() || m_nodes[handle].free) {
+        return 0;
+    }
+    return m_nodes[handle].size;
+}
+
+uint32_t TlsfAllocator::getFreeRegionCount() const {
+    uint32_t count = 0;
+    for (const auto& node : m_nodes) {
+        if (node.free) {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint64_t TlsfAllocator::getLargestFreeRegion() const {
+    uint64_t largest = 0;
+    for (const auto& node : m_nodes) {
+        if (node.free) {
+            largest = std::max(largest, node.size);
+        }
+    }
+    return largest;
+}
+
+// ============================================================================
+// GpuAllocator
+// ============================================================================
+
+GpuAllocator::~GpuAllocator() {
+    shutdown();
+}
+
+void GpuAllocator::init(VkDevice device, VkPhysicalDevice physicalDevice,
+                        bool memoryBudgetSupported, VkDeviceSize preferredBlockSize) {
+    shutdown();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_device = device;
+    m_physicalDevice = physicalDevice;
+    m_memoryBudgetSupported = memoryBudgetSupported;
+    m_preferredBlockSize = preferredBlockSize;
+    m_generation++;
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_memoryProperties);
+}
+
+void GpuAllocator::shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    for (auto& block : m_blocks) {
+        if (block && block->memory != VK_NULL_HANDLE) {
+            // vkFreeMemory implicitly unmaps
+            vkFreeMemory(m_device, block->memory, nullptr);
+        }
+    }
+    for (const auto& dedicated : m_dedicated) {
+        vkFreeMemory(m_device, dedicated.memory, nullptr);
+    }
+
+    m_blocks.clear();
+    m_freeBlockSlots.clear();
+    m_dedicated.clear();
+    m_heapReserved.fill(0);
+    m_deviceMemoryObjects = 0;
+    m_device = VK_NULL_HANDLE;
+    m_physicalDevice = VK_NULL_HANDLE;
+}
+
+VkDeviceSize GpuAllocator::getBlockSize(uint32_t memoryTypeIndex) const {
+    uint32_t heapIndex = m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    VkDeviceSize heapSize = m_memoryProperties.memoryHeaps[heapIndex].size;
+
+    // Small heaps (e.g. 256 MB BAR memory) get proportionally smaller blocks
+    constexpr VkDeviceSize kSmallHeapLimit = 1024ull * 1024 * 1024;
+    if (heapSize <= kSmallHeapLimit) {
+        return alignUp(heapSize / 8, TlsfAllocator::MIN_ALIGNMENT);
+    }
+    return m_preferredBlockSize;
+}
+
+uint32_t GpuAllocator::findMemoryType(uint32_t typeFilter,
+                                      VkMemoryPropertyFlags properties) const {
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++) {
+        if ((typeFilter & (1u << i)) &&
+            (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    throw std::runtime_error("Failed to find suitable memory type!");
+}
+
+bool GpuAllocator::allocateDeviceMemory(VkDeviceSize size, uint32_t memoryTypeIndex,
+                                        VkDeviceMemory& memory, void*& mapped) {
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    if (vkAllocateMemory(m_device, &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+        memory = VK_NULL_HANDLE;
+        return false;
+    }
+
+    // Host-visible memory stays persistently mapped
+    mapped = nullptr;
+    if (m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags &
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        if (vkMapMemory(m_device, memory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS) {
+            vkFreeMemory(m_device, memory, nullptr);
+            memory = VK_NULL_HANDLE;
+            return false;
+        }
+    }
+
+    uint32_t heapIndex = m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    m_heapReserved[heapIndex] += size;
+    m_deviceMemoryObjects++;
+    return true;
+}
+
+void GpuAllocator::freeDeviceMemory(VkDeviceMemory memory, VkDeviceSize size,
+                                    uint32_t memoryTypeIndex) {
+    vkFreeMemory(m_device, memory, nullptr);
+
+    uint32_t heapIndex = m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    m_heapReserved[heapIndex] -= size;
+    m_deviceMemoryObjects--;
+}
+
+uint32_t GpuAllocator::createBlock(uint32_t memoryTypeIndex, uint32_t poolIndex) {
+    VkDeviceSize blockSize = getBlockSize(memoryTypeIndex);
+
+    auto block = std::make_unique<Block>();
+    if (!allocateDeviceMemory(blockSize, memoryTypeIndex, block->memory, block->mapped)) {
+        return UINT32_MAX;
+    }
+    block->memoryTypeIndex = memoryTypeIndex;
+    block->poolIndex = poolIndex;
+    block->ranges = std::make_unique<TlsfAllocator>(blockSize);
+
+    if (!m_freeBlockSlots.empty()) {
+        uint32_t slot = m_freeBlockSlots.back();
+        m_freeBlockSlots.pop_back();
+        m_blocks[slot] = std::move(block);
+        return slot;
+    }
+    m_blocks.push_back(std::move(block));
+    return static_cast<uint32_t>(m_blocks.size() - 1);
+}
+
+void GpuAllocator::releaseBlock(uint32_t blockIndex) {
+    Block& block = *m_blocks[blockIndex];
+    freeDeviceMemory(block.memory, block.ranges->getCapacity(), block.memoryTypeIndex);
+    m_blocks[blockIndex].reset();
+    m_freeBlockSlots.push_back(blockIndex);
+}
+
+GpuAllocation GpuAllocator::allocate(const VkMemoryRequirements& requirements,
+                                     VkMemoryPropertyFlags properties, bool linear) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        throw std::runtime_error("GpuAllocator not initialized!");
+    }
+
+    uint32_t memoryTypeIndex = findMemoryType(requirements.memoryTypeBits, properties);
+    VkDeviceSize blockSize = getBlockSize(memoryTypeIndex);
+
+    GpuAllocation allocation;
+    allocation.memoryTypeIndex = memoryTypeIndex;
+    allocation.generation = m_generation;
+
+    // Large resources get their own memory object
+    if (requirements.size > blockSize / 2) {
+        void* mapped = nullptr;
+        if (!allocateDeviceMemory(requirements.size, memoryTypeIndex, allocation.memory,
+                                  mapped)) {
+            throw std::runtime_error("Failed to allocate device memory!");
+        }
+        allocation.size = requirements.size;
+        allocation.mapped = mapped;
+        m_dedicated.push_back({allocation.memory, requirements.size, memoryTypeIndex});
+        return allocation;
+    }
+
+    const uint32_t poolIndex = memoryTypeIndex * 2 + (linear ? 0 : 1);
+
+    auto tryBlock = [&](uint32_t blockIndex) {
+        Block& block = *m_blocks[blockIndex];
+        uint64_t offset = 0;
+        uint32_t handle = block.ranges->allocate(requirements.size, requirements.alignment, offset);
+        if (handle == TlsfAllocator::INVALID_HANDLE) {
+            return false;
+        }
+        allocation.memory = block.memory;
+        allocation.offset = offset;
+        allocation.size = block.ranges->getAllocationSize(handle);
+        allocation.mapped = block.mapped ? static_cast<char*>(block.mapped) + offset : nullptr;
+        allocation.blockIndex = blockIndex;
+        allocation.handle = handle;
+        return true;
+    };
+
+    for (uint32_t i = 0; i < m_blocks.size(); ++i) {
+        if (m_blocks[i] && m_blocks[i]->poolIndex == poolIndex && tryBlock(i)) {
+            return allocation;
+        }
+    }
+
+    uint32_t blockIndex = createBlock(memoryTypeIndex, poolIndex);
+    if (blockIndex == UINT32_MAX || !tryBlock(blockIndex)) {
+        throw std::runtime_error("Failed to allocate device memory block!");
+    }
+    return allocation;
+}
+
+GpuAllocation GpuAllocator::allocateForBuffer(VkBuffer buffer, VkMemoryPropertyFlags properties) {
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(m_device, buffer, &requirements);
+
+    GpuAllocation allocation = allocate(requirements, properties, true);
+    if (vkBindBufferMemory(m_device, buffer, allocation.memory, allocation.offset) != VK_SUCCESS) {
+        free(allocation);
+        throw std::runtime_error("Failed to bind buffer memory!");
+    }
+    return allocation;
+}
+
+GpuAllocation GpuAllocator::allocateForImage(VkImage image, VkMemoryPropertyFlags properties,
+                                             VkImageTiling tiling) {
+    VkMemoryRequirements requirements;
+    vkGetImageMemoryRequirements(m_device, image, &requirements);
+
+    GpuAllocation allocation =
+        allocate(requirements, properties, tiling == VK_IMAGE_TILING_LINEAR);
+    if (vkBindImageMemory(m_device, image, allocation.memory, allocation.offset) != VK_SUCCESS) {
+        free(allocation);
+        throw std::runtime_error("Failed to bind image memory!");
+    }
+    return allocation;
+}
+
+void GpuAllocator::free(GpuAllocation& allocation) {
+    if (!allocation.isValid()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Allocations from before a shutdown()/init() cycle are already gone
+    if (m_device == VK_NULL_HANDLE || allocation.generation != m_generation) {
+        allocation = GpuAllocation{};
+        return;
+    }
+
+    if (allocation.isDedicated()) {
+        auto it = std::find_if(m_dedicated.begin(), m_dedicated.end(),
+                               [&](const Dedicated& d) { return d.memory == allocation.memory; });
+        if (it != m_dedicated.end()) {
+            freeDeviceMemory(it->memory, it->size, it->memoryTypeIndex);
+            m_dedicated.erase(it);
+        }
+        allocation = GpuAllocation{};
+        return;
+    }
+
+    if (allocation.blockIndex < m_blocks.size() && m_blocks[allocation.blockIndex]) {
+        Block& block = *m_blocks[allocation.blockIndex];
+        block.ranges->free(allocation.handle);
+
+        // Keep one empty block per pool to avoid allocation churn
+        if (block.ranges->isEmpty()) {
+            for (uint32_t i = 0; i < m_blocks.size(); ++i) {
+                if (i != allocation.blockIndex && m_blocks[i] &&
+                    m_blocks[i]->poolIndex == block.poolIndex && m_blocks[i]->ranges->isEmpty()) {
+                    releaseBlock(allocation.blockIndex);
+                    break;
+                }
+            }
+        }
+    }
+
+    allocation = GpuAllocation{};
+}
+
+GpuMemoryStats GpuAllocator::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    GpuMemoryStats stats;
+    for (const auto& block : m_blocks) {
+        if (!block) {
+            continue;
+        }
+        stats.blockCount++;
+        stats.allocationCount += block->ranges->getAllocationCount();
+        stats.reservedBytes += block->ranges->getCapacity();
+        stats.usedBytes += block->ranges->getUsedBytes();
+        stats.freeRegionCount += block->ranges->getFreeRegionCount();
+        stats.largestFreeRegion =
+            std::max(stats.largestFreeRegion, block->ranges->getLargestFreeRegion());
+    }
+
+    for (const auto& dedicated : m_dedicated) {
+        stats.dedicatedAllocationCount++;
+        stats.allocationCount++;
+        stats.reservedBytes += dedicated.size;
+        stats.usedBytes += dedicated.size;
+    }
+
+    stats.deviceMemoryObjects = m_deviceMemoryObjects;
+    return stats;
+}
+
+std::vector<GpuHeapBudget> GpuAllocator::queryBudget() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<GpuHeapBudget> budgets;
+    if (m_physicalDevice == VK_NULL_HANDLE) {
+        return budgets;
+    }
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties{};
+    budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    if (m_memoryBudgetSupported) {
+        VkPhysicalDeviceMemoryProperties2 properties2{};
+        properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        properties2.pNext = &budgetProperties;
+        vkGetPhysicalDeviceMemoryProperties2(m_physicalDevice, &properties2);
+    }
+
+    budgets.reserve(m_memoryProperties.memoryHeapCount);
+    for (uint32_t i = 0; i < m_memoryProperties.memoryHeapCount; ++i) {
+        GpuHeapBudget heap;
+        heap.heapIndex = i;
+        heap.heapSize = m_memoryProperties.memoryHeaps[i].size;
+        heap.allocator = m_heapReserved[i];
+        if (m_memoryBudgetSupported) {
+            heap.budget = budgetProperties.heapBudget[i];
+            heap.usage = budgetProperties.heapUsage[i];
+        } else {
+            heap.budget = heap.heapSize / 10 * 8;
+            heap.usage = m_heapReserved[i];
+        }
+        budgets.push_back(heap);
+    }
+    return budgets;
+}
+
+}  // namespace vde
@@ -1,23 +1,61 @@
 #include <vde/HexGeometry.h>
+#include <vde/api/ThreadPool.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <functional>
 
 namespace vde {
 
 namespace {
-constexpr float PI = 3.14159265358979323846f;
-constexpr float DEG_TO_RAD = PI / 180.0f;
+constexpr float SQRT3 = 1.73205080756887729353f;
+constexpr float HALF_SQRT3 = SQRT3 * 0.5f;
+
+// Unit corner offsets (x, z), counter-clockwise from corner 0, for each
+// orientation: flat-top corners sit at 0, 60, ... degrees, pointy-top at 30, 90, ...
+using CornerTable = std::array<std::array<float, 2>, 6>;
+
+constexpr CornerTable FLAT_TOP_CORNERS = {{{1.0f, 0.0f},
+                                           {0.5f, HALF_SQRT3},
+                                           {-0.5f, HALF_SQRT3},
+                                           {-1.0f, 0.0f},
+                                           {-0.5f, -HALF_SQRT3},
+                                           {0.5f, -HALF_SQRT3}}};
+
+constexpr CornerTable POINTY_TOP_CORNERS = {{{HALF_SQRT3, 0.5f},
+                                             {0.0f, 1.0f},
+                                             {-HALF_SQRT3, 0.5f},
+                                             {-HALF_SQRT3, -0.5f},
+                                             {0.0f, -1.0f},
+                                             {HALF_SQRT3, -0.5f}}};
+
+// Center fan (center + 2 adjacent corners each), relative to the cell's first vertex
+constexpr std::array<uint32_t, HexGeometry::INDICES_PER_HEX> HEX_FAN_INDICES = {
+    0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 4, 5, 0, 5, 6, 0, 6, 1};
+
+const CornerTable& cornerTable(HexOrientation orientation) {
+    return orientation == HexOrientation::FlatTop ? FLAT_TOP_CORNERS : POINTY_TOP_CORNERS;
+}
+
+// Runs body(firstRow, endRow) over blocks of about CELLS_PER_TASK cells,
+// on the workers when there is more than one block
+void forEachRowBlock(uint32_t rows, size_t cellsPerRow, ThreadPool* workers,
+                     const std::function<void(uint32_t, uint32_t)>& body) {
+    const size_t rowsPerTask =
+        std::max<size_t>(1, HexGeometry::CELLS_PER_TASK / std::max<size_t>(1, cellsPerRow));
+    const size_t taskCount = (rows + rowsPerTask - 1) / rowsPerTask;
+    ThreadPool::parallelFor(workers, taskCount, [&](size_t task) {
+        auto first = static_cast<uint32_t>(task * rowsPerTask);
+        auto end = static_cast<uint32_t>(std::min<size_t>(rows, first + rowsPerTask));
+        body(first, end);
+    });
+}
 }  // namespace
 
 HexGeometry::HexGeometry(float size, HexOrientation orientation)
     : m_size(size), m_orientation(orientation) {}
 
-float HexGeometry::getStartAngle() const {
-    // Flat-top: first corner at 0° (right side)
-    // Pointy-top: first corner at 30°
-    return (m_orientation == HexOrientation::FlatTop) ? 0.0f : 30.0f * DEG_TO_RAD;
-}
-
 float HexGeometry::getWidth() const {
     // For flat-top: width = 2 * size (tip to tip)
     // For pointy-top: width = sqrt(3) * size (flat to flat)
@@ -42,63 +80,123 @@ std::vector<glm::vec3> HexGeometry::getCornerPositions(const glm::vec3& center)
     std::vector<glm::vec3> corners;
     corners.reserve(6);
 
-    float startAngle = getStartAngle();
-
-    for (int i = 0; i < 6; i++) {
-        float angle = startAngle + i * (PI / 3.0f);  // 60 degrees between corners
-        // Generate corners in XZ plane (Y is up)
-        float x = center.x + m_size * std::cos(angle);
-        float z = center.z + m_size * std::sin(angle);
-        corners.emplace_back(x, center.y, z);
+    // Generate corners in XZ plane (Y is up)
+    for (const auto& corner : cornerTable(m_orientation)) {
+        corners.emplace_back(center.x + m_size * corner[0], center.y,
+                             center.z + m_size * corner[1]);
     }
 
     return corners;
 }
 
-glm::vec2 HexGeometry::calculateUV(const glm::vec2& localPos) const {
-    // Map local position to [0, 1] UV range
-    // Local positions range from [-size, size] in both axes
-    float u = (localPos.x / m_size + 1.0f) * 0.5f;
-    float v = (localPos.y / m_size + 1.0f) * 0.5f;
+void HexGeometry::writeHex(const glm::vec3& center, Vertex* vertices, uint32_t* indices,
+                           uint32_t baseVertex) const {
+    const CornerTable& corners = cornerTable(m_orientation);
+
+    // Default color (white for texture tinting); UVs map [-size, size] to [0, 1]
+    const glm::vec3 color(1.0f, 1.0f, 1.0f);
+    vertices[0] = {center, color, glm::vec2(0.5f, 0.5f)};
+    for (size_t i = 0; i < 6; ++i) {
+        vertices[i + 1] = {glm::vec3(center.x + m_size * corners[i][0], center.y,
+                                     center.z + m_size * corners[i][1]),
+                           color,
+                           glm::vec2((corners[i][0] + 1.0f) * 0.5f, (corners[i][1] + 1.0f) * 0.5f)};
+    }
 
-    return glm::vec2(u, v);
+    // Wind counter-clockwise for front-facing (Vulkan default)
+    for (size_t i = 0; i < INDICES_PER_HEX; ++i) {
+        indices[i] = baseVertex + HEX_FAN_INDICES[i];
+    }
 }
 
 HexMesh HexGeometry::generateHex(const glm::vec3& center) const {
+    // Using center + 6 corners = 7 vertices, 6 triangles from center to each edge
     HexMesh mesh;
+    mesh.vertices.resize(VERTICES_PER_HEX);
+    mesh.indices.resize(INDICES_PER_HEX);
+    writeHex(center, mesh.vertices.data(), mesh.indices.data(), 0);
+    return mesh;
+}
+
+glm::vec3 HexGeometry::offsetToWorld(uint32_t column, uint32_t row,
+                                     const glm::vec3& origin) const {
+    if (m_orientation == HexOrientation::FlatTop) {
+        // Odd-q: odd columns are pushed half a hex down the column
+        return origin + glm::vec3(m_size * 1.5f * float(column), 0.0f,
+                                  m_size * SQRT3 * (float(row) + 0.5f * float(column & 1)));
+    }
+    // Odd-r: odd rows are pushed half a hex along the row
+    return origin + glm::vec3(m_size * SQRT3 * (float(column) + 0.5f * float(row & 1)), 0.0f,
+                              m_size * 1.5f * float(row));
+}
 
-    // Using center + 6 corners = 7 vertices
-    // 6 triangles from center to each edge
-    mesh.vertices.reserve(7);
-    mesh.indices.reserve(18);  // 6 triangles * 3 indices
-
-    // Default color (white for texture tinting)
-    glm::vec3 color(1.0f, 1.0f, 1.0f);
-
-    // Center vertex (index 0)
-    glm::vec2 centerUV = calculateUV(glm::vec2(0.0f, 0.0f));
-    mesh.vertices.push_back({center, color, centerUV});
-
-    // Corner vertices (indices 1-6)
-    std::vector<glm::vec3> corners = getCornerPositions(center);
-    for (int i = 0; i < 6; i++) {
-        // Use XZ for local position (hexes are in XZ plane)
-        glm::vec2 localPos(corners[i].x - center.x, corners[i].z - center.z);
-        glm::vec2 uv = calculateUV(localPos);
-        mesh.vertices.push_back({corners[i], color, uv});
+glm::vec3 HexGeometry::axialToWorld(int q, int r, const glm::vec3& origin) const {
+    if (m_orientation == HexOrientation::FlatTop) {
+        return origin + glm::vec3(m_size * 1.5f * float(q), 0.0f,
+                                  m_size * SQRT3 * (float(r) + 0.5f * float(q)));
     }
+    return origin + glm::vec3(m_size * SQRT3 * (float(q) + 0.5f * float(r)), 0.0f,
+                              m_size * 1.5f * float(r));
+}
 
-    // Indices for 6 triangles (center + 2 adjacent corners each)
-    // Wind counter-clockwise for front-facing (Vulkan default)
-    for (int i = 0; i < 6; i++) {
-        uint32_t current = static_cast<uint32_t>(i + 1);
-        uint32_t next = static_cast<uint32_t>((i + 1) % 6 + 1);
+void HexGeometry::generateRectRegion(uint32_t columns, uint32_t rows, const glm::vec3& origin,
+                                     Vertex* vertices, uint32_t* indices,
+                                     ThreadPool* workers) const {
+    forEachRowBlock(rows, columns, workers, [&](uint32_t firstRow, uint32_t endRow) {
+        for (uint32_t row = firstRow; row < endRow; ++row) {
+            size_t cell = static_cast<size_t>(row) * columns;
+            for (uint32_t column = 0; column < columns; ++column, ++cell) {
+                writeHex(offsetToWorld(column, row, origin), vertices + cell * VERTICES_PER_HEX,
+                         indices + cell * INDICES_PER_HEX,
+                         static_cast<uint32_t>(cell * VERTICES_PER_HEX));
+            }
+        }
+    });
+}
 
-        mesh.indices.push_back(0);        // Center
-        mesh.indices.push_back(current);  // Current corner
-        mesh.indices.push_back(next);     // Next corner
+HexMesh HexGeometry::generateRectRegion(uint32_t columns, uint32_t rows, const glm::vec3& origin,
+                                        ThreadPool* workers) const {
+    HexMesh mesh;
+    size_t cells = getRectRegionCellCount(columns, rows);
+    mesh.vertices.resize(cells * VERTICES_PER_HEX);
+    mesh.indices.resize(cells * INDICES_PER_HEX);
+    generateRectRegion(columns, rows, origin, mesh.vertices.data(), mesh.indices.data(), workers);
+    return mesh;
+}
+
+void HexGeometry::generateHexRegion(uint32_t radius, const glm::vec3& center, Vertex* vertices,
+                                    uint32_t* indices, ThreadPool* workers) const {
+    // Row r holds q in [max(-N, -N - r), min(N, N - r)]; prefix sums give
+    // each row's first cell so rows can be written independently
+    const int n = static_cast<int>(radius);
+    const uint32_t rowCount = 2 * radius + 1;
+    std::vector<size_t> rowStart(rowCount + 1, 0);
+    for (uint32_t i = 0; i < rowCount; ++i) {
+        rowStart[i + 1] = rowStart[i] + rowCount - static_cast<uint32_t>(std::abs(int(i) - n));
     }
 
+    forEachRowBlock(rowCount, rowCount, workers, [&](uint32_t firstRow, uint32_t endRow) {
+        for (uint32_t i = firstRow; i < endRow; ++i) {
+            const int r = static_cast<int>(i) - n;
+            const int firstQ = std::max(-n, -n - r);
+            const int endQ = std::min(n, n - r) + 1;
+            size_t cell = rowStart[i];
+            for (int q = firstQ; q < endQ; ++q, ++cell) {
+                writeHex(axialToWorld(q, r, center), vertices + cell * VERTICES_PER_HEX,
+                         indices + cell * INDICES_PER_HEX,
+                         static_cast<uint32_t>(cell * VERTICES_PER_HEX));
+            }
+        }
+    });
+}
+
+HexMesh HexGeometry::generateHexRegion(uint32_t radius, const glm::vec3& center,
+                                       ThreadPool* workers) const {
+    HexMesh mesh;
+    size_t cells = getHexRegionCellCount(radius);
+    mesh.vertices.resize(cells * VERTICES_PER_HEX);
+    mesh.indices.resize(cells * INDICES_PER_HEX);
+    generateHexRegion(radius, center, mesh.vertices.data(), mesh.indices.data(), workers);
     return mesh;
 }
 
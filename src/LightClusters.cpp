@@ -0,0 +1,280 @@
+/**
+ * @file LightClusters.cpp
+ * @brief Cluster bounds and parallel light binning
+ */
+
+#include <vde/LightClusters.h>
+#include <vde/api/ThreadPool.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <future>
+#include <limits>
+
+namespace vde {
+
+namespace {
+
+// GPULight::positionAndType.w values (match LightType and mesh.frag)
+constexpr int LIGHT_DIRECTIONAL = 0;
+constexpr int LIGHT_SPOT = 2;
+
+// Cones narrower than this are bounded by the sphere through apex and rim
+constexpr float COS_45 = 0.70710678f;
+
+static_assert(LightClusterGrid::TILE_COUNT <= 256, "Tile index must fit in 8 bits");
+
+}  // namespace
+
+LightClusterGrid::LightClusterGrid() : m_clusters(CLUSTER_COUNT) {}
+
+void LightClusterGrid::setProjection(const glm::mat4& projection, float nearPlane,
+                                     float farPlane) {
+    farPlane = std::max(farPlane, nearPlane + 1e-3f);
+    if (!m_minX.empty() && projection == m_projection && nearPlane == m_nearPlane &&
+        farPlane == m_farPlane) {
+        return;
+    }
+    m_projection = projection;
+    m_nearPlane = nearPlane;
+    m_farPlane = farPlane;
+
+    // Exponential slices need a positive near plane and a perspective divide
+    m_logarithmic = projection[3][3] == 0.0f && nearPlane > 0.0f;
+    if (m_logarithmic) {
+        const float logRange = std::log(farPlane / nearPlane);
+        m_sliceScale = float(GRID_Z) / logRange;
+        m_sliceBias = -float(GRID_Z) * std::log(nearPlane) / logRange;
+    } else {
+        m_sliceScale = float(GRID_Z) / (farPlane - nearPlane);
+        m_sliceBias = -nearPlane * m_sliceScale;
+    }
+
+    // Each tile corner is a line through view space: x/y = origin + slope * depth.
+    // Two unprojected points on it give the line for either projection type.
+    constexpr uint32_t CORNERS_X = GRID_X + 1;
+    constexpr uint32_t CORNERS_Y = GRID_Y + 1;
+    std::array<glm::vec2, CORNERS_X * CORNERS_Y> origins;
+    std::array<glm::vec2, CORNERS_X * CORNERS_Y> slopes;
+    const glm::mat4 inverse = glm::inverse(projection);
+    for (uint32_t j = 0; j < CORNERS_Y; ++j) {
+        for (uint32_t i = 0; i < CORNERS_X; ++i) {
+            const float ndcX = -1.0f + 2.0f * float(i) / float(GRID_X);
+            const float ndcY = -1.0f + 2.0f * float(j) / float(GRID_Y);
+            glm::vec4 a = inverse * glm::vec4(ndcX, ndcY, 0.0f, 1.0f);
+            glm::vec4 b = inverse * glm::vec4(ndcX, ndcY, 1.0f, 1.0f);
+            a = a / a.w;
+            b = b / b.w;
+            const float depthA = -a.z;
+            const float depthB = -b.z;
+            const glm::vec2 slope = (glm::vec2(b.x, b.y) - glm::vec2(a.x, a.y)) /
+                                    (depthB - depthA);
+            origins[j * CORNERS_X + i] = glm::vec2(a.x, a.y) - slope * depthA;
+            slopes[j * CORNERS_X + i] = slope;
+        }
+    }
+
+    m_minX.resize(CLUSTER_COUNT);
+    m_minY.resize(CLUSTER_COUNT);
+    m_maxX.resize(CLUSTER_COUNT);
+    m_maxY.resize(CLUSTER_COUNT);
+    for (uint32_t z = 0; z < GRID_Z; ++z) {
+        const std::array<float, 2> depths = {getSliceStart(z), getSliceStart(z + 1)};
+        for (uint32_t y = 0; y < GRID_Y; ++y) {
+            for (uint32_t x = 0; x < GRID_X; ++x) {
+                glm::vec2 lo(std::numeric_limits<float>::max());
+                glm::vec2 hi(std::numeric_limits<float>::lowest());
+                for (uint32_t corner = 0; corner < 4; ++corner) {
+                    const uint32_t line = (y + corner / 2) * CORNERS_X + x + corner % 2;
+                    for (float depth : depths) {
+                        glm::vec2 point = origins[line] + slopes[line] * depth;
+                        lo = glm::min(lo, point);
+                        hi = glm::max(hi, point);
+                    }
+                }
+                const uint32_t cluster = getClusterIndex(x, y, z);
+                m_minX[cluster] = lo.x;
+                m_minY[cluster] = lo.y;
+                m_maxX[cluster] = hi.x;
+                m_maxY[cluster] = hi.y;
+            }
+        }
+    }
+}
+
+uint32_t LightClusterGrid::getSlice(float depth) const {
+    const float mapped = m_logarithmic ? std::log(std::max(depth, m_nearPlane)) : depth;
+    const float slice = std::floor(mapped * m_sliceScale + m_sliceBias);
+    return static_cast<uint32_t>(std::clamp(slice, 0.0f, float(GRID_Z - 1)));
+}
+
+float LightClusterGrid::getSliceStart(uint32_t slice) const {
+    const float t = float(slice) / float(GRID_Z);
+    if (m_logarithmic) {
+        return m_nearPlane * std::pow(m_farPlane / m_nearPlane, t);
+    }
+    return m_nearPlane + (m_farPlane - m_nearPlane) * t;
+}
+
+void LightClusterGrid::build(std::span<const GPULight> lights, const glm::mat4& view,
+                             ThreadPool* workers) {
+    // Bounding spheres in view space, with depth positive away from the camera
+    LightBounds& bounds = m_lights;
+    bounds.x.clear();
+    bounds.y.clear();
+    bounds.z.clear();
+    bounds.radius.clear();
+    bounds.index.clear();
+    bounds.firstSlice.clear();
+    bounds.lastSlice.clear();
+
+    const glm::mat3 rotation(view);
+    for (uint32_t i = 0; i < lights.size(); ++i) {
+        const GPULight& light = lights[i];
+        const int type = static_cast<int>(light.positionAndType.w);
+        if (type == LIGHT_DIRECTIONAL) {
+            continue;
+        }
+
+        glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(light.positionAndType), 1.0f));
+        float radius = light.directionAndRange.w;
+
+        const float cosOuter = light.spotParams.y;
+        const glm::vec3 axis = rotation * glm::vec3(light.directionAndRange);
+        if (type == LIGHT_SPOT && cosOuter > 0.0f && glm::dot(axis, axis) > 0.0f) {
+            const glm::vec3 direction = glm::normalize(axis);
+            if (cosOuter >= COS_45) {
+                // Sphere through the apex and the rim of the cap
+                const float coneRadius = radius * 0.5f / cosOuter;
+                center += direction * coneRadius;
+                radius = coneRadius;
+            } else {
+                // Sphere around the rim circle; it also contains the apex
+                center += direction * (radius * cosOuter);
+                radius *= std::sqrt(1.0f - cosOuter * cosOuter);
+            }
+        }
+
+        const float depth = -center.z;
+        if (radius <= 0.0f || depth + radius < m_nearPlane || depth - radius > m_farPlane) {
+            continue;
+        }
+        bounds.x.push_back(center.x);
+        bounds.y.push_back(center.y);
+        bounds.z.push_back(depth);
+        bounds.radius.push_back(radius);
+        bounds.index.push_back(i);
+        bounds.firstSlice.push_back(getSlice(depth - radius));
+        bounds.lastSlice.push_back(getSlice(depth + radius));
+    }
+
+    // Slice groups are independent; each writes only its own result
+    const uint32_t taskCount = (GRID_Z + SLICES_PER_TASK - 1) / SLICES_PER_TASK;
+    m_tasks.resize(taskCount);
+    auto runTask = [this](uint32_t task) {
+        const uint32_t first = task * SLICES_PER_TASK;
+        binSlices(first, std::min(GRID_Z, first + SLICES_PER_TASK), m_tasks[task]);
+    };
+    if (workers != nullptr && !bounds.index.empty()) {
+        std::vector<std::future<void>> futures;
+        futures.reserve(taskCount);
+        for (uint32_t task = 0; task < taskCount; ++task) {
+            futures.push_back(workers->submit([&runTask, task]() { runTask(task); }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    } else {
+        for (uint32_t task = 0; task < taskCount; ++task) {
+            runTask(task);
+        }
+    }
+
+    // Groups cover consecutive slices, so concatenating them keeps cluster order
+    m_lightIndices.clear();
+    uint32_t cluster = 0;
+    for (const TaskResult& result : m_tasks) {
+        uint32_t offset = static_cast<uint32_t>(m_lightIndices.size());
+        for (uint32_t count : result.counts) {
+            m_clusters[cluster++] = {offset, count};
+            offset += count;
+        }
+        m_lightIndices.insert(m_lightIndices.end(), result.indices.begin(),
+                              result.indices.end());
+    }
+
+    std::vector<bool> binned(lights.size(), false);
+    m_binnedLightCount = 0;
+    for (uint32_t index : m_lightIndices) {
+        if (!binned[index]) {
+            binned[index] = true;
+            m_binnedLightCount++;
+        }
+    }
+}
+
+void LightClusterGrid::binSlices(uint32_t firstSlice, uint32_t endSlice,
+                                 TaskResult& result) const {
+    const LightBounds& bounds = m_lights;
+    const uint32_t lightCount = static_cast<uint32_t>(bounds.index.size());
+    result.counts.assign(size_t(endSlice - firstSlice) * TILE_COUNT, 0);
+    result.indices.clear();
+    result.mask.resize(TILE_COUNT);
+
+    for (uint32_t slice = firstSlice; slice < endSlice; ++slice) {
+        const uint32_t base = slice * TILE_COUNT;
+        const float* minX = m_minX.data() + base;
+        const float* minY = m_minY.data() + base;
+        const float* maxX = m_maxX.data() + base;
+        const float* maxY = m_maxY.data() + base;
+        const float sliceNear = getSliceStart(slice);
+        const float sliceFar = getSliceStart(slice + 1);
+        uint8_t* mask = result.mask.data();
+
+        // Hits are appended in light order, so the sort below keeps each
+        // cluster's list sorted by light
+        result.hits.clear();
+        for (uint32_t light = 0; light < lightCount; ++light) {
+            if (slice < bounds.firstSlice[light] || slice > bounds.lastSlice[light]) {
+                continue;
+            }
+            const float x = bounds.x[light];
+            const float y = bounds.y[light];
+            const float z = bounds.z[light];
+            const float radiusSq = bounds.radius[light] * bounds.radius[light];
+            const float dz = std::max(std::max(sliceNear - z, z - sliceFar), 0.0f);
+            const float remainingSq = radiusSq - dz * dz;
+
+            // Sphere against every box of the slice
+            for (uint32_t tile = 0; tile < TILE_COUNT; ++tile) {
+                const float dx = std::max(std::max(minX[tile] - x, x - maxX[tile]), 0.0f);
+                const float dy = std::max(std::max(minY[tile] - y, y - maxY[tile]), 0.0f);
+                mask[tile] = dx * dx + dy * dy <= remainingSq;
+            }
+            for (uint32_t tile = 0; tile < TILE_COUNT; ++tile) {
+                if (mask[tile]) {
+                    result.hits.push_back(light << 8 | tile);
+                }
+            }
+        }
+
+        // Counting sort by tile
+        uint32_t* counts = result.counts.data() + size_t(slice - firstSlice) * TILE_COUNT;
+        for (uint32_t hit : result.hits) {
+            counts[hit & 0xFF]++;
+        }
+        std::array<uint32_t, TILE_COUNT> next;
+        uint32_t offset = static_cast<uint32_t>(result.indices.size());
+        for (uint32_t tile = 0; tile < TILE_COUNT; ++tile) {
+            next[tile] = offset;
+            offset += counts[tile];
+        }
+        result.indices.resize(offset);
+        for (uint32_t hit : result.hits) {
+            result.indices[next[hit & 0xFF]++] = bounds.index[hit >> 8];
+        }
+    }
+}
+
+}  // namespace vde
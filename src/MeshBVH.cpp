@@ -0,0 +1,339 @@
+/**
+ * @file MeshBVH.cpp
+ * @brief Binned SAH triangle BVH and ray traversal
+ */
+
+#include <vde/MeshBVH.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace vde {
+
+namespace {
+
+struct Bounds {
+    glm::vec3 min{std::numeric_limits<float>::max()};
+    glm::vec3 max{std::numeric_limits<float>::lowest()};
+
+    void grow(const glm::vec3& point) {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    void grow(const Bounds& other) {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    // Half the surface area; only ratios matter to the SAH
+    float halfArea() const {
+        if (min.x > max.x) {
+            return 0.0f;
+        }
+        glm::vec3 extent = max - min;
+        return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+    }
+};
+
+// Per-triangle build data, partitioned in place so node scans stay sequential
+struct BuildTriangle {
+    Bounds bounds;
+    glm::vec3 centroid;
+    uint32_t id;
+};
+
+struct Bin {
+    Bounds bounds;
+    uint32_t count = 0;
+};
+
+// Entry distance of a ray into a box, or `limit` if it misses or enters past it
+float intersectBox(const glm::vec3& origin, const glm::vec3& inverseDirection,
+                   const MeshBVH::Node& node, float limit) {
+    glm::vec3 t0 = (node.boundsMin - origin) * inverseDirection;
+    glm::vec3 t1 = (node.boundsMax - origin) * inverseDirection;
+    glm::vec3 tNear = glm::min(t0, t1);
+    glm::vec3 tFar = glm::max(t0, t1);
+    float entry = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+    float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, limit));
+    return entry <= exit ? entry : limit;
+}
+
+}  // namespace
+
+void MeshBVH::clear() {
+    m_nodes.clear();
+    m_packets.clear();
+    m_triangleIds.clear();
+}
+
+void MeshBVH::build(std::span<const Vertex> vertices, std::span<const uint32_t> indices) {
+    clear();
+    const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+    if (triangleCount == 0) {
+        return;
+    }
+
+    std::vector<BuildTriangle> triangles(triangleCount);
+    for (uint32_t i = 0; i < triangleCount; ++i) {
+        for (uint32_t corner = 0; corner < 3; ++corner) {
+            triangles[i].bounds.grow(vertices[indices[i * 3 + corner]].position);
+        }
+        triangles[i].centroid = (triangles[i].bounds.min + triangles[i].bounds.max) * 0.5f;
+        triangles[i].id = i;
+    }
+
+    // A binary tree with one triangle per leaf has 2n - 1 nodes
+    m_nodes.reserve(size_t(triangleCount) * 2);
+    m_nodes.emplace_back();
+    m_nodes[0].triangleCount = triangleCount;
+
+    struct Pending {
+        uint32_t node;
+        uint32_t depth;
+    };
+    std::vector<Pending> stack = {{0, 0}};
+
+    // Reused across nodes; small nodes only clear the bins they use
+    std::array<std::array<Bin, BIN_COUNT>, 3> bins;
+    while (!stack.empty()) {
+        Pending pending = stack.back();
+        stack.pop_back();
+
+        const uint32_t first = m_nodes[pending.node].firstChildOrTriangle;
+        const uint32_t count = m_nodes[pending.node].triangleCount;
+
+        Bounds bounds;
+        Bounds centroidBounds;
+        for (uint32_t i = first; i < first + count; ++i) {
+            bounds.grow(triangles[i].bounds);
+            centroidBounds.grow(triangles[i].centroid);
+        }
+        m_nodes[pending.node].boundsMin = bounds.min;
+        m_nodes[pending.node].boundsMax = bounds.max;
+
+        if (count <= 1 || pending.depth + 1 >= MAX_DEPTH) {
+            continue;
+        }
+
+        // Bin every triangle on all three axes in one pass
+        const uint32_t binCount = std::min(BIN_COUNT, count);
+        glm::vec3 scale(0.0f);
+        for (int axis = 0; axis < 3; ++axis) {
+            float extent = centroidBounds.max[axis] - centroidBounds.min[axis];
+            scale[axis] = extent > 0.0f ? float(binCount) / extent : 0.0f;
+            std::fill_n(bins[axis].begin(), binCount, Bin{});
+        }
+        for (uint32_t i = first; i < first + count; ++i) {
+            glm::vec3 position = (triangles[i].centroid - centroidBounds.min) * scale;
+            for (int axis = 0; axis < 3; ++axis) {
+                Bin& bin = bins[axis][std::min(binCount - 1, uint32_t(position[axis]))];
+                bin.count++;
+                bin.bounds.grow(triangles[i].bounds);
+            }
+        }
+
+        // Cheapest split between bins over all three axes
+        float bestCost = std::numeric_limits<float>::max();
+        int bestAxis = -1;
+        uint32_t bestSplit = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (scale[axis] == 0.0f) {
+                continue;
+            }
+
+            // Sweep from the right to get the cost of every right side first
+            std::array<float, BIN_COUNT> rightCost{};
+            Bounds right;
+            uint32_t rightCount = 0;
+            for (uint32_t bin = binCount - 1; bin > 0; --bin) {
+                right.grow(bins[axis][bin].bounds);
+                rightCount += bins[axis][bin].count;
+                rightCost[bin] = right.halfArea() * float(rightCount);
+            }
+            Bounds left;
+            uint32_t leftCount = 0;
+            for (uint32_t split = 1; split < binCount; ++split) {
+                left.grow(bins[axis][split - 1].bounds);
+                leftCount += bins[axis][split - 1].count;
+                float cost = left.halfArea() * float(leftCount) + rightCost[split];
+                if (leftCount > 0 && leftCount < count && cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = split;
+                }
+            }
+        }
+
+        // Splitting (one more box test, then the children) must beat
+        // intersecting every triangle of the node
+        const float nodeArea = bounds.halfArea();
+        if (bestAxis < 0 || nodeArea * TRAVERSAL_COST + bestCost >= nodeArea * float(count)) {
+            continue;
+        }
+
+        const float lo = centroidBounds.min[bestAxis];
+        const float axisScale = scale[bestAxis];
+        auto middle = std::partition(
+            triangles.begin() + first, triangles.begin() + first + count,
+            [&](const BuildTriangle& triangle) {
+                uint32_t bin = uint32_t((triangle.centroid[bestAxis] - lo) * axisScale);
+                return std::min(binCount - 1, bin) < bestSplit;
+            });
+        const uint32_t leftCount = static_cast<uint32_t>(middle - triangles.begin()) - first;
+
+        const uint32_t leftChild = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+        m_nodes.emplace_back();
+        m_nodes[leftChild].firstChildOrTriangle = first;
+        m_nodes[leftChild].triangleCount = leftCount;
+        m_nodes[leftChild + 1].firstChildOrTriangle = first + leftCount;
+        m_nodes[leftChild + 1].triangleCount = count - leftCount;
+        m_nodes[pending.node].firstChildOrTriangle = leftChild;
+        m_nodes[pending.node].triangleCount = 0;
+
+        stack.push_back({leftChild, pending.depth + 1});
+        stack.push_back({leftChild + 1, pending.depth + 1});
+    }
+
+    // Leaf triangles in traversal order, packed PACKET_WIDTH at a time
+    m_packets.assign((triangleCount + PACKET_WIDTH - 1) / PACKET_WIDTH, TrianglePacket{});
+    m_triangleIds.resize(triangleCount);
+    for (uint32_t i = 0; i < triangleCount; ++i) {
+        uint32_t id = triangles[i].id;
+        m_triangleIds[i] = id;
+        const glm::vec3& a = vertices[indices[id * 3]].position;
+        const glm::vec3 edge1 = vertices[indices[id * 3 + 1]].position - a;
+        const glm::vec3 edge2 = vertices[indices[id * 3 + 2]].position - a;
+        TrianglePacket& packet = m_packets[i / PACKET_WIDTH];
+        const uint32_t lane = i % PACKET_WIDTH;
+        for (int axis = 0; axis < 3; ++axis) {
+            packet.v0[axis][lane] = a[axis];
+            packet.edge1[axis][lane] = edge1[axis];
+            packet.edge2[axis][lane] = edge2[axis];
+        }
+    }
+}
+
+bool MeshBVH::raycast(const glm::vec3& origin, const glm::vec3& direction, MeshRayHit& hit,
+                      float maxDistance) const {
+    if (m_nodes.empty()) {
+        return false;
+    }
+
+    const glm::vec3 inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    float closest = maxDistance;
+    bool found = false;
+
+    if (intersectBox(origin, inverseDirection, m_nodes[0], closest) >= closest) {
+        return false;
+    }
+
+    // Depth is capped at MAX_DEPTH, so at most one pending sibling per level
+    std::array<uint32_t, MAX_DEPTH> stack;
+    uint32_t stackSize = 0;
+    uint32_t current = 0;
+    while (true) {
+        const Node& node = m_nodes[current];
+        if (node.isLeaf()) {
+            // Packets may straddle leaves; lanes outside this leaf are ignored
+            const uint32_t begin = node.firstChildOrTriangle;
+            const uint32_t end = begin + node.triangleCount;
+            for (uint32_t packetIndex = begin / PACKET_WIDTH; packetIndex * PACKET_WIDTH < end;
+                 ++packetIndex) {
+                const TrianglePacket& packet = m_packets[packetIndex];
+
+                // Moller-Trumbore on every lane, accepting either face.  No early
+                // outs or guarded divides, so the lane loop vectorizes; degenerate
+                // and padding lanes fail the determinant test, misses keep closest.
+                float laneT[PACKET_WIDTH];
+                float laneU[PACKET_WIDTH];
+                float laneV[PACKET_WIDTH];
+                for (uint32_t lane = 0; lane < PACKET_WIDTH; ++lane) {
+                    const float px = direction.y * packet.edge2[2][lane] -
+                                     direction.z * packet.edge2[1][lane];
+                    const float py = direction.z * packet.edge2[0][lane] -
+                                     direction.x * packet.edge2[2][lane];
+                    const float pz = direction.x * packet.edge2[1][lane] -
+                                     direction.y * packet.edge2[0][lane];
+                    const float determinant = packet.edge1[0][lane] * px +
+                                              packet.edge1[1][lane] * py +
+                                              packet.edge1[2][lane] * pz;
+                    const float inverse = 1.0f / determinant;
+
+                    const float sx = origin.x - packet.v0[0][lane];
+                    const float sy = origin.y - packet.v0[1][lane];
+                    const float sz = origin.z - packet.v0[2][lane];
+                    const float u = (sx * px + sy * py + sz * pz) * inverse;
+
+                    const float qx = sy * packet.edge1[2][lane] - sz * packet.edge1[1][lane];
+                    const float qy = sz * packet.edge1[0][lane] - sx * packet.edge1[2][lane];
+                    const float qz = sx * packet.edge1[1][lane] - sy * packet.edge1[0][lane];
+                    const float v =
+                        (direction.x * qx + direction.y * qy + direction.z * qz) * inverse;
+                    const float t = (packet.edge2[0][lane] * qx + packet.edge2[1][lane] * qy +
+                                     packet.edge2[2][lane] * qz) *
+                                    inverse;
+
+                    const bool inside = (std::abs(determinant) >= 1e-12f) & (u >= 0.0f) &
+                                        (u <= 1.0f) & (v >= 0.0f) & (u + v <= 1.0f) &
+                                        (t > 0.0f) & (t < closest);
+                    laneT[lane] = inside ? t : closest;
+                    laneU[lane] = u;
+                    laneV[lane] = v;
+                }
+
+                // Lanes in traversal order, so ties resolve as a scalar loop would
+                for (uint32_t lane = 0; lane < PACKET_WIDTH; ++lane) {
+                    const uint32_t i = packetIndex * PACKET_WIDTH + lane;
+                    if (i >= begin && i < end && laneT[lane] < closest) {
+                        closest = laneT[lane];
+                        found = true;
+                        hit.distance = laneT[lane];
+                        hit.triangle = m_triangleIds[i];
+                        hit.u = laneU[lane];
+                        hit.v = laneV[lane];
+                    }
+                }
+            }
+        } else {
+            // Visit the nearer child first; the farther one may be culled by then
+            uint32_t nearChild = node.firstChildOrTriangle;
+            uint32_t farChild = nearChild + 1;
+            float nearDistance =
+                intersectBox(origin, inverseDirection, m_nodes[nearChild], closest);
+            float farDistance =
+                intersectBox(origin, inverseDirection, m_nodes[farChild], closest);
+            if (farDistance < nearDistance) {
+                std::swap(nearChild, farChild);
+                std::swap(nearDistance, farDistance);
+            }
+            if (nearDistance < closest) {
+                if (farDistance < closest) {
+                    stack[stackSize++] = farChild;
+                }
+                current = nearChild;
+                continue;
+            }
+        }
+
+        // Pop the next subtree that can still hold a closer hit
+        bool next = false;
+        while (stackSize > 0) {
+            uint32_t candidate = stack[--stackSize];
+            if (intersectBox(origin, inverseDirection, m_nodes[candidate], closest) < closest) {
+                current = candidate;
+                next = true;
+                break;
+            }
+        }
+        if (!next) {
+            break;
+        }
+    }
+    return found;
+}
+
+}  // namespace vde
@@ -0,0 +1,232 @@
+/**
+ * @file MeshCache.cpp
+ * @brief Implementation of the .vdemesh binary mesh cache
+ */
+
+#include <vde/MappedFile.h>
+#include <vde/MeshCache.h>
+#include <vde/ShaderCache.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+namespace vde {
+
+namespace {
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Describe the running build's Vertex so stale layouts are rejected
+void fillLayout(MeshFileHeader& header) {
+    auto attributes = Vertex::getAttributeDescriptions();
+    static_assert(attributes.size() <= std::size(MeshFileHeader{}.attributes));
+
+    header.vertexStride = sizeof(Vertex);
+    header.attributeCount = static_cast<uint32_t>(attributes.size());
+    for (size_t i = 0; i < attributes.size(); ++i) {
+        header.attributes[i].location = attributes[i].location;
+        header.attributes[i].format = static_cast<uint32_t>(attributes[i].format);
+        header.attributes[i].offset = attributes[i].offset;
+    }
+}
+
+// True when every index addresses one of vertexCount vertices
+bool indicesInRange(const std::vector<uint32_t>& indices, uint32_t vertexCount) {
+    return std::all_of(indices.begin(), indices.end(),
+                       [vertexCount](uint32_t index) { return index < vertexCount; });
+}
+
+}  // namespace
+
+MeshCache::MeshCache(const std::string& cacheDirectory) : m_cacheDirectory(cacheDirectory) {}
+
+std::string MeshCache::getCachePath(uint64_t sourceHash) const {
+    return m_cacheDirectory + "/" + ShaderHash::toHexString(sourceHash) + ".vdemesh";
+}
+
+bool MeshCache::load(uint64_t sourceHash, std::vector<Vertex>& vertices,
+                     std::vector<uint32_t>& indices, glm::vec3& boundsMin, glm::vec3& boundsMax,
+                     std::vector<MeshCacheLOD>* lods) {
+    std::string path = getCachePath(sourceHash);
+    MappedFile file;
+    if (!file.open(path)) {
+        m_lastError = "Mesh not cached: " + path;
+        return false;
+    }
+    if (file.size() < sizeof(MeshFileHeader)) {
+        m_lastError = "Truncated mesh cache file: " + path;
+        return false;
+    }
+
+    MeshFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    MeshFileHeader expected{};
+    fillLayout(expected);
+    if (header.magic != MAGIC || header.version != VERSION || header.sourceHash != sourceHash) {
+        m_lastError = "Mesh cache file is stale or not a .vdemesh file: " + path;
+        return false;
+    }
+    if (header.vertexStride != expected.vertexStride ||
+        header.attributeCount != expected.attributeCount ||
+        std::memcmp(header.attributes, expected.attributes,
+                    sizeof(MeshFileAttribute) * expected.attributeCount) != 0) {
+        m_lastError = "Mesh cache vertex layout does not match this build: " + path;
+        return false;
+    }
+
+    // Every non-empty blob must lie after the header and inside the file
+    auto inFile = [&](uint64_t offset, uint64_t bytes) {
+        return bytes == 0 || (offset >= sizeof(MeshFileHeader) && offset <= file.size() &&
+                              bytes <= file.size() - offset);
+    };
+    uint64_t vertexBytes = uint64_t(header.vertexCount) * sizeof(Vertex);
+    uint64_t indexBytes = uint64_t(header.indexCount) * sizeof(uint32_t);
+    uint64_t lodTableBytes = uint64_t(header.lodCount) * sizeof(MeshFileLOD);
+    if (!inFile(header.vertexOffset, vertexBytes) || !inFile(header.indexOffset, indexBytes) ||
+        header.lodCount > MAX_LODS || !inFile(header.lodOffset, lodTableBytes)) {
+        m_lastError = "Corrupt mesh cache file: " + path;
+        return false;
+    }
+
+    std::vector<MeshFileLOD> lodTable(header.lodCount);
+    if (header.lodCount > 0) {
+        std::memcpy(lodTable.data(), file.data() + header.lodOffset, lodTableBytes);
+    }
+    for (const MeshFileLOD& lod : lodTable) {
+        if (!inFile(lod.vertexOffset, uint64_t(lod.vertexCount) * sizeof(Vertex)) ||
+            !inFile(lod.indexOffset, uint64_t(lod.indexCount) * sizeof(uint32_t))) {
+            m_lastError = "Corrupt mesh cache file: " + path;
+            return false;
+        }
+    }
+
+    // Decode and validate everything before touching the caller's data, so a
+    // rejected file leaves the out-parameters as they were
+    std::vector<Vertex> loadedVertices(header.vertexCount);
+    std::memcpy(loadedVertices.data(), file.data() + header.vertexOffset, vertexBytes);
+    std::vector<uint32_t> loadedIndices(header.indexCount);
+    std::memcpy(loadedIndices.data(), file.data() + header.indexOffset, indexBytes);
+    if (!indicesInRange(loadedIndices, header.vertexCount)) {
+        m_lastError = "Mesh cache index out of range: " + path;
+        return false;
+    }
+
+    std::vector<MeshCacheLOD> loadedLods(lodTable.size());
+    for (size_t i = 0; i < lodTable.size(); ++i) {
+        const MeshFileLOD& entry = lodTable[i];
+        MeshCacheLOD& lod = loadedLods[i];
+        lod.vertices.resize(entry.vertexCount);
+        std::memcpy(lod.vertices.data(), file.data() + entry.vertexOffset,
+                    entry.vertexCount * sizeof(Vertex));
+        lod.indices.resize(entry.indexCount);
+        std::memcpy(lod.indices.data(), file.data() + entry.indexOffset,
+                    entry.indexCount * sizeof(uint32_t));
+        lod.error = entry.error;
+        if (!indicesInRange(lod.indices, entry.vertexCount)) {
+            m_lastError = "Mesh cache index out of range: " + path;
+            return false;
+        }
+    }
+
+    vertices = std::move(loadedVertices);
+    indices = std::move(loadedIndices);
+    boundsMin = glm::vec3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+    boundsMax = glm::vec3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+    if (lods) {
+        *lods = std::move(loadedLods);
+    }
+    return true;
+}
+
+bool MeshCache::store(uint64_t sourceHash, const std::vector<Vertex>& vertices,
+                      const std::vector<uint32_t>& indices, const glm::vec3& boundsMin,
+                      const glm::vec3& boundsMax, const std::vector<MeshCacheLOD>& lods) {
+    MeshFileHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.sourceHash = sourceHash;
+    header.vertexCount = static_cast<uint32_t>(vertices.size());
+    header.indexCount = static_cast<uint32_t>(indices.size());
+    header.lodCount = static_cast<uint32_t>(std::min<size_t>(lods.size(), MAX_LODS));
+    fillLayout(header);
+    for (int i = 0; i < 3; ++i) {
+        header.boundsMin[i] = boundsMin[i];
+        header.boundsMax[i] = boundsMax[i];
+    }
+
+    // Blobs in file order: base vertices and indices, the LOD table, then
+    // each level's vertices and indices
+    struct Blob {
+        const void* data;
+        uint64_t bytes;
+        uint64_t offset;
+    };
+    std::vector<Blob> blobs;
+    uint64_t end = sizeof(MeshFileHeader);
+    auto place = [&](const void* data, uint64_t bytes) -> uint64_t {
+        if (bytes == 0) {
+            return 0;  // Nothing to write, so no padding either
+        }
+        uint64_t offset = alignUp(end, BLOB_ALIGNMENT);
+        blobs.push_back({data, bytes, offset});
+        end = offset + bytes;
+        return offset;
+    };
+    header.vertexOffset = place(vertices.data(), uint64_t(vertices.size()) * sizeof(Vertex));
+    header.indexOffset = place(indices.data(), uint64_t(indices.size()) * sizeof(uint32_t));
+
+    std::vector<MeshFileLOD> lodTable(header.lodCount);
+    header.lodOffset = place(lodTable.data(), lodTable.size() * sizeof(MeshFileLOD));
+    for (size_t i = 0; i < lodTable.size(); ++i) {
+        const MeshCacheLOD& lod = lods[i];
+        lodTable[i].vertexCount = static_cast<uint32_t>(lod.vertices.size());
+        lodTable[i].indexCount = static_cast<uint32_t>(lod.indices.size());
+        lodTable[i].error = lod.error;
+        lodTable[i].vertexOffset =
+            place(lod.vertices.data(), uint64_t(lod.vertices.size()) * sizeof(Vertex));
+        lodTable[i].indexOffset =
+            place(lod.indices.data(), uint64_t(lod.indices.size()) * sizeof(uint32_t));
+    }
+
+    std::string path = getCachePath(sourceHash);
+    try {
+        std::filesystem::create_directories(m_cacheDirectory);
+
+        // Write to a temporary file first so a crash never leaves a torn mesh
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                m_lastError = "Failed to open mesh cache for writing: " + path;
+                return false;
+            }
+            static const char padding[BLOB_ALIGNMENT] = {};
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            uint64_t written = sizeof(header);
+            for (const Blob& blob : blobs) {
+                file.write(padding, static_cast<std::streamsize>(blob.offset - written));
+                file.write(static_cast<const char*>(blob.data),
+                           static_cast<std::streamsize>(blob.bytes));
+                written = blob.offset + blob.bytes;
+            }
+            if (!file) {
+                m_lastError = "Failed to write mesh cache: " + path;
+                return false;
+            }
+        }
+        std::filesystem::rename(tempPath, path);
+    } catch (const std::exception& e) {
+        m_lastError = "Failed to save mesh cache: " + std::string(e.what());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace vde
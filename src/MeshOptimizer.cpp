@@ -0,0 +1,292 @@
+/**
+ * @file MeshOptimizer.cpp
+ * @brief Tipsify vertex cache ordering, overdraw clustering and fetch remapping
+ */
+
+#include <vde/MeshOptimizer.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace vde {
+
+namespace {
+
+/**
+ * FIFO cache simulated with insertion timestamps: a vertex is cached while
+ * fewer than cacheSize other vertices have been inserted after it.
+ */
+class FifoCache {
+  public:
+    FifoCache(size_t vertexCount, uint32_t cacheSize)
+        : m_stamps(vertexCount, 0), m_time(cacheSize + 1), m_cacheSize(cacheSize) {}
+
+    /// Access a vertex; returns true on a miss (and inserts it)
+    bool access(uint32_t vertex) {
+        if (m_time - m_stamps[vertex] > m_cacheSize) {
+            m_stamps[vertex] = m_time++;
+            return true;
+        }
+        return false;
+    }
+
+    /// Evict everything
+    void flush() { m_time += m_cacheSize + 1; }
+
+    /// Insertions since the vertex was cached (large if never cached)
+    uint32_t age(uint32_t vertex) const { return m_time - m_stamps[vertex]; }
+
+  private:
+    std::vector<uint32_t> m_stamps;
+    uint32_t m_time;
+    uint32_t m_cacheSize;
+};
+
+bool indicesInRange(std::span<const uint32_t> indices, size_t vertexCount) {
+    return std::all_of(indices.begin(), indices.end(),
+                       [vertexCount](uint32_t index) { return index < vertexCount; });
+}
+
+uint32_t triangleMisses(FifoCache& cache, std::span<const uint32_t> indices, size_t triangle) {
+    uint32_t misses = 0;
+    for (size_t k = 0; k < 3; ++k) {
+        misses += cache.access(indices[triangle * 3 + k]) ? 1 : 0;
+    }
+    return misses;
+}
+
+}  // namespace
+
+float MeshOptimizer::computeACMR(std::span<const uint32_t> indices, size_t vertexCount,
+                                 uint32_t cacheSize) {
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || !indicesInRange(indices, vertexCount)) {
+        return 0.0f;
+    }
+
+    FifoCache cache(vertexCount, cacheSize);
+    size_t misses = 0;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        misses += triangleMisses(cache, indices, t);
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+std::vector<uint32_t> MeshOptimizer::optimizeVertexCache(std::span<const uint32_t> indices,
+                                                         size_t vertexCount, uint32_t cacheSize) {
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || indices.size() % 3 != 0 || !indicesInRange(indices, vertexCount)) {
+        return std::vector<uint32_t>(indices.begin(), indices.end());
+    }
+
+    // Vertex -> triangle adjacency (CSR) and live triangle counts
+    std::vector<uint32_t> live(vertexCount, 0);
+    for (uint32_t index : indices) {
+        live[index]++;
+    }
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        offsets[v + 1] = offsets[v] + live[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+
+    FifoCache cache(vertexCount, cacheSize);
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint32_t> deadEnd;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> result;
+    deadEnd.reserve(indices.size());
+    result.reserve(indices.size());
+    size_t cursor = 0;
+
+    // Most recently referenced vertex that still has triangles, else the next in input order
+    auto skipDeadEnd = [&]() -> int64_t {
+        while (!deadEnd.empty()) {
+            uint32_t vertex = deadEnd.back();
+            deadEnd.pop_back();
+            if (live[vertex] > 0) {
+                return vertex;
+            }
+        }
+        for (; cursor < vertexCount; ++cursor) {
+            if (live[cursor] > 0) {
+                return static_cast<int64_t>(cursor);
+            }
+        }
+        return -1;
+    };
+
+    int64_t fanning = skipDeadEnd();
+    while (fanning >= 0) {
+        // Emit every remaining triangle around the fanning vertex
+        candidates.clear();
+        for (uint32_t a = offsets[fanning]; a < offsets[fanning + 1]; ++a) {
+            uint32_t triangle = adjacency[a];
+            if (emitted[triangle]) {
+                continue;
+            }
+            emitted[triangle] = 1;
+            for (size_t k = 0; k < 3; ++k) {
+                uint32_t vertex = indices[triangle * 3 + k];
+                result.push_back(vertex);
+                deadEnd.push_back(vertex);
+                candidates.push_back(vertex);
+                live[vertex]--;
+                cache.access(vertex);
+            }
+        }
+
+        // Prefer the oldest candidate that will still be cached after its fan
+        int64_t best = -1;
+        int64_t bestPriority = -1;
+        for (uint32_t vertex : candidates) {
+            if (live[vertex] == 0) {
+                continue;
+            }
+            int64_t priority = 0;
+            if (cache.age(vertex) + 2 * live[vertex] <= cacheSize) {
+                priority = cache.age(vertex);
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                best = vertex;
+            }
+        }
+        fanning = best >= 0 ? best : skipDeadEnd();
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> MeshOptimizer::optimizeOverdraw(std::span<const uint32_t> indices,
+                                                      std::span<const Vertex> vertices,
+                                                      float threshold, uint32_t cacheSize) {
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || indices.size() % 3 != 0 ||
+        !indicesInRange(indices, vertices.size())) {
+        return std::vector<uint32_t>(indices.begin(), indices.end());
+    }
+
+    // Hard boundaries: triangles where the cache was effectively restarted
+    std::vector<size_t> hard;
+    {
+        FifoCache cache(vertices.size(), cacheSize);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            if (triangleMisses(cache, indices, t) == 3 || t == 0) {
+                hard.push_back(t);
+            }
+        }
+        hard.push_back(triangleCount);
+    }
+
+    // Soft boundaries: split a hard cluster wherever its running ACMR has
+    // already dropped to within threshold of the whole cluster's ACMR
+    std::vector<size_t> clusters;
+    FifoCache cache(vertices.size(), cacheSize);
+    for (size_t h = 0; h + 1 < hard.size(); ++h) {
+        size_t start = hard[h];
+        size_t end = hard[h + 1];
+
+        cache.flush();
+        size_t clusterMisses = 0;
+        for (size_t t = start; t < end; ++t) {
+            clusterMisses += triangleMisses(cache, indices, t);
+        }
+        float limit =
+            threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+        cache.flush();
+        clusters.push_back(start);
+        size_t clusterStart = start;
+        size_t misses = 0;
+        for (size_t t = start; t + 1 < end; ++t) {
+            misses += triangleMisses(cache, indices, t);
+            if (static_cast<float>(misses) <= limit * static_cast<float>(t + 1 - clusterStart)) {
+                clusters.push_back(t + 1);
+                clusterStart = t + 1;
+                misses = 0;
+                cache.flush();
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    // Sort clusters by how far they face away from the mesh centre
+    glm::vec3 meshCentroid(0.0f);
+    for (uint32_t index : indices) {
+        meshCentroid += vertices[index].position;
+    }
+    meshCentroid /= static_cast<float>(indices.size());
+
+    size_t clusterCount = clusters.size() - 1;
+    std::vector<float> keys(clusterCount, 0.0f);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        glm::vec3 centroid(0.0f);
+        glm::vec3 normal(0.0f);
+        float area = 0.0f;
+        for (size_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+            const glm::vec3& p0 = vertices[indices[t * 3 + 0]].position;
+            const glm::vec3& p1 = vertices[indices[t * 3 + 1]].position;
+            const glm::vec3& p2 = vertices[indices[t * 3 + 2]].position;
+            glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+            float triangleArea = glm::length(n);
+            centroid += (p0 + p1 + p2) * (triangleArea / 3.0f);
+            normal += n;
+            area += triangleArea;
+        }
+        float normalLength = glm::length(normal);
+        if (area > 0.0f && normalLength > 0.0f) {
+            keys[c] = glm::dot(centroid / area - meshCentroid, normal / normalLength);
+        }
+    }
+
+    std::vector<size_t> order(clusterCount);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](size_t a, size_t b) { return keys[a] > keys[b]; });
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+    for (size_t c : order) {
+        result.insert(result.end(), indices.begin() + clusters[c] * 3,
+                      indices.begin() + clusters[c + 1] * 3);
+    }
+    return result;
+}
+
+void MeshOptimizer::optimizeVertexFetch(std::vector<Vertex>& vertices,
+                                        std::vector<uint32_t>& indices) {
+    if (!indicesInRange(indices, vertices.size())) {
+        return;
+    }
+
+    constexpr uint32_t UNUSED = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> remap(vertices.size(), UNUSED);
+    uint32_t next = 0;
+    for (uint32_t index : indices) {
+        if (remap[index] == UNUSED) {
+            remap[index] = next++;
+        }
+    }
+    for (uint32_t& slot : remap) {
+        if (slot == UNUSED) {
+            slot = next++;
+        }
+    }
+
+    std::vector<Vertex> reordered(vertices.size());
+    for (size_t v = 0; v < vertices.size(); ++v) {
+        reordered[remap[v]] = vertices[v];
+    }
+    vertices = std::move(reordered);
+    for (uint32_t& index : indices) {
+        index = remap[index];
+    }
+}
+
+}  // namespace vde
@@ -0,0 +1,396 @@
+/**
+ * @file MeshSimplifier.cpp
+ * @brief Quadric error metric edge-collapse simplification
+ */
+
+#include <vde/MeshSimplifier.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace vde {
+
+namespace {
+
+/// Symmetric 4x4 quadric: sum of w * (dot(n, p) + d)^2 over planes
+struct Quadric {
+    double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0, c = 0.0;
+    double weight = 0.0;
+
+    void addPlane(const glm::vec3& n, float d, double w) {
+        double x = n.x, y = n.y, z = n.z, dd = d;
+        a00 += w * x * x;
+        a01 += w * x * y;
+        a02 += w * x * z;
+        a11 += w * y * y;
+        a12 += w * y * z;
+        a22 += w * z * z;
+        b0 += w * x * dd;
+        b1 += w * y * dd;
+        b2 += w * z * dd;
+        c += w * dd * dd;
+        weight += w;
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        a00 += other.a00;
+        a01 += other.a01;
+        a02 += other.a02;
+        a11 += other.a11;
+        a12 += other.a12;
+        a22 += other.a22;
+        b0 += other.b0;
+        b1 += other.b1;
+        b2 += other.b2;
+        c += other.c;
+        weight += other.weight;
+        return *this;
+    }
+
+    /// Weighted mean squared distance from p to the planes
+    double error(const glm::vec3& p) const {
+        if (weight <= 0.0) {
+            return 0.0;
+        }
+        double x = p.x, y = p.y, z = p.z;
+        double e = a00 * x * x + a11 * y * y + a22 * z * z +
+                   2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+                   2.0 * (b0 * x + b1 * y + b2 * z) + c;
+        return std::max(e, 0.0) / weight;
+    }
+};
+
+struct Collapse {
+    uint32_t from;
+    uint32_t to;
+    double cost;
+};
+
+uint64_t edgeKey(uint32_t a, uint32_t b) {
+    return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+}
+
+// Map each vertex to the first vertex with the same position
+std::vector<uint32_t> weldPositions(std::span<const Vertex> vertices) {
+    struct KeyHash {
+        size_t operator()(const std::array<uint32_t, 3>& key) const {
+            uint64_t h = key[0];
+            h = h * 0x9E3779B97F4A7C15ull ^ key[1];
+            h = h * 0x9E3779B97F4A7C15ull ^ key[2];
+            return static_cast<size_t>(h ^ (h >> 29));
+        }
+    };
+
+    std::unordered_map<std::array<uint32_t, 3>, uint32_t, KeyHash> first;
+    first.reserve(vertices.size());
+    std::vector<uint32_t> canonical(vertices.size());
+    for (size_t v = 0; v < vertices.size(); ++v) {
+        // Adding 0 folds -0.0 into +0.0 so equal positions hash equally
+        const glm::vec3& p = vertices[v].position;
+        std::array<uint32_t, 3> key = {std::bit_cast<uint32_t>(p.x + 0.0f),
+                                       std::bit_cast<uint32_t>(p.y + 0.0f),
+                                       std::bit_cast<uint32_t>(p.z + 0.0f)};
+        canonical[v] = first.try_emplace(key, static_cast<uint32_t>(v)).first->second;
+    }
+    return canonical;
+}
+
+float attributeDistance(const Vertex& a, const Vertex& b) {
+    glm::vec3 dc = a.color - b.color;
+    glm::vec2 dt = a.texCoord - b.texCoord;
+    return glm::dot(dc, dc) + glm::dot(dt, dt);
+}
+
+}  // namespace
+
+std::vector<uint32_t> MeshSimplifier::simplify(std::span<const Vertex> vertices,
+                                               std::span<const uint32_t> indices,
+                                               size_t targetIndexCount, float targetError,
+                                               float* resultError) {
+    if (resultError) {
+        *resultError = 0.0f;
+    }
+    size_t vertexCount = vertices.size();
+    bool valid = indices.size() % 3 == 0 &&
+                 std::all_of(indices.begin(), indices.end(),
+                             [vertexCount](uint32_t index) { return index < vertexCount; });
+    if (!valid || indices.size() <= targetIndexCount) {
+        return std::vector<uint32_t>(indices.begin(), indices.end());
+    }
+
+    // Simplify on welded positions; corners remember their original vertex
+    std::vector<uint32_t> canonical = weldPositions(vertices);
+    std::vector<uint32_t> triangles(indices.size());
+    std::vector<uint32_t> corners(indices.begin(), indices.end());
+    glm::vec3 boundsMin(std::numeric_limits<float>::max());
+    glm::vec3 boundsMax(std::numeric_limits<float>::lowest());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        triangles[i] = canonical[indices[i]];
+        boundsMin = glm::min(boundsMin, vertices[indices[i]].position);
+        boundsMax = glm::max(boundsMax, vertices[indices[i]].position);
+    }
+    double scale = glm::length(boundsMax - boundsMin);
+    if (!(scale > 0.0)) {
+        return std::vector<uint32_t>(indices.begin(), indices.end());
+    }
+    auto position = [&vertices](uint32_t v) -> const glm::vec3& { return vertices[v].position; };
+
+    // Area-weighted triangle planes
+    std::vector<Quadric> quadrics(vertexCount);
+    std::vector<glm::vec3> normals(triangles.size() / 3, glm::vec3(0.0f));
+    for (size_t t = 0; t < normals.size(); ++t) {
+        const glm::vec3& p0 = position(triangles[t * 3 + 0]);
+        glm::vec3 n = glm::cross(position(triangles[t * 3 + 1]) - p0,
+                                 position(triangles[t * 3 + 2]) - p0);
+        float length = glm::length(n);
+        if (length <= 0.0f) {
+            continue;
+        }
+        normals[t] = n / length;
+        float d = -glm::dot(normals[t], p0);
+        for (size_t k = 0; k < 3; ++k) {
+            quadrics[triangles[t * 3 + k]].addPlane(normals[t], d, 0.5 * length);
+        }
+    }
+
+    // Planes perpendicular to open borders keep the outline in place
+    {
+        std::vector<std::pair<uint64_t, uint32_t>> edges;
+        edges.reserve(triangles.size());
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            uint32_t a = triangles[i];
+            uint32_t b = triangles[i - i % 3 + (i + 1) % 3];
+            edges.emplace_back(edgeKey(a, b), static_cast<uint32_t>(i));
+        }
+        std::sort(edges.begin(), edges.end());
+        for (size_t e = 0; e < edges.size(); ++e) {
+            bool shared = (e > 0 && edges[e - 1].first == edges[e].first) ||
+                          (e + 1 < edges.size() && edges[e + 1].first == edges[e].first);
+            if (shared) {
+                continue;
+            }
+            uint32_t i = edges[e].second;
+            uint32_t a = triangles[i];
+            uint32_t b = triangles[i - i % 3 + (i + 1) % 3];
+            glm::vec3 edge = position(b) - position(a);
+            glm::vec3 m = glm::cross(edge, normals[i / 3]);
+            float length = glm::length(m);
+            if (length <= 0.0f) {
+                continue;
+            }
+            m /= length;
+            float d = -glm::dot(m, position(a));
+            double w = BOUNDARY_WEIGHT * glm::dot(edge, edge);
+            quadrics[a].addPlane(m, d, w);
+            quadrics[b].addPlane(m, d, w);
+        }
+    }
+
+    double errorLimit = double(targetError) * scale;
+    errorLimit *= errorLimit;
+    double worstError = 0.0;
+
+    std::vector<uint32_t> collapseTo(vertexCount);
+    std::vector<uint8_t> locked(vertexCount);
+    std::vector<uint8_t> border(vertexCount);
+    std::vector<uint64_t> keys;
+    std::vector<Collapse> collapses;
+    std::vector<uint32_t> offsets(vertexCount + 1);
+    std::vector<uint32_t> adjacency;
+
+    // Each pass collapses a batch of cheapest independent edges
+    while (triangles.size() > targetIndexCount) {
+        size_t triangleCount = triangles.size() / 3;
+
+        keys.clear();
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            keys.push_back(edgeKey(triangles[i], triangles[i - i % 3 + (i + 1) % 3]));
+        }
+        std::sort(keys.begin(), keys.end());
+
+        // Border vertices may only slide along border edges
+        std::fill(border.begin(), border.end(), 0);
+        for (size_t e = 0; e < keys.size();) {
+            size_t run = 1;
+            while (e + run < keys.size() && keys[e + run] == keys[e]) {
+                ++run;
+            }
+            if (run == 1) {
+                border[keys[e] >> 32] = 1;
+                border[keys[e] & 0xFFFFFFFFu] = 1;
+            }
+            e += run;
+        }
+
+        collapses.clear();
+        for (size_t e = 0; e < keys.size();) {
+            size_t run = 1;
+            while (e + run < keys.size() && keys[e + run] == keys[e]) {
+                ++run;
+            }
+            auto a = static_cast<uint32_t>(keys[e] >> 32);
+            auto b = static_cast<uint32_t>(keys[e] & 0xFFFFFFFFu);
+            bool borderEdge = run == 1;
+            e += run;
+
+            Quadric q = quadrics[a];
+            q += quadrics[b];
+            bool aMovable = !border[a] || borderEdge;
+            bool bMovable = !border[b] || borderEdge;
+            double costAB = aMovable ? q.error(position(b)) : std::numeric_limits<double>::max();
+            double costBA = bMovable ? q.error(position(a)) : std::numeric_limits<double>::max();
+            if (aMovable && costAB <= costBA) {
+                collapses.push_back({a, b, costAB});
+            } else if (bMovable) {
+                collapses.push_back({b, a, costBA});
+            }
+        }
+        if (collapses.empty()) {
+            break;
+        }
+        std::sort(collapses.begin(), collapses.end(),
+                  [](const Collapse& x, const Collapse& y) { return x.cost < y.cost; });
+
+        // Vertex -> triangle adjacency (CSR) of the current mesh
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (uint32_t v : triangles) {
+            offsets[v + 1]++;
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        adjacency.resize(triangles.size());
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < triangles.size(); ++i) {
+                adjacency[fill[triangles[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+        }
+
+        // Reject collapses that flip or sharply fold a neighbouring triangle
+        auto flips = [&](uint32_t from, uint32_t to) {
+            for (uint32_t a = offsets[from]; a < offsets[from + 1]; ++a) {
+                const uint32_t* tri = &triangles[adjacency[a] * 3];
+                if (tri[0] == to || tri[1] == to || tri[2] == to) {
+                    continue;
+                }
+                glm::vec3 p[3], q[3];
+                for (size_t k = 0; k < 3; ++k) {
+                    p[k] = position(tri[k]);
+                    q[k] = tri[k] == from ? position(to) : p[k];
+                }
+                glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+                glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+                if (glm::dot(before, after) <=
+                    0.25f * glm::length(before) * glm::length(after)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (size_t v = 0; v < vertexCount; ++v) {
+            collapseTo[v] = static_cast<uint32_t>(v);
+        }
+        std::fill(locked.begin(), locked.end(), 0);
+        size_t removable = triangleCount - targetIndexCount / 3;
+        size_t removed = 0;
+        size_t applied = 0;
+        for (const Collapse& collapse : collapses) {
+            if (collapse.cost > errorLimit || removed >= removable) {
+                break;
+            }
+            if (locked[collapse.from] || locked[collapse.to] ||
+                flips(collapse.from, collapse.to)) {
+                continue;
+            }
+
+            // Triangles on the edge degenerate; lock the ring so adjacency stays valid
+            for (uint32_t a = offsets[collapse.from]; a < offsets[collapse.from + 1]; ++a) {
+                const uint32_t* tri = &triangles[adjacency[a] * 3];
+                if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to) {
+                    removed++;
+                }
+                locked[tri[0]] = locked[tri[1]] = locked[tri[2]] = 1;
+            }
+            collapseTo[collapse.from] = collapse.to;
+            quadrics[collapse.to] += quadrics[collapse.from];
+            worstError = std::max(worstError, collapse.cost);
+            applied++;
+        }
+        if (applied == 0) {
+            break;
+        }
+
+        // Apply the batch and drop degenerate triangles
+        size_t write = 0;
+        for (size_t t = 0; t < triangleCount; ++t) {
+            uint32_t a = collapseTo[triangles[t * 3 + 0]];
+            uint32_t b = collapseTo[triangles[t * 3 + 1]];
+            uint32_t c = collapseTo[triangles[t * 3 + 2]];
+            if (a == b || b == c || a == c) {
+                continue;
+            }
+            for (size_t k = 0; k < 3; ++k) {
+                corners[write * 3 + k] = corners[t * 3 + k];
+            }
+            triangles[write * 3 + 0] = a;
+            triangles[write * 3 + 1] = b;
+            triangles[write * 3 + 2] = c;
+            write++;
+        }
+        triangles.resize(write * 3);
+        corners.resize(write * 3);
+    }
+
+    // Pick, at each corner's new position, the vertex closest to its old attributes
+    std::vector<uint32_t> groupOffsets(vertexCount + 1, 0);
+    for (uint32_t c : canonical) {
+        groupOffsets[c + 1]++;
+    }
+    for (size_t v = 0; v < vertexCount; ++v) {
+        groupOffsets[v + 1] += groupOffsets[v];
+    }
+    std::vector<uint32_t> groups(vertexCount);
+    {
+        std::vector<uint32_t> fill(groupOffsets.begin(), groupOffsets.end() - 1);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            groups[fill[canonical[v]]++] = static_cast<uint32_t>(v);
+        }
+    }
+
+    std::vector<uint32_t> result(triangles.size());
+    std::unordered_map<uint64_t, uint32_t> chosen;
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        uint32_t target = triangles[i];
+        uint32_t original = corners[i];
+        if (canonical[original] == target) {
+            result[i] = original;
+            continue;
+        }
+        auto [it, inserted] = chosen.try_emplace((uint64_t(original) << 32) | target, target);
+        if (inserted) {
+            float best = std::numeric_limits<float>::max();
+            for (uint32_t g = groupOffsets[target]; g < groupOffsets[target + 1]; ++g) {
+                float distance = attributeDistance(vertices[original], vertices[groups[g]]);
+                if (distance < best) {
+                    best = distance;
+                    it->second = groups[g];
+                }
+            }
+        }
+        result[i] = it->second;
+    }
+
+    if (resultError) {
+        *resultError = static_cast<float>(std::sqrt(worstError) / scale);
+    }
+    return result;
+}
+
+}  // namespace vde
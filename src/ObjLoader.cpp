@@ -0,0 +1,376 @@
+/**
+ * @file ObjLoader.cpp
+ * @brief Memory-mapped, chunk-parallel OBJ parser with corner deduplication
+ */
+
+#include <vde/MappedFile.h>
+#include <vde/ObjLoader.h>
+#include <vde/api/ThreadPool.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace vde {
+
+namespace {
+
+constexpr int32_t NO_INDEX = std::numeric_limits<int32_t>::min();
+
+/// Face corner as 0-based attribute indices (NO_INDEX when absent)
+struct Corner {
+    int32_t v = NO_INDEX;
+    int32_t vt = NO_INDEX;
+    int32_t vn = NO_INDEX;
+};
+
+/// A negative (relative) index resolved against the chunk, rebased after merge
+struct RelativeIndex {
+    size_t corner;
+    uint8_t component;  ///< 0 = v, 1 = vt, 2 = vn
+};
+
+/// Everything parsed from one line-aligned slice of the file
+struct ObjChunk {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec2> texCoords;
+    std::vector<Corner> corners;
+    std::vector<uint32_t> faceSizes;
+    std::vector<RelativeIndex> relative;
+    std::string error;
+};
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+const char* skipSpaces(const char* p, const char* end) {
+    while (p < end && isSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+bool parseFloat(const char*& p, const char* end, float& value) {
+    p = skipSpaces(p, end);
+    if (p < end && *p == '+') {
+        ++p;
+    }
+    auto [next, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc()) {
+        return false;
+    }
+    p = next;
+    return true;
+}
+
+bool parseIndex(const char*& p, const char* end, int64_t& value) {
+    auto [next, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc() || value == 0) {
+        return false;  // OBJ indices are 1-based; 0 is invalid
+    }
+    p = next;
+    return true;
+}
+
+// Store one OBJ index: positive indices are global, negative ones are
+// relative to the records seen so far and are fixed up after the merge.
+bool storeIndex(ObjChunk& chunk, int64_t raw, size_t localCount, uint8_t component,
+                int32_t& out) {
+    int64_t resolved = raw > 0 ? raw - 1 : static_cast<int64_t>(localCount) + raw;
+    if (resolved > std::numeric_limits<int32_t>::max() ||
+        resolved <= std::numeric_limits<int32_t>::min()) {
+        return false;
+    }
+    out = static_cast<int32_t>(resolved);
+    if (raw < 0) {
+        chunk.relative.push_back({chunk.corners.size(), component});
+    }
+    return true;
+}
+
+bool parseFace(ObjChunk& chunk, const char* p, const char* end) {
+    uint32_t count = 0;
+    while (true) {
+        p = skipSpaces(p, end);
+        if (p >= end) {
+            break;
+        }
+
+        Corner corner;
+        int64_t raw = 0;
+        if (!parseIndex(p, end, raw) ||
+            !storeIndex(chunk, raw, chunk.positions.size(), 0, corner.v)) {
+            return false;
+        }
+        if (p < end && *p == '/') {
+            ++p;
+            if (p < end && *p != '/' && !isSpace(*p)) {
+                if (!parseIndex(p, end, raw) ||
+                    !storeIndex(chunk, raw, chunk.texCoords.size(), 1, corner.vt)) {
+                    return false;
+                }
+            }
+            if (p < end && *p == '/') {
+                ++p;
+                if (!parseIndex(p, end, raw) ||
+                    !storeIndex(chunk, raw, chunk.normals.size(), 2, corner.vn)) {
+                    return false;
+                }
+            }
+        }
+        if (p < end && !isSpace(*p)) {
+            return false;
+        }
+
+        chunk.corners.push_back(corner);
+        count++;
+    }
+    chunk.faceSizes.push_back(count);
+    return true;
+}
+
+void parseChunk(std::string_view text, ObjChunk& chunk) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+        const char* next = lineEnd < end ? lineEnd + 1 : end;
+        if (lineEnd > p && lineEnd[-1] == '\r') {
+            --lineEnd;
+        }
+
+        const char* q = skipSpaces(p, lineEnd);
+        bool ok = true;
+        if (lineEnd - q >= 2 && q[0] == 'v' && isSpace(q[1])) {
+            glm::vec3 position;
+            q += 2;
+            ok = parseFloat(q, lineEnd, position.x) && parseFloat(q, lineEnd, position.y) &&
+                 parseFloat(q, lineEnd, position.z);
+            chunk.positions.push_back(position);
+        } else if (lineEnd - q >= 3 && q[0] == 'v' && q[1] == 'n' && isSpace(q[2])) {
+            glm::vec3 normal;
+            q += 3;
+            ok = parseFloat(q, lineEnd, normal.x) && parseFloat(q, lineEnd, normal.y) &&
+                 parseFloat(q, lineEnd, normal.z);
+            chunk.normals.push_back(normal);
+        } else if (lineEnd - q >= 3 && q[0] == 'v' && q[1] == 't' && isSpace(q[2])) {
+            glm::vec2 texCoord;
+            q += 3;
+            ok = parseFloat(q, lineEnd, texCoord.x);
+            // The v coordinate is optional (1D textures)
+            if (ok && skipSpaces(q, lineEnd) < lineEnd) {
+                ok = parseFloat(q, lineEnd, texCoord.y);
+            }
+            chunk.texCoords.push_back(texCoord);
+        } else if (lineEnd - q >= 2 && q[0] == 'f' && isSpace(q[1])) {
+            ok = parseFace(chunk, q + 2, lineEnd);
+        }
+
+        if (!ok) {
+            chunk.error = "Malformed OBJ record: " + std::string(q, lineEnd);
+            return;
+        }
+        p = next;
+    }
+}
+
+/// Open-addressing map from a (v, vt, vn) triple to its vertex index
+class CornerMap {
+  public:
+    explicit CornerMap(size_t expected) {
+        size_t capacity = 64;
+        while (capacity < expected * 2) {
+            capacity <<= 1;
+        }
+        m_slots.assign(capacity, Slot{});
+    }
+
+    /// Returns the existing index, or inserts nextIndex and returns it
+    uint32_t findOrInsert(const Corner& corner, uint32_t nextIndex) {
+        if ((m_size + 1) * 2 > m_slots.size()) {
+            grow();
+        }
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = hash(corner) & mask;; i = (i + 1) & mask) {
+            Slot& slot = m_slots[i];
+            if (slot.index == EMPTY) {
+                slot.corner = corner;
+                slot.index = nextIndex;
+                m_size++;
+                return nextIndex;
+            }
+            if (slot.corner.v == corner.v && slot.corner.vt == corner.vt &&
+                slot.corner.vn == corner.vn) {
+                return slot.index;
+            }
+        }
+    }
+
+  private:
+    static constexpr uint32_t EMPTY = std::numeric_limits<uint32_t>::max();
+
+    struct Slot {
+        Corner corner;
+        uint32_t index = EMPTY;
+    };
+
+    static size_t hash(const Corner& corner) {
+        uint64_t h = static_cast<uint32_t>(corner.v) * 0x9E3779B97F4A7C15ULL;
+        h ^= static_cast<uint32_t>(corner.vt) * 0xC2B2AE3D27D4EB4FULL;
+        h ^= static_cast<uint32_t>(corner.vn) * 0x165667B19E3779F9ULL;
+        return static_cast<size_t>(h ^ (h >> 29));
+    }
+
+    void grow() {
+        std::vector<Slot> old = std::move(m_slots);
+        m_slots.assign(old.size() * 2, Slot{});
+        size_t mask = m_slots.size() - 1;
+        for (const Slot& slot : old) {
+            if (slot.index == EMPTY) {
+                continue;
+            }
+            size_t i = hash(slot.corner) & mask;
+            while (m_slots[i].index != EMPTY) {
+                i = (i + 1) & mask;
+            }
+            m_slots[i] = slot;
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_size = 0;
+};
+
+// Split at line boundaries into pieces of roughly chunkSize bytes
+std::vector<std::string_view> splitLines(std::string_view text, size_t chunkSize) {
+    std::vector<std::string_view> pieces;
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = start + chunkSize;
+        if (end >= text.size()) {
+            end = text.size();
+        } else {
+            size_t newline = text.find('\n', end);
+            end = newline == std::string_view::npos ? text.size() : newline + 1;
+        }
+        pieces.push_back(text.substr(start, end - start));
+        start = end;
+    }
+    return pieces;
+}
+
+}  // namespace
+
+ObjMeshData ObjLoader::load(const std::string& path, ThreadPool* workers) {
+    MappedFile file;
+    if (!file.open(path)) {
+        ObjMeshData result;
+        result.error = "Failed to open OBJ file: " + path;
+        return result;
+    }
+    std::string_view text(reinterpret_cast<const char*>(file.data()), file.size());
+    return parse(text, workers);
+}
+
+ObjMeshData ObjLoader::parse(std::string_view text, ThreadPool* workers, size_t chunkSize) {
+    ObjMeshData result;
+
+    std::vector<std::string_view> pieces =
+        splitLines(text, chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE);
+    std::vector<ObjChunk> chunks(pieces.size());
+
+    ThreadPool::parallelFor(workers, pieces.size(),
+                            [&pieces, &chunks](size_t i) { parseChunk(pieces[i], chunks[i]); });
+
+    // Concatenate attributes in file order and rebase relative indices
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec2> texCoords;
+    size_t triangleCount = 0;
+    for (ObjChunk& chunk : chunks) {
+        if (!chunk.error.empty()) {
+            result.error = std::move(chunk.error);
+            return result;
+        }
+        for (const RelativeIndex& rel : chunk.relative) {
+            Corner& corner = chunk.corners[rel.corner];
+            int32_t* value = rel.component == 0   ? &corner.v
+                             : rel.component == 1 ? &corner.vt
+                                                  : &corner.vn;
+            size_t offset = rel.component == 0   ? positions.size()
+                            : rel.component == 1 ? texCoords.size()
+                                                 : normals.size();
+            *value += static_cast<int32_t>(offset);
+        }
+        positions.insert(positions.end(), chunk.positions.begin(), chunk.positions.end());
+        normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+        texCoords.insert(texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+        result.cornerCount += chunk.corners.size();
+        for (uint32_t size : chunk.faceSizes) {
+            triangleCount += size >= 3 ? size - 2 : 0;
+        }
+    }
+    result.positionCount = positions.size();
+    result.normalCount = normals.size();
+    result.texCoordCount = texCoords.size();
+
+    auto inRange = [](int32_t index, size_t count) {
+        return index == NO_INDEX || (index >= 0 && static_cast<size_t>(index) < count);
+    };
+
+    // Deduplicate corners and fan-triangulate each face
+    CornerMap cornerMap(std::max({positions.size(), texCoords.size(), normals.size()}));
+    result.vertices.reserve(positions.size());
+    result.indices.reserve(triangleCount * 3);
+    std::vector<uint32_t> face;
+    for (const ObjChunk& chunk : chunks) {
+        size_t cornerIndex = 0;
+        for (uint32_t size : chunk.faceSizes) {
+            face.clear();
+            for (uint32_t c = 0; c < size; ++c) {
+                const Corner& corner = chunk.corners[cornerIndex++];
+                if (corner.v == NO_INDEX || !inRange(corner.v, positions.size()) ||
+                    !inRange(corner.vt, texCoords.size()) ||
+                    !inRange(corner.vn, normals.size())) {
+                    result.vertices.clear();
+                    result.indices.clear();
+                    result.error = "OBJ face references a missing vertex attribute";
+                    return result;
+                }
+
+                auto next = static_cast<uint32_t>(result.vertices.size());
+                uint32_t index = cornerMap.findOrInsert(corner, next);
+                if (index == next) {
+                    Vertex vertex{};
+                    vertex.position = positions[corner.v];
+                    if (corner.vt != NO_INDEX) {
+                        vertex.texCoord = texCoords[corner.vt];
+                    }
+                    // Use normal as color for now (or white if no normal)
+                    vertex.color =
+                        corner.vn != NO_INDEX ? glm::abs(normals[corner.vn]) : glm::vec3(1.0f);
+                    result.vertices.push_back(vertex);
+                }
+                face.push_back(index);
+            }
+
+            // Triangulate face (assumes convex polygons)
+            for (size_t i = 1; i + 1 < face.size(); ++i) {
+                result.indices.push_back(face[0]);
+                result.indices.push_back(face[i]);
+                result.indices.push_back(face[i + 1]);
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace vde
@@ -0,0 +1,411 @@
+/**
+ * @file PipelineCache.cpp
+ * @brief Implementation of the hashed pipeline state cache
+ */
+
+#include <vde/PipelineCache.h>
+#include <vde/api/ThreadPool.h>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace vde {
+
+namespace {
+
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+class StateHasher {
+  public:
+    template <typename T>
+    void add(const T& value) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (unsigned char byte : bytes) {
+            m_hash ^= byte;
+            m_hash *= FNV_PRIME;
+        }
+    }
+
+    uint64_t value() const { return m_hash; }
+
+  private:
+    uint64_t m_hash = FNV_OFFSET_BASIS;
+};
+
+bool sameBindings(const std::vector<VkVertexInputBindingDescription>& a,
+                  const std::vector<VkVertexInputBindingDescription>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].binding != b[i].binding || a[i].stride != b[i].stride ||
+            a[i].inputRate != b[i].inputRate) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sameAttributes(const std::vector<VkVertexInputAttributeDescription>& a,
+                    const std::vector<VkVertexInputAttributeDescription>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].location != b[i].location || a[i].binding != b[i].binding ||
+            a[i].format != b[i].format || a[i].offset != b[i].offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+// ============================================================================
+// PipelineState
+// ============================================================================
+
+uint64_t PipelineState::hash() const {
+    StateHasher hasher;
+    hasher.add(vertexShader);
+    hasher.add(fragmentShader);
+    hasher.add(layout);
+    hasher.add(renderPass);
+    hasher.add(subpass);
+
+    hasher.add(vertexBindings.size());
+    for (const auto& binding : vertexBindings) {
+        hasher.add(binding.binding);
+        hasher.add(binding.stride);
+        hasher.add(binding.inputRate);
+    }
+    hasher.add(vertexAttributes.size());
+    for (const auto& attribute : vertexAttributes) {
+        hasher.add(attribute.location);
+        hasher.add(attribute.binding);
+        hasher.add(attribute.format);
+        hasher.add(attribute.offset);
+    }
+    hasher.add(topology);
+
+    hasher.add(polygonMode);
+    hasher.add(cullMode);
+    hasher.add(frontFace);
+    hasher.add(lineWidth);
+    hasher.add(samples);
+
+    hasher.add(depthTest);
+    hasher.add(depthWrite);
+    hasher.add(depthCompareOp);
+    hasher.add(blendMode);
+    return hasher.value();
+}
+
+bool PipelineState::operator==(const PipelineState& other) const {
+    return vertexShader == other.vertexShader && fragmentShader == other.fragmentShader &&
+           layout == other.layout && renderPass == other.renderPass &&
+           subpass == other.subpass && sameBindings(vertexBindings, other.vertexBindings) &&
+           sameAttributes(vertexAttributes, other.vertexAttributes) &&
+           topology == other.topology && polygonMode == other.polygonMode &&
+           cullMode == other.cullMode && frontFace == other.frontFace &&
+           lineWidth == other.lineWidth && samples == other.samples &&
+           depthTest == other.depthTest && depthWrite == other.depthWrite &&
+           depthCompareOp == other.depthCompareOp && blendMode == other.blendMode;
+}
+
+// ============================================================================
+// PipelineCache
+// ============================================================================
+
+PipelineCache::~PipelineCache() {
+    shutdown();
+}
+
+void PipelineCache::init(VkDevice device, VkPipelineCache driverCache, ThreadPool* workers) {
+    shutdown();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_device = device;
+    m_driverCache = driverCache;
+    m_workers = workers;
+    m_stats = PipelineCacheStats{};
+}
+
+void PipelineCache::shutdown() {
+    waitIdle();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        return;
+    }
+    for (auto& [state, entry] : m_entries) {
+        if (entry.pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(m_device, entry.pipeline, nullptr);
+        }
+    }
+    m_entries.clear();
+    m_device = VK_NULL_HANDLE;
+    m_driverCache = VK_NULL_HANDLE;
+    m_workers = nullptr;
+}
+
+void PipelineCache::setWorkers(ThreadPool* workers) {
+    waitIdle();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_workers = workers;
+}
+
+VkPipeline PipelineCache::createPipeline(VkDevice device, VkPipelineCache driverCache,
+                                         const PipelineState& state) {
+    std::array<VkPipelineShaderStageCreateInfo, 2> shaderStages{};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = state.vertexShader;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = state.fragmentShader;
+    shaderStages[1].pName = "main";
+
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputInfo.vertexBindingDescriptionCount =
+        static_cast<uint32_t>(state.vertexBindings.size());
+    vertexInputInfo.pVertexBindingDescriptions = state.vertexBindings.data();
+    vertexInputInfo.vertexAttributeDescriptionCount =
+        static_cast<uint32_t>(state.vertexAttributes.size());
+    vertexInputInfo.pVertexAttributeDescriptions = state.vertexAttributes.data();
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = state.topology;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+    // Viewport and scissor (dynamic)
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+
+    VkPipelineRasterizationStateCreateInfo rasterizer{};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = state.polygonMode;
+    rasterizer.lineWidth = state.lineWidth;
+    rasterizer.cullMode = state.cullMode;
+    rasterizer.frontFace = state.frontFace;
+    rasterizer.depthBiasEnable = VK_FALSE;
+
+    VkPipelineMultisampleStateCreateInfo multisampling{};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = state.samples;
+
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = state.depthTest ? VK_TRUE : VK_FALSE;
+    depthStencil.depthWriteEnable = state.depthWrite ? VK_TRUE : VK_FALSE;
+    depthStencil.depthCompareOp = state.depthCompareOp;
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorBlendAttachment.blendEnable =
+        state.blendMode == PipelineBlendMode::Opaque ? VK_FALSE : VK_TRUE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    colorBlendAttachment.dstColorBlendFactor = state.blendMode == PipelineBlendMode::Additive
+                                                   ? VK_BLEND_FACTOR_ONE
+                                                   : VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+
+    VkPipelineColorBlendStateCreateInfo colorBlending{};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+
+    std::array<VkDynamicState, 2> dynamicStates = {VK_DYNAMIC_STATE_VIEWPORT,
+                                                   VK_DYNAMIC_STATE_SCISSOR};
+    VkPipelineDynamicStateCreateInfo dynamicState{};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+    dynamicState.pDynamicStates = dynamicStates.data();
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+    pipelineInfo.pStages = shaderStages.data();
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = state.layout;
+    pipelineInfo.renderPass = state.renderPass;
+    pipelineInfo.subpass = state.subpass;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    if (vkCreateGraphicsPipelines(device, driverCache, 1, &pipelineInfo, nullptr, &pipeline) !=
+        VK_SUCCESS) {
+        return VK_NULL_HANDLE;
+    }
+    return pipeline;
+}
+
+PipelineCache::Entry& PipelineCache::findOrQueueLocked(const PipelineState& state, bool& queued) {
+    queued = false;
+    auto it = m_entries.find(state);
+    if (it != m_entries.end()) {
+        resolveLocked(it->second);
+        return it->second;
+    }
+
+    Entry& entry = m_entries[state];
+    if (m_workers == nullptr) {
+        return entry;  // caller compiles synchronously
+    }
+
+    // Compile on a worker; the state is copied so the caller's may go away
+    auto promise = std::make_shared<std::promise<VkPipeline>>();
+    entry.pending = promise->get_future().share();
+    m_workers->submit([promise, device = m_device, driverCache = m_driverCache, state]() {
+        promise->set_value(createPipeline(device, driverCache, state));
+    });
+    m_stats.asyncCompiles++;
+    queued = true;
+    return entry;
+}
+
+void PipelineCache::resolveLocked(Entry& entry) {
+    if (!entry.pending.valid() ||
+        entry.pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+    entry.pipeline = entry.pending.get();
+    entry.pending = {};
+    if (entry.pipeline == VK_NULL_HANDLE) {
+        entry.failed = true;
+        m_stats.failures++;
+    } else {
+        m_stats.pipelinesCreated++;
+    }
+}
+
+VkPipeline PipelineCache::get(const PipelineState& state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        throw std::runtime_error("PipelineCache not initialized!");
+    }
+
+    bool queued = false;
+    Entry& entry = findOrQueueLocked(state, queued);
+    if (entry.pending.valid()) {
+        // Workers never take the lock, so waiting here cannot deadlock
+        entry.pending.wait();
+        resolveLocked(entry);
+    } else if (entry.pipeline == VK_NULL_HANDLE && !entry.failed) {
+        entry.pipeline = createPipeline(m_device, m_driverCache, state);
+        if (entry.pipeline == VK_NULL_HANDLE) {
+            entry.failed = true;
+            m_stats.failures++;
+        } else {
+            m_stats.pipelinesCreated++;
+        }
+    } else if (!queued && entry.pipeline != VK_NULL_HANDLE) {
+        m_stats.hits++;
+    }
+
+    if (entry.failed) {
+        throw std::runtime_error("Failed to create graphics pipeline variant");
+    }
+    return entry.pipeline;
+}
+
+VkPipeline PipelineCache::request(const PipelineState& state) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_device == VK_NULL_HANDLE) {
+            return VK_NULL_HANDLE;
+        }
+        if (m_workers != nullptr) {
+            bool queued = false;
+            Entry& entry = findOrQueueLocked(state, queued);
+            if (entry.pipeline != VK_NULL_HANDLE) {
+                m_stats.hits++;
+            }
+            return entry.pipeline;
+        }
+    }
+
+    // No workers: compile inline, but report failures as "not available"
+    try {
+        return get(state);
+    } catch (const std::runtime_error&) {
+        return VK_NULL_HANDLE;
+    }
+}
+
+void PipelineCache::prewarm(const std::vector<PipelineState>& states) {
+    for (const auto& state : states) {
+        request(state);
+    }
+}
+
+void PipelineCache::waitIdle() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& [state, entry] : m_entries) {
+        if (entry.pending.valid()) {
+            entry.pending.wait();
+            resolveLocked(entry);
+        }
+    }
+}
+
+void PipelineCache::evictShader(VkShaderModule module) {
+    waitIdle();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        const PipelineState& state = it->first;
+        if (state.vertexShader == module || state.fragmentShader == module) {
+            if (it->second.pipeline != VK_NULL_HANDLE) {
+                vkDestroyPipeline(m_device, it->second.pipeline, nullptr);
+            }
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+size_t PipelineCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (const auto& [state, entry] : m_entries) {
+        if (entry.pipeline != VK_NULL_HANDLE) {
+            count++;
+        }
+    }
+    return count;
+}
+
+PipelineCacheStats PipelineCache::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+}  // namespace vde
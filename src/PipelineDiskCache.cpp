@@ -0,0 +1,168 @@
+/**
+ * @file PipelineDiskCache.cpp
+ * @brief Implementation of the persistent VkPipelineCache
+ */
+
+#include <vde/PipelineDiskCache.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace vde {
+
+namespace {
+
+uint32_t readU32(const uint8_t* data) {
+    // Pipeline cache headers are written in the host's byte order
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+}  // namespace
+
+PipelineDiskCache::PipelineDiskCache(const std::string& path) : m_path(path) {}
+
+PipelineDiskCache::~PipelineDiskCache() {
+    shutdown();
+}
+
+bool PipelineDiskCache::validateHeader(const uint8_t* data, size_t size, uint32_t vendorID,
+                                       uint32_t deviceID, const uint8_t uuid[VK_UUID_SIZE]) {
+    if (data == nullptr || size < HEADER_SIZE) {
+        return false;
+    }
+
+    uint32_t headerSize = readU32(data);
+    uint32_t headerVersion = readU32(data + 4);
+    if (headerSize < HEADER_SIZE || headerSize > size ||
+        headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE) {
+        return false;
+    }
+    if (readU32(data + 8) != vendorID || readU32(data + 12) != deviceID) {
+        return false;
+    }
+    return std::memcmp(data + 16, uuid, VK_UUID_SIZE) == 0;
+}
+
+std::vector<uint8_t> PipelineDiskCache::loadValidatedBlob(VkPhysicalDevice physicalDevice) {
+    std::ifstream file(m_path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        // No cache yet, that's okay
+        return {};
+    }
+
+    std::streamsize size = file.tellg();
+    if (size <= 0) {
+        return {};
+    }
+    std::vector<uint8_t> blob(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(blob.data()), size)) {
+        m_lastError = "Failed to read pipeline cache: " + m_path;
+        return {};
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    if (!validateHeader(blob.data(), blob.size(), properties.vendorID, properties.deviceID,
+                        properties.pipelineCacheUUID)) {
+        m_lastError = "Discarding pipeline cache from a different device or driver";
+        return {};
+    }
+    return blob;
+}
+
+bool PipelineDiskCache::init(VkDevice device, VkPhysicalDevice physicalDevice) {
+    shutdown();
+    m_device = device;
+    m_loadedBytes = 0;
+
+    std::vector<uint8_t> blob = loadValidatedBlob(physicalDevice);
+
+    VkPipelineCacheCreateInfo cacheInfo{};
+    cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cacheInfo.initialDataSize = blob.size();
+    cacheInfo.pInitialData = blob.empty() ? nullptr : blob.data();
+
+    VkResult result = vkCreatePipelineCache(m_device, &cacheInfo, nullptr, &m_cache);
+    if (result != VK_SUCCESS && !blob.empty()) {
+        // The driver rejected the blob despite a matching header; start empty
+        m_lastError = "Driver rejected pipeline cache data; starting with an empty cache";
+        blob.clear();
+        cacheInfo.initialDataSize = 0;
+        cacheInfo.pInitialData = nullptr;
+        result = vkCreatePipelineCache(m_device, &cacheInfo, nullptr, &m_cache);
+    }
+    if (result != VK_SUCCESS) {
+        m_lastError = "Failed to create pipeline cache";
+        m_cache = VK_NULL_HANDLE;
+        m_device = VK_NULL_HANDLE;
+        return false;
+    }
+
+    m_loadedBytes = blob.size();
+    return true;
+}
+
+bool PipelineDiskCache::save() {
+    if (m_cache == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    size_t size = 0;
+    if (vkGetPipelineCacheData(m_device, m_cache, &size, nullptr) != VK_SUCCESS || size == 0) {
+        m_lastError = "Failed to query pipeline cache size";
+        return false;
+    }
+    std::vector<uint8_t> data(size);
+    if (vkGetPipelineCacheData(m_device, m_cache, &size, data.data()) != VK_SUCCESS) {
+        m_lastError = "Failed to read pipeline cache data";
+        return false;
+    }
+    data.resize(size);
+
+    try {
+        std::filesystem::path path(m_path);
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path());
+        }
+
+        // Write to a temporary file first so a crash never leaves a torn blob
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                m_lastError = "Failed to open pipeline cache for writing: " + m_path;
+                return false;
+            }
+            file.write(reinterpret_cast<const char*>(data.data()),
+                       static_cast<std::streamsize>(data.size()));
+            if (!file) {
+                m_lastError = "Failed to write pipeline cache: " + m_path;
+                return false;
+            }
+        }
+        std::filesystem::rename(tempPath, path);
+    } catch (const std::exception& e) {
+        m_lastError = "Failed to save pipeline cache: " + std::string(e.what());
+        return false;
+    }
+    return true;
+}
+
+void PipelineDiskCache::shutdown() {
+    if (m_cache == VK_NULL_HANDLE) {
+        return;
+    }
+    if (m_saveOnShutdown) {
+        save();
+    }
+    vkDestroyPipelineCache(m_device, m_cache, nullptr);
+    m_cache = VK_NULL_HANDLE;
+    m_device = VK_NULL_HANDLE;
+}
+
+}  // namespace vde
@@ -0,0 +1,40 @@
+/**
+ * @file ShaderBundle.cpp
+ * @brief Lookup over the build-time generated SPIR-V table
+ */
+
+#include <vde/ShaderBundle.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace vde {
+
+namespace {
+
+#ifdef VDE_EMBED_SHADERS
+// Generated by cmake/EmbedShaders.cmake; defines EMBEDDED_SHADERS sorted by name
+#include "vde_embedded_shaders.inc"
+
+constexpr std::span<const EmbeddedShader> s_shaders(EMBEDDED_SHADERS);
+#else
+constexpr std::span<const EmbeddedShader> s_shaders;
+#endif
+
+}  // namespace
+
+std::span<const uint32_t> ShaderBundle::find(std::string_view name) {
+    auto it = std::lower_bound(
+        s_shaders.begin(), s_shaders.end(), name,
+        [](const EmbeddedShader& shader, std::string_view key) { return shader.name < key; });
+    if (it == s_shaders.end() || it->name != name) {
+        return {};
+    }
+    return {it->code, it->wordCount};
+}
+
+std::span<const EmbeddedShader> ShaderBundle::getShaders() {
+    return s_shaders;
+}
+
+}  // namespace vde
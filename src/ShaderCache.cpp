@@ -1,11 +1,36 @@
+#include <vde/MappedFile.h>
 #include <vde/ShaderCache.h>
+#include <vde/api/ThreadPool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 
 namespace vde {
 
+namespace {
+
+// Size and last write time of a source file; false if it cannot be read
+bool readSourceStamp(const std::string& path, uint64_t& size, int64_t& mtime) {
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return false;
+    }
+    auto writeTime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return false;
+    }
+    size = static_cast<uint64_t>(fileSize);
+    mtime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+}  // namespace
+
 ShaderCache::ShaderCache(const std::string& cacheDirectory)
     : m_cacheDirectory(cacheDirectory), m_manifestPath(cacheDirectory + "/manifest.json"),
       m_compiler(std::make_unique<ShaderCompiler>()) {}
@@ -92,6 +117,20 @@ bool ShaderCache::loadManifest() {
                     ShaderHash::fromHexString(entryStr.substr(hashStart, hashEnd - hashStart));
             }
 
+            // Extract sourceSize / sourceMtime (absent in older manifests)
+            size_t sizePos = entryStr.find("\"sourceSize\"");
+            if (sizePos != std::string::npos) {
+                size_t sizeStart = entryStr.find("\"", sizePos + 12) + 1;
+                size_t sizeEnd = entryStr.find("\"", sizeStart);
+                entry.sourceSize = std::stoull(entryStr.substr(sizeStart, sizeEnd - sizeStart));
+            }
+            size_t mtimePos = entryStr.find("\"sourceMtime\"");
+            if (mtimePos != std::string::npos) {
+                size_t mtimeStart = entryStr.find("\"", mtimePos + 13) + 1;
+                size_t mtimeEnd = entryStr.find("\"", mtimeStart);
+                entry.sourceMtime = std::stoll(entryStr.substr(mtimeStart, mtimeEnd - mtimeStart));
+            }
+
             // Extract spvFile
             size_t spvPos = entryStr.find("\"spvFile\"");
             if (spvPos != std::string::npos) {
@@ -181,6 +220,8 @@ bool ShaderCache::saveManifest() {
         file << "    {\n";
         file << "      \"sourcePath\": \"" << entry.sourcePath << "\",\n";
         file << "      \"sourceHash\": \"" << ShaderHash::toHexString(entry.sourceHash) << "\",\n";
+        file << "      \"sourceSize\": \"" << entry.sourceSize << "\",\n";
+        file << "      \"sourceMtime\": \"" << entry.sourceMtime << "\",\n";
         file << "      \"spvFile\": \"" << entry.spvFileName << "\",\n";
         file << "      \"stage\": \"" << stageName << "\"\n";
         file << "    }";
@@ -217,9 +258,7 @@ std::vector<uint32_t> ShaderCache::loadShader(const std::string& sourcePath,
     auto it = m_entries.find(sourcePath);
     if (it != m_entries.end()) {
         // Verify source hasn't changed
-        uint64_t currentHash = ShaderHash::hashFile(sourcePath);
-
-        if (currentHash == it->second.sourceHash) {
+        if (isSourceCurrent(sourcePath, it->second, &it->second)) {
             // Load from cache
             std::string spvPath = getSpvPath(it->second.spvFileName);
             auto spirv = loadSpvFromDisk(spvPath);
@@ -236,6 +275,91 @@ std::vector<uint32_t> ShaderCache::loadShader(const std::string& sourcePath,
     return compileAndCache(sourcePath, actualStage);
 }
 
+std::vector<std::vector<uint32_t>> ShaderCache::loadShaders(
+    std::span<const std::string> sourcePaths, ThreadPool* workers) {
+    if (!m_initialized) {
+        initialize();
+    }
+
+    // Each distinct path is loaded once, even if it appears more than once
+    std::unordered_map<std::string, size_t> slotOfPath;
+    std::vector<std::string> uniquePaths;
+    std::vector<size_t> slots;
+    slots.reserve(sourcePaths.size());
+    for (const auto& path : sourcePaths) {
+        auto [it, inserted] = slotOfPath.try_emplace(path, uniquePaths.size());
+        if (inserted) {
+            uniquePaths.push_back(path);
+        }
+        slots.push_back(it->second);
+    }
+
+    struct BatchItem {
+        std::vector<uint32_t> spirv;
+        std::optional<ShaderCacheEntry> entry;  ///< Set when the shader was recompiled
+        std::string error;
+    };
+    std::vector<BatchItem> items(uniquePaths.size());
+
+    // Workers only read m_entries; new entries are merged after they finish
+    auto loadItem = [this, &uniquePaths, &items](size_t index) {
+        const std::string& sourcePath = uniquePaths[index];
+        BatchItem& item = items[index];
+        const auto& entries = m_entries;
+
+        if (m_enabled) {
+            auto it = entries.find(sourcePath);
+            ShaderCacheEntry refreshed = it != entries.end() ? it->second : ShaderCacheEntry{};
+            if (it != entries.end() && isSourceCurrent(sourcePath, it->second, &refreshed)) {
+                item.spirv = loadSpvFromDisk(getSpvPath(it->second.spvFileName));
+                if (!item.spirv.empty()) {
+                    if (refreshed.sourceMtime != it->second.sourceMtime ||
+                        refreshed.sourceSize != it->second.sourceSize) {
+                        item.entry = std::move(refreshed);  // touched but identical
+                    }
+                    m_cacheHits++;
+                    return;
+                }
+            }
+        }
+
+        m_cacheMisses++;
+        std::filesystem::path fsPath(sourcePath);
+        ShaderStage stage = shaderStageFromExtension(fsPath.extension().string());
+
+        // glslang shader/program objects must not be shared across threads
+        ShaderCompiler compiler;
+        ShaderCacheEntry entry;
+        if (compileToDisk(compiler, sourcePath, stage, item.spirv, entry, item.error)) {
+            item.entry = std::move(entry);
+        }
+    };
+
+    ThreadPool::parallelFor(workers, uniquePaths.size(), loadItem);
+
+    // Merge results on the calling thread and write the manifest once
+    bool entriesChanged = false;
+    for (auto& item : items) {
+        if (item.entry) {
+            m_entries[item.entry->sourcePath] = std::move(*item.entry);
+            entriesChanged = true;
+        }
+        if (!item.error.empty()) {
+            m_lastError = item.error;
+        }
+    }
+    if (entriesChanged) {
+        saveManifest();
+    }
+
+    std::vector<std::vector<uint32_t>> results;
+    results.reserve(slots.size());
+    for (size_t slot : slots) {
+        results.push_back(items[slot].spirv);
+    }
+    return results;
+}
+
 std::vector<uint32_t> ShaderCache::reloadShader(const std::string& sourcePath) {
     invalidate(sourcePath);
 
@@ -251,8 +375,29 @@ bool ShaderCache::hasSourceChanged(const std::string& sourcePath) const {
         return true;  // Not in cache = changed
     }
 
-    uint64_t currentHash = ShaderHash::hashFile(sourcePath);
-    return currentHash != it->second.sourceHash;
+    return !isSourceCurrent(sourcePath, it->second, nullptr);
+}
+
+bool ShaderCache::isSourceCurrent(const std::string& sourcePath, const ShaderCacheEntry& entry,
+                                  ShaderCacheEntry* refreshed) const {
+    // Unchanged size and write time: trust the recorded hash without reading the file
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    bool haveStamp = readSourceStamp(sourcePath, size, mtime);
+    if (haveStamp && entry.matchesStamp(size, mtime)) {
+        return true;
+    }
+
+    if (ShaderHash::hashFile(sourcePath) != entry.sourceHash) {
+        return false;
+    }
+
+    // Touched but identical: record the new stamp so the next check is cheap
+    if (refreshed != nullptr && haveStamp) {
+        refreshed->sourceSize = size;
+        refreshed->sourceMtime = mtime;
+    }
+    return true;
 }
 
 void ShaderCache::invalidate(const std::string& sourcePath) {
@@ -298,7 +443,9 @@ std::vector<std::string> ShaderCache::hotReload() {
     }
 
     for (const auto& path : paths) {
-        if (hasSourceChanged(path)) {
+        // Refresh stamps of touched-but-identical sources so they are not rehashed again
+        auto it = m_entries.find(path);
+        if (it != m_entries.end() && !isSourceCurrent(path, it->second, &it->second)) {
             auto spirv = reloadShader(path);
             if (!spirv.empty()) {
                 reloadedShaders.push_back(path);
@@ -318,79 +465,132 @@ std::string ShaderCache::generateSpvFileName(uint64_t hash) const {
 }
 
 std::vector<uint32_t> ShaderCache::loadSpvFromDisk(const std::string& spvPath) const {
-    std::ifstream file(spvPath, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
+    MappedFile file;
+    if (!file.open(spvPath)) {
         return {};
     }
 
-    size_t fileSize = static_cast<size_t>(file.tellg());
-    if (fileSize % sizeof(uint32_t) != 0) {
+    size_t fileSize = file.size();
+    if (fileSize == 0 || fileSize % sizeof(uint32_t) != 0) {
         return {};  // Invalid SPIR-V file
     }
 
-    file.seekg(0);
-
-    std::vector<uint32_t> spirv(fileSize / sizeof(uint32_t));
-    file.read(reinterpret_cast<char*>(spirv.data()), static_cast<std::streamsize>(fileSize));
-
-    // Validate SPIR-V magic number
-    if (spirv.empty() || spirv[0] != 0x07230203) {
+    // Validate SPIR-V magic number before copying anything
+    uint32_t magic;
+    std::memcpy(&magic, file.data(), sizeof(magic));
+    if (magic != 0x07230203) {
         return {};  // Invalid SPIR-V
     }
 
+    // Single copy from the mapped pages into the result
+    std::vector<uint32_t> spirv(fileSize / sizeof(uint32_t));
+    std::memcpy(spirv.data(), file.data(), fileSize);
     return spirv;
 }
 
 bool ShaderCache::saveSpvToDisk(const std::string& spvPath,
                                 const std::vector<uint32_t>& spirv) const {
-    std::ofstream file(spvPath, std::ios::binary);
-    if (!file.is_open()) {
-        return false;
-    }
+    // Identical sources share one .spv and may be compiled on several workers at
+    // once, so each writer uses its own temporary file and renames it into place
+    static std::atomic<uint64_t> tempCounter{0};
+    std::filesystem::path tempPath = spvPath;
+    tempPath += "." + std::to_string(tempCounter.fetch_add(1)) + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
 
-    file.write(reinterpret_cast<const char*>(spirv.data()),
-               static_cast<std::streamsize>(spirv.size() * sizeof(uint32_t)));
+        file.write(reinterpret_cast<const char*>(spirv.data()),
+                   static_cast<std::streamsize>(spirv.size() * sizeof(uint32_t)));
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
 
-    return file.good();
+    std::error_code ec;
+    std::filesystem::rename(tempPath, spvPath, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
 }
 
-std::vector<uint32_t> ShaderCache::compileAndCache(const std::string& sourcePath,
-                                                   ShaderStage stage) {
-    // Compile shader
-    auto result = m_compiler->compileFile(sourcePath, stage);
+bool ShaderCache::compileToDisk(ShaderCompiler& compiler, const std::string& sourcePath,
+                                ShaderStage stage, std::vector<uint32_t>& spirv,
+                                ShaderCacheEntry& entry, std::string& error) const {
+    // Stamp before reading: an edit that lands after this point changes the
+    // write time, so the next check rehashes instead of trusting this entry
+    uint64_t sourceSize = 0;
+    int64_t sourceMtime = 0;
+    readSourceStamp(sourcePath, sourceSize, sourceMtime);
+
+    // Read the source once; the hash and the SPIR-V both come from this buffer
+    std::string source;
+    {
+        MappedFile file;
+        if (file.open(sourcePath)) {
+            source.assign(reinterpret_cast<const char*>(file.data()), file.size());
+        }
+    }
+    if (source.empty()) {
+        error = "Failed to read shader file: " + sourcePath;
+        return false;
+    }
+    uint64_t sourceHash = ShaderHash::hash(source);
 
+    auto result = compiler.compile(source, stage, sourcePath);
     if (!result.success) {
-        m_lastError = "Shader compilation failed: " + result.errorLog;
-        return {};
+        error = "Shader compilation failed: " + result.errorLog;
+        return false;
     }
 
-    // Calculate source hash
-    uint64_t sourceHash = ShaderHash::hashFile(sourcePath);
-
     // Generate cache filename
     std::string spvFileName = generateSpvFileName(sourceHash);
     std::string spvPath = getSpvPath(spvFileName);
 
     // Save to disk
     if (!saveSpvToDisk(spvPath, result.spirv)) {
-        m_lastError = "Failed to save compiled shader to cache";
+        error = "Failed to save compiled shader to cache";
         // Still return the compiled shader even if caching failed
     }
 
-    // Update cache entry
-    ShaderCacheEntry entry;
     entry.sourcePath = sourcePath;
     entry.sourceHash = sourceHash;
+    entry.sourceSize = sourceSize;
+    entry.sourceMtime = sourceMtime;
     entry.spvFileName = spvFileName;
     entry.stage = stage;
     entry.compileTime = std::chrono::system_clock::now();
 
+    spirv = std::move(result.spirv);
+    return true;
+}
+
+std::vector<uint32_t> ShaderCache::compileAndCache(const std::string& sourcePath,
+                                                   ShaderStage stage) {
+    std::vector<uint32_t> spirv;
+    ShaderCacheEntry entry;
+    std::string error;
+    bool compiled = compileToDisk(*m_compiler, sourcePath, stage, spirv, entry, error);
+    if (!error.empty()) {
+        m_lastError = error;
+    }
+    if (!compiled) {
+        return {};
+    }
+
+    // Update cache entry
     m_entries[sourcePath] = entry;
 
     // Save manifest
     saveManifest();
 
-    return result.spirv;
+    return spirv;
 }
 
 }  // namespace vde
@@ -1,33 +1,118 @@
+#include <vde/MappedFile.h>
 #include <vde/ShaderCache.h>
 
-#include <fstream>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
 namespace vde {
 
-uint64_t ShaderHash::hash(const std::string& content) {
-    // FNV-1a 64-bit hash
-    const uint64_t FNV_PRIME = 0x00000100000001B3ULL;
-    const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
-
-    uint64_t h = FNV_OFFSET_BASIS;
-    for (char c : content) {
-        h ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
-        h *= FNV_PRIME;
+namespace {
+
+// XXH64 constants
+constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxhRound(uint64_t acc, uint64_t input) {
+    acc += input * PRIME2;
+    acc = rotl(acc, 31);
+    return acc * PRIME1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t value) {
+    acc ^= xxhRound(0, value);
+    return acc * PRIME1 + PRIME4;
+}
+
+}  // namespace
+
+uint64_t ShaderHash::hash(const void* data, size_t size) {
+    // XXH64 (seed 0): four independent lanes over 32-byte stripes keep the
+    // multipliers busy instead of serializing on one byte at a time
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        uint64_t v1 = PRIME1 + PRIME2;
+        uint64_t v2 = PRIME2;
+        uint64_t v3 = 0;
+        uint64_t v4 = 0 - PRIME1;
+        const uint8_t* limit = end - 32;
+        do {
+            v1 = xxhRound(v1, read64(p));
+            v2 = xxhRound(v2, read64(p + 8));
+            v3 = xxhRound(v3, read64(p + 16));
+            v4 = xxhRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = PRIME5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    while (p + 8 <= end) {
+        h ^= xxhRound(0, read64(p));
+        h = rotl(h, 27) * PRIME1 + PRIME4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * PRIME1;
+        h = rotl(h, 23) * PRIME2 + PRIME3;
+        p += 4;
     }
+    while (p < end) {
+        h ^= static_cast<uint64_t>(*p) * PRIME5;
+        h = rotl(h, 11) * PRIME1;
+        p++;
+    }
+
+    // Avalanche
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
     return h;
 }
 
+uint64_t ShaderHash::hash(const std::string& content) {
+    return hash(content.data(), content.size());
+}
+
 uint64_t ShaderHash::hashFile(const std::string& filePath) {
-    std::ifstream file(filePath, std::ios::binary);
-    if (!file.is_open()) {
+    // Hash straight from the mapping; no stream or string copy
+    MappedFile file;
+    if (!file.open(filePath)) {
         return 0;
     }
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return hash(buffer.str());
+    return hash(file.data(), file.size());
 }
 
 std::string ShaderHash::toHexString(uint64_t hash) {
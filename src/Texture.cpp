@@ -17,8 +17,9 @@ Texture::Texture(Texture&& other) noexcept
       m_height(other.m_height), m_channels(other.m_channels), m_device(other.m_device),
       m_physicalDevice(other.m_physicalDevice), m_commandPool(other.m_commandPool),
       m_graphicsQueue(other.m_graphicsQueue), m_image(other.m_image),
-      m_imageMemory(other.m_imageMemory), m_imageView(other.m_imageView),
-      m_sampler(other.m_sampler) {
+      m_imageAllocation(other.m_imageAllocation), m_imageView(other.m_imageView),
+      m_sampler(other.m_sampler), m_uploadHandle(other.m_uploadHandle),
+      m_bindlessTable(other.m_bindlessTable), m_bindlessIndex(other.m_bindlessIndex) {
     other.m_width = 0;
     other.m_height = 0;
     other.m_channels = 4;
@@ -27,9 +28,12 @@ Texture::Texture(Texture&& other) noexcept
     other.m_commandPool = VK_NULL_HANDLE;
     other.m_graphicsQueue = VK_NULL_HANDLE;
     other.m_image = VK_NULL_HANDLE;
-    other.m_imageMemory = VK_NULL_HANDLE;
+    other.m_imageAllocation = GpuAllocation{};
     other.m_imageView = VK_NULL_HANDLE;
     other.m_sampler = VK_NULL_HANDLE;
+    other.m_uploadHandle = UploadHandle{};
+    other.m_bindlessTable = nullptr;
+    other.m_bindlessIndex = BindlessTextureTable::INVALID_INDEX;
 }
 
 Texture& Texture::operator=(Texture&& other) noexcept {
@@ -44,9 +48,12 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         m_commandPool = other.m_commandPool;
         m_graphicsQueue = other.m_graphicsQueue;
         m_image = other.m_image;
-        m_imageMemory = other.m_imageMemory;
+        m_imageAllocation = other.m_imageAllocation;
         m_imageView = other.m_imageView;
         m_sampler = other.m_sampler;
+        m_uploadHandle = other.m_uploadHandle;
+        m_bindlessTable = other.m_bindlessTable;
+        m_bindlessIndex = other.m_bindlessIndex;
         other.m_width = 0;
         other.m_height = 0;
         other.m_channels = 4;
@@ -55,9 +62,12 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         other.m_commandPool = VK_NULL_HANDLE;
         other.m_graphicsQueue = VK_NULL_HANDLE;
         other.m_image = VK_NULL_HANDLE;
-        other.m_imageMemory = VK_NULL_HANDLE;
+        other.m_imageAllocation = GpuAllocation{};
         other.m_imageView = VK_NULL_HANDLE;
         other.m_sampler = VK_NULL_HANDLE;
+        other.m_uploadHandle = UploadHandle{};
+        other.m_bindlessTable = nullptr;
+        other.m_bindlessIndex = BindlessTextureTable::INVALID_INDEX;
     }
     return *this;
 }
@@ -139,38 +149,8 @@ bool Texture::uploadToGPU(VulkanContext* context) {
         BufferUtils::init(m_device, m_physicalDevice, m_commandPool, m_graphicsQueue);
     }
 
-    // Create staging buffer
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingMemory;
-    BufferUtils::createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
-                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              stagingBuffer, stagingMemory);
-
-    // Copy pixel data to staging buffer
-    void* data;
-    vkMapMemory(m_device, stagingMemory, 0, imageSize, 0, &data);
-    memcpy(data, m_pixelData.data(), static_cast<size_t>(imageSize));
-    vkUnmapMemory(m_device, stagingMemory);
-
-    // Create Vulkan image
-    createImage(m_width, m_height, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
-                VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-    // Transition to transfer destination
-    transitionImageLayout(VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-    // Copy from staging buffer
-    copyBufferToImage(stagingBuffer, m_width, m_height);
-
-    // Transition to shader read
-    transitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-    // Cleanup staging buffer
-    vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-    vkFreeMemory(m_device, stagingMemory, nullptr);
+    // Create the image and queue the pixel upload
+    uploadPixels(m_pixelData.data(), imageSize);
 
     // Create image view
     createImageView(VK_FORMAT_R8G8B8A8_SRGB);
@@ -178,10 +158,45 @@ bool Texture::uploadToGPU(VulkanContext* context) {
     // Create sampler
     createSampler();
 
+    // Make the texture addressable by index in bindless shaders
+    if (context->getBindlessTextures().isInitialized()) {
+        registerBindless(context->getBindlessTextures());
+    }
+
     return true;
 }
 
+bool Texture::registerBindless(BindlessTextureTable& table) {
+    if (!isValid() || !table.isInitialized()) {
+        return false;
+    }
+    if (m_bindlessTable == &table && m_bindlessIndex != BindlessTextureTable::INVALID_INDEX) {
+        return true;
+    }
+    if (m_bindlessTable != nullptr) {
+        m_bindlessTable->remove(m_bindlessIndex);
+    }
+
+    m_bindlessIndex = table.add(m_imageView, m_sampler);
+    m_bindlessTable = m_bindlessIndex != BindlessTextureTable::INVALID_INDEX ? &table : nullptr;
+    return m_bindlessTable != nullptr;
+}
+
+bool Texture::isUploadComplete() const {
+    return BufferUtils::getUploadManager().isReady(m_uploadHandle);
+}
+
 void Texture::freeGPUResources(VkDevice device) {
+    // The transfer queue may still be writing into the image
+    BufferUtils::getUploadManager().wait(m_uploadHandle);
+    m_uploadHandle = UploadHandle{};
+
+    if (m_bindlessTable != nullptr) {
+        m_bindlessTable->remove(m_bindlessIndex);
+        m_bindlessTable = nullptr;
+        m_bindlessIndex = BindlessTextureTable::INVALID_INDEX;
+    }
+
     if (device != VK_NULL_HANDLE) {
         if (m_sampler != VK_NULL_HANDLE) {
             vkDestroySampler(device, m_sampler, nullptr);
@@ -195,10 +210,7 @@ void Texture::freeGPUResources(VkDevice device) {
             vkDestroyImage(device, m_image, nullptr);
             m_image = VK_NULL_HANDLE;
         }
-        if (m_imageMemory != VK_NULL_HANDLE) {
-            vkFreeMemory(device, m_imageMemory, nullptr);
-            m_imageMemory = VK_NULL_HANDLE;
-        }
+        BufferUtils::getAllocator().free(m_imageAllocation);
     }
     // Keep CPU pixel data and dimensions
 }
@@ -236,42 +248,12 @@ bool Texture::loadFromFile(const std::string& filepath, VkDevice device,
         BufferUtils::init(device, physicalDevice, commandPool, graphicsQueue);
     }
 
-    // Create staging buffer
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingMemory;
-    BufferUtils::createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
-                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              stagingBuffer, stagingMemory);
-
-    // Copy pixel data to staging buffer
-    void* data;
-    vkMapMemory(device, stagingMemory, 0, imageSize, 0, &data);
-    memcpy(data, imageData.pixels, static_cast<size_t>(imageSize));
-    vkUnmapMemory(device, stagingMemory);
+    // Create the image and queue the pixel upload
+    uploadPixels(imageData.pixels, imageSize);
 
-    // Free CPU image data
+    // Free CPU image data (already copied to staging memory)
     ImageLoader::free(imageData);
 
-    // Create Vulkan image
-    createImage(m_width, m_height, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
-                VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-    // Transition to transfer destination
-    transitionImageLayout(VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-    // Copy from staging buffer
-    copyBufferToImage(stagingBuffer, m_width, m_height);
-
-    // Transition to shader read
-    transitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-    // Cleanup staging buffer
-    vkDestroyBuffer(device, stagingBuffer, nullptr);
-    vkFreeMemory(device, stagingMemory, nullptr);
-
     // Create image view
     createImageView(VK_FORMAT_R8G8B8A8_SRGB);
 
@@ -305,38 +287,8 @@ bool Texture::createFromData(const uint8_t* pixels, uint32_t width, uint32_t hei
         BufferUtils::init(device, physicalDevice, commandPool, graphicsQueue);
     }
 
-    // Create staging buffer
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingMemory;
-    BufferUtils::createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
-                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              stagingBuffer, stagingMemory);
-
-    // Copy pixel data to staging buffer
-    void* data;
-    vkMapMemory(device, stagingMemory, 0, imageSize, 0, &data);
-    memcpy(data, pixels, static_cast<size_t>(imageSize));
-    vkUnmapMemory(device, stagingMemory);
-
-    // Create Vulkan image
-    createImage(m_width, m_height, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
-                VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-    // Transition to transfer destination
-    transitionImageLayout(VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-    // Copy from staging buffer
-    copyBufferToImage(stagingBuffer, m_width, m_height);
-
-    // Transition to shader read
-    transitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-    // Cleanup staging buffer
-    vkDestroyBuffer(device, stagingBuffer, nullptr);
-    vkFreeMemory(device, stagingMemory, nullptr);
+    // Create the image and queue the pixel upload
+    uploadPixels(pixels, imageSize);
 
     // Create image view
     createImageView(VK_FORMAT_R8G8B8A8_SRGB);
@@ -351,6 +303,38 @@ bool Texture::createFromData(const uint8_t* pixels, uint32_t width, uint32_t hei
 
 // Private helper methods
 
+void Texture::uploadPixels(const void* pixels, VkDeviceSize imageSize) {
+    createImage(m_width, m_height, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    // Queue on the transfer batch; the frame submission waits for it on the GPU
+    UploadManager& uploads = BufferUtils::getUploadManager();
+    if (uploads.isInitialized()) {
+        m_uploadHandle = uploads.uploadImage(m_image, m_width, m_height, pixels, imageSize);
+        return;
+    }
+
+    // Fallback: record transitions and copy into a single blocking submission
+    VkBuffer stagingBuffer;
+    GpuAllocation stagingAllocation;
+    BufferUtils::createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                              stagingBuffer, stagingAllocation);
+    memcpy(stagingAllocation.mapped, pixels, static_cast<size_t>(imageSize));
+
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+    transitionImageLayout(commandBuffer, VK_IMAGE_LAYOUT_UNDEFINED,
+                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    copyBufferToImage(commandBuffer, stagingBuffer, m_width, m_height);
+    transitionImageLayout(commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    endSingleTimeCommands(commandBuffer);
+
+    BufferUtils::destroyBuffer(stagingBuffer, stagingAllocation);
+}
+
 void Texture::createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling,
                           VkImageUsageFlags usage, VkMemoryPropertyFlags properties) {
     VkImageCreateInfo imageInfo{};
@@ -369,24 +353,27 @@ void Texture::createImage(uint32_t width, uint32_t height, VkFormat format, VkIm
     imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     imageInfo.flags = 0;
 
+    // Uploads on a dedicated transfer family write without ownership transfers
+    const std::vector<uint32_t>& sharedFamilies =
+        BufferUtils::getUploadManager().getSharedQueueFamilies();
+    if (!sharedFamilies.empty()) {
+        imageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        imageInfo.queueFamilyIndexCount = static_cast<uint32_t>(sharedFamilies.size());
+        imageInfo.pQueueFamilyIndices = sharedFamilies.data();
+    }
+
     if (vkCreateImage(m_device, &imageInfo, nullptr, &m_image) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create image!");
     }
 
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(m_device, m_image, &memRequirements);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex =
-        BufferUtils::findMemoryType(memRequirements.memoryTypeBits, properties);
-
-    if (vkAllocateMemory(m_device, &allocInfo, nullptr, &m_imageMemory) != VK_SUCCESS) {
-        throw std::runtime_error("Failed to allocate image memory!");
+    try {
+        m_imageAllocation =
+            BufferUtils::getAllocator().allocateForImage(m_image, properties, tiling);
+    } catch (...) {
+        vkDestroyImage(m_device, m_image, nullptr);
+        m_image = VK_NULL_HANDLE;
+        throw;
     }
-
-    vkBindImageMemory(m_device, m_image, m_imageMemory, 0);
 }
 
 void Texture::createImageView(VkFormat format) {
@@ -475,15 +462,21 @@ void Texture::endSingleTimeCommands(VkCommandBuffer commandBuffer) {
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &commandBuffer;
 
-    vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(m_graphicsQueue);
+    // Wait for this submission only (not the whole queue)
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    VkFence fence = VK_NULL_HANDLE;
+    vkCreateFence(m_device, &fenceInfo, nullptr, &fence);
+
+    vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, fence);
+    vkWaitForFences(m_device, 1, &fence, VK_TRUE, UINT64_MAX);
+    vkDestroyFence(m_device, fence, nullptr);
 
     vkFreeCommandBuffers(m_device, m_commandPool, 1, &commandBuffer);
 }
 
-void Texture::transitionImageLayout(VkImageLayout oldLayout, VkImageLayout newLayout) {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
-
+void Texture::transitionImageLayout(VkCommandBuffer commandBuffer, VkImageLayout oldLayout,
+                                    VkImageLayout newLayout) {
     // Set up image memory barrier
     VkImageMemoryBarrier barrier{};
     barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -519,13 +512,10 @@ void Texture::transitionImageLayout(VkImageLayout oldLayout, VkImageLayout newLa
 
     vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1,
                          &barrier);
-
-    endSingleTimeCommands(commandBuffer);
 }
 
-void Texture::copyBufferToImage(VkBuffer buffer, uint32_t width, uint32_t height) {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
-
+void Texture::copyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer buffer, uint32_t width,
+                                uint32_t height) {
     VkBufferImageCopy region{};
     region.bufferOffset = 0;
     region.bufferRowLength = 0;
@@ -539,8 +529,6 @@ void Texture::copyBufferToImage(VkBuffer buffer, uint32_t width, uint32_t height
 
     vkCmdCopyBufferToImage(commandBuffer, buffer, m_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
                            &region);
-
-    endSingleTimeCommands(commandBuffer);
 }
 
 }  // namespace vde
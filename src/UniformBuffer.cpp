@@ -12,7 +12,7 @@ UniformBuffer::~UniformBuffer() {
 
 UniformBuffer::UniformBuffer(UniformBuffer&& other) noexcept
     : m_device(other.m_device), m_bufferSize(other.m_bufferSize),
-      m_buffers(std::move(other.m_buffers)), m_buffersMemory(std::move(other.m_buffersMemory)),
+      m_buffers(std::move(other.m_buffers)), m_allocations(std::move(other.m_allocations)),
       m_buffersMapped(std::move(other.m_buffersMapped)) {
     // Nullify source
     other.m_device = VK_NULL_HANDLE;
@@ -26,7 +26,7 @@ UniformBuffer& UniformBuffer::operator=(UniformBuffer&& other) noexcept {
         m_device = other.m_device;
         m_bufferSize = other.m_bufferSize;
         m_buffers = std::move(other.m_buffers);
-        m_buffersMemory = std::move(other.m_buffersMemory);
+        m_allocations = std::move(other.m_allocations);
         m_buffersMapped = std::move(other.m_buffersMapped);
 
         other.m_device = VK_NULL_HANDLE;
@@ -51,19 +51,18 @@ void UniformBuffer::create(VkDevice device, [[maybe_unused]] VkPhysicalDevice ph
     m_bufferSize = bufferSize;
 
     m_buffers.resize(count);
-    m_buffersMemory.resize(count);
+    m_allocations.resize(count);
     m_buffersMapped.resize(count);
 
     for (uint32_t i = 0; i < count; i++) {
         BufferUtils::createBuffer(
             bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-            m_buffers[i], m_buffersMemory[i]);
+            m_buffers[i], m_allocations[i]);
 
-        // Persistently map the buffer
-        VkResult result =
-            vkMapMemory(device, m_buffersMemory[i], 0, bufferSize, 0, &m_buffersMapped[i]);
-        if (result != VK_SUCCESS) {
+        // Host-visible allocator blocks stay persistently mapped
+        m_buffersMapped[i] = m_allocations[i].mapped;
+        if (m_buffersMapped[i] == nullptr) {
             throw std::runtime_error("Failed to map uniform buffer memory!");
         }
     }
@@ -71,40 +70,35 @@ void UniformBuffer::create(VkDevice device, [[maybe_unused]] VkPhysicalDevice ph
 
 void UniformBuffer::cleanup() {
     for (size_t i = 0; i < m_buffers.size(); i++) {
-        // Unmap before destroying
-        if (m_buffersMapped[i] != nullptr && m_buffersMemory[i] != VK_NULL_HANDLE) {
-            vkUnmapMemory(m_device, m_buffersMemory[i]);
-            m_buffersMapped[i] = nullptr;
-        }
+        // The mapping belongs to the allocator block; just drop the pointer
+        m_buffersMapped[i] = nullptr;
 
         if (m_buffers[i] != VK_NULL_HANDLE) {
             vkDestroyBuffer(m_device, m_buffers[i], nullptr);
             m_buffers[i] = VK_NULL_HANDLE;
         }
 
-        if (m_buffersMemory[i] != VK_NULL_HANDLE) {
-            vkFreeMemory(m_device, m_buffersMemory[i], nullptr);
-            m_buffersMemory[i] = VK_NULL_HANDLE;
-        }
+        BufferUtils::getAllocator().free(m_allocations[i]);
     }
 
     m_buffers.clear();
-    m_buffersMemory.clear();
+    m_allocations.clear();
     m_buffersMapped.clear();
 }
 
-void UniformBuffer::update(uint32_t frameIndex, const void* data, VkDeviceSize size) {
+void UniformBuffer::update(uint32_t frameIndex, const void* data, VkDeviceSize size,
+                           VkDeviceSize offset) {
     if (frameIndex >= m_buffers.size()) {
         throw std::out_of_range("Frame index out of range for uniform buffer update");
     }
     if (data == nullptr) {
         throw std::invalid_argument("Cannot update uniform buffer with null data");
     }
-    if (size > m_bufferSize) {
+    if (offset > m_bufferSize || size > m_bufferSize - offset) {
         throw std::runtime_error("Data size exceeds uniform buffer size");
     }
 
-    memcpy(m_buffersMapped[frameIndex], data, size);
+    memcpy(static_cast<char*>(m_buffersMapped[frameIndex]) + offset, data, size);
 }
 
 VkBuffer UniformBuffer::getBuffer(uint32_t frameIndex) const {
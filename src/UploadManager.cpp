@@ -0,0 +1,492 @@
+/**
+ * @file UploadManager.cpp
+ * @brief Implementation of the staging-ring upload manager
+ */
+
+#include <vde/BufferUtils.h>
+#include <vde/UploadManager.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace vde {
+
+namespace {
+
+VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+UploadManager::~UploadManager() {
+    shutdown();
+}
+
+void UploadManager::init(VkDevice device, uint32_t queueFamily, VkQueue queue,
+                         uint32_t graphicsQueueFamily, bool timelineSemaphoreSupported,
+                         VkDeviceSize ringSize) {
+    shutdown();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_device = device;
+    m_queue = queue;
+    m_queueFamily = queueFamily;
+    m_graphicsQueueFamily = graphicsQueueFamily;
+    m_sharedQueueFamilies.clear();
+    if (queueFamily != graphicsQueueFamily) {
+        m_sharedQueueFamilies = {graphicsQueueFamily, queueFamily};
+    }
+
+    if (timelineSemaphoreSupported) {
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &typeInfo;
+
+        if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &m_timelineSemaphore) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create upload timeline semaphore!");
+        }
+    }
+
+    m_ringSize = alignUp(ringSize, STAGING_ALIGNMENT);
+    m_ringHead = 0;
+    m_ringTail = 0;
+    BufferUtils::createBuffer(m_ringSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                              m_ringBuffer, m_ringAllocation);
+
+    m_submittedValue = 0;
+    m_completedValue = 0;
+    m_stats = UploadStats{};
+}
+
+void UploadManager::shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    // Unsubmitted work is simply dropped; submitted work must finish first
+    while (!m_inFlight.empty()) {
+        vkWaitForFences(m_device, 1, &m_inFlight.front()->fence, VK_TRUE, UINT64_MAX);
+        retireFrontLocked();
+    }
+    if (m_current) {
+        destroyBatch(*m_current);
+        m_current.reset();
+    }
+    for (auto& batch : m_freeBatches) {
+        destroyBatch(*batch);
+    }
+    m_freeBatches.clear();
+
+    BufferUtils::destroyBuffer(m_ringBuffer, m_ringAllocation);
+
+    if (m_timelineSemaphore != VK_NULL_HANDLE) {
+        vkDestroySemaphore(m_device, m_timelineSemaphore, nullptr);
+        m_timelineSemaphore = VK_NULL_HANDLE;
+    }
+
+    m_sharedQueueFamilies.clear();
+    m_device = VK_NULL_HANDLE;
+    m_queue = VK_NULL_HANDLE;
+}
+
+// ============================================================================
+// Batches
+// ============================================================================
+
+UploadManager::Batch& UploadManager::beginBatchLocked() {
+    if (m_current) {
+        return *m_current;
+    }
+
+    std::unique_ptr<Batch> batch;
+    if (!m_freeBatches.empty()) {
+        batch = std::move(m_freeBatches.back());
+        m_freeBatches.pop_back();
+        vkResetCommandPool(m_device, batch->commandPool, 0);
+        vkResetFences(m_device, 1, &batch->fence);
+    } else {
+        batch = std::make_unique<Batch>();
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = m_queueFamily;
+        if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &batch->commandPool) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create upload command pool!");
+        }
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = batch->commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(m_device, &allocInfo, &batch->commandBuffer) !=
+            VK_SUCCESS) {
+            destroyBatch(*batch);
+            throw std::runtime_error("Failed to allocate upload command buffer!");
+        }
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(m_device, &fenceInfo, nullptr, &batch->fence) != VK_SUCCESS) {
+            destroyBatch(*batch);
+            throw std::runtime_error("Failed to create upload fence!");
+        }
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(batch->commandBuffer, &beginInfo);
+
+    batch->value = m_submittedValue + 1;
+    m_current = std::move(batch);
+    return *m_current;
+}
+
+UploadHandle UploadManager::flushLocked() {
+    if (!m_current) {
+        return UploadHandle{m_submittedValue};
+    }
+
+    Batch& batch = *m_current;
+    if (vkEndCommandBuffer(batch.commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to record upload command buffer!");
+    }
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &batch.commandBuffer;
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    if (m_timelineSemaphore != VK_NULL_HANDLE) {
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.signalSemaphoreValueCount = 1;
+        timelineInfo.pSignalSemaphoreValues = &batch.value;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &m_timelineSemaphore;
+    }
+
+    if (vkQueueSubmit(m_queue, 1, &submitInfo, batch.fence) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to submit upload batch!");
+    }
+
+    m_submittedValue = batch.value;
+    m_stats.batchesSubmitted++;
+    m_inFlight.push_back(std::move(m_current));
+
+    // Without a timeline semaphore the graphics queue cannot wait on the
+    // GPU, so complete the batch here (one wait per batch, not per asset)
+    if (m_timelineSemaphore == VK_NULL_HANDLE) {
+        waitLocked(m_submittedValue);
+    }
+
+    return UploadHandle{m_submittedValue};
+}
+
+void UploadManager::retireFrontLocked() {
+    std::unique_ptr<Batch> batch = std::move(m_inFlight.front());
+    m_inFlight.pop_front();
+
+    if (batch->usesRing) {
+        m_ringTail = batch->ringEnd;
+    }
+    for (auto& [buffer, allocation] : batch->oversized) {
+        BufferUtils::destroyBuffer(buffer, allocation);
+    }
+    batch->oversized.clear();
+    batch->usesRing = false;
+    batch->uploadCount = 0;
+
+    m_completedValue = batch->value;
+    m_freeBatches.push_back(std::move(batch));
+}
+
+void UploadManager::pollLocked() {
+    while (!m_inFlight.empty() &&
+           vkGetFenceStatus(m_device, m_inFlight.front()->fence) == VK_SUCCESS) {
+        retireFrontLocked();
+    }
+}
+
+void UploadManager::waitLocked(uint64_t value) {
+    while (!m_inFlight.empty() && m_inFlight.front()->value <= value) {
+        vkWaitForFences(m_device, 1, &m_inFlight.front()->fence, VK_TRUE, UINT64_MAX);
+        retireFrontLocked();
+    }
+}
+
+void UploadManager::destroyBatch(Batch& batch) {
+    for (auto& [buffer, allocation] : batch.oversized) {
+        BufferUtils::destroyBuffer(buffer, allocation);
+    }
+    batch.oversized.clear();
+    if (batch.fence != VK_NULL_HANDLE) {
+        vkDestroyFence(m_device, batch.fence, nullptr);
+        batch.fence = VK_NULL_HANDLE;
+    }
+    if (batch.commandPool != VK_NULL_HANDLE) {
+        // Frees the command buffer as well
+        vkDestroyCommandPool(m_device, batch.commandPool, nullptr);
+        batch.commandPool = VK_NULL_HANDLE;
+        batch.commandBuffer = VK_NULL_HANDLE;
+    }
+}
+
+// ============================================================================
+// Staging ring
+// ============================================================================
+
+bool UploadManager::isRingIdle() const {
+    if (m_current && m_current->usesRing) {
+        return false;
+    }
+    for (const auto& batch : m_inFlight) {
+        if (batch->usesRing) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool UploadManager::ringAllocate(VkDeviceSize size, VkDeviceSize& offset) {
+    bool idle = isRingIdle();
+    if (idle) {
+        m_ringHead = 0;
+        m_ringTail = 0;
+    }
+
+    VkDeviceSize start = alignUp(m_ringHead, STAGING_ALIGNMENT);
+    if (idle || m_ringHead > m_ringTail) {
+        // Free space is [head, size) followed by [0, tail)
+        if (start + size > m_ringSize) {
+            if (size > m_ringTail) {
+                return false;
+            }
+            start = 0;
+        }
+    } else if (m_ringHead < m_ringTail) {
+        if (start + size > m_ringTail) {
+            return false;
+        }
+    } else {
+        return false;  // head == tail with live data: full
+    }
+
+    m_ringHead = start + size;
+    offset = start;
+    return true;
+}
+
+void UploadManager::stageLocked(const void* data, VkDeviceSize size, VkBuffer& buffer,
+                                VkDeviceSize& offset) {
+    if (size <= m_ringSize) {
+        pollLocked();
+        bool allocated = ringAllocate(size, offset);
+
+        if (!allocated) {
+            // Our own unsubmitted copies may be what fills the ring
+            if (m_current && m_current->usesRing) {
+                flushLocked();
+            }
+            while (!allocated && !m_inFlight.empty()) {
+                m_stats.ringStalls++;
+                vkWaitForFences(m_device, 1, &m_inFlight.front()->fence, VK_TRUE, UINT64_MAX);
+                retireFrontLocked();
+                allocated = ringAllocate(size, offset);
+            }
+        }
+
+        if (allocated) {
+            Batch& batch = beginBatchLocked();
+            batch.usesRing = true;
+            batch.ringEnd = m_ringHead;
+            std::memcpy(static_cast<char*>(m_ringAllocation.mapped) + offset, data,
+                        static_cast<size_t>(size));
+            buffer = m_ringBuffer;
+            return;
+        }
+    }
+
+    // Too large for the ring: use a temporary buffer released with the batch
+    GpuAllocation allocation;
+    BufferUtils::createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                              buffer, allocation);
+    std::memcpy(allocation.mapped, data, static_cast<size_t>(size));
+    beginBatchLocked().oversized.emplace_back(buffer, allocation);
+    offset = 0;
+    m_stats.oversizedStagingBuffers++;
+}
+
+// ============================================================================
+// Uploads
+// ============================================================================
+
+UploadHandle UploadManager::uploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size,
+                                         VkDeviceSize dstOffset) {
+    if (data == nullptr || size == 0) {
+        return UploadHandle{};
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        throw std::runtime_error("UploadManager not initialized!");
+    }
+
+    VkBuffer stagingBuffer = VK_NULL_HANDLE;
+    VkDeviceSize stagingOffset = 0;
+    stageLocked(data, size, stagingBuffer, stagingOffset);
+
+    Batch& batch = beginBatchLocked();
+
+    VkBufferCopy region{};
+    region.srcOffset = stagingOffset;
+    region.dstOffset = dstOffset;
+    region.size = size;
+    vkCmdCopyBuffer(batch.commandBuffer, stagingBuffer, dstBuffer, 1, &region);
+
+    batch.uploadCount++;
+    m_stats.uploadCount++;
+    m_stats.bytesUploaded += size;
+    return UploadHandle{batch.value};
+}
+
+UploadHandle UploadManager::uploadImage(VkImage image, uint32_t width, uint32_t height,
+                                        const void* data, VkDeviceSize size) {
+    if (data == nullptr || size == 0) {
+        return UploadHandle{};
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        throw std::runtime_error("UploadManager not initialized!");
+    }
+
+    VkBuffer stagingBuffer = VK_NULL_HANDLE;
+    VkDeviceSize stagingOffset = 0;
+    stageLocked(data, size, stagingBuffer, stagingOffset);
+
+    Batch& batch = beginBatchLocked();
+
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    VkBufferImageCopy region{};
+    region.bufferOffset = stagingOffset;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = {0, 0, 0};
+    region.imageExtent = {width, height, 1};
+    vkCmdCopyBufferToImage(batch.commandBuffer, stagingBuffer, image,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+    // A transfer-only queue cannot name shader stages; the semaphore wait on
+    // the graphics queue makes the write visible to the shaders instead
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = 0;
+    vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                         &barrier);
+
+    batch.uploadCount++;
+    m_stats.uploadCount++;
+    m_stats.bytesUploaded += size;
+    return UploadHandle{batch.value};
+}
+
+// ============================================================================
+// Completion
+// ============================================================================
+
+UploadHandle UploadManager::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        return UploadHandle{};
+    }
+    pollLocked();
+    return flushLocked();
+}
+
+void UploadManager::poll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device != VK_NULL_HANDLE) {
+        pollLocked();
+    }
+}
+
+bool UploadManager::isReady(UploadHandle handle) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!handle.isValid() || m_device == VK_NULL_HANDLE) {
+        return true;
+    }
+    if (handle.value > m_submittedValue) {
+        return false;  // still in the batch being recorded
+    }
+    pollLocked();
+    return m_completedValue >= handle.value;
+}
+
+void UploadManager::wait(UploadHandle handle) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!handle.isValid() || m_device == VK_NULL_HANDLE) {
+        return;
+    }
+    if (handle.value > m_submittedValue) {
+        flushLocked();
+    }
+    waitLocked(handle.value);
+}
+
+void UploadManager::waitIdle() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_device == VK_NULL_HANDLE) {
+        return;
+    }
+    flushLocked();
+    waitLocked(m_submittedValue);
+}
+
+uint64_t UploadManager::getSubmittedValue() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_submittedValue;
+}
+
+UploadStats UploadManager::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+}  // namespace vde
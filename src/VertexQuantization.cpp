@@ -0,0 +1,96 @@
+/**
+ * @file VertexQuantization.cpp
+ * @brief Implementation of vertex and index quantization
+ */
+
+#include <vde/VertexQuantization.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace vde {
+
+namespace {
+
+constexpr float UNORM16_MAX = 65535.0f;
+constexpr float UNORM8_MAX = 255.0f;
+
+bool inUnitRange(float value) {
+    return value >= 0.0f && value <= 1.0f;
+}
+
+uint16_t toUnorm16(float value) {
+    return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * UNORM16_MAX));
+}
+
+uint8_t toUnorm8(float value) {
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * UNORM8_MAX));
+}
+
+}  // namespace
+
+bool VertexQuantization::canCompact(std::span<const Vertex> vertices) {
+    return std::all_of(vertices.begin(), vertices.end(), [](const Vertex& v) {
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!std::isfinite(v.position[axis]) || !inUnitRange(v.color[axis])) {
+                return false;
+            }
+        }
+        return inUnitRange(v.texCoord.x) && inUnitRange(v.texCoord.y);
+    });
+}
+
+std::vector<CompactVertex> VertexQuantization::compact(std::span<const Vertex> vertices,
+                                                       const glm::vec3& boundsMin,
+                                                       const glm::vec3& boundsMax) {
+    glm::vec3 extent = boundsMax - boundsMin;
+    glm::vec3 invExtent(0.0f);
+    for (int axis = 0; axis < 3; ++axis) {
+        if (extent[axis] > 0.0f) {
+            invExtent[axis] = 1.0f / extent[axis];
+        }
+    }
+
+    std::vector<CompactVertex> result(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Vertex& v = vertices[i];
+        CompactVertex& c = result[i];
+        for (int axis = 0; axis < 3; ++axis) {
+            c.position[axis] = toUnorm16((v.position[axis] - boundsMin[axis]) * invExtent[axis]);
+            c.color[axis] = toUnorm8(v.color[axis]);
+        }
+        c.position[3] = 0;
+        c.color[3] = 0;
+        c.texCoord[0] = toUnorm16(v.texCoord.x);
+        c.texCoord[1] = toUnorm16(v.texCoord.y);
+    }
+    return result;
+}
+
+std::vector<Vertex> VertexQuantization::expand(std::span<const CompactVertex> vertices,
+                                               const glm::vec3& boundsMin,
+                                               const glm::vec3& boundsMax) {
+    glm::vec3 extent = boundsMax - boundsMin;
+    std::vector<Vertex> result(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const CompactVertex& c = vertices[i];
+        Vertex& v = result[i];
+        for (int axis = 0; axis < 3; ++axis) {
+            float fraction = static_cast<float>(c.position[axis]) / UNORM16_MAX;
+            v.position[axis] = boundsMin[axis] + extent[axis] * fraction;
+            v.color[axis] = static_cast<float>(c.color[axis]) / UNORM8_MAX;
+        }
+        v.texCoord = glm::vec2(static_cast<float>(c.texCoord[0]) / UNORM16_MAX,
+                               static_cast<float>(c.texCoord[1]) / UNORM16_MAX);
+    }
+    return result;
+}
+
+std::vector<uint16_t> VertexQuantization::narrowIndices(std::span<const uint32_t> indices) {
+    std::vector<uint16_t> result(indices.size());
+    std::transform(indices.begin(), indices.end(), result.begin(),
+                   [](uint32_t index) { return static_cast<uint16_t>(index); });
+    return result;
+}
+
+}  // namespace vde
@@ -2,6 +2,7 @@
 #include <vde/Types.h>
 #include <vde/VulkanContext.h>
 #include <vde/Window.h>
+#include <vde/api/ThreadPool.h>
 
 #define GLM_FORCE_RADIANS
 #include <GLFW/glfw3.h>
@@ -9,9 +10,12 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstring>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <limits>
 #include <map>
@@ -40,11 +44,22 @@ void VulkanContext::initialize(Window* window) {
 
     m_startTime = glfwGetTime();
 
+    // One FrameContext per frame in flight, filled in as resources are created
+    m_framePacer.reset(m_framesInFlight);
+    m_frames.assign(m_framesInFlight, FrameContext{});
+    for (uint32_t i = 0; i < m_framesInFlight; ++i) {
+        m_frames[i].index = i;
+    }
+    m_frameWaited = false;
+
     createInstance();
     setupDebugMessenger();
     createSurface(window);
     pickPhysicalDevice();
     createLogicalDevice();
+
+    // Seed pipeline creation with the blob saved by the previous run
+    m_pipelineCache.init(m_device, m_physicalDevice);
     createSwapChain(window);
     createImageViews();
     createRenderPass();
@@ -53,10 +68,20 @@ void VulkanContext::initialize(Window* window) {
     createCommandPool();
 
     // Initialize BufferUtils for buffer creation
-    BufferUtils::init(m_device, m_physicalDevice, m_commandPool, m_graphicsQueue);
+    BufferUtils::init(m_device, m_physicalDevice, m_commandPool, m_graphicsQueue,
+                      m_memoryBudgetSupported);
+    BufferUtils::getUploadManager().init(m_device, m_transferQueueFamilyIndex, m_transferQueue,
+                                         m_graphicsQueueFamilyIndex,
+                                         m_timelineSemaphoreSupported);
     createUniformBuffers();
+    m_frameAllocator.create(m_framesInFlight, FrameAllocator::DEFAULT_CAPACITY,
+                            m_minUniformBufferOffsetAlignment, m_minStorageBufferOffsetAlignment);
     createCommandBuffers();
     createSyncObjects();
+
+    if (m_descriptorIndexingSupported) {
+        m_bindlessTextures.init(m_device, m_maxBindlessTextures, m_framesInFlight);
+    }
 }
 
 void VulkanContext::cleanup() {
@@ -74,35 +99,43 @@ void VulkanContext::cleanup() {
     }
     m_renderFinishedSemaphores.clear();
 
-    for (auto& semaphore : m_imageAvailableSemaphores) {
-        if (semaphore != VK_NULL_HANDLE) {
-            vkDestroySemaphore(m_device, semaphore, nullptr);
+    for (auto& frame : m_frames) {
+        if (frame.imageAvailable != VK_NULL_HANDLE) {
+            vkDestroySemaphore(m_device, frame.imageAvailable, nullptr);
         }
-    }
-    m_imageAvailableSemaphores.clear();
-
-    for (auto& fence : m_inFlightFences) {
-        if (fence != VK_NULL_HANDLE) {
-            vkDestroyFence(m_device, fence, nullptr);
+        if (frame.inFlightFence != VK_NULL_HANDLE) {
+            vkDestroyFence(m_device, frame.inFlightFence, nullptr);
         }
     }
-    m_inFlightFences.clear();
+    if (m_frameTimeline != VK_NULL_HANDLE) {
+        vkDestroySemaphore(m_device, m_frameTimeline, nullptr);
+        m_frameTimeline = VK_NULL_HANDLE;
+    }
 
-    // Destroy command pool
+    destroySecondaryCommandBuffers();
+
+    // Destroy command pool (frees the primary command buffers)
     if (m_commandPool != VK_NULL_HANDLE) {
         vkDestroyCommandPool(m_device, m_commandPool, nullptr);
         m_commandPool = VK_NULL_HANDLE;
     }
-    m_commandBuffers.clear();
 
     // Cleanup uniform buffers
     m_uniformBuffer.cleanup();
-    m_uboDescriptorSets.clear();
+    m_frameAllocator.destroy();
+
+    // Descriptor sets go with their pools; the frames hold nothing else
+    m_frames.clear();
+    m_imageFrameValues.clear();
 
     // Reset BufferUtils
     BufferUtils::reset();
 
+    // Persist compiled pipelines for the next launch
+    m_pipelineCache.shutdown();
+
     // Destroy descriptor set layouts
+    m_bindlessTextures.cleanup();
     m_descriptorManager.cleanup();
 
     cleanupSwapChain();
@@ -174,9 +207,8 @@ void VulkanContext::recreateSwapchain(uint32_t width, uint32_t height) {
     createRenderPass();
     createFramebuffers();
 
-    // Reset images in flight tracking for new swapchain
-    m_imagesInFlight.clear();
-    m_imagesInFlight.resize(m_swapChainImages.size(), VK_NULL_HANDLE);
+    // The device is idle, so no image is still being rendered
+    m_imageFrameValues.assign(m_swapChainImages.size(), 0);
 
     // Update camera aspect ratio
     float aspectRatio = static_cast<float>(width) / static_cast<float>(height);
@@ -342,6 +374,21 @@ QueueFamilyIndices VulkanContext::findQueueFamilies(VkPhysicalDevice device) {
         i++;
     }
 
+    // Prefer a dedicated transfer family (DMA engine), then any non-graphics one
+    for (uint32_t family = 0; family < queueFamilyCount; family++) {
+        VkQueueFlags flags = queueFamilies[family].queueFlags;
+        if (!(flags & VK_QUEUE_TRANSFER_BIT) || (flags & VK_QUEUE_GRAPHICS_BIT)) {
+            continue;
+        }
+        if (!(flags & VK_QUEUE_COMPUTE_BIT)) {
+            indices.transferFamily = family;
+            break;
+        }
+        if (!indices.transferFamily.has_value()) {
+            indices.transferFamily = family;
+        }
+    }
+
     return indices;
 }
 
@@ -428,6 +475,9 @@ void VulkanContext::createLogicalDevice() {
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
     std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily.value(),
                                               indices.presentFamily.value()};
+    if (indices.transferFamily.has_value()) {
+        uniqueQueueFamilies.insert(indices.transferFamily.value());
+    }
 
     float queuePriority = 1.0f;
     for (uint32_t queueFamily : uniqueQueueFamilies) {
@@ -439,15 +489,88 @@ void VulkanContext::createLogicalDevice() {
         queueCreateInfos.push_back(queueCreateInfo);
     }
 
+    // Optional core features: fillModeNonSolid enables the wireframe pipeline variants
+    VkPhysicalDeviceFeatures supportedFeatures;
+    vkGetPhysicalDeviceFeatures(m_physicalDevice, &supportedFeatures);
     VkPhysicalDeviceFeatures deviceFeatures{};
+    deviceFeatures.fillModeNonSolid = supportedFeatures.fillModeNonSolid;
+    m_fillModeNonSolidSupported = supportedFeatures.fillModeNonSolid == VK_TRUE;
+
+    // Optional extensions: memory budget lets GpuAllocator report real heap budgets
+    std::vector<const char*> enabledExtensions = m_deviceExtensions;
+    uint32_t extensionCount = 0;
+    vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &extensionCount, nullptr);
+    std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &extensionCount,
+                                         availableExtensions.data());
+    m_memoryBudgetSupported = false;
+    for (const auto& extension : availableExtensions) {
+        if (std::strcmp(extension.extensionName, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) == 0) {
+            enabledExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+            m_memoryBudgetSupported = true;
+            break;
+        }
+    }
+
+    // Timeline semaphores let graphics submissions wait on uploads without a CPU stall
+    VkPhysicalDeviceVulkan12Features vulkan12Features{};
+    vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &deviceProperties);
+    m_minUniformBufferOffsetAlignment = deviceProperties.limits.minUniformBufferOffsetAlignment;
+    m_minStorageBufferOffsetAlignment = deviceProperties.limits.minStorageBufferOffsetAlignment;
+    m_timelineSemaphoreSupported = false;
+    m_descriptorIndexingSupported = false;
+    m_maxBindlessTextures = 0;
+    if (deviceProperties.apiVersion >= VK_API_VERSION_1_2) {
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &vulkan12Features;
+        vkGetPhysicalDeviceFeatures2(m_physicalDevice, &features2);
+        m_timelineSemaphoreSupported = vulkan12Features.timelineSemaphore == VK_TRUE;
+
+        // Descriptor indexing backs the bindless texture table
+        m_descriptorIndexingSupported =
+            vulkan12Features.runtimeDescriptorArray == VK_TRUE &&
+            vulkan12Features.descriptorBindingPartiallyBound == VK_TRUE &&
+            vulkan12Features.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE &&
+            vulkan12Features.shaderSampledImageArrayNonUniformIndexing == VK_TRUE;
+        if (m_descriptorIndexingSupported) {
+            VkPhysicalDeviceVulkan12Properties vulkan12Properties{};
+            vulkan12Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+            VkPhysicalDeviceProperties2 properties2{};
+            properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+            properties2.pNext = &vulkan12Properties;
+            vkGetPhysicalDeviceProperties2(m_physicalDevice, &properties2);
+            m_maxBindlessTextures = std::min(
+                {BindlessTextureTable::DEFAULT_CAPACITY,
+                 vulkan12Properties.maxDescriptorSetUpdateAfterBindSampledImages,
+                 vulkan12Properties.maxDescriptorSetUpdateAfterBindSamplers,
+                 vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+                 vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSamplers});
+            m_descriptorIndexingSupported = m_maxBindlessTextures > 0;
+        }
+    }
+    VkPhysicalDeviceVulkan12Features enabled12Features{};
+    enabled12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    enabled12Features.timelineSemaphore = m_timelineSemaphoreSupported ? VK_TRUE : VK_FALSE;
+    if (m_descriptorIndexingSupported) {
+        enabled12Features.runtimeDescriptorArray = VK_TRUE;
+        enabled12Features.descriptorBindingPartiallyBound = VK_TRUE;
+        enabled12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        enabled12Features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+    }
 
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    createInfo.pNext = (m_timelineSemaphoreSupported || m_descriptorIndexingSupported)
+                           ? &enabled12Features
+                           : nullptr;
     createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
     createInfo.pQueueCreateInfos = queueCreateInfos.data();
     createInfo.pEnabledFeatures = &deviceFeatures;
-    createInfo.enabledExtensionCount = static_cast<uint32_t>(m_deviceExtensions.size());
-    createInfo.ppEnabledExtensionNames = m_deviceExtensions.data();
+    createInfo.enabledExtensionCount = static_cast<uint32_t>(enabledExtensions.size());
+    createInfo.ppEnabledExtensionNames = enabledExtensions.data();
 
     if (kEnableValidationLayers) {
         createInfo.enabledLayerCount = static_cast<uint32_t>(m_validationLayers.size());
@@ -463,6 +586,9 @@ void VulkanContext::createLogicalDevice() {
     m_graphicsQueueFamilyIndex = indices.graphicsFamily.value();
     vkGetDeviceQueue(m_device, indices.graphicsFamily.value(), 0, &m_graphicsQueue);
     vkGetDeviceQueue(m_device, indices.presentFamily.value(), 0, &m_presentQueue);
+
+    m_transferQueueFamilyIndex = indices.transferFamily.value_or(m_graphicsQueueFamilyIndex);
+    vkGetDeviceQueue(m_device, m_transferQueueFamilyIndex, 0, &m_transferQueue);
 }
 
 // =========================================================================
@@ -693,7 +819,7 @@ void VulkanContext::createFramebuffers() {
 // =========================================================================
 
 void VulkanContext::createDescriptorSetLayouts() {
-    m_descriptorManager.init(m_device);
+    m_descriptorManager.init(m_device, m_framesInFlight);
 }
 
 void VulkanContext::createUniformBuffers() {
@@ -702,38 +828,62 @@ void VulkanContext::createUniformBuffers() {
     m_camera.setTarget(glm::vec3(0.0f, 0.0f, 0.0f));
     m_camera.setPerspective(45.0f, aspectRatio, 0.1f, 200.0f);
 
-    m_uniformBuffer.create(m_device, m_physicalDevice, sizeof(UniformBufferObject),
-                           MAX_FRAMES_IN_FLIGHT);
-
-    m_uboDescriptorSets = m_descriptorManager.allocateUBODescriptorSets();
-
-    const auto& buffers = m_uniformBuffer.getBuffers();
-    for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
-        m_descriptorManager.updateUBODescriptor(m_uboDescriptorSets[i], buffers[i],
+    // One aligned camera slot per view, selected by dynamic offset
+    m_uboStride =
+        UniformBuffer::alignSize(sizeof(UniformBufferObject), m_minUniformBufferOffsetAlignment);
+    m_uniformBuffer.create(m_device, m_physicalDevice, m_uboStride * MAX_VIEWS, m_framesInFlight);
+
+    std::vector<VkDescriptorSet> uboSets = m_descriptorManager.allocateUBODescriptorSets();
+    for (FrameContext& frame : m_frames) {
+        frame.uniformBuffer = m_uniformBuffer.getBuffer(frame.index);
+        frame.uboDescriptorSet = uboSets[frame.index];
+        frame.cameraVersions.assign(MAX_VIEWS, 0);
+        m_descriptorManager.updateUBODescriptor(frame.uboDescriptorSet, frame.uniformBuffer,
                                                 sizeof(UniformBufferObject));
     }
 }
 
 VkCommandBuffer VulkanContext::getCurrentCommandBuffer() const {
-    if (m_commandBuffers.empty())
+    if (m_frames.empty())
         return VK_NULL_HANDLE;
-    return m_commandBuffers[m_currentFrame];
+    return getCurrentFrameContext().commandBuffer;
 }
 
 VkBuffer VulkanContext::getCurrentUniformBuffer() const {
-    if (!m_uniformBuffer.isCreated() || m_currentFrame >= m_uniformBuffer.getCount()) {
+    if (m_frames.empty()) {
         return VK_NULL_HANDLE;
     }
-    return m_uniformBuffer.getBuffer(m_currentFrame);
+    return getCurrentFrameContext().uniformBuffer;
 }
 
-void VulkanContext::updateUniformBuffer(uint32_t currentFrameIndex) {
+void VulkanContext::updateUniformBuffer() {
+    // Single-view frames use the first slot
+    m_currentView = 0;
+    writeCameraSlot(0, m_camera.getViewMatrix(), m_camera.getProjectionMatrix(),
+                    m_camera.getVersion());
+}
+
+void VulkanContext::writeCameraSlot(uint32_t view, const glm::mat4& viewMatrix,
+                                    const glm::mat4& projMatrix, uint64_t cameraVersion) {
+    // Each frame slot has its own buffer, so the slot may still hold this
+    // camera from the last time the frame slot came round
+    FrameContext& frame = getCurrentFrameContext();
+    if (cameraVersion != 0 && view < frame.cameraVersions.size() &&
+        frame.cameraVersions[view] == cameraVersion) {
+        m_uploadStats.cameraSlotsSkipped++;
+        return;
+    }
+
     UniformBufferObject ubo{};
     ubo.model = glm::mat4(1.0f);
-    ubo.view = m_camera.getViewMatrix();
-    ubo.proj = m_camera.getProjectionMatrix();
-
-    m_uniformBuffer.update(currentFrameIndex, &ubo, sizeof(ubo));
+    ubo.view = viewMatrix;
+    ubo.proj = projMatrix;
+    m_uniformBuffer.update(frame.index, &ubo, sizeof(ubo), view * m_uboStride);
+    if (view < frame.cameraVersions.size()) {
+        frame.cameraVersions[view] = cameraVersion;
+    }
+    m_uploadStats.cameraBytes += sizeof(ubo);
+    m_uploadStats.cameraSlotsWritten++;
 }
 
 // =========================================================================
@@ -754,17 +904,69 @@ void VulkanContext::createCommandPool() {
 }
 
 void VulkanContext::createCommandBuffers() {
-    m_commandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+    std::vector<VkCommandBuffer> commandBuffers(m_frames.size());
 
     VkCommandBufferAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     allocInfo.commandPool = m_commandPool;
     allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandBufferCount = static_cast<uint32_t>(m_commandBuffers.size());
+    allocInfo.commandBufferCount = static_cast<uint32_t>(commandBuffers.size());
 
-    if (vkAllocateCommandBuffers(m_device, &allocInfo, m_commandBuffers.data()) != VK_SUCCESS) {
+    if (vkAllocateCommandBuffers(m_device, &allocInfo, commandBuffers.data()) != VK_SUCCESS) {
         throw std::runtime_error("Failed to allocate command buffers!");
     }
+    for (FrameContext& frame : m_frames) {
+        frame.commandBuffer = commandBuffers[frame.index];
+    }
+}
+
+VkCommandBuffer VulkanContext::acquireSecondaryCommandBuffer(uint32_t slot) {
+    auto& frameSlots = getCurrentFrameContext().secondarySlots;
+    if (slot < frameSlots.size()) {
+        // The frame's previous submission has completed, so the pool is idle
+        vkResetCommandPool(m_device, frameSlots[slot].pool, 0);
+        return frameSlots[slot].buffer;
+    }
+
+    while (frameSlots.size() <= slot) {
+        SecondaryCommandSlot newSlot;
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = m_graphicsQueueFamilyIndex;
+
+        if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &newSlot.pool) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create secondary command pool!");
+        }
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = newSlot.pool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocInfo.commandBufferCount = 1;
+
+        if (vkAllocateCommandBuffers(m_device, &allocInfo, &newSlot.buffer) != VK_SUCCESS) {
+            vkDestroyCommandPool(m_device, newSlot.pool, nullptr);
+            throw std::runtime_error("Failed to allocate secondary command buffer!");
+        }
+
+        frameSlots.push_back(newSlot);
+    }
+
+    return frameSlots[slot].buffer;
+}
+
+void VulkanContext::destroySecondaryCommandBuffers() {
+    for (auto& frame : m_frames) {
+        for (auto& slot : frame.secondarySlots) {
+            // Destroying the pool frees its command buffers
+            if (slot.pool != VK_NULL_HANDLE) {
+                vkDestroyCommandPool(m_device, slot.pool, nullptr);
+            }
+        }
+        frame.secondarySlots.clear();
+    }
 }
 
 void VulkanContext::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
@@ -822,10 +1024,8 @@ void VulkanContext::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
 void VulkanContext::createSyncObjects() {
     size_t imageCount = m_swapChainImages.size();
 
-    m_imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
     m_renderFinishedSemaphores.resize(imageCount);
-    m_inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
-    m_imagesInFlight.resize(imageCount, VK_NULL_HANDLE);
+    m_imageFrameValues.assign(imageCount, 0);
 
     VkSemaphoreCreateInfo semaphoreInfo{};
     semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -834,10 +1034,30 @@ void VulkanContext::createSyncObjects() {
     fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
     fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-    for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
-        if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &m_imageAvailableSemaphores[i]) !=
-                VK_SUCCESS ||
-            vkCreateFence(m_device, &fenceInfo, nullptr, &m_inFlightFences[i]) != VK_SUCCESS) {
+    // Frames are paced on one timeline semaphore; per-frame fences are the
+    // fallback for devices without timeline semaphores
+    if (m_timelineSemaphoreSupported) {
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo timelineInfo{};
+        timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        timelineInfo.pNext = &typeInfo;
+
+        if (vkCreateSemaphore(m_device, &timelineInfo, nullptr, &m_frameTimeline) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create frame timeline semaphore!");
+        }
+    }
+
+    for (FrameContext& frame : m_frames) {
+        if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &frame.imageAvailable) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create synchronization objects!");
+        }
+        if (m_frameTimeline == VK_NULL_HANDLE &&
+            vkCreateFence(m_device, &fenceInfo, nullptr, &frame.inFlightFence) != VK_SUCCESS) {
             throw std::runtime_error("Failed to create synchronization objects!");
         }
     }
@@ -851,64 +1071,78 @@ void VulkanContext::createSyncObjects() {
     }
 }
 
+void VulkanContext::waitForFrameValue(uint64_t value) {
+    if (value == 0) {
+        return;
+    }
+
+    if (m_frameTimeline != VK_NULL_HANDLE) {
+        VkSemaphoreWaitInfo waitInfo{};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &m_frameTimeline;
+        waitInfo.pValues = &value;
+        vkWaitSemaphores(m_device, &waitInfo, UINT64_MAX);
+        return;
+    }
+
+    // Each fence stands for its slot's latest value; a slot only moves on
+    // after its previous value was waited for, so older values are done
+    for (const FrameContext& frame : m_frames) {
+        if (m_framePacer.getSlotValue(frame.index) == value) {
+            vkWaitForFences(m_device, 1, &frame.inFlightFence, VK_TRUE, UINT64_MAX);
+            return;
+        }
+    }
+}
+
 // =========================================================================
 // Drawing
 // =========================================================================
 
+void VulkanContext::waitForCurrentFrame() {
+    if (m_frameWaited || m_frames.empty()) {
+        return;
+    }
+    // Wait for the previous frame recorded into this slot; its resources are then free
+    waitForFrameValue(m_framePacer.getWaitValue());
+    m_frameAllocator.beginFrame(getCurrentFrame());
+    m_uploadStats.reset();
+    m_frameWaited = true;
+}
+
 void VulkanContext::drawFrame() {
-    // Wait for previous frame using this frame index
-    vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+    waitForCurrentFrame();
 
     // Acquire next image
     uint32_t imageIndex;
     VkResult result = vkAcquireNextImageKHR(m_device, m_swapChain, UINT64_MAX,
-                                            m_imageAvailableSemaphores[m_currentFrame],
+                                            getCurrentFrameContext().imageAvailable,
                                             VK_NULL_HANDLE, &imageIndex);
 
     if (result == VK_ERROR_OUT_OF_DATE_KHR) {
         recreateSwapchain(m_swapChainExtent.width, m_swapChainExtent.height);
+        m_frameWaited = false;  // Nothing was submitted; the slot is reused as-is
         return;
     } else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
         throw std::runtime_error("Failed to acquire swap chain image!");
     }
 
-    // Check if a previous frame is using this image (i.e. there is a fence to wait on)
-    if (m_imagesInFlight[imageIndex] != VK_NULL_HANDLE) {
-        vkWaitForFences(m_device, 1, &m_imagesInFlight[imageIndex], VK_TRUE, UINT64_MAX);
-    }
-    // Mark the image as now being in use by this frame
-    m_imagesInFlight[imageIndex] = m_inFlightFences[m_currentFrame];
-
-    vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
+    // A previous frame may still be rendering to this image
+    waitForFrameValue(m_imageFrameValues[imageIndex]);
 
     // Update uniform buffer
-    updateUniformBuffer(m_currentFrame);
+    updateUniformBuffer();
 
     // Record command buffer
-    vkResetCommandBuffer(m_commandBuffers[m_currentFrame], 0);
-    recordCommandBuffer(m_commandBuffers[m_currentFrame], imageIndex);
+    VkCommandBuffer commandBuffer = getCurrentFrameContext().commandBuffer;
+    vkResetCommandBuffer(commandBuffer, 0);
+    recordCommandBuffer(commandBuffer, imageIndex);
 
     // Submit command buffer
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-
-    VkSemaphore waitSemaphores[] = {m_imageAvailableSemaphores[m_currentFrame]};
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &m_commandBuffers[m_currentFrame];
-
     // Use per-image render finished semaphore to avoid conflicts with swapchain
     VkSemaphore signalSemaphores[] = {m_renderFinishedSemaphores[imageIndex]};
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = signalSemaphores;
-
-    if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_inFlightFences[m_currentFrame]) !=
-        VK_SUCCESS) {
-        throw std::runtime_error("Failed to submit draw command buffer!");
-    }
+    submitFrameCommandBuffer(commandBuffer, imageIndex);
 
     // Present
     VkPresentInfoKHR presentInfo{};
@@ -929,40 +1163,170 @@ void VulkanContext::drawFrame() {
         throw std::runtime_error("Failed to present swap chain image!");
     }
 
-    m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    m_framePacer.advance();
+    m_frameWaited = false;
+}
+
+void VulkanContext::submitFrameCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+    // Kick off any uploads queued this frame; the GPU (not the CPU) waits for them
+    UploadManager& uploads = BufferUtils::getUploadManager();
+    uploads.flush();
+
+    FrameContext& frame = getCurrentFrameContext();
+    std::array<VkSemaphore, 2> waitSemaphores = {frame.imageAvailable, VK_NULL_HANDLE};
+    std::array<VkPipelineStageFlags, 2> waitStages = {
+        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0};
+    std::array<uint64_t, 2> waitValues = {0, 0};
+    uint32_t waitCount = 1;
+
+    uint64_t uploadValue = uploads.getSubmittedValue();
+    if (uploads.getTimelineSemaphore() != VK_NULL_HANDLE && uploadValue > 0) {
+        waitSemaphores[waitCount] = uploads.getTimelineSemaphore();
+        waitStages[waitCount] = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                                VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        waitValues[waitCount] = uploadValue;
+        waitCount++;
+    }
+
+    // The submission signals the next frame value; the slot and the image
+    // are reused only once the timeline (or the slot's fence) reaches it
+    const uint64_t frameValue = m_framePacer.submit();
+    m_imageFrameValues[imageIndex] = frameValue;
+
+    std::array<VkSemaphore, 2> signalSemaphores = {m_renderFinishedSemaphores[imageIndex],
+                                                   m_frameTimeline};
+    std::array<uint64_t, 2> signalValues = {0, frameValue};
+    const uint32_t signalCount = m_frameTimeline != VK_NULL_HANDLE ? 2 : 1;
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.waitSemaphoreValueCount = waitCount;
+    timelineInfo.pWaitSemaphoreValues = waitValues.data();
+    timelineInfo.signalSemaphoreValueCount = signalCount;
+    timelineInfo.pSignalSemaphoreValues = signalValues.data();
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = (waitCount > 1 || signalCount > 1) ? &timelineInfo : nullptr;
+    submitInfo.waitSemaphoreCount = waitCount;
+    submitInfo.pWaitSemaphores = waitSemaphores.data();
+    submitInfo.pWaitDstStageMask = waitStages.data();
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &commandBuffer;
+    submitInfo.signalSemaphoreCount = signalCount;
+    submitInfo.pSignalSemaphores = signalSemaphores.data();
+
+    if (frame.inFlightFence != VK_NULL_HANDLE) {
+        vkResetFences(m_device, 1, &frame.inFlightFence);
+    }
+    if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, frame.inFlightFence) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to submit draw command buffer!");
+    }
+
+    m_bindlessTextures.nextFrame();
 }
 
 void VulkanContext::drawFrameMultiScene(const std::vector<SceneRenderInfo>& sceneRenderInfos) {
     if (sceneRenderInfos.empty()) {
         return;
     }
+    if (sceneRenderInfos.size() > MAX_VIEWS) {
+        throw std::runtime_error("Too many scenes for one frame (MAX_VIEWS)!");
+    }
 
-    // Wait for previous frame using this frame index
-    vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+    waitForCurrentFrame();
 
     // Acquire next image
     uint32_t imageIndex;
     VkResult result = vkAcquireNextImageKHR(m_device, m_swapChain, UINT64_MAX,
-                                            m_imageAvailableSemaphores[m_currentFrame],
+                                            getCurrentFrameContext().imageAvailable,
                                             VK_NULL_HANDLE, &imageIndex);
 
     if (result == VK_ERROR_OUT_OF_DATE_KHR) {
         recreateSwapchain(m_swapChainExtent.width, m_swapChainExtent.height);
+        m_frameWaited = false;  // Nothing was submitted; the slot is reused as-is
         return;
     } else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
         throw std::runtime_error("Failed to acquire swap chain image!");
     }
 
-    // Check if a previous frame is using this image
-    if (m_imagesInFlight[imageIndex] != VK_NULL_HANDLE) {
-        vkWaitForFences(m_device, 1, &m_imagesInFlight[imageIndex], VK_TRUE, UINT64_MAX);
+    // A previous frame may still be rendering to this image
+    waitForFrameValue(m_imageFrameValues[imageIndex]);
+
+    // Record secondary command buffers in parallel when a recording pool is set.
+    // Slots are acquired on this thread; each task owns its slot's pool.
+    const bool parallel =
+        m_recordingThreadPool != nullptr && m_recordingThreadPool->getThreadCount() > 0;
+    std::vector<std::vector<VkCommandBuffer>> secondaryBuffers(sceneRenderInfos.size());
+    if (parallel) {
+        VkFramebuffer framebuffer = m_swapChainFramebuffers[imageIndex];
+        std::vector<std::future<void>> tasks;
+        uint32_t slot = 0;
+
+        for (size_t i = 0; i < sceneRenderInfos.size(); ++i) {
+            const auto& info = sceneRenderInfos[i];
+            VkRenderPass renderPass = info.clearPass ? m_renderPass : m_renderPassLoad;
+
+            for (const auto& recorder : info.secondaryRecorders) {
+                VkCommandBuffer secondary = acquireSecondaryCommandBuffer(slot++);
+                secondaryBuffers[i].push_back(secondary);
+
+                tasks.push_back(m_recordingThreadPool->submit(
+                    [secondary, renderPass, framebuffer, &recorder]() {
+                        VkCommandBufferInheritanceInfo inheritance{};
+                        inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+                        inheritance.renderPass = renderPass;
+                        inheritance.subpass = 0;
+                        inheritance.framebuffer = framebuffer;
+
+                        VkCommandBufferBeginInfo secondaryBegin{};
+                        secondaryBegin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                        secondaryBegin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                                               VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+                        secondaryBegin.pInheritanceInfo = &inheritance;
+
+                        if (vkBeginCommandBuffer(secondary, &secondaryBegin) != VK_SUCCESS) {
+                            throw std::runtime_error(
+                                "Failed to begin recording secondary command buffer!");
+                        }
+                        if (recorder) {
+                            recorder(secondary);
+                        }
+                        if (vkEndCommandBuffer(secondary) != VK_SUCCESS) {
+                            throw std::runtime_error("Failed to record secondary command buffer!");
+                        }
+                    }));
+            }
+        }
+
+        // Wait for every task before rethrowing so none outlives the recorders
+        std::exception_ptr error;
+        for (auto& task : tasks) {
+            try {
+                task.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
     }
-    m_imagesInFlight[imageIndex] = m_inFlightFences[m_currentFrame];
 
-    vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
+    // Every view's camera goes to its own slot of this frame's UBO; draws
+    // select it by dynamic offset, so no transfer or barrier is recorded.
+    // Slots already holding the same camera version are left alone.
+    for (size_t i = 0; i < sceneRenderInfos.size(); ++i) {
+        const SceneRenderInfo& info = sceneRenderInfos[i];
+        writeCameraSlot(static_cast<uint32_t>(i), info.viewMatrix, info.projMatrix,
+                        info.cameraVersion);
+    }
 
     // Record command buffer with multi-scene rendering
-    VkCommandBuffer commandBuffer = m_commandBuffers[m_currentFrame];
+    VkCommandBuffer commandBuffer = getCurrentFrameContext().commandBuffer;
     vkResetCommandBuffer(commandBuffer, 0);
 
     VkCommandBufferBeginInfo beginInfo{};
@@ -971,54 +1335,57 @@ void VulkanContext::drawFrameMultiScene(const std::vector<SceneRenderInfo>& scen
         throw std::runtime_error("Failed to begin recording command buffer!");
     }
 
-    for (size_t i = 0; i < sceneRenderInfos.size(); ++i) {
-        const auto& info = sceneRenderInfos[i];
-        bool isFirst = info.clearPass;
-
-        // Update UBO with this scene's camera via vkCmdUpdateBuffer
-        // (Must be outside render pass)
-        UniformBufferObject ubo{};
-        ubo.model = glm::mat4(1.0f);
-        ubo.view = info.viewMatrix;
-        ubo.proj = info.projMatrix;
-
-        VkBuffer uboBuffer = m_uniformBuffer.getBuffer(m_currentFrame);
-        vkCmdUpdateBuffer(commandBuffer, uboBuffer, 0, sizeof(UniformBufferObject), &ubo);
-
-        // Pipeline barrier: transfer write -> uniform read
-        VkBufferMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_UNIFORM_READ_BIT;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.buffer = uboBuffer;
-        barrier.offset = 0;
-        barrier.size = sizeof(UniformBufferObject);
-
-        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
-                             VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 0, nullptr, 1, &barrier, 0,
-                             nullptr);
-
-        // Begin render pass
+    VkClearValue clearColor = {{{m_clearColor.r, m_clearColor.g, m_clearColor.b, m_clearColor.a}}};
+    bool passOpen = false;
+    bool cleared = !sceneRenderInfos.front().clearPass;
+    VkSubpassContents openContents = VK_SUBPASS_CONTENTS_INLINE;
+
+    // All views share one pass; a subpass holds either secondaries or inline
+    // commands, so a LOAD pass is started only when the contents change
+    auto usePass = [&](VkSubpassContents contents) {
+        if (passOpen && openContents == contents) {
+            return;
+        }
+        if (passOpen) {
+            vkCmdEndRenderPass(commandBuffer);
+        }
+
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = isFirst ? m_renderPass : m_renderPassLoad;
+        renderPassInfo.renderPass = cleared ? m_renderPassLoad : m_renderPass;
         renderPassInfo.framebuffer = m_swapChainFramebuffers[imageIndex];
         renderPassInfo.renderArea.offset = {0, 0};
         renderPassInfo.renderArea.extent = m_swapChainExtent;
-
-        VkClearValue clearColor = {
-            {{m_clearColor.r, m_clearColor.g, m_clearColor.b, m_clearColor.a}}};
-        if (isFirst) {
+        if (!cleared) {
             renderPassInfo.clearValueCount = 1;
             renderPassInfo.pClearValues = &clearColor;
-        } else {
-            renderPassInfo.clearValueCount = 0;
-            renderPassInfo.pClearValues = nullptr;
         }
 
-        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, contents);
+        passOpen = true;
+        cleared = true;
+        openContents = contents;
+    };
+
+    for (size_t i = 0; i < sceneRenderInfos.size(); ++i) {
+        const auto& info = sceneRenderInfos[i];
+        m_currentView = static_cast<uint32_t>(i);
+
+        const auto& secondaries = secondaryBuffers[i];
+        if (!secondaries.empty()) {
+            // Execute the pre-recorded secondaries in submission order
+            usePass(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            vkCmdExecuteCommands(commandBuffer, static_cast<uint32_t>(secondaries.size()),
+                                 secondaries.data());
+        }
+
+        // Without a recording pool, recorders run inline on the primary buffer
+        const bool inlineRecorders = !parallel && !info.secondaryRecorders.empty();
+        if (!info.renderCallback && !inlineRecorders) {
+            continue;
+        }
+
+        usePass(VK_SUBPASS_CONTENTS_INLINE);
 
         // Set per-scene viewport and scissor
         vkCmdSetViewport(commandBuffer, 0, 1, &info.viewport);
@@ -1029,14 +1396,25 @@ void VulkanContext::drawFrameMultiScene(const std::vector<SceneRenderInfo>& scen
         m_scissorOverride = info.scissor;
         m_hasViewportOverride = true;
 
+        if (inlineRecorders) {
+            for (const auto& recorder : info.secondaryRecorders) {
+                if (recorder) {
+                    recorder(commandBuffer);
+                }
+            }
+        }
+
         // Call scene's render callback
         if (info.renderCallback) {
             info.renderCallback(commandBuffer);
         }
-
-        vkCmdEndRenderPass(commandBuffer);
     }
 
+    // The first pass also clears, so begin one even if nothing was drawn
+    usePass(passOpen ? openContents : VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdEndRenderPass(commandBuffer);
+    m_currentView = 0;
+
     // Clear viewport override after multi-scene rendering
     m_hasViewportOverride = false;
 
@@ -1045,25 +1423,8 @@ void VulkanContext::drawFrameMultiScene(const std::vector<SceneRenderInfo>& scen
     }
 
     // Submit
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-
-    VkSemaphore waitSemaphores[] = {m_imageAvailableSemaphores[m_currentFrame]};
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &commandBuffer;
-
     VkSemaphore signalSemaphores[] = {m_renderFinishedSemaphores[imageIndex]};
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = signalSemaphores;
-
-    if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_inFlightFences[m_currentFrame]) !=
-        VK_SUCCESS) {
-        throw std::runtime_error("Failed to submit draw command buffer!");
-    }
+    submitFrameCommandBuffer(commandBuffer, imageIndex);
 
     // Present
     VkPresentInfoKHR presentInfo{};
@@ -1084,7 +1445,8 @@ void VulkanContext::drawFrameMultiScene(const std::vector<SceneRenderInfo>& scen
         throw std::runtime_error("Failed to present swap chain image!");
     }
 
-    m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    m_framePacer.advance();
+    m_frameWaited = false;
 }
 
 // =========================================================================
@@ -1122,4 +1484,18 @@ VkShaderModule VulkanContext::createShaderModule(const std::vector<char>& code)
     return shaderModule;
 }
 
+VkShaderModule VulkanContext::createShaderModule(std::span<const uint32_t> code) {
+    VkShaderModuleCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    createInfo.codeSize = code.size_bytes();
+    createInfo.pCode = code.data();
+
+    VkShaderModule shaderModule;
+    if (vkCreateShaderModule(m_device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create shader module!");
+    }
+
+    return shaderModule;
+}
+
 }  // namespace vde
@@ -11,11 +11,15 @@
 #include <vde/api/Game.h>
 #include <vde/api/Material.h>
 #include <vde/api/Mesh.h>
+#include <vde/api/RenderQueue.h>
 #include <vde/api/Scene.h>
 
 #include <glm/gtc/matrix_transform.hpp>
 
-#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 
 namespace vde {
 
@@ -25,26 +29,41 @@ EntityId Entity::s_nextId = 1;
 // Static sprite quad mesh (shared by all SpriteEntity instances)
 static std::shared_ptr<Mesh> s_spriteQuad = nullptr;
 
-// Descriptor set cache for textures per frame (maps {frame, texture} to descriptor set)
-// We need per-frame caching because the UBO buffer changes each frame
-// Note: Descriptor sets are allocated from Game's descriptor pool and cleaned up
-// when the pool is destroyed. This map just tracks which sets exist.
-static constexpr uint32_t MAX_FRAMES = 2;
-static std::unordered_map<Texture*, VkDescriptorSet> s_textureDescriptorSets[MAX_FRAMES];
+// Unit edge tube instanced by wireframe MeshEntities
+static std::shared_ptr<Mesh> s_edgeTube = nullptr;
+
+// Sprite descriptor sets bind the frame's UBO, so they are cached per frame
+// in FrameContext::descriptorCache, keyed by texture (nullptr for the
+// bindless UBO-only set).  They are allocated from Game's sprite pool and
+// freed with it; Game clears the caches on shutdown.
 
 /**
- * @brief Clear sprite descriptor set cache (called on Game shutdown).
+ * @brief Release the shared sprite meshes (called on Game shutdown).
  *
  * This is a free function (not static) so it can be called from Game.cpp.
  * Declared as extern in Game.cpp.
  */
 void clearSpriteDescriptorCache() {
-    for (int i = 0; i < MAX_FRAMES; ++i) {
-        s_textureDescriptorSets[i].clear();
-    }
-    // Clean up the static sprite quad mesh to ensure its Vulkan buffers
-    // are destroyed before the device is destroyed
+    // Clean up the static sprite quad and edge tube meshes to ensure their
+    // Vulkan buffers are destroyed before the device is destroyed
     s_spriteQuad.reset();
+    s_edgeTube.reset();
+}
+
+// When an entity is rendered outside Scene::render() (e.g. from a custom
+// render override) the queue is not collecting, so the command is
+// recorded immediately through a single-command flush.
+void Entity::submitRenderCommand(VulkanContext* context, const RenderCommand& command) {
+    RenderQueue& queue = m_scene->getRenderQueue();
+    if (queue.isRecording()) {
+        queue.submit(command);
+        return;
+    }
+
+    queue.begin();
+    queue.submit(command);
+    queue.flush(context->getCurrentCommandBuffer(), context->getEffectiveViewport(),
+                context->getEffectiveScissor());
 }
 
 // Helper to get or create the sprite quad mesh
@@ -68,6 +87,9 @@ static std::shared_ptr<Mesh> getSpriteQuadMesh() {
         };
 
         s_spriteQuad->setData(vertices, indices);
+
+        // The sprite pipeline only accepts the full Vertex layout
+        s_spriteQuad->setCompactVerticesAllowed(false);
     }
     return s_spriteQuad;
 }
@@ -138,6 +160,37 @@ MeshEntity::MeshEntity()
     : Entity(), m_mesh(nullptr), m_texture(nullptr), m_material(nullptr),
       m_meshId(INVALID_RESOURCE_ID), m_textureId(INVALID_RESOURCE_ID), m_color(Color::white()) {}
 
+float MeshEntity::computeScreenSize(float radius, float distance, float fovY) {
+    float tanHalfFov = std::tan(glm::radians(fovY) * 0.5f);
+    if (distance <= radius || tanHalfFov <= 0.0f) {
+        return std::numeric_limits<float>::max();
+    }
+    return radius / (distance * tanHalfFov);
+}
+
+size_t MeshEntity::selectLOD(float screenSize, size_t currentLOD, size_t lodCount,
+                             float threshold, float hysteresis) {
+    if (lodCount <= 1) {
+        return 0;
+    }
+
+    // Ideal level for a given first threshold: one more level per halving
+    auto levelFor = [&](float firstThreshold) {
+        size_t level = 0;
+        float boundary = firstThreshold;
+        while (level + 1 < lodCount && screenSize < boundary) {
+            ++level;
+            boundary *= 0.5f;
+        }
+        return level;
+    };
+
+    // Shrunk thresholds give the finest level we may stay at, grown ones the coarsest
+    size_t finest = levelFor(threshold * (1.0f - hysteresis));
+    size_t coarsest = levelFor(threshold * (1.0f + hysteresis));
+    return std::clamp(currentLOD, finest, coarsest);
+}
+
 void MeshEntity::render() {
     // Get the mesh (either direct or via resource ID)
     std::shared_ptr<Mesh> mesh = m_mesh;
@@ -151,6 +204,12 @@ void MeshEntity::render() {
         return;
     }
 
+    // Drawn by its StaticBatch chunk instead
+    if (m_staticBatched) {
+        m_renderedTriangles = 0;
+        return;
+    }
+
     // Get Game and Vulkan context
     Game* game = m_scene->getGame();
     if (!game) {
@@ -162,96 +221,140 @@ void MeshEntity::render() {
         return;
     }
 
-    // Upload mesh to GPU if needed
-    if (!mesh->isOnGPU()) {
-        mesh->uploadToGPU(context);
+    // Pick a level of detail from the projected bounding sphere
+    const GameCamera* camera = m_scene->getCamera();
+    Mesh* drawMesh = mesh.get();
+    size_t lod = 0;
+    if (m_lodEnabled && camera && mesh->getLODCount() > 1) {
+        const Camera& cam = camera->getCamera();
+        glm::vec3 center = glm::vec3(getModelMatrix() * glm::vec4(mesh->getBoundsCenter(), 1.0f));
+        glm::vec3 scale = glm::abs(m_transform.scale.toVec3());
+        float radius = mesh->getBoundingRadius() * std::max({scale.x, scale.y, scale.z});
+        float distance = glm::length(center - cam.getPosition());
+        float screenSize = computeScreenSize(radius, distance, cam.getFOV());
+        lod = selectLOD(screenSize, m_currentLOD, mesh->getLODCount(), m_lodThreshold,
+                        m_lodHysteresis);
+        drawMesh = mesh->getLOD(lod);
     }
+    m_currentLOD = lod;
 
-    // Update lighting UBO with scene lighting data
-    game->updateLightingUBO(m_scene);
+    // Wireframes draw the unit edge tube once per edge of the selected level
+    Mesh* geometry = drawMesh;
+    if (m_wireframe) {
+        if (!s_edgeTube) {
+            s_edgeTube = Mesh::createEdgeTube();
+        }
+        geometry = s_edgeTube.get();
+        if (!drawMesh->hasEdgesOnGPU()) {
+            drawMesh->uploadEdgesToGPU(context);
+        }
+        if (!drawMesh->hasEdgesOnGPU()) {
+            m_renderedTriangles = 0;
+            return;
+        }
+    }
 
-    // Get current command buffer
-    VkCommandBuffer cmd = context->getCurrentCommandBuffer();
-    if (cmd == VK_NULL_HANDLE) {
-        return;
+    // Upload mesh to GPU if needed
+    if (!geometry->isOnGPU()) {
+        geometry->uploadToGPU(context);
     }
 
     // Get pipeline
-    VkPipeline pipeline = game->getMeshPipeline();
+    VkPipeline pipeline =
+        m_wireframe ? game->getMeshEdgePipeline()
+                    : game->getMeshPipeline(m_material.get(), geometry->getGPUVertexFormat());
     VkPipelineLayout pipelineLayout = game->getMeshPipelineLayout();
     if (pipeline == VK_NULL_HANDLE || pipelineLayout == VK_NULL_HANDLE) {
         return;
     }
 
-    // Bind pipeline
-    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-
-    // Set viewport and scissor (dynamic state) — uses override if set
-    VkViewport viewport = context->getEffectiveViewport();
-    vkCmdSetViewport(cmd, 0, 1, &viewport);
-
-    VkRect2D scissor = context->getEffectiveScissor();
-    vkCmdSetScissor(cmd, 0, 1, &scissor);
-
-    // Bind UBO descriptor set (set 0)
-    VkDescriptorSet uboDescriptorSet = context->getCurrentUBODescriptorSet();
-    if (uboDescriptorSet != VK_NULL_HANDLE) {
-        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1,
-                                &uboDescriptorSet, 0, nullptr);
+    RenderCommand command;
+    command.pipeline = pipeline;
+    command.pipelineLayout = pipelineLayout;
+    command.mesh = geometry;
+    if (m_wireframe) {
+        command.instanceBuffer = drawMesh->getEdgeBuffer();
+        command.instanceCount = drawMesh->getEdgeCount();
     }
-
-    // Bind lighting descriptor set (set 1)
-    VkDescriptorSet lightingDescriptorSet = game->getCurrentLightingDescriptorSet();
-    if (lightingDescriptorSet != VK_NULL_HANDLE) {
-        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 1, 1,
-                                &lightingDescriptorSet, 0, nullptr);
+    m_renderedTriangles = geometry->getIndexCount() / 3 * command.instanceCount;
+
+    // Per-draw data: model matrix + material properties + dequantization
+    // (the edge shader reads params as the tube thickness instead)
+    DrawUBO drawData;
+
+    // Compact positions are [0,1] fractions of the bounds: the shader scales
+    // them by the extent and the bounds minimum is folded into the model
+    drawData.model = getModelMatrix();
+    drawData.params = glm::vec4(geometry->getGPUPositionScale(), 0.0f);
+    if (geometry->getGPUVertexFormat() == VertexFormat::Compact) {
+        drawData.model = glm::translate(drawData.model, geometry->getGPUPositionOffset());
+    }
+    if (m_wireframe) {
+        drawData.params = glm::vec4(m_wireframeThickness, 0.0f, 0.0f, 0.0f);
     }
-
-    // Prepare push constants: model matrix + material properties
-    struct MeshPushConstants {
-        glm::mat4 model;
-        MaterialPushConstants material;
-    } pushData;
-
-    pushData.model = getModelMatrix();
 
     // Get material properties (use defaults if no material)
     if (m_material) {
         Material::GPUData gpuData = m_material->getGPUData();
-        pushData.material.albedo = gpuData.albedo;
-        pushData.material.emission = gpuData.emission;
-        pushData.material.roughness = gpuData.roughness;
-        pushData.material.metallic = gpuData.metallic;
-        pushData.material.normalStrength = gpuData.normalStrength;
-        pushData.material.padding = 0.0f;
+        drawData.material.albedo = gpuData.albedo;
+        drawData.material.emission = gpuData.emission;
+        drawData.material.roughness = gpuData.roughness;
+        drawData.material.metallic = gpuData.metallic;
+        drawData.material.normalStrength = gpuData.normalStrength;
+        drawData.material.padding = 0.0f;
     } else {
         // Default material: entity color, medium roughness, non-metallic
-        pushData.material.albedo = glm::vec4(m_color.r, m_color.g, m_color.b, 1.0f);
-        pushData.material.emission = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
-        pushData.material.roughness = 0.5f;
-        pushData.material.metallic = 0.0f;
-        pushData.material.normalStrength = 1.0f;
-        pushData.material.padding = 0.0f;
+        drawData.material.albedo = glm::vec4(m_color.r, m_color.g, m_color.b, 1.0f);
+        drawData.material.emission = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+        drawData.material.roughness = 0.5f;
+        drawData.material.metallic = 0.0f;
+        drawData.material.normalStrength = 1.0f;
+        drawData.material.padding = 0.0f;
     }
 
-    // Push model matrix and material as push constants
-    vkCmdPushConstants(cmd, pipelineLayout,
-                       VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
-                       sizeof(MeshPushConstants), &pushData);
-
-    // Bind mesh buffers
-    mesh->bind(cmd);
-
-    // Draw
-    if (mesh->getIndexCount() > 0) {
-        vkCmdDrawIndexed(cmd, static_cast<uint32_t>(mesh->getIndexCount()), 1, 0, 0, 0);
-    } else if (mesh->getVertexCount() > 0) {
-        vkCmdDraw(cmd, static_cast<uint32_t>(mesh->getVertexCount()), 1, 0, 0);
+    // Set 0: camera UBO at the current view's slot, set 1: the view's lighting;
+    // set 2: this draw's data in the frame allocator
+    uint32_t drawOffset = 0;
+    command.descriptorSets[2] = game->pushDrawData(drawData, drawOffset);
+    if (command.descriptorSets[2] == VK_NULL_HANDLE) {
+        m_renderedTriangles = 0;
+        return;
+    }
+    command.descriptorSets[0] = context->getCurrentUBODescriptorSet();
+    command.descriptorSets[1] = game->getCurrentLightingDescriptorSet();
+    command.descriptorSetCount = 3;
+    command.dynamicOffsetMask = 0b101;
+    command.dynamicOffsets = {context->getCurrentUBOOffset(), 0, drawOffset};
+
+    // Sort key: insertion order by default, or grouped by state.  Blended
+    // materials go after the opaque geometry behind them, back to front.
+    if (m_scene->getRenderSortMode() == RenderSortMode::StateSorted) {
+        const bool transparent = m_material && m_material->isTransparent();
+        uint32_t depth = 0;
+        if (camera) {
+            const Camera& cam = camera->getCamera();
+            float distance = glm::length(m_transform.position.toVec3() - cam.getPosition());
+            depth = RenderSortKey::quantizeDepth(distance, cam.getFarPlane(), transparent);
+        }
+        if (transparent) {
+            command.sortKey = RenderSortKey::makeDepthSorted(
+                RenderPassBucket::Transparent, depth, pipeline, m_material.get(), drawMesh);
+        } else {
+            command.sortKey = RenderSortKey::makeStateSorted(RenderPassBucket::Opaque, pipeline,
+                                                             m_material.get(), drawMesh, depth);
+        }
+    } else {
+        command.sortKey =
+            RenderSortKey::makeOrdered(RenderPassBucket::Ordered,
+                                       m_scene->getRenderQueue().nextSequence(), pipeline,
+                                       drawMesh);
     }
+
+    submitRenderCommand(context, command);
 }
 
 // ============================================================================
-// SpriteEntity Implementation (Phase 3)
+// SpriteEntity Implementation
 // ============================================================================
 
 SpriteEntity::SpriteEntity()
@@ -306,12 +409,6 @@ void SpriteEntity::render() {
         quadMesh->uploadToGPU(context);
     }
 
-    // Get current command buffer
-    VkCommandBuffer cmd = context->getCurrentCommandBuffer();
-    if (cmd == VK_NULL_HANDLE) {
-        return;
-    }
-
     // Get pipeline
     VkPipeline pipeline = game->getSpritePipeline();
     VkPipelineLayout pipelineLayout = game->getSpritePipelineLayout();
@@ -319,54 +416,80 @@ void SpriteEntity::render() {
         return;
     }
 
-    // Get current frame index for per-frame descriptor set caching
-    uint32_t currentFrame = context->getCurrentFrame();
-    if (currentFrame >= MAX_FRAMES) {
-        currentFrame = 0;
-    }
+    // Descriptor sets are cached per frame, alongside the UBO they bind
+    auto& frameCache = context->getCurrentFrameContext().descriptorCache;
 
-    // Get or create combined sprite descriptor set for this texture (per-frame)
-    // The descriptor set contains both UBO (binding 0) and texture (binding 1)
     VkDescriptorSet spriteDescSet = VK_NULL_HANDLE;
-    auto& frameCache = s_textureDescriptorSets[currentFrame];
-    auto it = frameCache.find(texturePtr);
-    if (it != frameCache.end()) {
-        spriteDescSet = it->second;
-    } else {
-        // Allocate new combined sprite descriptor set
-        spriteDescSet = game->allocateSpriteDescriptorSet();
-        if (spriteDescSet == VK_NULL_HANDLE) {
+    uint32_t textureIndex = BindlessTextureTable::INVALID_INDEX;
+    BindlessTextureTable& bindlessTextures = context->getBindlessTextures();
+
+    if (game->isSpriteBindless()) {
+        // Textures created through the legacy API are registered on first use
+        if (!texturePtr->registerBindless(bindlessTextures)) {
             return;
         }
-
-        // Update descriptor with UBO and texture info
-        VkBuffer uboBuffer = context->getCurrentUniformBuffer();
-        game->updateSpriteDescriptor(spriteDescSet, uboBuffer, 192,  // sizeof(UniformBufferObject)
-                                     texturePtr->getImageView(), texturePtr->getSampler());
-
-        // Cache it for this frame
-        frameCache[texturePtr] = spriteDescSet;
+        textureIndex = texturePtr->getBindlessIndex();
+
+        auto it = frameCache.find(nullptr);
+        if (it != frameCache.end()) {
+            spriteDescSet = it->second;
+        } else {
+            spriteDescSet = game->allocateSpriteDescriptorSet();
+            if (spriteDescSet == VK_NULL_HANDLE) {
+                return;
+            }
+            game->updateSpriteDescriptor(spriteDescSet, context->getCurrentUniformBuffer(),
+                                         192,  // sizeof(UniformBufferObject)
+                                         VK_NULL_HANDLE, VK_NULL_HANDLE);
+            frameCache[nullptr] = spriteDescSet;
+        }
+    } else {
+        // Fallback: combined sprite descriptor set per texture (per-frame)
+        // The descriptor set contains both UBO (binding 0) and texture (binding 1)
+        auto it = frameCache.find(texturePtr);
+        if (it != frameCache.end()) {
+            spriteDescSet = it->second;
+        } else {
+            // Allocate new combined sprite descriptor set
+            spriteDescSet = game->allocateSpriteDescriptorSet();
+            if (spriteDescSet == VK_NULL_HANDLE) {
+                return;
+            }
+
+            // Update descriptor with UBO and texture info
+            VkBuffer uboBuffer = context->getCurrentUniformBuffer();
+            game->updateSpriteDescriptor(spriteDescSet, uboBuffer,
+                                         192,  // sizeof(UniformBufferObject)
+                                         texturePtr->getImageView(), texturePtr->getSampler());
+
+            // Cache it for this frame
+            frameCache[texturePtr] = spriteDescSet;
+        }
     }
 
-    // Bind pipeline
-    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-
-    // Set viewport and scissor (dynamic state) — uses override if set
-    VkViewport viewport = context->getEffectiveViewport();
-    vkCmdSetViewport(cmd, 0, 1, &viewport);
-
-    VkRect2D scissor = context->getEffectiveScissor();
-    vkCmdSetScissor(cmd, 0, 1, &scissor);
-
-    // Bind combined sprite descriptor set (contains both UBO and texture)
-    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1,
-                            &spriteDescSet, 0, nullptr);
+    RenderCommand command;
+    command.pipeline = pipeline;
+    command.pipelineLayout = pipelineLayout;
+    command.mesh = quadMesh.get();
+
+    // Combined sprite descriptor set (contains both UBO and texture), or the
+    // UBO set plus the bindless table
+    command.descriptorSets[0] = spriteDescSet;
+    command.descriptorSetCount = 1;
+    command.dynamicOffsetMask = 0b1;
+    command.dynamicOffsets[0] = context->getCurrentUBOOffset();
+    if (textureIndex != BindlessTextureTable::INVALID_INDEX) {
+        command.descriptorSets[1] = bindlessTextures.getDescriptorSet();
+        command.descriptorSetCount = 2;
+    }
 
     // Push constants: model matrix (64 bytes) + tint (16 bytes) + uvRect (16 bytes)
+    // + bindless texture index (4 bytes, bindless mode only)
     struct SpritePushConstants {
         glm::mat4 model;
         glm::vec4 tint;
         glm::vec4 uvRect;
+        uint32_t textureIndex;
     } pushData;
 
     // Apply anchor offset to model matrix
@@ -375,15 +498,27 @@ void SpriteEntity::render() {
     pushData.model = getModelMatrix() * anchorOffset;
     pushData.tint = glm::vec4(m_color.r, m_color.g, m_color.b, m_color.a);
     pushData.uvRect = glm::vec4(m_uvX, m_uvY, m_uvWidth, m_uvHeight);
+    pushData.textureIndex = textureIndex;
 
-    vkCmdPushConstants(cmd, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
-                       sizeof(SpritePushConstants), &pushData);
+    if (textureIndex != BindlessTextureTable::INVALID_INDEX) {
+        command.setPushConstants(VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                                 &pushData, offsetof(SpritePushConstants, textureIndex) +
+                                                sizeof(uint32_t));
+    } else {
+        command.setPushConstants(VK_SHADER_STAGE_VERTEX_BIT, &pushData,
+                                 offsetof(SpritePushConstants, textureIndex));
+    }
 
-    // Bind quad mesh buffers
-    quadMesh->bind(cmd);
+    // Sprites are alpha blended without depth test, so draw order is kept.
+    // Bindless sprites share one set, so the texture no longer breaks batches.
+    const void* material = textureIndex != BindlessTextureTable::INVALID_INDEX
+                               ? static_cast<const void*>(&bindlessTextures)
+                               : static_cast<const void*>(texturePtr);
+    command.sortKey =
+        RenderSortKey::makeOrdered(RenderPassBucket::Ordered,
+                                   m_scene->getRenderQueue().nextSequence(), pipeline, material);
 
-    // Draw
-    vkCmdDrawIndexed(cmd, static_cast<uint32_t>(quadMesh->getIndexCount()), 1, 0, 0, 0);
+    submitRenderCommand(context, command);
 }
 
 }  // namespace vde
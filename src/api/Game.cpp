@@ -4,6 +4,8 @@
  */
 
 #include <vde/BufferUtils.h>
+#include <vde/HexPrismMesh.h>
+#include <vde/ShaderBundle.h>
 #include <vde/ShaderCompiler.h>
 #include <vde/Types.h>
 #include <vde/VulkanContext.h>
@@ -11,6 +13,7 @@
 #include <vde/api/AudioManager.h>
 #include <vde/api/Game.h>
 #include <vde/api/LightBox.h>
+#include <vde/api/Material.h>
 #include <vde/api/PhysicsEntity.h>
 #include <vde/api/PhysicsScene.h>
 
@@ -53,9 +56,8 @@ bool Game::initialize(const GameSettings& settings) {
     }
 
     m_settings = settings;
-
-    // Initialize glslang for shader compilation
-    glslang::InitializeProcess();
+    m_initializeStart = std::chrono::steady_clock::now();
+    m_timeToFirstFrameMs = 0.0;
 
     try {
         // Create window
@@ -68,8 +70,19 @@ bool Game::initialize(const GameSettings& settings) {
 
         // Create and initialize Vulkan context
         m_vulkanContext = std::make_unique<VulkanContext>();
+        m_vulkanContext->setFramesInFlight(settings.graphics.framesInFlight);
         m_vulkanContext->initialize(m_window.get());
 
+        // Worker threads for parallel command buffer recording
+        if (settings.graphics.renderThreads > 0) {
+            m_renderThreadPool = std::make_unique<ThreadPool>(settings.graphics.renderThreads);
+            m_vulkanContext->setRecordingThreadPool(m_renderThreadPool.get());
+        }
+
+        // Pipeline variants compile on the render workers when there are any
+        m_pipelineCache.init(m_vulkanContext->getDevice(), m_vulkanContext->getPipelineCache(),
+                             m_renderThreadPool.get());
+
         // Create lighting resources first (needed by mesh pipeline)
         createLightingResources();
 
@@ -108,8 +121,14 @@ bool Game::initialize(const GameSettings& settings) {
     } catch (const std::exception& e) {
         // Clean up on failure
         std::cerr << "Game initialization failed: " << e.what() << std::endl;
+        m_pipelineCache.shutdown();
         m_vulkanContext.reset();
+        m_renderThreadPool.reset();
         m_window.reset();
+        if (m_glslangInitialized) {
+            glslang::FinalizeProcess();
+            m_glslangInitialized = false;
+        }
         throw;
     }
 }
@@ -136,7 +155,11 @@ void Game::shutdown() {
     m_scenes.clear();
     m_sceneStack.clear();
 
-    // Clear sprite descriptor cache (static in Entity.cpp)
+    // Forget cached sprite descriptor sets before their pool is destroyed,
+    // and the shared sprite meshes (static in Entity.cpp)
+    if (m_vulkanContext) {
+        m_vulkanContext->clearFrameDescriptorCaches();
+    }
     clearSpriteDescriptorCache();
 
     // Shutdown audio system
@@ -146,18 +169,24 @@ void Game::shutdown() {
     destroyLightingResources();
     destroySpriteRenderingPipeline();
     destroyMeshRenderingPipeline();
+    m_pipelineCache.shutdown();
 
     // Cleanup Vulkan
     if (m_vulkanContext) {
+        m_vulkanContext->setRecordingThreadPool(nullptr);
         m_vulkanContext->cleanup();
         m_vulkanContext.reset();
     }
+    m_renderThreadPool.reset();
 
     // Destroy window
     m_window.reset();
 
-    // Finalize glslang
-    glslang::FinalizeProcess();
+    // Finalize glslang if any shader had to be compiled at runtime
+    if (m_glslangInitialized) {
+        glslang::FinalizeProcess();
+        m_glslangInitialized = false;
+    }
 
     m_initialized = false;
 }
@@ -207,6 +236,9 @@ void Game::run() {
         // (covers: onUpdate, scene update, audio, pre-render, render)
         m_scheduler.execute();
 
+        if (m_frameCount == 0) {
+            logTimeToFirstFrame();
+        }
         m_frameCount++;
     }
 
@@ -218,6 +250,24 @@ void Game::run() {
     m_running = false;
 }
 
+void Game::logTimeToFirstFrame() {
+    m_timeToFirstFrameMs = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - m_initializeStart)
+                               .count();
+
+    const PipelineDiskCache& pipelineCache = m_vulkanContext->getPipelineDiskCache();
+    std::cout << "Time to first frame: " << m_timeToFirstFrameMs << " ms (pipeline cache ";
+    if (pipelineCache.wasLoadedFromDisk()) {
+        std::cout << "warm, " << pipelineCache.getLoadedSize() << " bytes from "
+                  << pipelineCache.getPath();
+    } else if (!pipelineCache.getLastError().empty()) {
+        std::cout << "cold: " << pipelineCache.getLastError();
+    } else {
+        std::cout << "cold";
+    }
+    std::cout << ")" << std::endl;
+}
+
 void Game::quit() {
     m_running = false;
 }
@@ -398,7 +448,31 @@ void Game::applyDisplaySettings(const DisplaySettings& settings) {
 
 void Game::applyGraphicsSettings(const GraphicsSettings& settings) {
     m_settings.graphics = settings;
-    // Phase 2+: Apply graphics settings to renderer
+
+    // Rebuild the render thread pool if the thread count changed (between frames,
+    // so no recording is in flight)
+    size_t currentThreads = m_renderThreadPool ? m_renderThreadPool->getThreadCount() : 0;
+    if (m_vulkanContext && settings.renderThreads != currentThreads) {
+        m_vulkanContext->setRecordingThreadPool(nullptr);
+        m_pipelineCache.setWorkers(nullptr);
+        m_renderThreadPool.reset();
+        if (settings.renderThreads > 0) {
+            m_renderThreadPool = std::make_unique<ThreadPool>(settings.renderThreads);
+            m_vulkanContext->setRecordingThreadPool(m_renderThreadPool.get());
+            m_pipelineCache.setWorkers(m_renderThreadPool.get());
+        }
+    }
+    // Phase 2+: Apply remaining graphics settings to renderer
+}
+
+void Game::applyDebugSettings(const DebugSettings& settings) {
+    bool wireframeEnabled = settings.wireframe && !m_settings.debug.wireframe;
+    m_settings.debug = settings;
+
+    // Start compiling the wireframe variants now so the toggle doesn't hitch
+    if (wireframeEnabled && m_meshPipeline != VK_NULL_HANDLE) {
+        prewarmMeshVariants();
+    }
 }
 
 void Game::setResizeCallback(std::function<void(uint32_t, uint32_t)> callback) {
@@ -715,6 +789,30 @@ void Game::setupInputCallbacks() {
     }
 }
 
+VkShaderModule Game::createBuiltinShaderModule(const std::string& name) {
+    // Release builds embed SPIR-V at build time (VDE_EMBED_SHADERS)
+    std::span<const uint32_t> embedded = ShaderBundle::find(name);
+    if (!embedded.empty()) {
+        return m_vulkanContext->createShaderModule(embedded);
+    }
+
+    // Otherwise compile from shaders/ at runtime
+    if (!m_glslangInitialized) {
+        glslang::InitializeProcess();
+        m_glslangInitialized = true;
+    }
+
+    ShaderCompiler compiler;
+    ShaderStage stage = shaderStageFromExtension(name.substr(name.find_last_of('.')));
+    auto result = compiler.compileFile("shaders/" + name, stage);
+    if (!result.success) {
+        std::cerr << "Shader compilation failed (" << name << "): " << result.errorLog
+                  << std::endl;
+        throw std::runtime_error("Failed to compile shader " + name + ": " + result.errorLog);
+    }
+    return m_vulkanContext->createShaderModule(std::span<const uint32_t>(result.spirv));
+}
+
 void Game::createMeshRenderingPipeline() {
     std::cout << "Creating mesh rendering pipeline..." << std::endl;
 
@@ -726,121 +824,17 @@ void Game::createMeshRenderingPipeline() {
     VkDevice device = m_vulkanContext->getDevice();
     std::cout << "Got device" << std::endl;
 
-    // Compile shaders
-    ShaderCompiler compiler;
-    std::vector<uint32_t> vertSpv, fragSpv;
-
-    std::cout << "Compiling vertex shader..." << std::endl;
-    auto vertResult = compiler.compileFile("shaders/mesh.vert", ShaderStage::Vertex);
-    if (!vertResult.success) {
-        std::cerr << "Vertex shader compilation failed: " << vertResult.errorLog << std::endl;
-        throw std::runtime_error("Failed to compile mesh vertex shader: " + vertResult.errorLog);
-    }
-    vertSpv = vertResult.spirv;
-    std::cout << "Vertex shader compiled successfully (" << vertSpv.size() << " words)"
-              << std::endl;
-
-    auto fragResult = compiler.compileFile("shaders/mesh.frag", ShaderStage::Fragment);
-    if (!fragResult.success) {
-        throw std::runtime_error("Failed to compile mesh fragment shader: " + fragResult.errorLog);
-    }
-    fragSpv = fragResult.spirv;
+    // Create shader modules (kept alive so variants can be built later)
+    m_meshVertShader = createBuiltinShaderModule("mesh.vert");
+    m_meshFragShader = createBuiltinShaderModule("mesh.frag");
+    m_meshCompactVertShader = createBuiltinShaderModule("mesh_compact.vert");
+    m_meshEdgeVertShader = createBuiltinShaderModule("mesh_edge.vert");
+    m_hexPrismVertShader = createBuiltinShaderModule("hex_prism.vert");
 
-    // Create shader modules
-    VkShaderModule vertShaderModule = m_vulkanContext->createShaderModule(std::vector<char>(
-        reinterpret_cast<char*>(vertSpv.data()),
-        reinterpret_cast<char*>(vertSpv.data()) + vertSpv.size() * sizeof(uint32_t)));
-    VkShaderModule fragShaderModule = m_vulkanContext->createShaderModule(std::vector<char>(
-        reinterpret_cast<char*>(fragSpv.data()),
-        reinterpret_cast<char*>(fragSpv.data()) + fragSpv.size() * sizeof(uint32_t)));
-
-    // Shader stage creation
-    VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
-    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule;
-    vertShaderStageInfo.pName = "main";
-
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule;
-    fragShaderStageInfo.pName = "main";
-
-    VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
-
-    // Vertex input
-    auto bindingDescription = Vertex::getBindingDescription();
-    auto attributeDescriptions = Vertex::getAttributeDescriptions();
-
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
-    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputInfo.vertexAttributeDescriptionCount =
-        static_cast<uint32_t>(attributeDescriptions.size());
-    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
-
-    // Input assembly
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
-    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-
-    // Viewport and scissor (dynamic)
-    VkPipelineViewportStateCreateInfo viewportState{};
-    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.scissorCount = 1;
-
-    // Rasterizer
-    VkPipelineRasterizationStateCreateInfo rasterizer{};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
-    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-
-    // Multisampling
-    VkPipelineMultisampleStateCreateInfo multisampling{};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-
-    // Depth/stencil (no depth test for Phase 2)
-    VkPipelineDepthStencilStateCreateInfo depthStencil{};
-    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable = VK_FALSE;
-    depthStencil.depthWriteEnable = VK_FALSE;
-
-    // Color blending
-    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_FALSE;
-
-    VkPipelineColorBlendStateCreateInfo colorBlending{};
-    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments = &colorBlendAttachment;
-
-    // Dynamic state
-    std::vector<VkDynamicState> dynamicStates = {VK_DYNAMIC_STATE_VIEWPORT,
-                                                 VK_DYNAMIC_STATE_SCISSOR};
-
-    VkPipelineDynamicStateCreateInfo dynamicState{};
-    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
-    dynamicState.pDynamicStates = dynamicStates.data();
-
-    // Descriptor set layout (for view/projection UBO)
+    // Descriptor set layout (for view/projection UBO, one dynamic slot per view)
     VkDescriptorSetLayoutBinding uboLayoutBinding{};
     uboLayoutBinding.binding = 0;
-    uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     uboLayoutBinding.descriptorCount = 1;
     uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 
@@ -854,55 +848,204 @@ void Game::createMeshRenderingPipeline() {
         throw std::runtime_error("Failed to create mesh descriptor set layout");
     }
 
-    // Push constant range (for model matrix + material properties)
-    // Size: 64 (mat4) + 48 (MaterialPushConstants) = 112 bytes
-    VkPushConstantRange pushConstantRange{};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(glm::mat4) + sizeof(MaterialPushConstants);
+    // Per-draw data (Set 2): model matrix + material properties + shader
+    // parameter, pushed to the frame allocator and selected by dynamic offset
+    createDrawDescriptorSets();
 
-    // Pipeline layout with two descriptor set layouts
-    // Set 0: UBO (view/projection), Set 1: Lighting UBO
-    std::array<VkDescriptorSetLayout, 2> descriptorSetLayouts = {m_meshDescriptorSetLayout,
-                                                                 m_lightingDescriptorSetLayout};
+    // Pipeline layout with three descriptor set layouts
+    // Set 0: UBO (view/projection), Set 1: Lighting UBO, Set 2: DrawUBO
+    std::array<VkDescriptorSetLayout, 3> descriptorSetLayouts = {
+        m_meshDescriptorSetLayout, m_lightingDescriptorSetLayout, m_drawDescriptorSetLayout};
 
     VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size());
     pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts.data();
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    pipelineLayoutInfo.pushConstantRangeCount = 0;
 
     if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &m_meshPipelineLayout) !=
         VK_SUCCESS) {
         throw std::runtime_error("Failed to create mesh pipeline layout");
     }
 
-    // Create graphics pipeline
-    VkGraphicsPipelineCreateInfo pipelineInfo{};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
-    pipelineInfo.pStages = shaderStages;
-    pipelineInfo.pVertexInputState = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState = &multisampling;
-    pipelineInfo.pDepthStencilState = &depthStencil;
-    pipelineInfo.pColorBlendState = &colorBlending;
-    pipelineInfo.pDynamicState = &dynamicState;
-    pipelineInfo.layout = m_meshPipelineLayout;
-    pipelineInfo.renderPass = m_vulkanContext->getRenderPass();
-    pipelineInfo.subpass = 0;
-
-    if (vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr,
-                                  &m_meshPipeline) != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create mesh graphics pipeline");
-    }
-
-    // Cleanup shader modules
-    vkDestroyShaderModule(device, fragShaderModule, nullptr);
-    vkDestroyShaderModule(device, vertShaderModule, nullptr);
+    // Base pipeline: filled, back-face culled, opaque, no depth test (Phase 2)
+    PipelineState state;
+    state.vertexShader = m_meshVertShader;
+    state.fragmentShader = m_meshFragShader;
+    state.layout = m_meshPipelineLayout;
+    state.renderPass = m_vulkanContext->getRenderPass();
+    state.vertexBindings = {Vertex::getBindingDescription()};
+    auto attributeDescriptions = Vertex::getAttributeDescriptions();
+    state.vertexAttributes.assign(attributeDescriptions.begin(), attributeDescriptions.end());
+    state.cullMode = VK_CULL_MODE_BACK_BIT;
+    state.depthTest = false;
+    state.depthWrite = false;
+    state.blendMode = PipelineBlendMode::Opaque;
+
+    // Compact base: same pipeline reading CompactVertex through mesh_compact.vert
+    PipelineState compactState = state;
+    compactState.vertexShader = m_meshCompactVertShader;
+    compactState.vertexBindings = {CompactVertex::getBindingDescription()};
+    auto compactAttributes = CompactVertex::getAttributeDescriptions();
+    compactState.vertexAttributes.assign(compactAttributes.begin(), compactAttributes.end());
+
+    // Instanced edges: unit tube at binding 0, one EdgeInstance per edge at binding 1
+    PipelineState edgeState = state;
+    edgeState.vertexShader = m_meshEdgeVertShader;
+    edgeState.vertexBindings = {Vertex::getBindingDescription(),
+                                EdgeInstance::getBindingDescription()};
+    auto edgeAttributes = EdgeInstance::getAttributeDescriptions();
+    edgeState.vertexAttributes.insert(edgeState.vertexAttributes.end(), edgeAttributes.begin(),
+                                      edgeAttributes.end());
+
+    // Instanced hex maps: shared prism at binding 0, one HexPrismInstance per cell at binding 1
+    PipelineState hexState = state;
+    hexState.vertexShader = m_hexPrismVertShader;
+    hexState.vertexBindings = {Vertex::getBindingDescription(),
+                               HexPrismInstance::getBindingDescription()};
+    auto hexAttributes = HexPrismInstance::getAttributeDescriptions();
+    hexState.vertexAttributes.insert(hexState.vertexAttributes.end(), hexAttributes.begin(),
+                                     hexAttributes.end());
+
+    // Variants: transparent materials blend, debug wireframe draws lines
+    for (size_t i = 0; i < m_meshVariants.size(); ++i) {
+        m_meshVariants[i] = (i & 4) ? compactState : state;
+        if (i & 1) {
+            m_meshVariants[i].blendMode = PipelineBlendMode::Alpha;
+        }
+        if (i & 2) {
+            m_meshVariants[i].polygonMode = VK_POLYGON_MODE_LINE;
+        }
+    }
+
+    m_meshPipeline = m_pipelineCache.get(state);
+    m_meshCompactPipeline = m_pipelineCache.get(compactState);
+    m_meshEdgePipeline = m_pipelineCache.get(edgeState);
+    m_hexPrismPipeline = m_pipelineCache.get(hexState);
+    prewarmMeshVariants();
+}
+
+void Game::prewarmMeshVariants() {
+    // Transparent variants are always likely; wireframe only when enabled
+    std::vector<PipelineState> states = {m_meshVariants[1], m_meshVariants[5]};
+    if (m_settings.debug.wireframe && m_vulkanContext->isFillModeNonSolidSupported()) {
+        for (size_t index : {2u, 3u, 6u, 7u}) {
+            states.push_back(m_meshVariants[index]);
+        }
+    }
+    m_pipelineCache.prewarm(states);
+}
+
+VkPipeline Game::getMeshPipeline(const Material* material, VertexFormat format) {
+    size_t index = (material != nullptr && material->isTransparent()) ? 1 : 0;
+    if (m_settings.debug.wireframe && m_vulkanContext &&
+        m_vulkanContext->isFillModeNonSolidSupported()) {
+        index += 2;
+    }
+
+    // The fallback must read the same vertex layout as the mesh
+    VkPipeline base = m_meshPipeline;
+    if (format == VertexFormat::Compact) {
+        index += 4;
+        base = m_meshCompactPipeline;
+    }
+    if ((index & 3) == 0 || !m_pipelineCache.isInitialized()) {
+        return base;
+    }
+
+    // Never stall a frame on a variant; draw with the base pipeline until ready
+    VkPipeline variant = m_pipelineCache.request(m_meshVariants[index]);
+    return variant != VK_NULL_HANDLE ? variant : base;
+}
+
+void Game::createDrawDescriptorSets() {
+    VkDevice device = m_vulkanContext->getDevice();
+    const uint32_t framesInFlight = m_vulkanContext->getFramesInFlight();
+
+    VkDescriptorSetLayoutBinding drawBinding{};
+    drawBinding.binding = 0;
+    drawBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    drawBinding.descriptorCount = 1;
+    drawBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &drawBinding;
+
+    if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_drawDescriptorSetLayout) !=
+        VK_SUCCESS) {
+        throw std::runtime_error("Failed to create draw descriptor set layout");
+    }
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    poolSize.descriptorCount = framesInFlight;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = framesInFlight;
+
+    if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_drawDescriptorPool) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create draw descriptor pool");
+    }
+
+    std::vector<VkDescriptorSetLayout> layouts(framesInFlight, m_drawDescriptorSetLayout);
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = m_drawDescriptorPool;
+    allocInfo.descriptorSetCount = framesInFlight;
+    allocInfo.pSetLayouts = layouts.data();
+
+    m_drawDescriptorSets.resize(framesInFlight);
+    if (vkAllocateDescriptorSets(device, &allocInfo, m_drawDescriptorSets.data()) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate draw descriptor sets");
+    }
+
+    // Point each frame's set at one DrawUBO of that frame's allocator buffer
+    const FrameAllocator& frameAllocator = m_vulkanContext->getFrameAllocator();
+    for (uint32_t i = 0; i < framesInFlight; i++) {
+        VkDescriptorBufferInfo bufferInfo{};
+        bufferInfo.buffer = frameAllocator.getBuffer(i);
+        bufferInfo.offset = 0;
+        bufferInfo.range = sizeof(DrawUBO);
+
+        VkWriteDescriptorSet descriptorWrite{};
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = m_drawDescriptorSets[i];
+        descriptorWrite.dstBinding = 0;
+        descriptorWrite.dstArrayElement = 0;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.pBufferInfo = &bufferInfo;
+
+        vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
+    }
+}
+
+VkDescriptorSet Game::pushDrawData(const DrawUBO& data, uint32_t& offset) {
+    offset = 0;
+    if (!m_vulkanContext || m_drawDescriptorSets.empty()) {
+        return VK_NULL_HANDLE;
+    }
+    uint32_t currentFrame = m_vulkanContext->getCurrentFrame();
+    if (currentFrame >= m_drawDescriptorSets.size()) {
+        return VK_NULL_HANDLE;
+    }
+
+    FrameAllocation allocation = m_vulkanContext->getFrameAllocator().pushUniform(data);
+    if (!allocation.isValid()) {
+        // The stats reset with the frame slot, so this warns once per frame
+        if (m_vulkanContext->getUploadStats().drawsDropped++ == 0) {
+            std::cerr << "Warning: frame allocator full, skipping draws this frame" << std::endl;
+        }
+        return VK_NULL_HANDLE;
+    }
+    m_vulkanContext->getUploadStats().drawBytes += sizeof(DrawUBO);
+    offset = allocation.offset;
+    return m_drawDescriptorSets[currentFrame];
 }
 
 void Game::destroyMeshRenderingPipeline() {
@@ -912,10 +1055,20 @@ void Game::destroyMeshRenderingPipeline() {
 
     VkDevice device = m_vulkanContext->getDevice();
 
-    if (m_meshPipeline != VK_NULL_HANDLE) {
-        vkDestroyPipeline(device, m_meshPipeline, nullptr);
-        m_meshPipeline = VK_NULL_HANDLE;
+    // The pipeline cache owns the pipelines; drop every variant of these shaders
+    for (VkShaderModule* module : {&m_meshVertShader, &m_meshCompactVertShader,
+                                   &m_meshEdgeVertShader, &m_hexPrismVertShader,
+                                   &m_meshFragShader}) {
+        if (*module != VK_NULL_HANDLE) {
+            m_pipelineCache.evictShader(*module);
+            vkDestroyShaderModule(device, *module, nullptr);
+            *module = VK_NULL_HANDLE;
+        }
     }
+    m_meshPipeline = VK_NULL_HANDLE;
+    m_meshCompactPipeline = VK_NULL_HANDLE;
+    m_meshEdgePipeline = VK_NULL_HANDLE;
+    m_hexPrismPipeline = VK_NULL_HANDLE;
 
     if (m_meshPipelineLayout != VK_NULL_HANDLE) {
         vkDestroyPipelineLayout(device, m_meshPipelineLayout, nullptr);
@@ -926,6 +1079,17 @@ void Game::destroyMeshRenderingPipeline() {
         vkDestroyDescriptorSetLayout(device, m_meshDescriptorSetLayout, nullptr);
         m_meshDescriptorSetLayout = VK_NULL_HANDLE;
     }
+
+    // Descriptor sets are freed when pool is destroyed
+    m_drawDescriptorSets.clear();
+    if (m_drawDescriptorPool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device, m_drawDescriptorPool, nullptr);
+        m_drawDescriptorPool = VK_NULL_HANDLE;
+    }
+    if (m_drawDescriptorSetLayout != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(device, m_drawDescriptorSetLayout, nullptr);
+        m_drawDescriptorSetLayout = VK_NULL_HANDLE;
+    }
 }
 
 void Game::createSpriteRenderingPipeline() {
@@ -938,6 +1102,11 @@ void Game::createSpriteRenderingPipeline() {
 
     VkDevice device = m_vulkanContext->getDevice();
 
+    // With descriptor indexing, sprites pick their texture from the bindless
+    // table by push-constant index instead of binding a set per texture
+    BindlessTextureTable& bindlessTextures = m_vulkanContext->getBindlessTextures();
+    m_spriteBindless = bindlessTextures.isInitialized();
+
     // Create sampler for sprites
     VkSamplerCreateInfo samplerInfo{};
     samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
@@ -961,129 +1130,17 @@ void Game::createSpriteRenderingPipeline() {
         throw std::runtime_error("Failed to create sprite sampler");
     }
 
-    // Compile shaders
-    ShaderCompiler compiler;
-
-    std::cout << "Compiling sprite vertex shader..." << std::endl;
-    auto vertResult = compiler.compileFile("shaders/simple_sprite.vert", ShaderStage::Vertex);
-    if (!vertResult.success) {
-        std::cerr << "Sprite vertex shader compilation failed: " << vertResult.errorLog
-                  << std::endl;
-        throw std::runtime_error("Failed to compile sprite vertex shader: " + vertResult.errorLog);
-    }
-    std::cout << "Sprite vertex shader compiled successfully" << std::endl;
-
-    auto fragResult = compiler.compileFile("shaders/simple_sprite.frag", ShaderStage::Fragment);
-    if (!fragResult.success) {
-        throw std::runtime_error("Failed to compile sprite fragment shader: " +
-                                 fragResult.errorLog);
-    }
-
     // Create shader modules
-    VkShaderModule vertShaderModule = m_vulkanContext->createShaderModule(
-        std::vector<char>(reinterpret_cast<char*>(vertResult.spirv.data()),
-                          reinterpret_cast<char*>(vertResult.spirv.data()) +
-                              vertResult.spirv.size() * sizeof(uint32_t)));
-    VkShaderModule fragShaderModule = m_vulkanContext->createShaderModule(
-        std::vector<char>(reinterpret_cast<char*>(fragResult.spirv.data()),
-                          reinterpret_cast<char*>(fragResult.spirv.data()) +
-                              fragResult.spirv.size() * sizeof(uint32_t)));
-
-    // Shader stage creation
-    VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
-    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule;
-    vertShaderStageInfo.pName = "main";
-
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule;
-    fragShaderStageInfo.pName = "main";
-
-    VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
-
-    // Vertex input - uses same Vertex structure as mesh
-    auto bindingDescription = Vertex::getBindingDescription();
-    auto attributeDescriptions = Vertex::getAttributeDescriptions();
-
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
-    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputInfo.vertexAttributeDescriptionCount =
-        static_cast<uint32_t>(attributeDescriptions.size());
-    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
-
-    // Input assembly
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
-    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-
-    // Viewport and scissor (dynamic)
-    VkPipelineViewportStateCreateInfo viewportState{};
-    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.scissorCount = 1;
-
-    // Rasterizer - no culling for sprites (they may be flipped)
-    VkPipelineRasterizationStateCreateInfo rasterizer{};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_NONE;  // No culling for sprites
-    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-
-    // Multisampling
-    VkPipelineMultisampleStateCreateInfo multisampling{};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-
-    // Depth/stencil (no depth test for sprites - render order matters)
-    VkPipelineDepthStencilStateCreateInfo depthStencil{};
-    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable = VK_FALSE;
-    depthStencil.depthWriteEnable = VK_FALSE;
-
-    // Color blending - alpha blending for sprites
-    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_TRUE;
-    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
-    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
-    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
-
-    VkPipelineColorBlendStateCreateInfo colorBlending{};
-    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments = &colorBlendAttachment;
-
-    // Dynamic state
-    std::vector<VkDynamicState> dynamicStates = {VK_DYNAMIC_STATE_VIEWPORT,
-                                                 VK_DYNAMIC_STATE_SCISSOR};
-
-    VkPipelineDynamicStateCreateInfo dynamicState{};
-    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
-    dynamicState.pDynamicStates = dynamicStates.data();
+    m_spriteVertShader = createBuiltinShaderModule("simple_sprite.vert");
+    m_spriteFragShader = createBuiltinShaderModule(
+        m_spriteBindless ? "simple_sprite_bindless.frag" : "simple_sprite.frag");
 
     // Descriptor set layout (for UBO and texture sampler)
     std::array<VkDescriptorSetLayoutBinding, 2> bindings{};
 
-    // Binding 0: UBO (view/projection)
+    // Binding 0: UBO (view/projection, one dynamic slot per view)
     bindings[0].binding = 0;
-    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     bindings[0].descriptorCount = 1;
     bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 
@@ -1093,9 +1150,10 @@ void Game::createSpriteRenderingPipeline() {
     bindings[1].descriptorCount = 1;
     bindings[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 
+    // Bindless sprites only need the UBO here; textures come from set 1
     VkDescriptorSetLayoutCreateInfo layoutInfo{};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    layoutInfo.bindingCount = m_spriteBindless ? 1 : static_cast<uint32_t>(bindings.size());
     layoutInfo.pBindings = bindings.data();
 
     if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_spriteDescriptorSetLayout) !=
@@ -1105,7 +1163,7 @@ void Game::createSpriteRenderingPipeline() {
 
     // Create descriptor pool for sprite descriptor sets
     std::array<VkDescriptorPoolSize, 2> poolSizes{};
-    poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     poolSizes[0].descriptorCount = 100;  // Support up to 100 sprite descriptor sets
     poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     poolSizes[1].descriptorCount = 100;
@@ -1126,12 +1184,19 @@ void Game::createSpriteRenderingPipeline() {
     pushConstantRange.offset = 0;
     pushConstantRange.size =
         sizeof(glm::mat4) + sizeof(glm::vec4) + sizeof(glm::vec4);  // model + tint + uvRect
+    if (m_spriteBindless) {
+        // + bindless texture index, read by the fragment shader
+        pushConstantRange.stageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
+        pushConstantRange.size += sizeof(uint32_t);
+    }
 
-    // Pipeline layout
+    // Pipeline layout (set 0: UBO [+ texture], set 1: bindless textures)
+    std::array<VkDescriptorSetLayout, 2> setLayouts = {m_spriteDescriptorSetLayout,
+                                                       bindlessTextures.getLayout()};
     VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = 1;
-    pipelineLayoutInfo.pSetLayouts = &m_spriteDescriptorSetLayout;
+    pipelineLayoutInfo.setLayoutCount = m_spriteBindless ? 2 : 1;
+    pipelineLayoutInfo.pSetLayouts = setLayouts.data();
     pipelineLayoutInfo.pushConstantRangeCount = 1;
     pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
 
@@ -1140,31 +1205,22 @@ void Game::createSpriteRenderingPipeline() {
         throw std::runtime_error("Failed to create sprite pipeline layout");
     }
 
-    // Create graphics pipeline
-    VkGraphicsPipelineCreateInfo pipelineInfo{};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
-    pipelineInfo.pStages = shaderStages;
-    pipelineInfo.pVertexInputState = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState = &multisampling;
-    pipelineInfo.pDepthStencilState = &depthStencil;
-    pipelineInfo.pColorBlendState = &colorBlending;
-    pipelineInfo.pDynamicState = &dynamicState;
-    pipelineInfo.layout = m_spritePipelineLayout;
-    pipelineInfo.renderPass = m_vulkanContext->getRenderPass();
-    pipelineInfo.subpass = 0;
-
-    if (vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr,
-                                  &m_spritePipeline) != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create sprite graphics pipeline");
-    }
-
-    // Cleanup shader modules
-    vkDestroyShaderModule(device, fragShaderModule, nullptr);
-    vkDestroyShaderModule(device, vertShaderModule, nullptr);
+    // Sprites use the same Vertex structure as meshes, with no culling (they
+    // may be flipped), no depth test (render order matters) and alpha blending
+    PipelineState state;
+    state.vertexShader = m_spriteVertShader;
+    state.fragmentShader = m_spriteFragShader;
+    state.layout = m_spritePipelineLayout;
+    state.renderPass = m_vulkanContext->getRenderPass();
+    state.vertexBindings = {Vertex::getBindingDescription()};
+    auto attributeDescriptions = Vertex::getAttributeDescriptions();
+    state.vertexAttributes.assign(attributeDescriptions.begin(), attributeDescriptions.end());
+    state.cullMode = VK_CULL_MODE_NONE;
+    state.depthTest = false;
+    state.depthWrite = false;
+    state.blendMode = PipelineBlendMode::Alpha;
+
+    m_spritePipeline = m_pipelineCache.get(state);
 
     // Create default white texture (1x1 pixel)
     m_defaultWhiteTexture = std::make_unique<Texture>();
@@ -1191,10 +1247,14 @@ void Game::destroySpriteRenderingPipeline() {
         m_defaultWhiteTexture.reset();
     }
 
-    if (m_spritePipeline != VK_NULL_HANDLE) {
-        vkDestroyPipeline(device, m_spritePipeline, nullptr);
-        m_spritePipeline = VK_NULL_HANDLE;
+    for (VkShaderModule* module : {&m_spriteVertShader, &m_spriteFragShader}) {
+        if (*module != VK_NULL_HANDLE) {
+            m_pipelineCache.evictShader(*module);
+            vkDestroyShaderModule(device, *module, nullptr);
+            *module = VK_NULL_HANDLE;
+        }
     }
+    m_spritePipeline = VK_NULL_HANDLE;
 
     if (m_spritePipelineLayout != VK_NULL_HANDLE) {
         vkDestroyPipelineLayout(device, m_spritePipelineLayout, nullptr);
@@ -1215,6 +1275,7 @@ void Game::destroySpriteRenderingPipeline() {
         vkDestroySampler(device, m_spriteSampler, nullptr);
         m_spriteSampler = VK_NULL_HANDLE;
     }
+    m_spriteBindless = false;
 }
 
 VkDescriptorSet Game::allocateSpriteDescriptorSet() {
@@ -1261,10 +1322,17 @@ void Game::updateSpriteDescriptor(VkDescriptorSet descriptorSet, VkBuffer uboBuf
     descriptorWrites[0].dstSet = descriptorSet;
     descriptorWrites[0].dstBinding = 0;
     descriptorWrites[0].dstArrayElement = 0;
-    descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     descriptorWrites[0].descriptorCount = 1;
     descriptorWrites[0].pBufferInfo = &bufferInfo;
 
+    // Bindless layouts have no texture binding
+    if (m_spriteBindless || imageView == VK_NULL_HANDLE) {
+        vkUpdateDescriptorSets(m_vulkanContext->getDevice(), 1, descriptorWrites.data(), 0,
+                               nullptr);
+        return;
+    }
+
     // Binding 1: Texture sampler
     descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
     descriptorWrites[1].dstSet = descriptorSet;
@@ -1292,97 +1360,70 @@ void Game::createLightingResources() {
     }
 
     VkDevice device = m_vulkanContext->getDevice();
-    constexpr uint32_t framesInFlight = 2;  // MAX_FRAMES_IN_FLIGHT
+    const uint32_t framesInFlight = m_vulkanContext->getFramesInFlight();
 
-    // Create lighting descriptor set layout (Set 1: Lighting UBO)
-    VkDescriptorSetLayoutBinding lightingBinding{};
-    lightingBinding.binding = 0;
-    lightingBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    lightingBinding.descriptorCount = 1;
-    lightingBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    // Create lighting descriptor set layout (Set 1): the lighting UBO, then
+    // the light and cluster storage buffers, all in one view's region buffer
+    std::array<VkDescriptorSetLayoutBinding, 3> lightingBindings{};
+    for (uint32_t binding = 0; binding < lightingBindings.size(); binding++) {
+        lightingBindings[binding].binding = binding;
+        lightingBindings[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        lightingBindings[binding].descriptorCount = 1;
+        lightingBindings[binding].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    lightingBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 
     VkDescriptorSetLayoutCreateInfo layoutInfo{};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    layoutInfo.bindingCount = 1;
-    layoutInfo.pBindings = &lightingBinding;
+    layoutInfo.bindingCount = static_cast<uint32_t>(lightingBindings.size());
+    layoutInfo.pBindings = lightingBindings.data();
 
     if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_lightingDescriptorSetLayout) !=
         VK_SUCCESS) {
         throw std::runtime_error("Failed to create lighting descriptor set layout");
     }
 
-    // Create descriptor pool for lighting UBO
-    VkDescriptorPoolSize poolSize{};
-    poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSize.descriptorCount = framesInFlight;
+    // One region (and set) per frame in flight and view
+    const uint32_t regionCount = framesInFlight * VulkanContext::MAX_VIEWS;
+
+    // Create descriptor pool for the lighting sets
+    std::array<VkDescriptorPoolSize, 2> poolSizes{};
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    poolSizes[0].descriptorCount = regionCount;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[1].descriptorCount = regionCount * 2;
 
     VkDescriptorPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    poolInfo.poolSizeCount = 1;
-    poolInfo.pPoolSizes = &poolSize;
-    poolInfo.maxSets = framesInFlight;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    poolInfo.pPoolSizes = poolSizes.data();
+    poolInfo.maxSets = regionCount;
 
     if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_lightingDescriptorPool) !=
         VK_SUCCESS) {
         throw std::runtime_error("Failed to create lighting descriptor pool");
     }
 
-    // Create lighting UBO buffers (one per frame)
-    VkDeviceSize bufferSize = sizeof(LightingUBO);
-    m_lightingUBOBuffers.resize(framesInFlight);
-    m_lightingUBOMemory.resize(framesInFlight);
-    m_lightingUBOMapped.resize(framesInFlight);
-
-    for (uint32_t i = 0; i < framesInFlight; i++) {
-        BufferUtils::createBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
-                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                  m_lightingUBOBuffers[i], m_lightingUBOMemory[i]);
-
-        // Persistently map the buffer
-        vkMapMemory(device, m_lightingUBOMemory[i], 0, bufferSize, 0, &m_lightingUBOMapped[i]);
-    }
+    m_viewLighting.clear();
+    m_viewLighting.resize(VulkanContext::MAX_VIEWS);
 
-    // Allocate descriptor sets
-    std::vector<VkDescriptorSetLayout> layouts(framesInFlight, m_lightingDescriptorSetLayout);
+    // Allocate descriptor sets; each is written when its region's buffer is
+    // created on first use
+    std::vector<VkDescriptorSetLayout> layouts(regionCount, m_lightingDescriptorSetLayout);
     VkDescriptorSetAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     allocInfo.descriptorPool = m_lightingDescriptorPool;
-    allocInfo.descriptorSetCount = framesInFlight;
+    allocInfo.descriptorSetCount = regionCount;
     allocInfo.pSetLayouts = layouts.data();
 
-    m_lightingDescriptorSets.resize(framesInFlight);
-    if (vkAllocateDescriptorSets(device, &allocInfo, m_lightingDescriptorSets.data()) !=
-        VK_SUCCESS) {
+    std::vector<VkDescriptorSet> descriptorSets(regionCount);
+    if (vkAllocateDescriptorSets(device, &allocInfo, descriptorSets.data()) != VK_SUCCESS) {
         throw std::runtime_error("Failed to allocate lighting descriptor sets");
     }
-
-    // Update descriptor sets to point to UBO buffers
-    for (uint32_t i = 0; i < framesInFlight; i++) {
-        VkDescriptorBufferInfo bufferInfo{};
-        bufferInfo.buffer = m_lightingUBOBuffers[i];
-        bufferInfo.offset = 0;
-        bufferInfo.range = bufferSize;
-
-        VkWriteDescriptorSet descriptorWrite{};
-        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrite.dstSet = m_lightingDescriptorSets[i];
-        descriptorWrite.dstBinding = 0;
-        descriptorWrite.dstArrayElement = 0;
-        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        descriptorWrite.descriptorCount = 1;
-        descriptorWrite.pBufferInfo = &bufferInfo;
-
-        vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
-    }
-
-    // Initialize with default lighting (white ambient)
-    LightingUBO defaultLighting{};
-    defaultLighting.ambientColorAndIntensity = glm::vec4(1.0f, 1.0f, 1.0f, 0.3f);
-    defaultLighting.lightCounts = glm::ivec4(0, 0, 0, 0);
-
-    for (uint32_t i = 0; i < framesInFlight; i++) {
-        memcpy(m_lightingUBOMapped[i], &defaultLighting, sizeof(LightingUBO));
+    m_lightingRegions.clear();
+    m_lightingRegions.resize(regionCount);
+    for (uint32_t i = 0; i < regionCount; i++) {
+        m_lightingRegions[i].descriptorSet = descriptorSets[i];
     }
 
     std::cout << "Lighting resources created successfully" << std::endl;
@@ -1395,24 +1436,13 @@ void Game::destroyLightingResources() {
 
     VkDevice device = m_vulkanContext->getDevice();
 
-    // Unmap and destroy UBO buffers
-    for (size_t i = 0; i < m_lightingUBOBuffers.size(); i++) {
-        if (m_lightingUBOMapped[i]) {
-            vkUnmapMemory(device, m_lightingUBOMemory[i]);
-        }
-        if (m_lightingUBOBuffers[i] != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, m_lightingUBOBuffers[i], nullptr);
-        }
-        if (m_lightingUBOMemory[i] != VK_NULL_HANDLE) {
-            vkFreeMemory(device, m_lightingUBOMemory[i], nullptr);
-        }
-    }
-    m_lightingUBOBuffers.clear();
-    m_lightingUBOMemory.clear();
-    m_lightingUBOMapped.clear();
+    m_viewLighting.clear();
 
     // Descriptor sets are freed when pool is destroyed
-    m_lightingDescriptorSets.clear();
+    for (LightingRegion& region : m_lightingRegions) {
+        BufferUtils::destroyBuffer(region.buffer, region.allocation);
+    }
+    m_lightingRegions.clear();
 
     if (m_lightingDescriptorPool != VK_NULL_HANDLE) {
         vkDestroyDescriptorPool(device, m_lightingDescriptorPool, nullptr);
@@ -1425,77 +1455,253 @@ void Game::destroyLightingResources() {
     }
 }
 
+// Lighting region layout: the LightingUBO, then the lights from the next
+// GPULight boundary, then the cluster words
+static constexpr VkDeviceSize LIGHTING_LIGHTS_OFFSET = 128;
+static constexpr VkDeviceSize MIN_LIGHTING_REGION_SIZE = 16 * 1024;
+static_assert(LIGHTING_LIGHTS_OFFSET >= sizeof(LightingUBO) &&
+                  LIGHTING_LIGHTS_OFFSET % sizeof(GPULight) == 0,
+              "Lights must follow the LightingUBO at a GPULight boundary");
+
+Game::LightingRegion* Game::getCurrentLightingRegion() {
+    if (!m_vulkanContext) {
+        return nullptr;
+    }
+    size_t index = size_t(m_vulkanContext->getCurrentFrame()) * VulkanContext::MAX_VIEWS +
+                   m_vulkanContext->getCurrentView();
+    return index < m_lightingRegions.size() ? &m_lightingRegions[index] : nullptr;
+}
+
 VkDescriptorSet Game::getCurrentLightingDescriptorSet() const {
-    if (m_lightingDescriptorSets.empty() || !m_vulkanContext) {
+    if (!m_vulkanContext) {
         return VK_NULL_HANDLE;
     }
-    uint32_t currentFrame = m_vulkanContext->getCurrentFrame();
-    if (currentFrame >= m_lightingDescriptorSets.size()) {
-        currentFrame = 0;
+    size_t index = size_t(m_vulkanContext->getCurrentFrame()) * VulkanContext::MAX_VIEWS +
+                   m_vulkanContext->getCurrentView();
+    if (index >= m_lightingRegions.size() ||
+        m_lightingRegions[index].buffer == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
     }
-    return m_lightingDescriptorSets[currentFrame];
+    return m_lightingRegions[index].descriptorSet;
 }
 
-void Game::updateLightingUBO(const Scene* scene) {
-    if (!m_vulkanContext || m_lightingUBOMapped.empty()) {
-        return;
+bool Game::reserveLightingRegion(LightingRegion& region, VkDeviceSize size) {
+    if (region.buffer != VK_NULL_HANDLE && size <= region.capacity) {
+        return true;
     }
 
-    uint32_t currentFrame = m_vulkanContext->getCurrentFrame();
-    if (currentFrame >= m_lightingUBOMapped.size()) {
-        currentFrame = 0;
-    }
-
-    LightingUBO ubo{};
-
-    if (scene) {
-        const LightBox& lightBox = scene->getEffectiveLighting();
-
-        // Set ambient
-        const Color& ambient = lightBox.getAmbientColor();
-        ubo.ambientColorAndIntensity =
-            glm::vec4(ambient.r, ambient.g, ambient.b, lightBox.getAmbientIntensity());
-
-        // Convert lights
-        const std::vector<Light>& lights = lightBox.getLights();
-        uint32_t numLights =
-            static_cast<uint32_t>(std::min(lights.size(), static_cast<size_t>(MAX_LIGHTS)));
-        ubo.lightCounts = glm::ivec4(static_cast<int>(numLights), 0, 0, 0);
-
-        for (uint32_t i = 0; i < numLights; i++) {
-            const Light& light = lights[i];
-            GPULight& gpuLight = ubo.lights[i];
-
-            // Position/direction and type
-            if (light.type == LightType::Directional) {
-                gpuLight.positionAndType =
-                    glm::vec4(light.direction.x, light.direction.y, light.direction.z, 0.0f);
-            } else {
-                gpuLight.positionAndType =
-                    glm::vec4(light.position.x, light.position.y, light.position.z,
-                              static_cast<float>(static_cast<int>(light.type)));
-            }
+    // The frame slot has been waited on, so nothing still reads the old buffer
+    VkDeviceSize capacity = std::max(region.capacity, MIN_LIGHTING_REGION_SIZE);
+    while (capacity < size) {
+        capacity *= 2;
+    }
+    BufferUtils::destroyBuffer(region.buffer, region.allocation);
+    BufferUtils::createBuffer(capacity,
+                              VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                                  VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                              region.buffer, region.allocation);
+    region.lightsVersion = 0;
+    region.clustersVersion = 0;
+    if (region.allocation.mapped == nullptr) {
+        BufferUtils::destroyBuffer(region.buffer, region.allocation);
+        region.capacity = 0;
+        return false;
+    }
+    region.capacity = capacity;
+
+    // UBO at the start, lights and cluster words addressed through it
+    std::array<VkDescriptorBufferInfo, 3> bufferInfos{};
+    std::array<VkWriteDescriptorSet, 3> descriptorWrites{};
+    for (uint32_t binding = 0; binding < bufferInfos.size(); binding++) {
+        bufferInfos[binding].buffer = region.buffer;
+        bufferInfos[binding].offset = 0;
+        bufferInfos[binding].range = VK_WHOLE_SIZE;
+
+        descriptorWrites[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[binding].dstSet = region.descriptorSet;
+        descriptorWrites[binding].dstBinding = binding;
+        descriptorWrites[binding].dstArrayElement = 0;
+        descriptorWrites[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorWrites[binding].descriptorCount = 1;
+        descriptorWrites[binding].pBufferInfo = &bufferInfos[binding];
+    }
+    bufferInfos[0].range = sizeof(LightingUBO);
+    descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 
-            // Direction and range
-            gpuLight.directionAndRange =
-                glm::vec4(light.direction.x, light.direction.y, light.direction.z, light.range);
+    vkUpdateDescriptorSets(m_vulkanContext->getDevice(),
+                           static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(),
+                           0, nullptr);
+    return true;
+}
 
-            // Color and intensity
-            gpuLight.colorAndIntensity =
-                glm::vec4(light.color.r, light.color.g, light.color.b, light.intensity);
+// Pack a light for the lighting storage buffer
+static GPULight toGPULight(const Light& light) {
+    GPULight gpuLight{};
 
-            // Spot params (cosines of angles)
-            gpuLight.spotParams =
-                glm::vec4(std::cos(glm::radians(light.spotAngle)),
-                          std::cos(glm::radians(light.spotOuterAngle)), 0.0f, 0.0f);
+    // Position/direction and type
+    if (light.type == LightType::Directional) {
+        gpuLight.positionAndType =
+            glm::vec4(light.direction.x, light.direction.y, light.direction.z, 0.0f);
+    } else {
+        gpuLight.positionAndType = glm::vec4(light.position.x, light.position.y, light.position.z,
+                                             static_cast<float>(static_cast<int>(light.type)));
+    }
+
+    // Direction and range
+    gpuLight.directionAndRange =
+        glm::vec4(light.direction.x, light.direction.y, light.direction.z, light.range);
+
+    // Color and intensity
+    gpuLight.colorAndIntensity =
+        glm::vec4(light.color.r, light.color.g, light.color.b, light.intensity);
+
+    // Spot params (cosines of angles)
+    gpuLight.spotParams = glm::vec4(std::cos(glm::radians(light.spotAngle)),
+                                    std::cos(glm::radians(light.spotOuterAngle)), 0.0f, 0.0f);
+    return gpuLight;
+}
+
+const LightClusterGrid& Game::getLightClusters(uint32_t view) const {
+    static const LightClusterGrid empty;
+    return view < m_viewLighting.size() ? m_viewLighting[view].clusters : empty;
+}
+
+void Game::updateLightingUBO(const Scene* scene, uint32_t view, const VkViewport& viewport) {
+    if (!m_vulkanContext || view >= m_viewLighting.size()) {
+        return;
+    }
+    ViewLighting& lighting = m_viewLighting[view];
+
+    // Repack only when the LightBox changed (versions are unique across
+    // light boxes, so switching scenes or light boxes also repacks)
+    const LightBox* lightBox = scene ? &scene->getEffectiveLighting() : nullptr;
+    const uint64_t lightBoxVersion = lightBox ? lightBox->getVersion() : 0;
+    const bool repack = !lighting.packed || lighting.lightBoxVersion != lightBoxVersion;
+    if (repack) {
+        lighting.lights.clear();
+        lighting.directionalCount = 0;
+        if (lightBox) {
+            const Color& ambient = lightBox->getAmbientColor();
+            lighting.ambient =
+                glm::vec4(ambient.r, ambient.g, ambient.b, lightBox->getAmbientIntensity());
+
+            // Convert lights, directional ones first: they light every fragment,
+            // the rest are looked up through the clusters
+            const std::vector<Light>& lights = lightBox->getLights();
+            for (const Light& light : lights) {
+                if (light.type == LightType::Directional && lighting.lights.size() < MAX_LIGHTS) {
+                    lighting.lights.push_back(toGPULight(light));
+                }
+            }
+            lighting.directionalCount = static_cast<uint32_t>(lighting.lights.size());
+            for (const Light& light : lights) {
+                if (light.type != LightType::Directional && lighting.lights.size() < MAX_LIGHTS) {
+                    lighting.lights.push_back(toGPULight(light));
+                }
+            }
+        } else {
+            // Default: white ambient, no lights
+            lighting.ambient = glm::vec4(1.0f, 1.0f, 1.0f, 0.3f);
         }
+        lighting.packed = true;
+        lighting.lightBoxVersion = lightBoxVersion;
+        lighting.lightsVersion++;
+    }
+
+    // Bin point and spot lights into the clusters of this view's frustum
+    // (before the fence wait, so it overlaps the GPU).  The context camera
+    // is shared by all views, so the key is the scene camera it was set from.
+    const Camera& camera = m_vulkanContext->getCamera();
+    const GameCamera* sceneCamera = scene ? scene->getCamera() : nullptr;
+    const uint64_t cameraVersion = sceneCamera ? sceneCamera->getVersion() : camera.getVersion();
+    const glm::mat4 viewMatrix = camera.getViewMatrix();
+    const bool rebin = repack || lighting.cameraVersion != cameraVersion;
+    if (rebin) {
+        lighting.clusters.setProjection(camera.getProjectionMatrix(), camera.getNearPlane(),
+                                        camera.getFarPlane());
+        lighting.clusters.build(lighting.lights, viewMatrix, m_renderThreadPool.get());
+        lighting.cameraVersion = cameraVersion;
+    }
+
+    // The UBO and cluster words are rewritten together; a new viewport
+    // changes the UBO only
+    const glm::vec4 viewportRect(viewport.x, viewport.y, viewport.width, viewport.height);
+    if (rebin || lighting.viewport != viewportRect) {
+        lighting.viewport = viewportRect;
+        lighting.clustersVersion++;
+    }
+
+    // The region of this frame slot and view may still be read by the GPU
+    m_vulkanContext->waitForCurrentFrame();
+    FrameUploadStats& uploadStats = m_vulkanContext->getUploadStats();
+    if (rebin) {
+        uploadStats.lightingRebuilds++;
     } else {
-        // Default: white ambient, no lights
-        ubo.ambientColorAndIntensity = glm::vec4(1.0f, 1.0f, 1.0f, 0.3f);
-        ubo.lightCounts = glm::ivec4(0, 0, 0, 0);
+        uploadStats.lightingReuses++;
+    }
+
+    // Region layout: LightingUBO, lights, then (with clustered lights) the
+    // cluster ranges followed by the light index list.  Without clusters
+    // only directional lights apply.
+    const LightClusterGrid& clusterGrid = lighting.clusters;
+    const std::vector<LightCluster>& clusters = clusterGrid.getClusters();
+    const std::vector<uint32_t>& lightIndices = clusterGrid.getLightIndices();
+    const std::vector<GPULight>& gpuLights = lighting.lights;
+    const bool clustered = gpuLights.size() > lighting.directionalCount && !lightIndices.empty();
+    const VkDeviceSize lightBytes = gpuLights.size() * sizeof(GPULight);
+    const VkDeviceSize clusterBytes = clustered ? clusters.size() * sizeof(LightCluster) : 0;
+    const VkDeviceSize indexBytes = clustered ? lightIndices.size() * sizeof(uint32_t) : 0;
+    const VkDeviceSize clusterOffset = LIGHTING_LIGHTS_OFFSET + lightBytes;
+
+    // Each frame slot keeps its own copy, so it may still hold this data
+    // from the last time the slot came round
+    LightingRegion* region = getCurrentLightingRegion();
+    if (!region || !reserveLightingRegion(*region, clusterOffset + clusterBytes + indexBytes)) {
+        return;
+    }
+    if (region->lightsVersion == lighting.lightsVersion &&
+        region->clustersVersion == lighting.clustersVersion) {
+        uploadStats.lightingSlotsSkipped++;
+        return;
     }
+    auto* bytes = static_cast<uint8_t*>(region->allocation.mapped);
 
-    memcpy(m_lightingUBOMapped[currentFrame], &ubo, sizeof(LightingUBO));
+    if (region->lightsVersion != lighting.lightsVersion) {
+        if (lightBytes > 0) {
+            std::memcpy(bytes + LIGHTING_LIGHTS_OFFSET, gpuLights.data(), lightBytes);
+        }
+        uploadStats.lightingBytes += lightBytes;
+        region->lightsVersion = lighting.lightsVersion;
+    }
+
+    // A new light list always rebins, so the clusters are current here
+    if (region->clustersVersion != lighting.clustersVersion) {
+        LightingUBO ubo{};
+        ubo.ambientColorAndIntensity = lighting.ambient;
+        ubo.lightCounts = glm::ivec4(static_cast<int>(gpuLights.size()),
+                                     static_cast<int>(lighting.directionalCount), 0, 0);
+        ubo.bufferOffsets.x = static_cast<uint32_t>(LIGHTING_LIGHTS_OFFSET / sizeof(GPULight));
+        if (clustered) {
+            std::memcpy(bytes + clusterOffset, clusters.data(), clusterBytes);
+            std::memcpy(bytes + clusterOffset + clusterBytes, lightIndices.data(), indexBytes);
+            ubo.clusterGrid =
+                glm::uvec4(LightClusterGrid::GRID_X, LightClusterGrid::GRID_Y,
+                           LightClusterGrid::GRID_Z, clusterGrid.isLogarithmic() ? 1u : 0u);
+            ubo.bufferOffsets.y = static_cast<uint32_t>(clusterOffset / sizeof(uint32_t));
+        }
+        ubo.viewport = lighting.viewport;
+        // View depth is minus the view-space z, i.e. minus the view matrix's third row
+        ubo.depthPlane = -glm::vec4(viewMatrix[0][2], viewMatrix[1][2], viewMatrix[2][2],
+                                    viewMatrix[3][2]);
+        ubo.sliceParams = glm::vec4(clusterGrid.getSliceScale(), clusterGrid.getSliceBias(),
+                                    clusterGrid.getNearPlane(), clusterGrid.getFarPlane());
+        std::memcpy(bytes, &ubo, sizeof(ubo));
+        uploadStats.lightingBytes += sizeof(ubo) + clusterBytes + indexBytes;
+        region->clustersVersion = lighting.clustersVersion;
+    }
+    uploadStats.lightingSlotsWritten++;
 }
 
 void Game::setFocusedScene(const std::string& sceneName) {
@@ -1557,13 +1763,50 @@ void Game::renderSingleViewport() {
         m_activeScene->getCamera()->applyTo(*m_vulkanContext);
     }
 
+    // One view: every scene in the group shares the primary scene's camera
+    // and lighting
+    m_vulkanContext->setCurrentView(0);
+    updateLightingUBO(m_activeScene, 0, m_vulkanContext->getEffectiveViewport());
+
+    if (m_renderThreadPool) {
+        // Parallel path: collect every scene's draws, record them as
+        // secondary command buffers, then run onRender() inline
+        m_renderStats.reset();
+
+        VulkanContext::SceneRenderInfo info{};
+        info.clearPass = true;
+        info.viewMatrix = m_vulkanContext->getCamera().getViewMatrix();
+        info.projMatrix = m_vulkanContext->getCamera().getProjectionMatrix();
+        info.cameraVersion = m_vulkanContext->getCamera().getVersion();
+        info.viewport = m_vulkanContext->getEffectiveViewport();
+        info.scissor = m_vulkanContext->getEffectiveScissor();
+
+        for (const auto& sceneName : m_activeSceneGroup.sceneNames) {
+            auto it = m_scenes.find(sceneName);
+            if (it != m_scenes.end()) {
+                prepareDeferredScene(it->second.get(), info.viewport, info.scissor,
+                                     info.secondaryRecorders);
+            }
+        }
+        info.renderCallback = [this](VkCommandBuffer cmd) {
+            (void)cmd;
+            onRender();
+        };
+
+        m_vulkanContext->drawFrameMultiScene({info});
+        finishDeferredScenes();
+        return;
+    }
+
     m_vulkanContext->setRenderCallback([this](VkCommandBuffer cmd) {
         (void)cmd;
+        m_renderStats.reset();
         // Render all scenes in the active group
         for (const auto& sceneName : m_activeSceneGroup.sceneNames) {
             auto it = m_scenes.find(sceneName);
             if (it != m_scenes.end()) {
                 it->second->render();
+                m_renderStats += it->second->getRenderQueue().getStats();
             }
         }
         onRender();
@@ -1574,53 +1817,82 @@ void Game::renderSingleViewport() {
 
 void Game::renderMultiViewport() {
     VkExtent2D extent = m_vulkanContext->getSwapChainExtent();
+    const bool parallel = m_renderThreadPool != nullptr;
+    if (parallel) {
+        m_renderStats.reset();
+    }
 
     std::vector<VulkanContext::SceneRenderInfo> renderInfos;
 
-    for (size_t i = 0; i < m_activeSceneGroup.sceneNames.size(); ++i) {
-        const auto& sceneName = m_activeSceneGroup.sceneNames[i];
+    for (const auto& sceneName : m_activeSceneGroup.sceneNames) {
         auto it = m_scenes.find(sceneName);
         if (it == m_scenes.end()) {
             continue;
         }
 
+        // Each scene is a view with its own camera and lighting slot
+        if (renderInfos.size() == VulkanContext::MAX_VIEWS) {
+            break;
+        }
+        const uint32_t view = static_cast<uint32_t>(renderInfos.size());
+        m_vulkanContext->setCurrentView(view);
+
         Scene* scene = it->second.get();
 
         VulkanContext::SceneRenderInfo info{};
-        info.clearPass = (i == 0);
+        info.clearPass = (view == 0);
+
+        // Compute viewport and scissor from the scene's ViewportRect
+        const ViewportRect& vpRect = scene->getViewportRect();
+        info.viewport = vpRect.toVkViewport(extent.width, extent.height);
+        info.scissor = vpRect.toVkScissor(extent.width, extent.height);
 
         // Get the scene's camera matrices
         if (scene->getCamera()) {
+            // Fit the aspect ratio to the viewport first so the matrices,
+            // the camera slot and the lighting clusters share one version
+            float vpAspect = vpRect.getAspectRatio(extent.width, extent.height);
+            scene->getCamera()->setAspectRatio(vpAspect);
+
             // Apply camera to get internal state updated (positions etc.)
             scene->getCamera()->applyTo(*m_vulkanContext);
             info.viewMatrix = m_vulkanContext->getCamera().getViewMatrix();
             info.projMatrix = m_vulkanContext->getCamera().getProjectionMatrix();
+            // The context camera is shared by all views; key the slot on
+            // the scene's own camera, which the matrices were derived from
+            info.cameraVersion = scene->getCamera()->getVersion();
         } else {
             info.viewMatrix = glm::mat4(1.0f);
             info.projMatrix = glm::mat4(1.0f);
         }
 
-        // Compute viewport and scissor from the scene's ViewportRect
-        const ViewportRect& vpRect = scene->getViewportRect();
-        info.viewport = vpRect.toVkViewport(extent.width, extent.height);
-        info.scissor = vpRect.toVkScissor(extent.width, extent.height);
+        // Update lighting for this scene's view
+        updateLightingUBO(scene, view, info.viewport);
 
-        // Update camera aspect ratio based on viewport dimensions
-        if (scene->getCamera()) {
-            float vpAspect = vpRect.getAspectRatio(extent.width, extent.height);
-            scene->getCamera()->setAspectRatio(vpAspect);
+        if (parallel) {
+            // Collect now; the queue is recorded on the render threads
+            prepareDeferredScene(scene, info.viewport, info.scissor, info.secondaryRecorders);
+        } else {
+            // Capture scene pointer for the lambda
+            info.renderCallback = [this, scene](VkCommandBuffer cmd) {
+                (void)cmd;
+                scene->render();
+                m_renderStats += scene->getRenderQueue().getStats();
+            };
         }
 
-        // Update lighting for this scene
-        updateLightingUBO(scene);
+        renderInfos.push_back(std::move(info));
+    }
 
-        // Capture scene pointer for the lambda
-        info.renderCallback = [this, scene](VkCommandBuffer cmd) {
-            (void)cmd;
-            scene->render();
+    // Reset frame statistics before the first scene records
+    if (!parallel && !renderInfos.empty()) {
+        auto firstCallback = renderInfos.front().renderCallback;
+        renderInfos.front().renderCallback = [this, firstCallback](VkCommandBuffer cmd) {
+            m_renderStats.reset();
+            if (firstCallback) {
+                firstCallback(cmd);
+            }
         };
-
-        renderInfos.push_back(std::move(info));
     }
 
     // Add the onRender callback to the last scene's render
@@ -1635,6 +1907,53 @@ void Game::renderMultiViewport() {
     }
 
     m_vulkanContext->drawFrameMultiScene(renderInfos);
+    if (parallel) {
+        finishDeferredScenes();
+    }
+}
+
+// Smallest queue slice worth handing to its own render thread
+static constexpr size_t kMinDrawsPerRecordChunk = 256;
+
+void Game::prepareDeferredScene(Scene* scene, const VkViewport& viewport, const VkRect2D& scissor,
+                                std::vector<std::function<void(VkCommandBuffer)>>& recorders) {
+    // Entities submit on the main thread (uploads, descriptor caches and
+    // lighting updates are not thread-safe); only recording is parallel
+    scene->m_deferRenderQueueFlush = true;
+    scene->render();
+    scene->m_deferRenderQueueFlush = false;
+    m_deferredScenes.push_back(scene);
+
+    const RenderQueue& queue = scene->getRenderQueue();
+    const size_t drawCount = queue.size();
+    if (drawCount == 0) {
+        return;
+    }
+
+    // Split large queues into contiguous chunks, at most one per thread
+    size_t chunkCount = (drawCount + kMinDrawsPerRecordChunk - 1) / kMinDrawsPerRecordChunk;
+    chunkCount = std::clamp<size_t>(chunkCount, 1, m_renderThreadPool->getThreadCount());
+    const size_t chunkSize = (drawCount + chunkCount - 1) / chunkCount;
+
+    for (size_t first = 0; first < drawCount; first += chunkSize) {
+        const size_t count = std::min(chunkSize, drawCount - first);
+        RenderQueueStats* stats = &m_recordStats.emplace_back();
+        recorders.push_back([&queue, viewport, scissor, first, count, stats](VkCommandBuffer cmd) {
+            queue.record(cmd, viewport, scissor, first, count, *stats);
+        });
+    }
+}
+
+void Game::finishDeferredScenes() {
+    for (Scene* scene : m_deferredScenes) {
+        scene->getRenderQueue().clear();
+        m_renderStats += scene->getRenderQueue().getStats();
+    }
+    for (const auto& stats : m_recordStats) {
+        m_renderStats += stats;
+    }
+    m_deferredScenes.clear();
+    m_recordStats.clear();
 }
 
 void Game::rebuildSchedulerGraph() {
@@ -0,0 +1,409 @@
+/**
+ * @file HexMapEntity.cpp
+ * @brief Implementation of the instanced hex prism map entity
+ */
+
+#include <vde/BufferUtils.h>
+#include <vde/Camera.h>
+#include <vde/VulkanContext.h>
+#include <vde/api/Game.h>
+#include <vde/api/HexMapEntity.h>
+#include <vde/api/Mesh.h>
+#include <vde/api/RenderQueue.h>
+#include <vde/api/Scene.h>
+#include <vde/api/StaticBatch.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace vde {
+
+static constexpr float SQRT3 = 1.7320508f;
+
+// Unit-height prism converted to the engine's Vertex layout
+static std::shared_ptr<Mesh> createPrismMesh(float hexRadius) {
+    std::vector<HexPrismVertex> prismVertices;
+    std::vector<uint32_t> indices;
+    HexPrismMeshGenerator::generate(hexRadius, prismVertices, indices);
+
+    // Normals travel in the vertex color, as for every engine mesh
+    std::vector<Vertex> vertices;
+    vertices.reserve(prismVertices.size());
+    for (const HexPrismVertex& v : prismVertices) {
+        vertices.push_back({v.position, v.normal, v.texCoord});
+    }
+
+    // The generator winds faces opposite to the engine's meshes (see
+    // Mesh::createCube()), which the back-face culled pipeline would drop
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        std::swap(indices[i + 1], indices[i + 2]);
+    }
+
+    auto mesh = std::make_shared<Mesh>();
+    mesh->setData(vertices, indices);
+    mesh->setCompactVerticesAllowed(false);
+    return mesh;
+}
+
+HexMapEntity::~HexMapEntity() {
+    releaseGPUBuffers();
+}
+
+bool HexMapEntity::create(uint32_t columns, uint32_t rows, float hexRadius, uint32_t chunkSize) {
+    if (columns == 0 || rows == 0 || columns > MAX_DIMENSION || rows > MAX_DIMENSION ||
+        chunkSize == 0 || !(hexRadius > 0.0f)) {
+        return false;
+    }
+
+    if (!m_prism || hexRadius != m_hexRadius) {
+        m_prism = createPrismMesh(hexRadius);
+    }
+    m_columns = columns;
+    m_rows = rows;
+    m_hexRadius = hexRadius;
+    m_chunkSize = chunkSize;
+    m_chunkColumns = (columns + chunkSize - 1) / chunkSize;
+    const uint32_t chunkRows = (rows + chunkSize - 1) / chunkSize;
+
+    m_instances.clear();
+    m_instances.reserve(size_t(columns) * rows);
+    m_chunks.clear();
+    m_chunks.reserve(size_t(m_chunkColumns) * chunkRows);
+
+    // Chunk-major: each chunk's cells are contiguous, row by row within it
+    for (uint32_t chunkRow = 0; chunkRow < chunkRows; ++chunkRow) {
+        for (uint32_t chunkColumn = 0; chunkColumn < m_chunkColumns; ++chunkColumn) {
+            Chunk chunk;
+            chunk.firstColumn = chunkColumn * chunkSize;
+            chunk.firstRow = chunkRow * chunkSize;
+            chunk.columns = std::min(chunkSize, columns - chunk.firstColumn);
+            const uint32_t chunkRowCount = std::min(chunkSize, rows - chunk.firstRow);
+            chunk.firstInstance = static_cast<uint32_t>(m_instances.size());
+            chunk.instanceCount = chunk.columns * chunkRowCount;
+
+            glm::vec3 centerMin(std::numeric_limits<float>::max());
+            glm::vec3 centerMax(std::numeric_limits<float>::lowest());
+            for (uint32_t row = chunk.firstRow; row < chunk.firstRow + chunkRowCount; ++row) {
+                for (uint32_t column = chunk.firstColumn;
+                     column < chunk.firstColumn + chunk.columns; ++column) {
+                    glm::ivec2 axial = offsetToAxial(column, row);
+                    HexPrismInstance instance;
+                    instance.q = static_cast<int16_t>(axial.x);
+                    instance.r = static_cast<int16_t>(axial.y);
+                    m_instances.push_back(instance);
+
+                    glm::vec3 center = axialToLocal(axial.x, axial.y, hexRadius);
+                    centerMin = glm::min(centerMin, center);
+                    centerMax = glm::max(centerMax, center);
+                }
+            }
+
+            // Cell centers grown by the prism footprint and the unit height
+            glm::vec3 extent(hexRadius, 0.0f, hexRadius * SQRT3 * 0.5f);
+            chunk.boundsMin = centerMin - extent;
+            chunk.boundsMax = centerMax + extent;
+            chunk.boundsMax.y = 1.0f;
+            m_chunks.push_back(chunk);
+        }
+    }
+
+    // Buffers are sized for the old map; earlier frames may still read them
+    for (FrameBuffer& frame : m_frames) {
+        retireBuffer(frame);
+    }
+    return true;
+}
+
+glm::ivec2 HexMapEntity::offsetToAxial(uint32_t column, uint32_t row) {
+    int q = static_cast<int>(column);
+    int r = static_cast<int>(row) - (q - (q & 1)) / 2;
+    return glm::ivec2(q, r);
+}
+
+glm::vec3 HexMapEntity::axialToLocal(int q, int r, float hexRadius) {
+    return glm::vec3(hexRadius * 1.5f * float(q), 0.0f,
+                     hexRadius * SQRT3 * (float(r) + float(q) * 0.5f));
+}
+
+uint32_t HexMapEntity::locate(uint32_t column, uint32_t row, uint32_t& chunkIndex) const {
+    if (column >= m_columns || row >= m_rows) {
+        return UINT32_MAX;
+    }
+    chunkIndex = (row / m_chunkSize) * m_chunkColumns + column / m_chunkSize;
+    const Chunk& chunk = m_chunks[chunkIndex];
+    return chunk.firstInstance + (row - chunk.firstRow) * chunk.columns +
+           (column - chunk.firstColumn);
+}
+
+uint32_t HexMapEntity::getInstanceIndex(uint32_t column, uint32_t row) const {
+    uint32_t chunkIndex = 0;
+    return locate(column, row, chunkIndex);
+}
+
+const HexPrismInstance* HexMapEntity::getCell(uint32_t column, uint32_t row) const {
+    uint32_t slot = getInstanceIndex(column, row);
+    return slot == UINT32_MAX ? nullptr : &m_instances[slot];
+}
+
+void HexMapEntity::setCell(uint32_t column, uint32_t row, float height, const Color& color) {
+    uint32_t chunkIndex = 0;
+    uint32_t slot = locate(column, row, chunkIndex);
+    if (slot == UINT32_MAX) {
+        return;
+    }
+    m_instances[slot].height = height;
+    m_instances[slot].color = HexPrismInstance::packColor(color.toVec4());
+    growChunkBounds(m_chunks[chunkIndex], height);
+    markDirty(slot);
+}
+
+void HexMapEntity::setCellHeight(uint32_t column, uint32_t row, float height) {
+    uint32_t chunkIndex = 0;
+    uint32_t slot = locate(column, row, chunkIndex);
+    if (slot == UINT32_MAX) {
+        return;
+    }
+    m_instances[slot].height = height;
+    growChunkBounds(m_chunks[chunkIndex], height);
+    markDirty(slot);
+}
+
+void HexMapEntity::setCellColor(uint32_t column, uint32_t row, const Color& color) {
+    uint32_t slot = getInstanceIndex(column, row);
+    if (slot == UINT32_MAX) {
+        return;
+    }
+    m_instances[slot].color = HexPrismInstance::packColor(color.toVec4());
+    markDirty(slot);
+}
+
+void HexMapEntity::growChunkBounds(Chunk& chunk, float height) {
+    // Bounds only grow: shrinking would need a scan of the whole chunk
+    chunk.boundsMin.y = std::min(chunk.boundsMin.y, height);
+    chunk.boundsMax.y = std::max(chunk.boundsMax.y, height);
+}
+
+void HexMapEntity::markDirty(uint32_t slot) {
+    for (FrameBuffer& frame : m_frames) {
+        if (frame.fullUpload) {
+            continue;
+        }
+        // Past a quarter of the map one memcpy beats scattered slot writes
+        if (frame.dirtySlots.size() >= m_instances.size() / 4) {
+            frame.dirtySlots.clear();
+            frame.fullUpload = true;
+            continue;
+        }
+        frame.dirtySlots.push_back(slot);
+    }
+}
+
+void HexMapEntity::setFramesInFlight(uint32_t count) {
+    for (size_t i = count; i < m_frames.size(); ++i) {
+        retireBuffer(m_frames[i]);
+    }
+    m_frames.resize(count);
+}
+
+size_t HexMapEntity::getPendingSlotCount(uint32_t frame) const {
+    if (frame >= m_frames.size()) {
+        return 0;
+    }
+    const FrameBuffer& buffer = m_frames[frame];
+    return buffer.fullUpload ? m_instances.size() : buffer.dirtySlots.size();
+}
+
+VkBuffer HexMapEntity::syncInstanceBuffer(uint32_t frame) {
+    // Each frame in flight owns a buffer, so writing this frame's copy never
+    // races the GPU reading the previous frame's
+    FrameBuffer& buffer = m_frames[frame];
+    if (buffer.buffer == VK_NULL_HANDLE) {
+        BufferUtils::createBuffer(sizeof(HexPrismInstance) * m_instances.size(),
+                                  VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  buffer.buffer, buffer.allocation);
+        buffer.fullUpload = true;
+    }
+
+    // Host-visible allocator blocks stay persistently mapped
+    auto* mapped = static_cast<HexPrismInstance*>(buffer.allocation.mapped);
+    if (mapped == nullptr) {
+        return VK_NULL_HANDLE;
+    }
+
+    writePendingInstances(frame, mapped);
+    return buffer.buffer;
+}
+
+size_t HexMapEntity::writePendingInstances(uint32_t frame, HexPrismInstance* destination) {
+    if (frame >= m_frames.size()) {
+        return 0;
+    }
+    FrameBuffer& buffer = m_frames[frame];
+    size_t written = 0;
+    if (buffer.fullUpload) {
+        std::memcpy(destination, m_instances.data(),
+                    sizeof(HexPrismInstance) * m_instances.size());
+        written = m_instances.size();
+    } else {
+        for (uint32_t slot : buffer.dirtySlots) {
+            destination[slot] = m_instances[slot];
+        }
+        written = buffer.dirtySlots.size();
+    }
+    buffer.dirtySlots.clear();
+    buffer.fullUpload = false;
+    return written;
+}
+
+void HexMapEntity::retireBuffer(FrameBuffer& frame) {
+    if (frame.buffer != VK_NULL_HANDLE) {
+        m_retiredBuffers.push_back({frame.buffer, frame.allocation, m_lastFrameValue});
+        frame.buffer = VK_NULL_HANDLE;
+        frame.allocation = GpuAllocation{};
+    }
+    frame.dirtySlots.clear();
+    frame.fullUpload = true;
+}
+
+void HexMapEntity::freeRetiredBuffers(uint64_t completedValue) {
+    // The timeline completes in order, so every value up to completedValue is done
+    auto done = [&](RetiredBuffer& retired) {
+        if (retired.frameValue > completedValue) {
+            return false;
+        }
+        BufferUtils::destroyBuffer(retired.buffer, retired.allocation);
+        return true;
+    };
+    m_retiredBuffers.erase(
+        std::remove_if(m_retiredBuffers.begin(), m_retiredBuffers.end(), done),
+        m_retiredBuffers.end());
+}
+
+void HexMapEntity::releaseGPUBuffers() {
+    for (FrameBuffer& frame : m_frames) {
+        BufferUtils::destroyBuffer(frame.buffer, frame.allocation);
+        frame.dirtySlots.clear();
+        frame.fullUpload = true;
+    }
+    freeRetiredBuffers(UINT64_MAX);
+}
+
+void HexMapEntity::render() {
+    m_visibleChunks = 0;
+    if (!m_scene || m_instances.empty()) {
+        return;
+    }
+
+    Game* game = m_scene->getGame();
+    if (!game) {
+        return;
+    }
+
+    VulkanContext* context = game->getVulkanContext();
+    if (!context) {
+        return;
+    }
+
+    VkPipeline pipeline = game->getHexPrismPipeline();
+    VkPipelineLayout pipelineLayout = game->getMeshPipelineLayout();
+    if (pipeline == VK_NULL_HANDLE || pipelineLayout == VK_NULL_HANDLE) {
+        return;
+    }
+
+    if (!m_prism->isOnGPU()) {
+        m_prism->uploadToGPU(context);
+    }
+
+    // This frame's slot has been waited for, and with it every earlier frame
+    const FramePacer& pacer = context->getFramePacer();
+    freeRetiredBuffers(pacer.getWaitValue());
+    m_lastFrameValue = pacer.getSubmittedValue() + 1;
+
+    setFramesInFlight(pacer.getFramesInFlight());
+    VkBuffer instanceBuffer = syncInstanceBuffer(context->getCurrentFrameContext().index);
+    if (instanceBuffer == VK_NULL_HANDLE) {
+        return;
+    }
+
+    // Same per-draw data as meshes; params carries the radius
+    DrawUBO drawData;
+    drawData.model = getModelMatrix();
+    // Black albedo makes mesh.frag use the per-cell color
+    drawData.material.albedo = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    drawData.material.emission = glm::vec4(0.0f);
+    drawData.material.roughness = 0.8f;
+    drawData.material.metallic = 0.0f;
+    drawData.material.normalStrength = 1.0f;
+    drawData.material.padding = 0.0f;
+    drawData.params = glm::vec4(m_hexRadius, 0.0f, 0.0f, 0.0f);
+
+    // Every chunk draw shares one copy of the data
+    uint32_t drawOffset = 0;
+    VkDescriptorSet drawSet = game->pushDrawData(drawData, drawOffset);
+    if (drawSet == VK_NULL_HANDLE) {
+        return;
+    }
+
+    RenderCommand command;
+    command.pipeline = pipeline;
+    command.pipelineLayout = pipelineLayout;
+    command.mesh = m_prism.get();
+    command.instanceBuffer = instanceBuffer;
+
+    // Set 0: camera UBO at the current view's slot, set 1: the view's lighting;
+    // set 2: the map's draw data
+    command.descriptorSets[0] = context->getCurrentUBODescriptorSet();
+    command.descriptorSets[1] = game->getCurrentLightingDescriptorSet();
+    command.descriptorSets[2] = drawSet;
+    command.descriptorSetCount = 3;
+    command.dynamicOffsetMask = 0b101;
+    command.dynamicOffsets = {context->getCurrentUBOOffset(), 0, drawOffset};
+
+    // Planes extracted from the full model-view-projection are in map space,
+    // so the local chunk bounds are tested without transforming them
+    const GameCamera* camera = m_scene->getCamera();
+    glm::mat4 modelViewProjection(1.0f);
+    if (camera) {
+        modelViewProjection = camera->getCamera().getViewProjectionMatrix() * drawData.model;
+    }
+
+    const bool stateSorted = m_scene->getRenderSortMode() == RenderSortMode::StateSorted;
+    for (const Chunk& chunk : m_chunks) {
+        if (camera && !StaticBatch::intersectsFrustum(modelViewProjection, chunk.boundsMin,
+                                                      chunk.boundsMax)) {
+            continue;
+        }
+        ++m_visibleChunks;
+
+        command.firstInstance = chunk.firstInstance;
+        command.instanceCount = chunk.instanceCount;
+
+        // Sort key: insertion order by default, or grouped by state.  The
+        // draw data's opacity is 1, so chunks always belong to the opaque bucket.
+        if (stateSorted) {
+            uint32_t depth = 0;
+            if (camera) {
+                const Camera& cam = camera->getCamera();
+                glm::vec3 center = glm::vec3(
+                    drawData.model * glm::vec4((chunk.boundsMin + chunk.boundsMax) * 0.5f, 1.0f));
+                float distance = glm::length(center - cam.getPosition());
+                depth = RenderSortKey::quantizeDepth(distance, cam.getFarPlane());
+            }
+            command.sortKey = RenderSortKey::makeStateSorted(RenderPassBucket::Opaque, pipeline,
+                                                             nullptr, m_prism.get(), depth);
+        } else {
+            command.sortKey =
+                RenderSortKey::makeOrdered(RenderPassBucket::Ordered,
+                                           m_scene->getRenderQueue().nextSequence(), pipeline,
+                                           m_prism.get());
+        }
+
+        submitRenderCommand(context, command);
+    }
+}
+
+}  // namespace vde
@@ -5,24 +5,50 @@
 
 #include <vde/api/LightBox.h>
 
+#include <atomic>
 #include <stdexcept>
 
 namespace vde {
 
+namespace {
+// Shared by every light box so versions are unique across instances
+std::atomic<uint64_t> g_nextLightBoxVersion{1};
+
+uint64_t nextVersion() {
+    return g_nextLightBoxVersion.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace
+
 // ============================================================================
 // LightBox Implementation
 // ============================================================================
 
+LightBox::LightBox() : m_version(nextVersion()) {}
+
+void LightBox::markChanged() {
+    m_version = nextVersion();
+}
+
 size_t LightBox::addLight(const Light& light) {
     m_lights.push_back(light);
+    markChanged();
     return m_lights.size() - 1;
 }
 
+void LightBox::setLight(size_t index, const Light& light) {
+    if (index >= m_lights.size()) {
+        throw std::out_of_range("Light index out of range");
+    }
+    m_lights[index] = light;
+    markChanged();
+}
+
 void LightBox::removeLight(size_t index) {
     if (index >= m_lights.size()) {
         throw std::out_of_range("Light index out of range");
     }
     m_lights.erase(m_lights.begin() + static_cast<ptrdiff_t>(index));
+    markChanged();
 }
 
 // ============================================================================
@@ -4,6 +4,11 @@
  */
 
 #include <vde/BufferUtils.h>
+#include <vde/MeshCache.h>
+#include <vde/MeshSimplifier.h>
+#include <vde/ObjLoader.h>
+#include <vde/ShaderCache.h>
+#include <vde/VertexQuantization.h>
 #include <vde/VulkanContext.h>
 #include <vde/api/Mesh.h>
 
@@ -11,10 +16,8 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <fstream>
 #include <limits>
-#include <set>
-#include <sstream>
+#include <mutex>
 #include <utility>
 
 namespace vde {
@@ -26,107 +29,155 @@ Mesh::~Mesh() {
     }
 }
 
-bool Mesh::loadFromFile(const std::string& path) {
-    // Simple OBJ loader (supports only vertices, normals, and texture coords)
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        return false;
-    }
+namespace {
 
-    std::vector<glm::vec3> positions;
-    std::vector<glm::vec3> normals;
-    std::vector<glm::vec2> texCoords;
-    std::vector<Vertex> vertices;
-    std::vector<uint32_t> indices;
+std::mutex s_cacheDirectoryMutex;
+std::string s_cacheDirectory = MeshCache::DEFAULT_DIRECTORY;
 
-    std::string line;
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        std::string prefix;
-        iss >> prefix;
-
-        if (prefix == "v") {
-            // Vertex position
-            glm::vec3 pos;
-            iss >> pos.x >> pos.y >> pos.z;
-            positions.push_back(pos);
-        } else if (prefix == "vn") {
-            // Vertex normal
-            glm::vec3 normal;
-            iss >> normal.x >> normal.y >> normal.z;
-            normals.push_back(normal);
-        } else if (prefix == "vt") {
-            // Texture coordinate
-            glm::vec2 texCoord;
-            iss >> texCoord.x >> texCoord.y;
-            texCoords.push_back(texCoord);
-        } else if (prefix == "f") {
-            // Face - parse v/vt/vn format
-            std::string vertexStr;
-            std::vector<uint32_t> faceIndices;
-
-            while (iss >> vertexStr) {
-                std::istringstream vertexStream(vertexStr);
-                std::string indexStr;
-                int posIdx = -1, texIdx = -1, normIdx = -1;
-
-                // Parse v/vt/vn
-                if (std::getline(vertexStream, indexStr, '/')) {
-                    posIdx = std::stoi(indexStr) - 1;
-                }
-                if (std::getline(vertexStream, indexStr, '/')) {
-                    if (!indexStr.empty()) {
-                        texIdx = std::stoi(indexStr) - 1;
-                    }
-                }
-                if (std::getline(vertexStream, indexStr, '/')) {
-                    if (!indexStr.empty()) {
-                        normIdx = std::stoi(indexStr) - 1;
-                    }
-                }
+}  // namespace
 
-                // Create vertex
-                Vertex vertex{};
-                if (posIdx >= 0 && posIdx < positions.size()) {
-                    vertex.position = positions[posIdx];
-                }
-                if (texIdx >= 0 && texIdx < texCoords.size()) {
-                    vertex.texCoord = texCoords[texIdx];
-                }
-                // Use normal as color for now (or white if no normal)
-                if (normIdx >= 0 && normIdx < normals.size()) {
-                    vertex.color = glm::abs(normals[normIdx]);
-                } else {
-                    vertex.color = glm::vec3(1.0f);
-                }
+void Mesh::setCacheDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(s_cacheDirectoryMutex);
+    s_cacheDirectory = directory;
+}
 
-                vertices.push_back(vertex);
-                faceIndices.push_back(static_cast<uint32_t>(vertices.size() - 1));
-            }
+std::string Mesh::getCacheDirectory() {
+    std::lock_guard<std::mutex> lock(s_cacheDirectoryMutex);
+    return s_cacheDirectory;
+}
 
-            // Triangulate face (assumes convex polygons)
-            for (size_t i = 1; i + 1 < faceIndices.size(); ++i) {
-                indices.push_back(faceIndices[0]);
-                indices.push_back(faceIndices[i]);
-                indices.push_back(faceIndices[i + 1]);
+bool Mesh::loadFromFile(const std::string& path) {
+    // Binary cache first, keyed by the source's content hash
+    std::string cacheDirectory = getCacheDirectory();
+    uint64_t sourceHash = 0;
+    if (!cacheDirectory.empty()) {
+        sourceHash = ShaderHash::hashFile(path);
+        MeshCache cache(cacheDirectory);
+        std::vector<MeshCacheLOD> lods;
+        if (sourceHash != 0 &&
+            cache.load(sourceHash, m_vertices, m_indices, m_boundsMin, m_boundsMax, &lods)) {
+            // The LOD chain comes from the file; a cache hit never simplifies
+            m_bvh.clear();
+            m_lods.clear();
+            for (MeshCacheLOD& level : lods) {
+                auto lod = std::make_shared<Mesh>();
+                lod->m_vertices = std::move(level.vertices);
+                lod->m_indices = std::move(level.indices);
+                lod->m_compactVerticesAllowed = m_compactVerticesAllowed;
+                lod->calculateBounds();
+                m_lods.push_back({lod, level.error});
             }
+            return true;
         }
     }
 
-    if (vertices.empty() || indices.empty()) {
+    // OBJ only: positions, normals and texture coords, deduplicated per corner
+    ObjMeshData data = ObjLoader::load(path);
+    if (!data.isValid()) {
         return false;
     }
 
-    setData(vertices, indices);
+    setData(data.vertices, data.indices);
+    optimize(true);
+    generateLODs();
+
+    if (sourceHash != 0) {
+        std::vector<MeshCacheLOD> lods;
+        for (const LODLevel& level : m_lods) {
+            lods.push_back({level.mesh->m_vertices, level.mesh->m_indices, level.error});
+        }
+        MeshCache cache(cacheDirectory);
+        cache.store(sourceHash, m_vertices, m_indices, m_boundsMin, m_boundsMax, lods);
+    }
     return true;
 }
 
 void Mesh::setData(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
     m_vertices = vertices;
     m_indices = indices;
+    m_lods.clear();
+    m_bvh.clear();
     calculateBounds();
 }
 
+size_t Mesh::generateLODs(size_t maxLevels, float reduction, float maxError) {
+    m_lods.clear();
+
+    // Each level is simplified from the previous one
+    const Mesh* source = this;
+    float accumulatedError = 0.0f;
+    while (getLODCount() < maxLevels) {
+        size_t targetTriangles =
+            static_cast<size_t>(static_cast<float>(source->m_indices.size() / 3) * reduction);
+        if (targetTriangles < MIN_LOD_TRIANGLES) {
+            break;
+        }
+
+        float error = 0.0f;
+        std::vector<uint32_t> indices = MeshSimplifier::simplify(
+            source->m_vertices, source->m_indices, targetTriangles * 3, maxError, &error);
+
+        // Not worth a level if the error budget stopped it early
+        if (indices.empty() || indices.size() * 10 > source->m_indices.size() * 9) {
+            break;
+        }
+
+        // Keep only the referenced vertices (fetch order puts them first)
+        std::vector<Vertex> vertices = source->m_vertices;
+        indices = MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+        MeshOptimizer::optimizeVertexFetch(vertices, indices);
+        vertices.resize(*std::max_element(indices.begin(), indices.end()) + 1);
+
+        auto lod = std::make_shared<Mesh>();
+        lod->m_vertices = std::move(vertices);
+        lod->m_indices = std::move(indices);
+        lod->m_compactVerticesAllowed = m_compactVerticesAllowed;
+        lod->calculateBounds();
+
+        accumulatedError += error;
+        m_lods.push_back({lod, accumulatedError});
+        source = lod.get();
+    }
+    return getLODCount();
+}
+
+Mesh* Mesh::getLOD(size_t level) {
+    if (level == 0 || m_lods.empty()) {
+        return this;
+    }
+    return m_lods[std::min(level, m_lods.size()) - 1].mesh.get();
+}
+
+float Mesh::getLODError(size_t level) const {
+    if (level == 0 || m_lods.empty()) {
+        return 0.0f;
+    }
+    return m_lods[std::min(level, m_lods.size()) - 1].error;
+}
+
+MeshOptimizeStats Mesh::optimize(bool reduceOverdraw) {
+    MeshOptimizeStats stats;
+    stats.acmrBefore = MeshOptimizer::computeACMR(m_indices, m_vertices.size());
+
+    m_indices = MeshOptimizer::optimizeVertexCache(m_indices, m_vertices.size());
+    if (reduceOverdraw) {
+        m_indices = MeshOptimizer::optimizeOverdraw(m_indices, m_vertices);
+    }
+    MeshOptimizer::optimizeVertexFetch(m_vertices, m_indices);
+    m_bvh.clear();
+
+    stats.acmrAfter = MeshOptimizer::computeACMR(m_indices, m_vertices.size());
+    m_optimizeStats = stats;
+    return stats;
+}
+
+const MeshBVH& Mesh::getBVH() const {
+    if (m_bvh.isEmpty() && m_indices.size() >= 3) {
+        m_bvh.build(m_vertices, m_indices);
+    }
+    return m_bvh;
+}
+
 void Mesh::calculateBounds() {
     if (m_vertices.empty()) {
         m_boundsMin = glm::vec3(0.0f);
@@ -249,6 +300,7 @@ ResourcePtr<Mesh> Mesh::createSphere(float radius, int segments, int rings) {
     }
 
     mesh->setData(vertices, indices);
+    mesh->optimize();
     return mesh;
 }
 
@@ -299,6 +351,7 @@ ResourcePtr<Mesh> Mesh::createPlane(float width, float height, int subdivisionsX
     }
 
     mesh->setData(vertices, indices);
+    mesh->optimize();
     return mesh;
 }
 
@@ -384,6 +437,7 @@ ResourcePtr<Mesh> Mesh::createCylinder(float radius, float height, int segments)
     }
 
     mesh->setData(vertices, indices);
+    mesh->optimize();
     return mesh;
 }
 
@@ -496,14 +550,75 @@ void addEdgeTube(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
 }
 
 /**
- * @brief Build a canonical edge key so (a,b) == (b,a).
+ * @brief Pack an edge into a canonical 64-bit key so (a,b) == (b,a).
  */
-std::pair<uint32_t, uint32_t> makeEdgeKey(uint32_t a, uint32_t b) {
-    return (a < b) ? std::make_pair(a, b) : std::make_pair(b, a);
+uint64_t makeEdgeKey(uint32_t a, uint32_t b) {
+    return (a < b) ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
 }
 
 }  // namespace
 
+std::vector<std::pair<uint32_t, uint32_t>> Mesh::extractEdges(
+    const std::vector<uint32_t>& indices) {
+    const size_t cornerCount = indices.size() - indices.size() % 3;
+    uint32_t maxIndex = 0;
+    for (size_t i = 0; i < cornerCount; ++i) {
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    auto forEachEdge = [&](auto&& visit) {
+        for (size_t i = 0; i < cornerCount; i += 3) {
+            for (size_t k = 0; k < 3; ++k) {
+                uint32_t a = indices[i + k];
+                uint32_t b = indices[i + (k + 1) % 3];
+                if (a != b) {
+                    visit(std::min(a, b), std::max(a, b));
+                }
+            }
+        }
+    };
+
+    // Sparse index ranges (more vertices than corners): sort packed keys
+    if (maxIndex >= cornerCount) {
+        std::vector<uint64_t> keys;
+        keys.reserve(cornerCount);
+        forEachEdge([&](uint32_t a, uint32_t b) { keys.push_back(makeEdgeKey(a, b)); });
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        edges.reserve(keys.size());
+        for (uint64_t key : keys) {
+            edges.emplace_back(static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key));
+        }
+        return edges;
+    }
+
+    // Counting sort by the smaller vertex: each vertex gets a flat slice of
+    // its larger neighbours, which is tiny and deduplicated in place
+    std::vector<uint32_t> offsets(size_t(maxIndex) + 2, 0);
+    forEachEdge([&](uint32_t a, uint32_t) { offsets[a + 1]++; });
+    for (size_t v = 1; v < offsets.size(); ++v) {
+        offsets[v] += offsets[v - 1];
+    }
+
+    std::vector<uint32_t> neighbours(offsets.back());
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    forEachEdge([&](uint32_t a, uint32_t b) { neighbours[cursor[a]++] = b; });
+
+    // Most edges are shared by two triangles, so expect about half
+    edges.reserve(neighbours.size() / 2);
+    for (uint32_t v = 0; v <= maxIndex; ++v) {
+        auto first = neighbours.begin() + offsets[v];
+        auto last = neighbours.begin() + offsets[v + 1];
+        std::sort(first, last);
+        last = std::unique(first, last);
+        for (auto it = first; it != last; ++it) {
+            edges.emplace_back(v, *it);
+        }
+    }
+    return edges;
+}
+
 ResourcePtr<Mesh> Mesh::createWireframe(const ResourcePtr<Mesh>& sourceMesh, float thickness) {
     if (!sourceMesh) {
         return std::make_shared<Mesh>();
@@ -514,19 +629,14 @@ ResourcePtr<Mesh> Mesh::createWireframe(const ResourcePtr<Mesh>& sourceMesh, flo
 ResourcePtr<Mesh> Mesh::createWireframe(const std::vector<Vertex>& srcVertices,
                                         const std::vector<uint32_t>& srcIndices, float thickness) {
     auto mesh = std::make_shared<Mesh>();
-
-    // Collect unique edges from the triangle list
-    std::set<std::pair<uint32_t, uint32_t>> edgeSet;
-    for (size_t i = 0; i + 2 < srcIndices.size(); i += 3) {
-        edgeSet.insert(makeEdgeKey(srcIndices[i], srcIndices[i + 1]));
-        edgeSet.insert(makeEdgeKey(srcIndices[i + 1], srcIndices[i + 2]));
-        edgeSet.insert(makeEdgeKey(srcIndices[i + 2], srcIndices[i]));
-    }
+    std::vector<std::pair<uint32_t, uint32_t>> edges = extractEdges(srcIndices);
 
     // Build tube geometry for each unique edge
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
-    for (const auto& [a, b] : edgeSet) {
+    vertices.reserve(edges.size() * 8);
+    indices.reserve(edges.size() * 24);
+    for (const auto& [a, b] : edges) {
         addEdgeTube(vertices, indices, srcVertices[a].position, srcVertices[b].position, thickness);
     }
 
@@ -534,9 +644,52 @@ ResourcePtr<Mesh> Mesh::createWireframe(const std::vector<Vertex>& srcVertices,
     return mesh;
 }
 
-void Mesh::uploadToGPU(VulkanContext* context) {
+ResourcePtr<Mesh> Mesh::createEdgeTube() {
+    auto mesh = std::make_shared<Mesh>();
+
+    // Same corners, normals and winding as addEdgeTube(), expressed in the
+    // (right, forward, direction) frame the edge shader rebuilds per instance
+    const glm::vec2 corners[4] = {{1.0f, 1.0f}, {1.0f, -1.0f}, {-1.0f, -1.0f}, {-1.0f, 1.0f}};
+    std::vector<Vertex> vertices;
+    for (float z : {0.0f, 1.0f}) {
+        for (const glm::vec2& corner : corners) {
+            glm::vec3 normal = glm::normalize(glm::vec3(corner.x, corner.y, 0.0f));
+            vertices.push_back({glm::vec3(corner.x, corner.y, z), normal, glm::vec2(0.0f)});
+        }
+    }
+
+    std::vector<uint32_t> indices;
+    for (uint32_t i = 0; i < 4; i++) {
+        uint32_t next = (i + 1) % 4;
+        indices.insert(indices.end(), {i, i + 4, next + 4, i, next + 4, next});
+    }
+
+    mesh->setData(vertices, indices);
+    mesh->setCompactVerticesAllowed(false);
+    return mesh;
+}
+
+std::vector<EdgeInstance> Mesh::createEdgeInstances() const {
+    std::vector<std::pair<uint32_t, uint32_t>> edges = extractEdges(m_indices);
+
+    std::vector<EdgeInstance> instances;
+    instances.reserve(edges.size());
+    for (const auto& [a, b] : edges) {
+        if (b >= m_vertices.size()) {
+            continue;
+        }
+        const glm::vec3& start = m_vertices[a].position;
+        const glm::vec3& end = m_vertices[b].position;
+        if (glm::length(end - start) >= 0.0001f) {
+            instances.push_back({start, end});
+        }
+    }
+    return instances;
+}
+
+UploadHandle Mesh::uploadToGPU(VulkanContext* context) {
     if (!context || m_vertices.empty()) {
-        return;
+        return UploadHandle{};
     }
 
     // Free existing buffers if already uploaded
@@ -553,38 +706,100 @@ void Mesh::uploadToGPU(VulkanContext* context) {
                           context->getCommandPool(), context->getGraphicsQueue());
     }
 
-    // Upload vertex buffer
-    VkDeviceSize vertexBufferSize = sizeof(Vertex) * m_vertices.size();
-    BufferUtils::createDeviceLocalBuffer(m_vertices.data(), vertexBufferSize,
-                                         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, m_vertexBuffer,
-                                         m_vertexBufferMemory);
+    // Upload vertex buffer, quantized when the data allows (the staging copy
+    // is taken immediately, so the temporary may go out of scope)
+    m_gpuPositionOffset = m_boundsMin;
+    m_gpuPositionScale = m_boundsMax - m_boundsMin;
+    if (m_compactVerticesAllowed && VertexQuantization::canCompact(m_vertices)) {
+        std::vector<CompactVertex> compact =
+            VertexQuantization::compact(m_vertices, m_boundsMin, m_boundsMax);
+        m_gpuVertexFormat = VertexFormat::Compact;
+        m_uploadHandle = BufferUtils::createDeviceLocalBuffer(
+            compact.data(), sizeof(CompactVertex) * compact.size(),
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, m_vertexBuffer, m_vertexAllocation);
+    } else {
+        m_gpuVertexFormat = VertexFormat::Full;
+        m_uploadHandle = BufferUtils::createDeviceLocalBuffer(
+            m_vertices.data(), sizeof(Vertex) * m_vertices.size(),
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, m_vertexBuffer, m_vertexAllocation);
+    }
 
-    // Upload index buffer if we have indices
+    // Upload index buffer if we have indices (same batch, so the later handle covers both)
     if (!m_indices.empty()) {
-        VkDeviceSize indexBufferSize = sizeof(uint32_t) * m_indices.size();
-        BufferUtils::createDeviceLocalBuffer(m_indices.data(), indexBufferSize,
-                                             VK_BUFFER_USAGE_INDEX_BUFFER_BIT, m_indexBuffer,
-                                             m_indexBufferMemory);
+        UploadHandle indexHandle;
+        if (VertexQuantization::canUse16BitIndices(m_vertices.size())) {
+            std::vector<uint16_t> narrow = VertexQuantization::narrowIndices(m_indices);
+            m_indexType = VK_INDEX_TYPE_UINT16;
+            indexHandle = BufferUtils::createDeviceLocalBuffer(
+                narrow.data(), sizeof(uint16_t) * narrow.size(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                m_indexBuffer, m_indexAllocation);
+        } else {
+            m_indexType = VK_INDEX_TYPE_UINT32;
+            indexHandle = BufferUtils::createDeviceLocalBuffer(
+                m_indices.data(), sizeof(uint32_t) * m_indices.size(),
+                VK_BUFFER_USAGE_INDEX_BUFFER_BIT, m_indexBuffer, m_indexAllocation);
+        }
+        if (indexHandle.value > m_uploadHandle.value) {
+            m_uploadHandle = indexHandle;
+        }
     }
+
+    return m_uploadHandle;
+}
+
+UploadHandle Mesh::uploadEdgesToGPU(VulkanContext* context) {
+    if (!context || m_edgeBuffer != VK_NULL_HANDLE) {
+        return UploadHandle{};
+    }
+
+    std::vector<EdgeInstance> edges = createEdgeInstances();
+    if (edges.empty()) {
+        return UploadHandle{};
+    }
+
+    m_device = context->getDevice();
+    if (!BufferUtils::isInitialized()) {
+        BufferUtils::init(context->getDevice(), context->getPhysicalDevice(),
+                          context->getCommandPool(), context->getGraphicsQueue());
+    }
+
+    UploadHandle handle = BufferUtils::createDeviceLocalBuffer(
+        edges.data(), sizeof(EdgeInstance) * edges.size(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+        m_edgeBuffer, m_edgeAllocation);
+    m_edgeCount = static_cast<uint32_t>(edges.size());
+
+    // freeGPUBuffers() waits on the latest handle
+    if (handle.value > m_uploadHandle.value) {
+        m_uploadHandle = handle;
+    }
+    return handle;
+}
+
+bool Mesh::isUploadComplete() const {
+    return BufferUtils::getUploadManager().isReady(m_uploadHandle);
 }
 
 void Mesh::freeGPUBuffers(VkDevice device) {
+    // The transfer queue may still be writing into the buffers
+    BufferUtils::getUploadManager().wait(m_uploadHandle);
+    m_uploadHandle = UploadHandle{};
+
     if (m_vertexBuffer != VK_NULL_HANDLE) {
         vkDestroyBuffer(device, m_vertexBuffer, nullptr);
         m_vertexBuffer = VK_NULL_HANDLE;
     }
-    if (m_vertexBufferMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(device, m_vertexBufferMemory, nullptr);
-        m_vertexBufferMemory = VK_NULL_HANDLE;
-    }
+    BufferUtils::getAllocator().free(m_vertexAllocation);
     if (m_indexBuffer != VK_NULL_HANDLE) {
         vkDestroyBuffer(device, m_indexBuffer, nullptr);
         m_indexBuffer = VK_NULL_HANDLE;
     }
-    if (m_indexBufferMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(device, m_indexBufferMemory, nullptr);
-        m_indexBufferMemory = VK_NULL_HANDLE;
+    BufferUtils::getAllocator().free(m_indexAllocation);
+    if (m_edgeBuffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device, m_edgeBuffer, nullptr);
+        m_edgeBuffer = VK_NULL_HANDLE;
     }
+    BufferUtils::getAllocator().free(m_edgeAllocation);
+    m_edgeCount = 0;
 
     // Reset device handle since we've cleaned up
     m_device = VK_NULL_HANDLE;
@@ -600,7 +815,7 @@ void Mesh::bind(VkCommandBuffer commandBuffer) const {
     vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
 
     if (m_indexBuffer != VK_NULL_HANDLE) {
-        vkCmdBindIndexBuffer(commandBuffer, m_indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(commandBuffer, m_indexBuffer, 0, m_indexType);
     }
 }
 
@@ -0,0 +1,321 @@
+/**
+ * @file RenderQueue.cpp
+ * @brief Implementation of the sort-keyed RenderQueue
+ */
+
+#include <vde/api/Mesh.h>
+#include <vde/api/RenderQueue.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace vde {
+
+// ============================================================================
+// RenderSortKey
+// ============================================================================
+
+uint64_t RenderSortKey::foldHandle(const void* handle, uint32_t bits) {
+    if (handle == nullptr || bits == 0) {
+        return 0;
+    }
+
+    // Mix the pointer bits so that neighbouring allocations spread across
+    // the field, then keep the top bits of the product (Fibonacci hashing).
+    uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+    value ^= value >> 33;
+    value *= 0x9E3779B97F4A7C15ull;
+    return value >> (64 - bits);
+}
+
+uint64_t RenderSortKey::makeStateSorted(RenderPassBucket bucket, const void* pipeline,
+                                        const void* material, const void* mesh,
+                                        uint32_t depth) {
+    uint64_t key = static_cast<uint64_t>(bucket) << (64 - BUCKET_BITS);
+    key |= foldHandle(pipeline, PIPELINE_BITS) << (MATERIAL_BITS + MESH_BITS + DEPTH_BITS);
+    key |= foldHandle(material, MATERIAL_BITS) << (MESH_BITS + DEPTH_BITS);
+    key |= foldHandle(mesh, MESH_BITS) << DEPTH_BITS;
+    key |= static_cast<uint64_t>(depth) & ((1ull << DEPTH_BITS) - 1);
+    return key;
+}
+
+uint64_t RenderSortKey::makeDepthSorted(RenderPassBucket bucket, uint32_t depth,
+                                        const void* pipeline, const void* material,
+                                        const void* mesh) {
+    uint64_t key = static_cast<uint64_t>(bucket) << (64 - BUCKET_BITS);
+    key |= (static_cast<uint64_t>(depth) & ((1ull << DEPTH_BITS) - 1))
+           << (PIPELINE_BITS + MATERIAL_BITS + MESH_BITS);
+    key |= foldHandle(pipeline, PIPELINE_BITS) << (MATERIAL_BITS + MESH_BITS);
+    key |= foldHandle(material, MATERIAL_BITS) << MESH_BITS;
+    key |= foldHandle(mesh, MESH_BITS);
+    return key;
+}
+
+uint64_t RenderSortKey::makeOrdered(RenderPassBucket bucket, uint32_t sequence,
+                                    const void* pipeline, const void* material) {
+    uint64_t key = static_cast<uint64_t>(bucket) << (64 - BUCKET_BITS);
+    key |= static_cast<uint64_t>(sequence) << (PIPELINE_BITS + ORDERED_MATERIAL_BITS);
+    key |= foldHandle(pipeline, PIPELINE_BITS) << ORDERED_MATERIAL_BITS;
+    key |= foldHandle(material, ORDERED_MATERIAL_BITS);
+    return key;
+}
+
+uint32_t RenderSortKey::quantizeDepth(float distance, float maxDistance, bool backToFront) {
+    constexpr uint32_t maxValue = (1u << DEPTH_BITS) - 1;
+    if (!(maxDistance > 0.0f)) {
+        return 0;
+    }
+
+    float t = std::clamp(distance / maxDistance, 0.0f, 1.0f);
+    uint32_t value = static_cast<uint32_t>(t * static_cast<float>(maxValue));
+    return backToFront ? maxValue - value : value;
+}
+
+// ============================================================================
+// RenderCommand / RenderQueueStats
+// ============================================================================
+
+bool RenderCommand::setPushConstants(VkShaderStageFlags stages, const void* data,
+                                     uint32_t size) {
+    if (size > MAX_PUSH_CONSTANT_SIZE || (size > 0 && data == nullptr)) {
+        return false;
+    }
+    pushConstantStages = stages;
+    pushConstantSize = size;
+    if (size > 0) {
+        std::memcpy(pushConstants.data(), data, size);
+    }
+    return true;
+}
+
+RenderQueueStats& RenderQueueStats::operator+=(const RenderQueueStats& other) {
+    commandsSubmitted += other.commandsSubmitted;
+    drawCalls += other.drawCalls;
+    triangles += other.triangles;
+    pipelineBinds += other.pipelineBinds;
+    pipelineBindsSkipped += other.pipelineBindsSkipped;
+    descriptorSetBinds += other.descriptorSetBinds;
+    descriptorSetBindsSkipped += other.descriptorSetBindsSkipped;
+    meshBinds += other.meshBinds;
+    meshBindsSkipped += other.meshBindsSkipped;
+    return *this;
+}
+
+// ============================================================================
+// RenderQueue
+// ============================================================================
+
+void RenderQueue::begin() {
+    m_commands.clear();
+    m_stats.reset();
+    m_sequence = 0;
+    m_recording = true;
+}
+
+void RenderQueue::submit(const RenderCommand& command) {
+    m_commands.push_back(command);
+    m_stats.commandsSubmitted++;
+}
+
+void RenderQueue::radixSort(const std::vector<uint64_t>& keys, std::vector<uint32_t>& order) {
+    const size_t count = keys.size();
+    order.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        order[i] = static_cast<uint32_t>(i);
+    }
+    if (count < 2) {
+        return;
+    }
+
+    std::vector<uint32_t> scratch(count);
+
+    // LSD radix sort, one byte per pass.  Counting sort is stable, so equal
+    // keys keep their submission order.
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+        std::array<uint32_t, 256> histogram{};
+        for (uint32_t index : order) {
+            histogram[(keys[index] >> shift) & 0xFF]++;
+        }
+
+        // Skip passes where every key shares the same byte
+        if (histogram[(keys[order[0]] >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram) {
+            uint32_t n = bucket;
+            bucket = offset;
+            offset += n;
+        }
+
+        for (uint32_t index : order) {
+            scratch[histogram[(keys[index] >> shift) & 0xFF]++] = index;
+        }
+        order.swap(scratch);
+    }
+}
+
+void RenderQueue::sort() {
+    if (m_commands.size() < 2) {
+        return;
+    }
+
+    m_keys.resize(m_commands.size());
+    for (size_t i = 0; i < m_commands.size(); ++i) {
+        m_keys[i] = m_commands[i].sortKey;
+    }
+
+    radixSort(m_keys, m_order);
+
+    std::vector<RenderCommand> sorted;
+    sorted.reserve(m_commands.size());
+    for (uint32_t index : m_order) {
+        sorted.push_back(m_commands[index]);
+    }
+    m_commands.swap(sorted);
+}
+
+void RenderQueue::end() {
+    m_recording = false;
+    sort();
+}
+
+void RenderQueue::clear() {
+    m_commands.clear();
+    m_recording = false;
+}
+
+void RenderQueue::flush(VkCommandBuffer commandBuffer, const VkViewport& viewport,
+                        const VkRect2D& scissor) {
+    end();
+    record(commandBuffer, viewport, scissor, 0, m_commands.size(), m_stats);
+    m_commands.clear();
+}
+
+void RenderQueue::record(VkCommandBuffer commandBuffer, const VkViewport& viewport,
+                         const VkRect2D& scissor, size_t first, size_t count,
+                         RenderQueueStats& stats) const {
+    if (first >= m_commands.size() || count == 0) {
+        return;
+    }
+    const size_t last = std::min(m_commands.size(), first + count);
+
+    const bool emit = commandBuffer != VK_NULL_HANDLE;
+    if (emit) {
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    }
+
+    VkPipeline boundPipeline = VK_NULL_HANDLE;
+    VkPipelineLayout boundLayout = VK_NULL_HANDLE;
+    std::array<VkDescriptorSet, RenderCommand::MAX_DESCRIPTOR_SETS> boundSets{};
+    std::array<uint32_t, RenderCommand::MAX_DESCRIPTOR_SETS> boundOffsets{};
+    const Mesh* boundMesh = nullptr;
+    VkBuffer boundInstances = VK_NULL_HANDLE;
+
+    for (size_t i = first; i < last; ++i) {
+        const RenderCommand& command = m_commands[i];
+        if (command.pipeline == VK_NULL_HANDLE || command.pipelineLayout == VK_NULL_HANDLE) {
+            continue;
+        }
+
+        // Pipeline
+        if (command.pipeline != boundPipeline) {
+            if (emit) {
+                vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                  command.pipeline);
+            }
+            boundPipeline = command.pipeline;
+            stats.pipelineBinds++;
+        } else {
+            stats.pipelineBindsSkipped++;
+        }
+
+        // A different layout may disturb previously bound sets; be conservative
+        if (command.pipelineLayout != boundLayout) {
+            boundSets.fill(VK_NULL_HANDLE);
+            boundLayout = command.pipelineLayout;
+        }
+
+        // Descriptor sets
+        uint32_t setCount =
+            std::min(command.descriptorSetCount, RenderCommand::MAX_DESCRIPTOR_SETS);
+        for (uint32_t set = 0; set < setCount; ++set) {
+            VkDescriptorSet descriptorSet = command.descriptorSets[set];
+            if (descriptorSet == VK_NULL_HANDLE) {
+                continue;
+            }
+            // A different view's slot of the same set is a rebind
+            const uint32_t offsetCount = (command.dynamicOffsetMask >> set) & 1u;
+            const uint32_t offset = offsetCount ? command.dynamicOffsets[set] : 0;
+            if (descriptorSet != boundSets[set] || offset != boundOffsets[set]) {
+                if (emit) {
+                    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                            command.pipelineLayout, set, 1, &descriptorSet,
+                                            offsetCount, &offset);
+                }
+                boundSets[set] = descriptorSet;
+                boundOffsets[set] = offset;
+                stats.descriptorSetBinds++;
+            } else {
+                stats.descriptorSetBindsSkipped++;
+            }
+        }
+
+        // Push constants are per-draw data and are always recorded
+        if (emit && command.pushConstantSize > 0) {
+            vkCmdPushConstants(commandBuffer, command.pipelineLayout,
+                               command.pushConstantStages, 0, command.pushConstantSize,
+                               command.pushConstants.data());
+        }
+
+        if (!command.mesh) {
+            continue;
+        }
+
+        // Vertex / index buffers
+        if (command.mesh != boundMesh) {
+            if (emit) {
+                command.mesh->bind(commandBuffer);
+            }
+            boundMesh = command.mesh;
+            stats.meshBinds++;
+        } else {
+            stats.meshBindsSkipped++;
+        }
+
+        // Per-instance buffer
+        if (command.instanceBuffer != VK_NULL_HANDLE && command.instanceBuffer != boundInstances) {
+            if (emit) {
+                VkDeviceSize offset = 0;
+                vkCmdBindVertexBuffers(commandBuffer, 1, 1, &command.instanceBuffer, &offset);
+            }
+            boundInstances = command.instanceBuffer;
+        }
+
+        // Draw
+        const uint32_t instances = command.instanceCount;
+        if (instances == 0) {
+            continue;
+        }
+        if (command.mesh->getIndexCount() > 0) {
+            if (emit) {
+                vkCmdDrawIndexed(commandBuffer,
+                                 static_cast<uint32_t>(command.mesh->getIndexCount()), instances,
+                                 0, 0, command.firstInstance);
+            }
+            stats.drawCalls++;
+            stats.triangles += uint64_t(command.mesh->getIndexCount() / 3) * instances;
+        } else if (command.mesh->getVertexCount() > 0) {
+            if (emit) {
+                vkCmdDraw(commandBuffer, static_cast<uint32_t>(command.mesh->getVertexCount()),
+                          instances, 0, command.firstInstance);
+            }
+            stats.drawCalls++;
+            stats.triangles += uint64_t(command.mesh->getVertexCount() / 3) * instances;
+        }
+    }
+}
+
+}  // namespace vde
@@ -3,13 +3,16 @@
  * @brief Implementation of Scene class
  */
 
+#include <vde/VulkanContext.h>
 #include <vde/api/AudioManager.h>
 #include <vde/api/Game.h>
+#include <vde/api/Mesh.h>
 #include <vde/api/PhysicsEntity.h>
 #include <vde/api/PhysicsScene.h>
 #include <vde/api/Scene.h>
 
 #include <algorithm>
+#include <cmath>
 #include <stdexcept>
 
 namespace vde {
@@ -40,12 +43,52 @@ void Scene::update(float deltaTime) {
 }
 
 void Scene::render() {
-    // Render all visible entities
+    // Visible entities submit their draws to the render queue
+    m_renderQueue.begin();
+
+    // Merged static geometry, culled per chunk.  Sorted queues order the
+    // chunks by key, so they can be submitted up front; in submission order
+    // each chunk is drawn where its earliest merged entity would have been.
+    const bool interleaveChunks = m_staticBatch.getChunkCount() > 0 &&
+                                  m_renderSortMode == RenderSortMode::Submission;
+    if (m_staticBatch.getChunkCount() > 0) {
+        glm::mat4 viewProjection(1.0f);
+        if (m_camera) {
+            viewProjection = m_camera->getCamera().getViewProjectionMatrix();
+        }
+        const glm::mat4* frustum = m_camera ? &viewProjection : nullptr;
+        if (interleaveChunks) {
+            m_staticBatch.cull(frustum);
+        } else {
+            m_staticBatch.render(frustum);
+        }
+    }
     for (auto& entity : m_entities) {
-        if (entity && entity->isVisible()) {
+        if (!entity) {
+            continue;
+        }
+        if (interleaveChunks) {
+            m_staticBatch.renderChunkLedBy(entity->getId());
+        }
+        if (entity->isVisible()) {
             entity->render();
         }
     }
+
+    // Parallel recording: Game records the sorted queue on worker threads
+    if (m_deferRenderQueueFlush) {
+        m_renderQueue.end();
+        return;
+    }
+
+    // Sort and record the queued draws
+    VulkanContext* context = m_game ? m_game->getVulkanContext() : nullptr;
+    if (!context) {
+        m_renderQueue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+        return;
+    }
+    m_renderQueue.flush(context->getCurrentCommandBuffer(), context->getEffectiveViewport(),
+                        context->getEffectiveScissor());
 }
 
 // ============================================================================
@@ -184,9 +227,116 @@ void Scene::removeEntity(EntityId id) {
 
     m_entities.pop_back();
     m_entityIndex.erase(it);
+
+    // Its geometry is baked into a chunk; rebuild without it
+    if (m_staticBatch.contains(id)) {
+        buildStaticBatches(m_staticBatch.getChunkSize());
+    }
+}
+
+size_t Scene::buildStaticBatches(float chunkSize) {
+    m_staticBatch.clear();
+
+    std::vector<std::shared_ptr<MeshEntity>> candidates;
+    for (const auto& entity : m_entities) {
+        auto meshEntity = std::dynamic_pointer_cast<MeshEntity>(entity);
+        if (meshEntity && meshEntity->isStatic() && meshEntity->isVisible() &&
+            !meshEntity->isWireframe()) {
+            candidates.push_back(std::move(meshEntity));
+        }
+    }
+    return m_staticBatch.build(candidates, this, chunkSize);
+}
+
+bool Scene::raycast(const Ray& ray, SceneRayHit& hit, float maxDistance) const {
+    float rayLength = glm::length(ray.direction);
+    if (rayLength <= 0.0f) {
+        return false;
+    }
+    const glm::vec3 direction = ray.direction / rayLength;
+
+    // Broad phase: world bounding spheres, kept with their entry distance
+    struct Candidate {
+        float entry;
+        MeshEntity* entity;
+        glm::mat4 model;
+    };
+    std::vector<Candidate> candidates;
+    for (const auto& entity : m_entities) {
+        auto* meshEntity = dynamic_cast<MeshEntity*>(entity.get());
+        if (!meshEntity || !meshEntity->isVisible() || !meshEntity->getMesh()) {
+            continue;
+        }
+        const Mesh& mesh = *meshEntity->getMesh();
+        if (mesh.getIndexCount() < 3) {
+            continue;
+        }
+
+        glm::mat4 model = meshEntity->getModelMatrix();
+        float maxScale = std::max(std::max(glm::length(glm::vec3(model[0])),
+                                           glm::length(glm::vec3(model[1]))),
+                                  glm::length(glm::vec3(model[2])));
+        glm::vec3 center = glm::vec3(model * glm::vec4(mesh.getBoundsCenter(), 1.0f));
+        float radius = mesh.getBoundingRadius() * maxScale;
+
+        glm::vec3 offset = ray.origin - center;
+        float b = glm::dot(offset, direction);
+        float discriminant = b * b - (glm::dot(offset, offset) - radius * radius);
+        if (discriminant < 0.0f) {
+            continue;
+        }
+        float root = std::sqrt(discriminant);
+        if (-b + root < 0.0f) {
+            continue;  // Sphere is behind the ray
+        }
+        float entry = std::max(0.0f, -b - root);
+        if (entry < maxDistance) {
+            candidates.push_back({entry, meshEntity, model});
+        }
+    }
+
+    // Nearest spheres first, so farther ones are skipped once something is hit
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate& a, const Candidate& b) { return a.entry < b.entry; });
+
+    float closest = maxDistance;
+    bool found = false;
+    for (const Candidate& candidate : candidates) {
+        if (candidate.entry >= closest) {
+            break;
+        }
+
+        // In local space the ray parameter still measures world distance,
+        // because the direction is transformed without renormalizing
+        glm::mat4 inverseModel = glm::inverse(candidate.model);
+        glm::vec3 localOrigin = glm::vec3(inverseModel * glm::vec4(ray.origin, 1.0f));
+        glm::vec3 localDirection = glm::vec3(inverseModel * glm::vec4(direction, 0.0f));
+
+        MeshRayHit meshHit;
+        const MeshBVH& bvh = candidate.entity->getMesh()->getBVH();
+        if (bvh.raycast(localOrigin, localDirection, meshHit, closest)) {
+            closest = meshHit.distance;
+            found = true;
+            hit.entity = candidate.entity;
+            hit.triangle = meshHit.triangle;
+            hit.distance = meshHit.distance;
+            hit.point = ray.origin + direction * meshHit.distance;
+        }
+    }
+    return found;
+}
+
+bool Scene::pick(float screenX, float screenY, float screenWidth, float screenHeight,
+                 SceneRayHit& hit) const {
+    if (!m_camera) {
+        return false;
+    }
+    return raycast(m_camera->screenToWorldRay(screenX, screenY, screenWidth, screenHeight), hit);
 }
 
 void Scene::clearEntities() {
+    m_staticBatch.clear();
+
     // Notify all entities
     for (auto& entity : m_entities) {
         if (entity) {
@@ -0,0 +1,206 @@
+/**
+ * @file StaticBatch.cpp
+ * @brief Implementation of StaticBatch
+ */
+
+#include <vde/api/Entity.h>
+#include <vde/api/Material.h>
+#include <vde/api/Mesh.h>
+#include <vde/api/StaticBatch.h>
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <tuple>
+
+namespace vde {
+
+namespace {
+
+// Entities share a chunk when they match in material (or color) and cell
+struct ChunkKey {
+    std::shared_ptr<Material> material;
+    std::tuple<float, float, float, float> color;
+    std::tuple<int64_t, int64_t, int64_t> cell;
+
+    bool operator<(const ChunkKey& other) const {
+        return std::tie(material, color, cell) <
+               std::tie(other.material, other.color, other.cell);
+    }
+};
+
+struct ChunkBuilder {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<EntityId> sources;
+    Color color;
+};
+
+// mesh.frag shades with the vertex color when the albedo is (near) black.
+// Baking rotates that color as a normal, so such entities must stay unbatched.
+bool usesVertexColorAlbedo(const MeshEntity& entity) {
+    const std::shared_ptr<Material>& material = entity.getMaterial();
+    const Color& albedo = material ? material->getAlbedo() : entity.getColor();
+    return glm::length(glm::vec3(albedo.r, albedo.g, albedo.b)) < 0.01f;
+}
+
+}  // namespace
+
+StaticBatch::~StaticBatch() {
+    clear();
+}
+
+size_t StaticBatch::build(const std::vector<std::shared_ptr<MeshEntity>>& entities, Scene* scene,
+                          float chunkSize) {
+    clear();
+    m_chunkSize = chunkSize > 0.0f ? chunkSize : DEFAULT_CHUNK_SIZE;
+
+    std::map<ChunkKey, ChunkBuilder> builders;
+    for (const auto& entity : entities) {
+        std::shared_ptr<Mesh> mesh = entity ? entity->getMesh() : nullptr;
+        if (!mesh || mesh->getVertexCount() == 0 || usesVertexColorAlbedo(*entity)) {
+            continue;
+        }
+
+        glm::mat4 model = entity->getModelMatrix();
+        glm::mat3 normalMatrix = glm::mat3(model);
+        glm::vec3 center = glm::vec3(model * glm::vec4(mesh->getBoundsCenter(), 1.0f));
+
+        ChunkKey key;
+        key.material = entity->getMaterial();
+        if (!key.material) {
+            const Color& c = entity->getColor();
+            key.color = {c.r, c.g, c.b, c.a};
+        }
+        key.cell = {static_cast<int64_t>(std::floor(center.x / m_chunkSize)),
+                    static_cast<int64_t>(std::floor(center.y / m_chunkSize)),
+                    static_cast<int64_t>(std::floor(center.z / m_chunkSize))};
+
+        ChunkBuilder& builder = builders[key];
+        builder.color = entity->getColor();
+        builder.sources.push_back(entity->getId());
+
+        // Bake the transform; the color doubles as the normal, so rotate it as
+        // the mesh shader would (it normalizes after transforming)
+        auto base = static_cast<uint32_t>(builder.vertices.size());
+        for (const Vertex& vertex : mesh->getVertices()) {
+            Vertex baked = vertex;
+            baked.position = glm::vec3(model * glm::vec4(vertex.position, 1.0f));
+            baked.color = normalMatrix * vertex.color;
+            builder.vertices.push_back(baked);
+        }
+
+        // Mirroring transforms flip the winding; undo it so culling still works
+        bool mirrored = glm::determinant(normalMatrix) < 0.0f;
+        const std::vector<uint32_t>& indices = mesh->getIndices();
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            builder.indices.push_back(base + indices[i]);
+            builder.indices.push_back(base + indices[mirrored ? i + 2 : i + 1]);
+            builder.indices.push_back(base + indices[mirrored ? i + 1 : i + 2]);
+        }
+
+        entity->m_staticBatched = true;
+        m_sources.insert(entity->getId());
+        m_sourceEntities.push_back(entity);
+    }
+
+    m_chunks.reserve(builders.size());
+    for (auto& [key, builder] : builders) {
+        auto mesh = std::make_shared<Mesh>();
+        mesh->setData(builder.vertices, builder.indices);
+        mesh->optimize();
+
+        Chunk chunk;
+        chunk.entity = std::make_shared<MeshEntity>();
+        chunk.entity->setMesh(mesh);
+        chunk.entity->setMaterial(key.material);
+        chunk.entity->setColor(builder.color);
+        chunk.entity->setLODEnabled(false);
+        chunk.entity->setName("StaticBatchChunk");
+        if (scene) {
+            chunk.entity->onAttach(scene);
+        }
+        chunk.boundsMin = mesh->getBoundsMin();
+        chunk.boundsMax = mesh->getBoundsMax();
+        chunk.sources = std::move(builder.sources);
+        m_chunkByLeader[chunk.sources.front()] = m_chunks.size();
+        m_chunks.push_back(std::move(chunk));
+    }
+    return m_chunks.size();
+}
+
+void StaticBatch::clear() {
+    for (const auto& weak : m_sourceEntities) {
+        if (auto entity = weak.lock()) {
+            entity->m_staticBatched = false;
+        }
+    }
+    for (Chunk& chunk : m_chunks) {
+        chunk.entity->onDetach();
+    }
+    m_chunks.clear();
+    m_sources.clear();
+    m_chunkByLeader.clear();
+    m_sourceEntities.clear();
+    m_visibleChunks = 0;
+}
+
+void StaticBatch::cull(const glm::mat4* viewProjection) {
+    m_visibleChunks = 0;
+    for (Chunk& chunk : m_chunks) {
+        chunk.visible = !viewProjection ||
+                        intersectsFrustum(*viewProjection, chunk.boundsMin, chunk.boundsMax);
+        if (chunk.visible) {
+            m_visibleChunks++;
+        }
+    }
+}
+
+void StaticBatch::render(const glm::mat4* viewProjection) {
+    cull(viewProjection);
+    for (Chunk& chunk : m_chunks) {
+        if (chunk.visible) {
+            chunk.entity->render();
+        }
+    }
+}
+
+bool StaticBatch::renderChunkLedBy(EntityId id) {
+    auto it = m_chunkByLeader.find(id);
+    if (it == m_chunkByLeader.end() || !m_chunks[it->second].visible) {
+        return false;
+    }
+    m_chunks[it->second].entity->render();
+    return true;
+}
+
+const StaticBatch::Chunk* StaticBatch::findChunkLedBy(EntityId id) const {
+    auto it = m_chunkByLeader.find(id);
+    return it != m_chunkByLeader.end() ? &m_chunks[it->second] : nullptr;
+}
+
+bool StaticBatch::intersectsFrustum(const glm::mat4& viewProjection, const glm::vec3& boundsMin,
+                                    const glm::vec3& boundsMax) {
+    // Gribb-Hartmann planes from the matrix rows (column-major storage).  The
+    // near plane uses the -w <= z convention, which is looser than Vulkan's
+    // 0 <= z and therefore still conservative.
+    auto row = [&viewProjection](int r) {
+        return glm::vec4(viewProjection[0][r], viewProjection[1][r], viewProjection[2][r],
+                         viewProjection[3][r]);
+    };
+    glm::vec4 planes[6] = {row(3) + row(0), row(3) - row(0), row(3) + row(1),
+                           row(3) - row(1), row(3) + row(2), row(3) - row(2)};
+
+    for (const glm::vec4& plane : planes) {
+        // Corner furthest along the plane normal
+        glm::vec3 positive(plane.x >= 0.0f ? boundsMax.x : boundsMin.x,
+                           plane.y >= 0.0f ? boundsMax.y : boundsMin.y,
+                           plane.z >= 0.0f ? boundsMax.z : boundsMin.z);
+        if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace vde
@@ -5,6 +5,9 @@
 
 #include <vde/api/ThreadPool.h>
 
+#include <algorithm>
+#include <exception>
+
 namespace vde {
 
 ThreadPool::ThreadPool(size_t threadCount) : m_threadCount(threadCount) {
@@ -73,6 +76,45 @@ std::vector<std::thread::id> ThreadPool::getWorkerThreadIds() const {
     return ids;
 }
 
+void ThreadPool::parallelFor(ThreadPool* workers, size_t taskCount,
+                             const std::function<void(size_t)>& task) {
+    if (taskCount == 0) {
+        return;
+    }
+    if (taskCount == 1) {
+        task(0);
+        return;
+    }
+
+    std::unique_ptr<ThreadPool> ownedPool;
+    if (workers == nullptr) {
+        size_t threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        ownedPool = std::make_unique<ThreadPool>(std::min(threads, taskCount));
+        workers = ownedPool.get();
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(taskCount);
+    for (size_t i = 0; i < taskCount; ++i) {
+        futures.push_back(workers->submit([&task, i]() { task(i); }));
+    }
+
+    // Wait for every task before rethrowing so none outlives the caller's task
+    std::exception_ptr error;
+    for (auto& future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 void ThreadPool::workerLoop() {
     while (true) {
         std::packaged_task<void()> task;
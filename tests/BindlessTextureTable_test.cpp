@@ -0,0 +1,115 @@
+/**
+ * @file BindlessTextureTable_test.cpp
+ * @brief Unit tests for bindless texture slot management (GPU-free)
+ */
+
+#include <vde/BindlessTextureTable.h>
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+namespace vde {
+namespace test {
+
+class BindlessSlotAllocatorTest : public ::testing::Test {
+  protected:
+    BindlessSlotAllocator slots{8, 2};
+};
+
+TEST_F(BindlessSlotAllocatorTest, AllocatesSequentialSlots) {
+    EXPECT_EQ(slots.allocate(), 0u);
+    EXPECT_EQ(slots.allocate(), 1u);
+    EXPECT_EQ(slots.allocate(), 2u);
+    EXPECT_EQ(slots.getUsedCount(), 3u);
+    EXPECT_EQ(slots.getHighWaterMark(), 3u);
+}
+
+TEST_F(BindlessSlotAllocatorTest, ReturnsInvalidWhenFull) {
+    std::set<uint32_t> taken;
+    for (int i = 0; i < 8; ++i) {
+        taken.insert(slots.allocate());
+    }
+    EXPECT_EQ(taken.size(), 8u);
+    EXPECT_EQ(slots.allocate(), BindlessSlotAllocator::INVALID_SLOT);
+}
+
+TEST_F(BindlessSlotAllocatorTest, ReleasedSlotWaitsForRetireFrames) {
+    for (int i = 0; i < 8; ++i) {
+        slots.allocate();
+    }
+    slots.release(3);
+    EXPECT_EQ(slots.getUsedCount(), 7u);
+
+    // Still referenced by frames in flight
+    EXPECT_EQ(slots.allocate(), BindlessSlotAllocator::INVALID_SLOT);
+    slots.nextFrame();
+    EXPECT_EQ(slots.allocate(), BindlessSlotAllocator::INVALID_SLOT);
+    slots.nextFrame();
+    EXPECT_EQ(slots.allocate(), 3u);
+}
+
+TEST_F(BindlessSlotAllocatorTest, ReusesRetiredSlotBeforeNewOnes) {
+    uint32_t first = slots.allocate();
+    slots.allocate();
+    slots.release(first);
+    slots.nextFrame();
+    slots.nextFrame();
+    EXPECT_EQ(slots.allocate(), first);
+    EXPECT_EQ(slots.getHighWaterMark(), 2u);
+}
+
+TEST_F(BindlessSlotAllocatorTest, ZeroRetireFramesRecyclesImmediately) {
+    BindlessSlotAllocator immediate(4, 0);
+    uint32_t slot = immediate.allocate();
+    immediate.release(slot);
+    EXPECT_EQ(immediate.allocate(), slot);
+}
+
+TEST_F(BindlessSlotAllocatorTest, IgnoresUnknownSlots) {
+    slots.allocate();
+    EXPECT_FALSE(slots.release(5));
+    EXPECT_FALSE(slots.release(BindlessSlotAllocator::INVALID_SLOT));
+    EXPECT_EQ(slots.getUsedCount(), 1u);
+}
+
+TEST_F(BindlessSlotAllocatorTest, RejectsDoubleRelease) {
+    BindlessSlotAllocator immediate(4, 0);
+    uint32_t first = immediate.allocate();
+    uint32_t second = immediate.allocate();
+    EXPECT_TRUE(immediate.release(first));
+    EXPECT_FALSE(immediate.release(first));
+    EXPECT_EQ(immediate.getUsedCount(), 1u);
+
+    // The slot is handed out once, then fresh slots follow
+    EXPECT_EQ(immediate.allocate(), first);
+    uint32_t third = immediate.allocate();
+    EXPECT_NE(third, first);
+    EXPECT_NE(third, second);
+
+    // Retiring slots are not allocated either
+    EXPECT_TRUE(slots.release(slots.allocate()));
+    EXPECT_FALSE(slots.release(0));
+}
+
+TEST_F(BindlessSlotAllocatorTest, ResetForgetsEverything) {
+    slots.allocate();
+    slots.allocate();
+    slots.reset(2, 1);
+    EXPECT_EQ(slots.getCapacity(), 2u);
+    EXPECT_EQ(slots.getUsedCount(), 0u);
+    EXPECT_EQ(slots.allocate(), 0u);
+}
+
+TEST(BindlessTextureTableTest, UninitializedTableIsInert) {
+    BindlessTextureTable table;
+    EXPECT_FALSE(table.isInitialized());
+    EXPECT_EQ(table.getCapacity(), 0u);
+    EXPECT_EQ(table.add(VK_NULL_HANDLE, VK_NULL_HANDLE), BindlessTextureTable::INVALID_INDEX);
+    table.remove(0);
+    table.nextFrame();
+    EXPECT_EQ(table.getTextureCount(), 0u);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -136,5 +136,42 @@ TEST_F(CameraTest, AspectRatioAffectsProjection) {
     EXPECT_NE(proj16x9[0][0], proj4x3[0][0]);
 }
 
+TEST_F(CameraTest, VersionChangesOnlyWhenValuesChange) {
+    uint64_t version = camera.getVersion();
+    EXPECT_NE(version, 0u);
+
+    // Re-setting the current values (as GameCamera::applyTo does every frame)
+    camera.setPosition(camera.getPosition());
+    camera.setTarget(camera.getTarget());
+    camera.setUp(camera.getUp());
+    camera.setPerspective(camera.getFOV(), camera.getAspectRatio(), camera.getNearPlane(),
+                          camera.getFarPlane());
+    camera.translate(glm::vec3(0.0f));
+    EXPECT_EQ(camera.getVersion(), version);
+
+    camera.setPosition(camera.getPosition() + glm::vec3(1.0f, 0.0f, 0.0f));
+    EXPECT_GT(camera.getVersion(), version);
+    version = camera.getVersion();
+
+    camera.setAspectRatio(camera.getAspectRatio() * 2.0f);
+    EXPECT_GT(camera.getVersion(), version);
+    version = camera.getVersion();
+
+    camera.setOrthographic(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 10.0f);
+    EXPECT_GT(camera.getVersion(), version);
+    version = camera.getVersion();
+    camera.setOrthographic(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 10.0f);
+    EXPECT_EQ(camera.getVersion(), version);
+}
+
+TEST_F(CameraTest, VersionsAreUniqueAcrossCameras) {
+    Camera other;
+    EXPECT_NE(other.getVersion(), camera.getVersion());
+
+    camera.zoom(1.0f);
+    other.zoom(1.0f);
+    EXPECT_NE(other.getVersion(), camera.getVersion());
+}
+
 }  // namespace test
 }  // namespace vde
@@ -245,3 +245,57 @@ TEST_F(MeshEntityTest, InheritsFromEntity) {
     meshEntity->setPosition(10.0f, 20.0f, 30.0f);
     EXPECT_FLOAT_EQ(meshEntity->getPosition().x, 10.0f);
 }
+
+TEST_F(MeshEntityTest, LODDefaults) {
+    EXPECT_TRUE(meshEntity->isLODEnabled());
+    EXPECT_FLOAT_EQ(meshEntity->getLODThreshold(), MeshEntity::DEFAULT_LOD_THRESHOLD);
+    EXPECT_EQ(meshEntity->getCurrentLOD(), 0u);
+    EXPECT_EQ(meshEntity->getRenderedTriangleCount(), 0u);
+}
+
+TEST_F(MeshEntityTest, ScreenSizeShrinksWithDistance) {
+    float nearSize = MeshEntity::computeScreenSize(1.0f, 10.0f, 90.0f);
+    float farSize = MeshEntity::computeScreenSize(1.0f, 20.0f, 90.0f);
+    EXPECT_NEAR(nearSize, 0.1f, 1e-5f);
+    EXPECT_NEAR(farSize, nearSize * 0.5f, 1e-5f);
+
+    // Camera inside the sphere: always full detail
+    EXPECT_GT(MeshEntity::computeScreenSize(1.0f, 0.5f, 90.0f), 1.0f);
+}
+
+TEST_F(MeshEntityTest, SelectLODHalvesThresholdPerLevel) {
+    // Thresholds 0.25, 0.125, 0.0625 with no hysteresis
+    EXPECT_EQ(MeshEntity::selectLOD(0.5f, 0, 4, 0.25f, 0.0f), 0u);
+    EXPECT_EQ(MeshEntity::selectLOD(0.2f, 0, 4, 0.25f, 0.0f), 1u);
+    EXPECT_EQ(MeshEntity::selectLOD(0.1f, 0, 4, 0.25f, 0.0f), 2u);
+    EXPECT_EQ(MeshEntity::selectLOD(0.01f, 0, 4, 0.25f, 0.0f), 3u);
+
+    // Never beyond the last level, and a single level is always 0
+    EXPECT_EQ(MeshEntity::selectLOD(0.0001f, 0, 2, 0.25f, 0.0f), 1u);
+    EXPECT_EQ(MeshEntity::selectLOD(0.0001f, 0, 1, 0.25f, 0.0f), 0u);
+}
+
+TEST_F(MeshEntityTest, SelectLODHysteresisPreventsPopping) {
+    // Just below the boundary: stay on LOD 0 until 10% past it
+    EXPECT_EQ(MeshEntity::selectLOD(0.24f, 0, 4, 0.25f, 0.1f), 0u);
+    EXPECT_EQ(MeshEntity::selectLOD(0.22f, 0, 4, 0.25f, 0.1f), 1u);
+
+    // Just above the boundary: LOD 1 is kept until 10% past it
+    EXPECT_EQ(MeshEntity::selectLOD(0.26f, 1, 4, 0.25f, 0.1f), 1u);
+    EXPECT_EQ(MeshEntity::selectLOD(0.28f, 1, 4, 0.25f, 0.1f), 0u);
+
+    // Large jumps still move several levels at once
+    EXPECT_EQ(MeshEntity::selectLOD(0.01f, 0, 4, 0.25f, 0.1f), 3u);
+    EXPECT_EQ(MeshEntity::selectLOD(1.0f, 3, 4, 0.25f, 0.1f), 0u);
+}
+
+TEST_F(MeshEntityTest, WireframeDefaults) {
+    EXPECT_FALSE(meshEntity->isWireframe());
+    EXPECT_FLOAT_EQ(meshEntity->getWireframeThickness(),
+                    MeshEntity::DEFAULT_WIREFRAME_THICKNESS);
+
+    meshEntity->setWireframe(true);
+    meshEntity->setWireframeThickness(0.05f);
+    EXPECT_TRUE(meshEntity->isWireframe());
+    EXPECT_FLOAT_EQ(meshEntity->getWireframeThickness(), 0.05f);
+}
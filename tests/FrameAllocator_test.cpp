@@ -0,0 +1,80 @@
+/**
+ * @file FrameAllocator_test.cpp
+ * @brief Unit tests for the linear range allocator behind FrameAllocator
+ *
+ * LinearAllocator only manages offsets, so these tests run without a GPU.
+ */
+
+#include <vde/FrameAllocator.h>
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+namespace vde {
+namespace test {
+
+class LinearAllocatorTest : public ::testing::Test {
+  protected:
+    static constexpr uint64_t kCapacity = 4096;
+
+    LinearAllocator m_allocator{kCapacity};
+};
+
+TEST_F(LinearAllocatorTest, AllocationsAreSequentialAndAligned) {
+    EXPECT_EQ(m_allocator.allocate(100, 256), 0u);
+    EXPECT_EQ(m_allocator.allocate(16, 256), 256u);
+    EXPECT_EQ(m_allocator.allocate(4, 4), 272u);
+    EXPECT_EQ(m_allocator.allocate(64, 64), 320u);
+    EXPECT_EQ(m_allocator.getUsedBytes(), 384u);
+}
+
+TEST_F(LinearAllocatorTest, ZeroAlignmentMeansUnaligned) {
+    EXPECT_EQ(m_allocator.allocate(3, 0), 0u);
+    EXPECT_EQ(m_allocator.allocate(5, 0), 3u);
+}
+
+TEST_F(LinearAllocatorTest, OverflowFailsWithoutConsumingSpace) {
+    EXPECT_EQ(m_allocator.allocate(4000, 16), 0u);
+    EXPECT_EQ(m_allocator.allocate(256, 16), LinearAllocator::INVALID_OFFSET);
+    EXPECT_EQ(m_allocator.getFailedCount(), 1u);
+    EXPECT_EQ(m_allocator.getUsedBytes(), 4000u);
+
+    // A smaller request still fits in the tail
+    EXPECT_EQ(m_allocator.allocate(96, 16), 4000u);
+    EXPECT_EQ(m_allocator.getUsedBytes(), kCapacity);
+}
+
+TEST_F(LinearAllocatorTest, ResetRecyclesEverything) {
+    m_allocator.allocate(1000, 16);
+    m_allocator.allocate(5000, 16);
+    m_allocator.reset();
+
+    EXPECT_EQ(m_allocator.getUsedBytes(), 0u);
+    EXPECT_EQ(m_allocator.getRequestedBytes(), 0u);
+    EXPECT_EQ(m_allocator.getFailedCount(), 0u);
+    EXPECT_EQ(m_allocator.allocate(16, 16), 0u);
+}
+
+TEST_F(LinearAllocatorTest, HighWaterMarkIncludesFailedRequests) {
+    m_allocator.allocate(3000, 256);
+    m_allocator.allocate(2000, 256);  // Does not fit
+    EXPECT_EQ(m_allocator.getRequestedBytes(), 5072u);
+    EXPECT_EQ(m_allocator.getHighWaterMark(), 5072u);
+
+    // A lighter frame does not lower the mark
+    m_allocator.reset();
+    m_allocator.allocate(512, 256);
+    EXPECT_EQ(m_allocator.getHighWaterMark(), 5072u);
+}
+
+TEST(FrameAllocatorTest, UncreatedAllocatorReturnsInvalidAllocations) {
+    FrameAllocator allocator;
+    EXPECT_FALSE(allocator.isCreated());
+    EXPECT_FALSE(allocator.allocateUniform(64).isValid());
+    EXPECT_EQ(allocator.getBuffer(0), VK_NULL_HANDLE);
+    EXPECT_EQ(allocator.getHighWaterMark(), 0u);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,108 @@
+/**
+ * @file FrameContext_test.cpp
+ * @brief Unit tests for FramePacer frame slot and timeline tracking
+ *
+ * FramePacer only tracks values, so these tests run without a GPU.
+ */
+
+#include <vde/FrameContext.h>
+
+#include <gtest/gtest.h>
+
+namespace vde {
+namespace test {
+
+TEST(FramePacerTest, FrameCountIsClamped) {
+    EXPECT_EQ(FramePacer(0).getFramesInFlight(), MIN_FRAMES_IN_FLIGHT);
+    EXPECT_EQ(FramePacer(1).getFramesInFlight(), MIN_FRAMES_IN_FLIGHT);
+    EXPECT_EQ(FramePacer(3).getFramesInFlight(), 3u);
+    EXPECT_EQ(FramePacer(8).getFramesInFlight(), MAX_FRAMES_IN_FLIGHT);
+    EXPECT_EQ(FramePacer().getFramesInFlight(), DEFAULT_FRAMES_IN_FLIGHT);
+}
+
+TEST(FramePacerTest, FreshSlotsNeedNoWait) {
+    FramePacer pacer(3);
+    for (uint32_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(pacer.getCurrentSlot(), i);
+        EXPECT_EQ(pacer.getWaitValue(), 0u);
+        pacer.submit();
+        pacer.advance();
+    }
+    EXPECT_EQ(pacer.getCurrentSlot(), 0u);
+}
+
+TEST(FramePacerTest, SlotWaitsForItsPreviousSubmission) {
+    // Double buffering: frame N waits for frame N - 2
+    FramePacer pacer(2);
+    EXPECT_EQ(pacer.submit(), 1u);
+    pacer.advance();
+    EXPECT_EQ(pacer.submit(), 2u);
+    pacer.advance();
+
+    EXPECT_EQ(pacer.getCurrentSlot(), 0u);
+    EXPECT_EQ(pacer.getWaitValue(), 1u);
+    EXPECT_EQ(pacer.submit(), 3u);
+    pacer.advance();
+    EXPECT_EQ(pacer.getWaitValue(), 2u);
+}
+
+TEST(FramePacerTest, TripleBufferingRunsFurtherAhead) {
+    // Frame N waits for frame N - 3
+    FramePacer pacer(3);
+    for (int i = 0; i < 5; ++i) {
+        pacer.submit();
+        pacer.advance();
+    }
+    EXPECT_EQ(pacer.getSubmittedValue(), 5u);
+    EXPECT_EQ(pacer.getCurrentSlot(), 2u);
+    EXPECT_EQ(pacer.getWaitValue(), 3u);
+    EXPECT_EQ(pacer.getSlotValue(0), 4u);
+    EXPECT_EQ(pacer.getSlotValue(1), 5u);
+}
+
+TEST(FramePacerTest, SkippedSubmissionKeepsSlotValue) {
+    // A frame that acquires no image submits nothing and stays on its slot
+    FramePacer pacer(2);
+    pacer.submit();
+    pacer.advance();
+    EXPECT_EQ(pacer.getWaitValue(), 0u);
+    EXPECT_EQ(pacer.getCurrentSlot(), 1u);
+
+    EXPECT_EQ(pacer.submit(), 2u);
+    EXPECT_EQ(pacer.getSlotValue(1), 2u);
+}
+
+TEST(FramePacerTest, ResetForgetsSubmissions) {
+    FramePacer pacer(2);
+    pacer.submit();
+    pacer.advance();
+    pacer.reset(3);
+    EXPECT_EQ(pacer.getFramesInFlight(), 3u);
+    EXPECT_EQ(pacer.getCurrentSlot(), 0u);
+    EXPECT_EQ(pacer.getSubmittedValue(), 0u);
+    EXPECT_EQ(pacer.getWaitValue(), 0u);
+}
+
+TEST(FrameUploadStatsTest, TotalsAndReset) {
+    FrameUploadStats stats;
+    stats.cameraBytes = 192;
+    stats.cameraSlotsWritten = 1;
+    stats.cameraSlotsSkipped = 2;
+    stats.lightingBytes = 1000;
+    stats.lightingRebuilds = 1;
+    stats.lightingSlotsSkipped = 3;
+    EXPECT_EQ(stats.getTotalBytes(), 1192u);
+    stats.drawBytes = 256;
+    stats.drawsDropped = 4;
+    EXPECT_EQ(stats.getTotalBytes(), 1448u);
+
+    stats.reset();
+    EXPECT_EQ(stats.getTotalBytes(), 0u);
+    EXPECT_EQ(stats.cameraSlotsSkipped, 0u);
+    EXPECT_EQ(stats.lightingRebuilds, 0u);
+    EXPECT_EQ(stats.lightingSlotsSkipped, 0u);
+    EXPECT_EQ(stats.drawsDropped, 0u);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -236,6 +236,19 @@ TEST_F(OrbitCameraTest, GetViewMatrix) {
     EXPECT_TRUE(hasNonZero);
 }
 
+TEST_F(OrbitCameraTest, VersionFollowsChanges) {
+    uint64_t version = camera->getVersion();
+    camera->setDistance(camera->getDistance());
+    EXPECT_EQ(camera->getVersion(), version);
+
+    camera->rotate(5.0f, 0.0f);
+    EXPECT_GT(camera->getVersion(), version);
+    version = camera->getVersion();
+
+    camera->setAspectRatio(camera->getAspectRatio() * 0.5f);
+    EXPECT_GT(camera->getVersion(), version);
+}
+
 // ============================================================================
 // Camera2D Tests
 // ============================================================================
@@ -0,0 +1,166 @@
+/**
+ * @file GpuAllocator_test.cpp
+ * @brief Unit tests for the TLSF range allocator behind GpuAllocator
+ *
+ * TlsfAllocator only manages offsets, so these tests run without a GPU.
+ */
+
+#include <vde/GpuAllocator.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace vde {
+namespace test {
+
+class TlsfAllocatorTest : public ::testing::Test {
+  protected:
+    static constexpr uint64_t kCapacity = 1024 * 1024;
+
+    TlsfAllocator m_allocator{kCapacity};
+};
+
+TEST_F(TlsfAllocatorTest, StartsEmpty) {
+    EXPECT_EQ(m_allocator.getCapacity(), kCapacity);
+    EXPECT_EQ(m_allocator.getUsedBytes(), 0u);
+    EXPECT_TRUE(m_allocator.isEmpty());
+    EXPECT_EQ(m_allocator.getFreeRegionCount(), 1u);
+    EXPECT_EQ(m_allocator.getLargestFreeRegion(), kCapacity);
+}
+
+TEST_F(TlsfAllocatorTest, SizesRoundUpToMinAlignment) {
+    uint64_t offset = 0;
+    uint32_t handle = m_allocator.allocate(1, 1, offset);
+    ASSERT_NE(handle, TlsfAllocator::INVALID_HANDLE);
+    EXPECT_EQ(offset % TlsfAllocator::MIN_ALIGNMENT, 0u);
+    EXPECT_EQ(m_allocator.getAllocationSize(handle), TlsfAllocator::MIN_ALIGNMENT);
+    EXPECT_EQ(m_allocator.getUsedBytes(), TlsfAllocator::MIN_ALIGNMENT);
+}
+
+TEST_F(TlsfAllocatorTest, HonoursLargeAlignment) {
+    uint64_t offset = 0;
+    ASSERT_NE(m_allocator.allocate(48, 16, offset), TlsfAllocator::INVALID_HANDLE);
+
+    uint32_t handle = m_allocator.allocate(256, 4096, offset);
+    ASSERT_NE(handle, TlsfAllocator::INVALID_HANDLE);
+    EXPECT_EQ(offset % 4096, 0u);
+
+    // The padding in front of the aligned range stays usable
+    uint64_t paddingOffset = 0;
+    ASSERT_NE(m_allocator.allocate(64, 16, paddingOffset), TlsfAllocator::INVALID_HANDLE);
+    EXPECT_LT(paddingOffset, offset);
+}
+
+TEST_F(TlsfAllocatorTest, RejectsInvalidRequests) {
+    uint64_t offset = 0;
+    EXPECT_EQ(m_allocator.allocate(0, 16, offset), TlsfAllocator::INVALID_HANDLE);
+    EXPECT_EQ(m_allocator.allocate(64, 48, offset), TlsfAllocator::INVALID_HANDLE);
+    EXPECT_EQ(m_allocator.allocate(kCapacity + 16, 16, offset), TlsfAllocator::INVALID_HANDLE);
+}
+
+TEST_F(TlsfAllocatorTest, WholeCapacityFitsExactly) {
+    uint64_t offset = 1;
+    uint32_t handle = m_allocator.allocate(kCapacity, 16, offset);
+    ASSERT_NE(handle, TlsfAllocator::INVALID_HANDLE);
+    EXPECT_EQ(offset, 0u);
+    EXPECT_EQ(m_allocator.getFreeBytes(), 0u);
+    EXPECT_EQ(m_allocator.allocate(16, 16, offset), TlsfAllocator::INVALID_HANDLE);
+
+    m_allocator.free(handle);
+    EXPECT_TRUE(m_allocator.isEmpty());
+}
+
+TEST_F(TlsfAllocatorTest, FreeMergesNeighbours) {
+    uint64_t offset = 0;
+    uint32_t a = m_allocator.allocate(1024, 16, offset);
+    uint32_t b = m_allocator.allocate(1024, 16, offset);
+    uint32_t c = m_allocator.allocate(1024, 16, offset);
+    ASSERT_NE(c, TlsfAllocator::INVALID_HANDLE);
+
+    // Freeing a and c leaves two holes plus the tail
+    m_allocator.free(a);
+    m_allocator.free(c);
+    EXPECT_EQ(m_allocator.getFreeRegionCount(), 2u);
+
+    // Freeing b joins everything back into a single region
+    m_allocator.free(b);
+    EXPECT_EQ(m_allocator.getFreeRegionCount(), 1u);
+    EXPECT_EQ(m_allocator.getLargestFreeRegion(), kCapacity);
+}
+
+TEST_F(TlsfAllocatorTest, DoubleFreeIsIgnored) {
+    uint64_t offset = 0;
+    uint32_t handle = m_allocator.allocate(512, 16, offset);
+    m_allocator.free(handle);
+    m_allocator.free(handle);
+    m_allocator.free(12345);
+    EXPECT_TRUE(m_allocator.isEmpty());
+    EXPECT_EQ(m_allocator.getUsedBytes(), 0u);
+}
+
+TEST_F(TlsfAllocatorTest, RandomWorkloadNeverOverlaps) {
+    std::mt19937 rng(42);
+    std::vector<std::pair<uint32_t, std::pair<uint64_t, uint64_t>>> live;
+
+    for (int i = 0; i < 4000; ++i) {
+        if (live.empty() || rng() % 3 != 0) {
+            uint64_t size = 1 + rng() % 8192;
+            uint64_t alignment = 1ull << (rng() % 9);
+            uint64_t offset = 0;
+            uint32_t handle = m_allocator.allocate(size, alignment, offset);
+            if (handle == TlsfAllocator::INVALID_HANDLE) {
+                continue;
+            }
+            uint64_t actual = m_allocator.getAllocationSize(handle);
+            ASSERT_EQ(offset % std::max<uint64_t>(alignment, TlsfAllocator::MIN_ALIGNMENT), 0u);
+            ASSERT_GE(actual, size);
+            ASSERT_LE(offset + actual, kCapacity);
+            for (const auto& other : live) {
+                uint64_t otherOffset = other.second.first;
+                uint64_t otherSize = other.second.second;
+                ASSERT_TRUE(offset + actual <= otherOffset || otherOffset + otherSize <= offset);
+            }
+            live.push_back({handle, {offset, actual}});
+        } else {
+            size_t index = rng() % live.size();
+            m_allocator.free(live[index].first);
+            live[index] = live.back();
+            live.pop_back();
+        }
+    }
+
+    uint64_t used = 0;
+    for (const auto& entry : live) {
+        used += entry.second.second;
+    }
+    EXPECT_EQ(m_allocator.getUsedBytes(), used);
+    EXPECT_EQ(m_allocator.getAllocationCount(), live.size());
+
+    for (const auto& entry : live) {
+        m_allocator.free(entry.first);
+    }
+    EXPECT_TRUE(m_allocator.isEmpty());
+    EXPECT_EQ(m_allocator.getLargestFreeRegion(), kCapacity);
+}
+
+TEST(GpuMemoryStatsTest, FragmentationReflectsLargestFreeRegion) {
+    GpuMemoryStats stats;
+    EXPECT_FLOAT_EQ(stats.getFragmentation(), 0.0f);
+
+    stats.blockCount = 1;
+    stats.reservedBytes = 1000;
+    stats.usedBytes = 600;
+    stats.largestFreeRegion = 400;
+    EXPECT_FLOAT_EQ(stats.getFragmentation(), 0.0f);
+
+    stats.largestFreeRegion = 100;
+    EXPECT_FLOAT_EQ(stats.getFragmentation(), 0.75f);
+}
+
+}  // namespace test
+}  // namespace vde
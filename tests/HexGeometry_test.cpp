@@ -4,8 +4,11 @@
  */
 
 #include <vde/HexGeometry.h>
+#include <vde/api/ThreadPool.h>
 
 #include <cmath>
+#include <set>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -110,5 +113,86 @@ TEST_F(HexGeometryTest, VerticesHaveUVCoordinates) {
     }
 }
 
+TEST_F(HexGeometryTest, CornerTablesMatchTrigonometry) {
+    const float pi = 3.14159265358979f;
+    for (HexOrientation orientation : {HexOrientation::FlatTop, HexOrientation::PointyTop}) {
+        HexGeometry geometry(2.0f, orientation);
+        float startAngle = orientation == HexOrientation::FlatTop ? 0.0f : pi / 6.0f;
+        auto corners = geometry.getCornerPositions(glm::vec3(1.0f, 3.0f, -1.0f));
+        for (int i = 0; i < 6; i++) {
+            float angle = startAngle + i * (pi / 3.0f);
+            EXPECT_NEAR(corners[i].x, 1.0f + 2.0f * std::cos(angle), 1e-5f);
+            EXPECT_NEAR(corners[i].y, 3.0f, 1e-5f);
+            EXPECT_NEAR(corners[i].z, -1.0f + 2.0f * std::sin(angle), 1e-5f);
+        }
+    }
+}
+
+TEST_F(HexGeometryTest, RectRegionCellsMatchGenerateHex) {
+    glm::vec3 origin(10.0f, 1.0f, 5.0f);
+    HexMesh region = hexGeom.generateRectRegion(4, 3, origin);
+    ASSERT_EQ(region.vertices.size(), 12u * HexGeometry::VERTICES_PER_HEX);
+    ASSERT_EQ(region.indices.size(), 12u * HexGeometry::INDICES_PER_HEX);
+
+    // Cell (column 3, row 2)
+    size_t cell = 2 * 4 + 3;
+    HexMesh single = hexGeom.generateHex(hexGeom.offsetToWorld(3, 2, origin));
+    for (size_t i = 0; i < HexGeometry::VERTICES_PER_HEX; ++i) {
+        EXPECT_EQ(region.vertices[cell * HexGeometry::VERTICES_PER_HEX + i], single.vertices[i]);
+    }
+    for (size_t i = 0; i < HexGeometry::INDICES_PER_HEX; ++i) {
+        EXPECT_EQ(region.indices[cell * HexGeometry::INDICES_PER_HEX + i],
+                  single.indices[i] + cell * HexGeometry::VERTICES_PER_HEX);
+    }
+}
+
+TEST_F(HexGeometryTest, OffsetLayoutsStaggerOddLines) {
+    glm::vec3 oddColumn = hexGeom.offsetToWorld(1, 0);
+    EXPECT_NEAR(oddColumn.x, 1.5f, 1e-5f);
+    EXPECT_NEAR(oddColumn.z, std::sqrt(3.0f) * 0.5f, 1e-5f);
+
+    HexGeometry pointy(1.0f, HexOrientation::PointyTop);
+    glm::vec3 oddRow = pointy.offsetToWorld(0, 1);
+    EXPECT_NEAR(oddRow.x, std::sqrt(3.0f) * 0.5f, 1e-5f);
+    EXPECT_NEAR(oddRow.z, 1.5f, 1e-5f);
+}
+
+TEST_F(HexGeometryTest, HexRegionCoversEveryCellOnce) {
+    const uint32_t radius = 5;
+    HexMesh region = hexGeom.generateHexRegion(radius);
+    size_t cells = HexGeometry::getHexRegionCellCount(radius);
+    EXPECT_EQ(cells, 91u);
+    ASSERT_EQ(region.vertices.size(), cells * HexGeometry::VERTICES_PER_HEX);
+
+    // Neighbouring centers are sqrt(3) apart, so rounding separates them
+    std::set<std::pair<int, int>> centers;
+    float maxDistance = 0.0f;
+    for (size_t cell = 0; cell < cells; ++cell) {
+        glm::vec3 center = region.vertices[cell * HexGeometry::VERTICES_PER_HEX].position;
+        centers.insert({int(std::lround(center.x * 10.0f)), int(std::lround(center.z * 10.0f))});
+        maxDistance = std::max(maxDistance, std::sqrt(center.x * center.x + center.z * center.z));
+    }
+    EXPECT_EQ(centers.size(), cells);
+    EXPECT_NEAR(maxDistance, radius * std::sqrt(3.0f), 1e-3f);
+    for (uint32_t index : region.indices) {
+        EXPECT_LT(index, region.vertices.size());
+    }
+}
+
+TEST_F(HexGeometryTest, ParallelRegionMatchesSerial) {
+    // Enough rows for several tasks
+    ThreadPool inlinePool(0);
+    ThreadPool workers(4);
+    HexMesh serial = hexGeom.generateRectRegion(200, 300, glm::vec3(0.0f), &inlinePool);
+    HexMesh parallel = hexGeom.generateRectRegion(200, 300, glm::vec3(0.0f), &workers);
+    EXPECT_TRUE(serial.vertices == parallel.vertices);
+    EXPECT_TRUE(serial.indices == parallel.indices);
+
+    HexMesh serialHex = hexGeom.generateHexRegion(150, glm::vec3(0.0f), &inlinePool);
+    HexMesh parallelHex = hexGeom.generateHexRegion(150, glm::vec3(0.0f), &workers);
+    EXPECT_TRUE(serialHex.vertices == parallelHex.vertices);
+    EXPECT_TRUE(serialHex.indices == parallelHex.indices);
+}
+
 }  // namespace test
 }  // namespace vde
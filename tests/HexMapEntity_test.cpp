@@ -0,0 +1,136 @@
+/**
+ * @file HexMapEntity_test.cpp
+ * @brief Unit tests for the instanced hex prism map (GPU-free)
+ */
+
+#include <vde/api/HexMapEntity.h>
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+using namespace vde;
+
+class HexMapEntityTest : public ::testing::Test {
+  protected:
+    HexMapEntity map;
+
+    void SetUp() override {
+        ASSERT_TRUE(map.create(70, 40, 1.0f, 32));
+        map.setFramesInFlight(2);
+    }
+};
+
+TEST_F(HexMapEntityTest, CreateRejectsInvalidDimensions) {
+    HexMapEntity other;
+    EXPECT_FALSE(other.create(0, 10));
+    EXPECT_FALSE(other.create(10, HexMapEntity::MAX_DIMENSION + 1));
+    EXPECT_FALSE(other.create(10, 10, 0.0f));
+    EXPECT_EQ(other.getCellCount(), 0u);
+}
+
+TEST_F(HexMapEntityTest, ChunksPartitionTheMap) {
+    EXPECT_EQ(map.getCellCount(), 70u * 40u);
+    ASSERT_EQ(map.getChunkCount(), 6u);  // 3 x 2 chunks of up to 32 x 32
+
+    // Every cell owns one slot, inside its chunk's contiguous range
+    std::set<uint32_t> slots;
+    for (uint32_t row = 0; row < 40; ++row) {
+        for (uint32_t column = 0; column < 70; ++column) {
+            slots.insert(map.getInstanceIndex(column, row));
+        }
+    }
+    EXPECT_EQ(slots.size(), map.getCellCount());
+    EXPECT_EQ(*slots.rbegin(), map.getCellCount() - 1);
+
+    uint32_t next = 0;
+    for (const HexMapEntity::Chunk& chunk : map.getChunks()) {
+        EXPECT_EQ(chunk.firstInstance, next);
+        next += chunk.instanceCount;
+    }
+    EXPECT_EQ(map.getChunks().back().instanceCount, 6u * 8u);
+    EXPECT_EQ(map.getInstanceIndex(70, 0), UINT32_MAX);
+    EXPECT_EQ(map.getCell(0, 40), nullptr);
+}
+
+TEST_F(HexMapEntityTest, OddColumnsSitHalfAHexLower) {
+    glm::ivec2 axial = HexMapEntity::offsetToAxial(1, 0);
+    glm::vec3 center = HexMapEntity::axialToLocal(axial.x, axial.y, 1.0f);
+    EXPECT_NEAR(center.x, 1.5f, 1e-5f);
+    EXPECT_NEAR(center.z, 0.8660254f, 1e-5f);
+
+    const HexPrismInstance* cell = map.getCell(5, 7);
+    ASSERT_NE(cell, nullptr);
+    glm::ivec2 expected = HexMapEntity::offsetToAxial(5, 7);
+    EXPECT_EQ(cell->q, expected.x);
+    EXPECT_EQ(cell->r, expected.y);
+}
+
+TEST_F(HexMapEntityTest, HeightChangeTouchesOnlyItsSlot) {
+    std::vector<HexPrismInstance> gpu(map.getCellCount());
+    EXPECT_EQ(map.writePendingInstances(0, gpu.data()), map.getCellCount());
+    EXPECT_EQ(map.getPendingSlotCount(0), 0u);
+
+    map.setCellHeight(33, 5, 4.0f);
+    EXPECT_EQ(map.getPendingSlotCount(0), 1u);
+    EXPECT_EQ(map.writePendingInstances(0, gpu.data()), 1u);
+    EXPECT_FLOAT_EQ(gpu[map.getInstanceIndex(33, 5)].height, 4.0f);
+
+    // The other frame's buffer has not been written yet
+    EXPECT_EQ(map.getPendingSlotCount(1), map.getCellCount());
+}
+
+TEST_F(HexMapEntityTest, FrameSlotsFollowFramesInFlight) {
+    std::vector<HexPrismInstance> gpu(map.getCellCount());
+    EXPECT_EQ(map.getFramesInFlight(), 2u);
+    map.writePendingInstances(0, gpu.data());
+    map.writePendingInstances(1, gpu.data());
+
+    // Changes queue only on slots that exist
+    map.setCellHeight(3, 3, 2.0f);
+    EXPECT_EQ(map.getPendingSlotCount(1), 1u);
+    EXPECT_EQ(map.getPendingSlotCount(2), 0u);
+    EXPECT_EQ(map.writePendingInstances(2, gpu.data()), 0u);
+
+    // A slot added later starts from a full upload; existing slots keep their queues
+    map.setFramesInFlight(3);
+    EXPECT_EQ(map.getPendingSlotCount(0), 1u);
+    EXPECT_EQ(map.getPendingSlotCount(2), map.getCellCount());
+
+    map.setFramesInFlight(2);
+    EXPECT_EQ(map.getFramesInFlight(), 2u);
+    EXPECT_EQ(map.getPendingSlotCount(1), 1u);
+}
+
+TEST_F(HexMapEntityTest, RecreateQueuesFullUploadOnEverySlot) {
+    std::vector<HexPrismInstance> gpu(map.getCellCount());
+    map.writePendingInstances(0, gpu.data());
+    map.writePendingInstances(1, gpu.data());
+
+    // The old buffers are retired, so each slot refills a new one
+    ASSERT_TRUE(map.create(10, 10));
+    EXPECT_EQ(map.getFramesInFlight(), 2u);
+    EXPECT_EQ(map.getPendingSlotCount(0), 100u);
+    EXPECT_EQ(map.getPendingSlotCount(1), 100u);
+}
+
+TEST_F(HexMapEntityTest, ManyChangesFallBackToFullUpload) {
+    std::vector<HexPrismInstance> gpu(map.getCellCount());
+    map.writePendingInstances(0, gpu.data());
+    for (uint32_t column = 0; column < 70; ++column) {
+        for (uint32_t row = 0; row < 20; ++row) {
+            map.setCellHeight(column, row, 2.0f);
+        }
+    }
+    EXPECT_EQ(map.getPendingSlotCount(0), map.getCellCount());
+}
+
+TEST_F(HexMapEntityTest, ChunkBoundsGrowWithHeight) {
+    const HexMapEntity::Chunk& chunk = map.getChunks()[1];
+    EXPECT_FLOAT_EQ(chunk.boundsMax.y, 1.0f);
+    map.setCell(40, 3, 6.0f, Color(1.0f, 0.0f, 0.0f));
+    EXPECT_FLOAT_EQ(chunk.boundsMax.y, 6.0f);
+    EXPECT_FLOAT_EQ(map.getChunks()[0].boundsMax.y, 1.0f);
+    EXPECT_EQ(map.getCell(40, 3)->color, 0xFF0000FFu);
+}
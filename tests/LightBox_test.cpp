@@ -157,6 +157,53 @@ TEST_F(LightBoxTest, GetLightsVector) {
 
 // ============================================================================
 // SimpleColorLightBox Tests
+TEST_F(LightBoxTest, EditsBumpVersion) {
+    uint64_t version = lightBox->getVersion();
+    EXPECT_EQ(lightBox->getVersion(), version);
+
+    lightBox->addLight(Light::point(Position(0.0f, 1.0f, 0.0f)));
+    EXPECT_GT(lightBox->getVersion(), version);
+    version = lightBox->getVersion();
+
+    lightBox->setLight(0, Light::point(Position(1.0f, 1.0f, 0.0f)));
+    EXPECT_GT(lightBox->getVersion(), version);
+    version = lightBox->getVersion();
+
+    lightBox->getLight(0).range = 20.0f;
+    EXPECT_GT(lightBox->getVersion(), version);
+    version = lightBox->getVersion();
+
+    lightBox->setAmbientIntensity(lightBox->getAmbientIntensity());
+    EXPECT_EQ(lightBox->getVersion(), version);
+    lightBox->setAmbientIntensity(0.5f);
+    EXPECT_GT(lightBox->getVersion(), version);
+    version = lightBox->getVersion();
+
+    lightBox->setAmbientColor(lightBox->getAmbientColor());
+    EXPECT_EQ(lightBox->getVersion(), version);
+    lightBox->setAmbientColor(Color(0.2f, 0.3f, 0.4f));
+    EXPECT_GT(lightBox->getVersion(), version);
+    version = lightBox->getVersion();
+
+    lightBox->removeLight(0);
+    EXPECT_GT(lightBox->getVersion(), version);
+}
+
+TEST_F(LightBoxTest, ReadingDoesNotBumpVersion) {
+    lightBox->addLight(Light::directional(Direction(0.0f, -1.0f, 0.0f)));
+    uint64_t version = lightBox->getVersion();
+
+    const LightBox& constBox = *lightBox;
+    EXPECT_EQ(constBox.getLight(0).type, LightType::Directional);
+    EXPECT_EQ(constBox.getLights().size(), 1u);
+    EXPECT_EQ(lightBox->getVersion(), version);
+}
+
+TEST_F(LightBoxTest, VersionsAreUniqueAcrossLightBoxes) {
+    SimpleColorLightBox other;
+    EXPECT_NE(other.getVersion(), lightBox->getVersion());
+}
+
 // ============================================================================
 
 class SimpleColorLightBoxTest : public ::testing::Test {};
@@ -0,0 +1,249 @@
+/**
+ * @file LightClusters_test.cpp
+ * @brief Unit tests for vde::LightClusterGrid (GPU-free)
+ */
+
+#include <vde/LightClusters.h>
+#include <vde/api/ThreadPool.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace vde {
+namespace test {
+
+class LightClusterGridTest : public ::testing::Test {
+  protected:
+    static constexpr float NEAR_PLANE = 0.1f;
+    static constexpr float FAR_PLANE = 100.0f;
+
+    LightClusterGrid grid;
+    glm::mat4 view{1.0f};
+    glm::mat4 projection{1.0f};
+    std::vector<GPULight> lights;
+
+    void SetUp() override {
+        view = glm::lookAt(glm::vec3(0.0f, 2.0f, 5.0f), glm::vec3(0.0f, 0.0f, -10.0f),
+                           glm::vec3(0.0f, 1.0f, 0.0f));
+        projection =
+            glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, NEAR_PLANE, FAR_PLANE);
+        projection[1][1] *= -1.0f;  // Vulkan clip space, as Camera does
+        grid.setProjection(projection, NEAR_PLANE, FAR_PLANE);
+    }
+
+    static GPULight makePoint(const glm::vec3& position, float range) {
+        GPULight light{};
+        light.positionAndType = glm::vec4(position, 1.0f);
+        light.directionAndRange = glm::vec4(0.0f, 0.0f, 0.0f, range);
+        return light;
+    }
+
+    static GPULight makeSpot(const glm::vec3& position, const glm::vec3& direction, float range,
+                             float outerDegrees) {
+        GPULight light{};
+        light.positionAndType = glm::vec4(position, 2.0f);
+        light.directionAndRange = glm::vec4(direction, range);
+        light.spotParams = glm::vec4(std::cos(glm::radians(outerDegrees * 0.5f)),
+                                     std::cos(glm::radians(outerDegrees)), 0.0f, 0.0f);
+        return light;
+    }
+
+    // Cluster a world-space point falls into, the way the fragment shader
+    // computes it; false if the point is off screen
+    bool clusterOf(const glm::vec3& world, uint32_t& cluster) const {
+        glm::vec4 viewPos = view * glm::vec4(world, 1.0f);
+        glm::vec4 clip = projection * viewPos;
+        if (clip.w <= 0.0f) {
+            return false;
+        }
+        float ndcX = clip.x / clip.w;
+        float ndcY = clip.y / clip.w;
+        float depth = -viewPos.z;
+        if (std::abs(ndcX) >= 1.0f || std::abs(ndcY) >= 1.0f || depth < NEAR_PLANE ||
+            depth > FAR_PLANE) {
+            return false;
+        }
+        auto x = static_cast<uint32_t>((ndcX + 1.0f) * 0.5f * LightClusterGrid::GRID_X);
+        auto y = static_cast<uint32_t>((ndcY + 1.0f) * 0.5f * LightClusterGrid::GRID_Y);
+        cluster = LightClusterGrid::getClusterIndex(x, y, grid.getSlice(depth));
+        return true;
+    }
+
+    bool clusterHasLight(uint32_t cluster, uint32_t light) const {
+        const LightCluster& range = grid.getClusters()[cluster];
+        auto begin = grid.getLightIndices().begin() + range.offset;
+        return std::find(begin, begin + range.count, light) != begin + range.count;
+    }
+};
+
+TEST_F(LightClusterGridTest, PerspectiveSlicesAreExponential) {
+    EXPECT_TRUE(grid.isLogarithmic());
+    EXPECT_FLOAT_EQ(grid.getSliceStart(0), NEAR_PLANE);
+    EXPECT_NEAR(grid.getSliceStart(LightClusterGrid::GRID_Z), FAR_PLANE, 1e-3f);
+    EXPECT_EQ(grid.getSlice(NEAR_PLANE), 0u);
+    EXPECT_EQ(grid.getSlice(FAR_PLANE * 0.999f), LightClusterGrid::GRID_Z - 1);
+    EXPECT_EQ(grid.getSlice(0.0f), 0u);
+    EXPECT_EQ(grid.getSlice(1000.0f), LightClusterGrid::GRID_Z - 1);
+
+    for (uint32_t slice = 0; slice < LightClusterGrid::GRID_Z; ++slice) {
+        float start = grid.getSliceStart(slice);
+        float end = grid.getSliceStart(slice + 1);
+        EXPECT_LT(start, end);
+        EXPECT_EQ(grid.getSlice((start + end) * 0.5f), slice);
+    }
+    // Each slice is deeper than the one before it
+    EXPECT_GT(grid.getSliceStart(2) - grid.getSliceStart(1),
+              grid.getSliceStart(1) - grid.getSliceStart(0));
+}
+
+TEST_F(LightClusterGridTest, PointLightCoversEveryPointInRange) {
+    lights.push_back(makePoint(glm::vec3(1.0f, 0.5f, -8.0f), 4.0f));
+    grid.build(lights, view);
+    EXPECT_EQ(grid.getBinnedLightCount(), 1u);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    int tested = 0;
+    for (int i = 0; i < 2000; ++i) {
+        glm::vec3 offset(unit(rng), unit(rng), unit(rng));
+        if (glm::length(offset) > 1.0f) {
+            continue;
+        }
+        uint32_t cluster = 0;
+        if (clusterOf(glm::vec3(lights[0].positionAndType) + offset * 3.99f, cluster)) {
+            EXPECT_TRUE(clusterHasLight(cluster, 0)) << "point " << i;
+            tested++;
+        }
+    }
+    EXPECT_GT(tested, 500);
+
+    // Far away from the light nothing is binned
+    uint32_t farCluster = 0;
+    ASSERT_TRUE(clusterOf(glm::vec3(-30.0f, 0.0f, -80.0f), farCluster));
+    EXPECT_EQ(grid.getClusters()[farCluster].count, 0u);
+}
+
+TEST_F(LightClusterGridTest, SpotLightCoversItsCone) {
+    const glm::vec3 apex(0.0f, 3.0f, -6.0f);
+    const glm::vec3 axis = glm::normalize(glm::vec3(0.2f, -1.0f, -0.3f));
+    lights.push_back(makeSpot(apex, axis, 8.0f, 30.0f));
+    lights.push_back(makeSpot(apex, -axis, 6.0f, 70.0f));
+    grid.build(lights, view);
+    EXPECT_EQ(grid.getBinnedLightCount(), 2u);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    for (uint32_t light = 0; light < lights.size(); ++light) {
+        const glm::vec3 direction = glm::vec3(lights[light].directionAndRange);
+        const float range = lights[light].directionAndRange.w;
+        const float cosOuter = lights[light].spotParams.y;
+        int tested = 0;
+        for (int i = 0; i < 4000; ++i) {
+            glm::vec3 offset(unit(rng), unit(rng), unit(rng));
+            float distance = glm::length(offset);
+            if (distance > 1.0f || distance < 1e-3f ||
+                glm::dot(offset / distance, direction) < cosOuter) {
+                continue;
+            }
+            uint32_t cluster = 0;
+            if (clusterOf(apex + offset * (range * 0.999f), cluster)) {
+                EXPECT_TRUE(clusterHasLight(cluster, light)) << "light " << light;
+                tested++;
+            }
+        }
+        EXPECT_GT(tested, 50);
+    }
+}
+
+TEST_F(LightClusterGridTest, DirectionalAndOutOfRangeLightsAreNotBinned) {
+    GPULight sun{};
+    sun.positionAndType = glm::vec4(0.0f, -1.0f, 0.0f, 0.0f);
+    lights.push_back(sun);
+    lights.push_back(makePoint(glm::vec3(0.0f, 2.0f, 20.0f), 5.0f));    // Behind the camera
+    lights.push_back(makePoint(glm::vec3(0.0f, 0.0f, -200.0f), 5.0f));  // Beyond the far plane
+    lights.push_back(makePoint(glm::vec3(0.0f, 0.0f, -10.0f), 0.0f));   // No range
+    grid.build(lights, view);
+
+    EXPECT_EQ(grid.getBinnedLightCount(), 0u);
+    EXPECT_TRUE(grid.getLightIndices().empty());
+    for (const LightCluster& cluster : grid.getClusters()) {
+        EXPECT_EQ(cluster.count, 0u);
+    }
+}
+
+TEST_F(LightClusterGridTest, ClusterRangesAreContiguous) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> spread(-40.0f, 40.0f);
+    std::uniform_real_distribution<float> depth(-90.0f, 0.0f);
+    for (int i = 0; i < 200; ++i) {
+        lights.push_back(makePoint(glm::vec3(spread(rng), spread(rng) * 0.3f, depth(rng)), 6.0f));
+    }
+    grid.build(lights, view);
+
+    uint32_t expectedOffset = 0;
+    for (const LightCluster& cluster : grid.getClusters()) {
+        EXPECT_EQ(cluster.offset, expectedOffset);
+        expectedOffset += cluster.count;
+        // Lists are sorted by light index
+        auto begin = grid.getLightIndices().begin() + cluster.offset;
+        EXPECT_TRUE(std::is_sorted(begin, begin + cluster.count));
+    }
+    EXPECT_EQ(expectedOffset, grid.getLightIndices().size());
+}
+
+TEST_F(LightClusterGridTest, ParallelBuildMatchesSerial) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> spread(-30.0f, 30.0f);
+    std::uniform_real_distribution<float> depth(-95.0f, 5.0f);
+    std::uniform_real_distribution<float> range(0.5f, 10.0f);
+    for (int i = 0; i < 500; ++i) {
+        glm::vec3 position(spread(rng), spread(rng) * 0.5f, depth(rng));
+        if (i % 3 == 0) {
+            lights.push_back(makeSpot(position, glm::vec3(0.0f, -1.0f, 0.0f), range(rng), 50.0f));
+        } else {
+            lights.push_back(makePoint(position, range(rng)));
+        }
+    }
+
+    grid.build(lights, view);
+    std::vector<LightCluster> serialClusters = grid.getClusters();
+    std::vector<uint32_t> serialIndices = grid.getLightIndices();
+    ASSERT_FALSE(serialIndices.empty());
+
+    ThreadPool workers(4);
+    grid.build(lights, view, &workers);
+    ASSERT_EQ(grid.getLightIndices(), serialIndices);
+    for (uint32_t i = 0; i < LightClusterGrid::CLUSTER_COUNT; ++i) {
+        EXPECT_EQ(grid.getClusters()[i].offset, serialClusters[i].offset);
+        EXPECT_EQ(grid.getClusters()[i].count, serialClusters[i].count);
+    }
+}
+
+TEST_F(LightClusterGridTest, OrthographicSlicesAreLinear) {
+    view = glm::mat4(1.0f);
+    projection = glm::ortho(-10.0f, 10.0f, -5.0f, 5.0f, -1.0f, 50.0f);
+    grid.setProjection(projection, -1.0f, 50.0f);
+    EXPECT_FALSE(grid.isLogarithmic());
+    EXPECT_FLOAT_EQ(grid.getSliceStart(1) - grid.getSliceStart(0),
+                    grid.getSliceStart(2) - grid.getSliceStart(1));
+
+    lights.push_back(makePoint(glm::vec3(3.0f, -2.0f, -20.0f), 2.0f));
+    grid.build(lights, view);
+    EXPECT_EQ(grid.getBinnedLightCount(), 1u);
+
+    // Orthographic NDC maps straight to tiles
+    glm::vec4 clip = projection * glm::vec4(3.0f, -2.0f, -20.0f, 1.0f);
+    auto x = static_cast<uint32_t>((clip.x + 1.0f) * 0.5f * LightClusterGrid::GRID_X);
+    auto y = static_cast<uint32_t>((clip.y + 1.0f) * 0.5f * LightClusterGrid::GRID_Y);
+    uint32_t cluster = LightClusterGrid::getClusterIndex(x, y, grid.getSlice(20.0f));
+    EXPECT_TRUE(clusterHasLight(cluster, 0));
+    EXPECT_EQ(grid.getClusters()[LightClusterGrid::getClusterIndex(0, 0, 0)].count, 0u);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,76 @@
+/**
+ * @file MappedFile_test.cpp
+ * @brief Unit tests for vde::MappedFile
+ */
+
+#include <vde/MappedFile.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace vde {
+namespace test {
+
+class MappedFileTest : public ::testing::Test {
+  protected:
+    std::filesystem::path path;
+
+    void SetUp() override {
+        path = std::filesystem::temp_directory_path() / "vde_mapped_file_test.bin";
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    void writeFile(const std::string& content) {
+        std::ofstream(path, std::ios::binary) << content;
+    }
+};
+
+TEST_F(MappedFileTest, MapsFileContents) {
+    writeFile("hello mapped world");
+
+    MappedFile file;
+    ASSERT_TRUE(file.open(path.string()));
+    EXPECT_TRUE(file.isOpen());
+    ASSERT_EQ(file.size(), 18u);
+    EXPECT_EQ(std::memcmp(file.data(), "hello mapped world", 18), 0);
+}
+
+TEST_F(MappedFileTest, MissingFileFailsToOpen) {
+    MappedFile file;
+    EXPECT_FALSE(file.open((path.string() + ".missing")));
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(file.data(), nullptr);
+}
+
+TEST_F(MappedFileTest, EmptyFileOpensWithNoData) {
+    writeFile("");
+
+    MappedFile file;
+    ASSERT_TRUE(file.open(path.string()));
+    EXPECT_EQ(file.size(), 0u);
+    EXPECT_EQ(file.data(), nullptr);
+}
+
+TEST_F(MappedFileTest, MoveTransfersMapping) {
+    writeFile("abcd");
+
+    MappedFile a;
+    ASSERT_TRUE(a.open(path.string()));
+    MappedFile b = std::move(a);
+    EXPECT_FALSE(a.isOpen());
+    ASSERT_TRUE(b.isOpen());
+    EXPECT_EQ(b.size(), 4u);
+    EXPECT_EQ(b.data()[3], 'd');
+
+    b.close();
+    EXPECT_FALSE(b.isOpen());
+    EXPECT_EQ(b.size(), 0u);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,176 @@
+/**
+ * @file MeshBVH_test.cpp
+ * @brief Unit tests for vde::MeshBVH (GPU-free)
+ */
+
+#include <vde/MeshBVH.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "TestGeometry.h"
+
+namespace vde {
+namespace test {
+
+class MeshBVHTest : public ::testing::Test {
+  protected:
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+
+    // Random triangle soup inside [-10, 10]^3
+    void makeSoup(int triangles, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> center(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+        for (int i = 0; i < triangles; ++i) {
+            glm::vec3 c(center(rng), center(rng), center(rng));
+            for (int corner = 0; corner < 3; ++corner) {
+                Vertex v{};
+                v.position = c + glm::vec3(offset(rng), offset(rng), offset(rng));
+                indices.push_back(static_cast<uint32_t>(vertices.size()));
+                vertices.push_back(v);
+            }
+        }
+    }
+
+    // Closest hit by testing every triangle
+    bool bruteForce(const glm::vec3& origin, const glm::vec3& direction, MeshRayHit& hit) {
+        MeshBVH single;
+        bool found = false;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            std::vector<uint32_t> one = {indices[i], indices[i + 1], indices[i + 2]};
+            single.build(vertices, one);
+            MeshRayHit candidate;
+            if (single.raycast(origin, direction, candidate) &&
+                (!found || candidate.distance < hit.distance)) {
+                hit = candidate;
+                hit.triangle = static_cast<uint32_t>(i / 3);
+                found = true;
+            }
+        }
+        return found;
+    }
+};
+
+TEST_F(MeshBVHTest, EmptyMeshNeverHits) {
+    MeshBVH bvh;
+    bvh.build(vertices, indices);
+    EXPECT_TRUE(bvh.isEmpty());
+    MeshRayHit hit;
+    EXPECT_FALSE(bvh.raycast(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f), hit));
+}
+
+TEST_F(MeshBVHTest, HitsGridTriangleAtExactPoint) {
+    makeGrid(16, vertices, indices);
+    MeshBVH bvh;
+    bvh.build(vertices, indices);
+    EXPECT_EQ(bvh.getTriangleCount(), 512u);
+    EXPECT_GT(bvh.getNodes().size(), 1u);
+
+    MeshRayHit hit;
+    glm::vec3 origin(3.25f, 7.5f, 5.0f);
+    glm::vec3 direction(0.0f, 0.0f, -2.0f);
+    ASSERT_TRUE(bvh.raycast(origin, direction, hit));
+    EXPECT_NEAR(hit.distance, 2.5f, 1e-5f);
+
+    // Quad (3, 7), lower-left triangle
+    EXPECT_EQ(hit.triangle, (7u * 16u + 3u) * 2u);
+    glm::vec3 a = vertices[indices[hit.triangle * 3]].position;
+    glm::vec3 b = vertices[indices[hit.triangle * 3 + 1]].position;
+    glm::vec3 c = vertices[indices[hit.triangle * 3 + 2]].position;
+    glm::vec3 point = a + (b - a) * hit.u + (c - a) * hit.v;
+    EXPECT_NEAR(point.x, 3.25f, 1e-5f);
+    EXPECT_NEAR(point.y, 7.5f, 1e-5f);
+}
+
+TEST_F(MeshBVHTest, RespectsMaxDistanceAndMisses) {
+    makeGrid(4, vertices, indices);
+    MeshBVH bvh;
+    bvh.build(vertices, indices);
+
+    MeshRayHit hit;
+    EXPECT_FALSE(bvh.raycast(glm::vec3(1.5f, 1.5f, 5.0f), glm::vec3(0.0f, 0.0f, -1.0f), hit, 4.0f));
+    EXPECT_FALSE(bvh.raycast(glm::vec3(9.0f, 1.5f, 5.0f), glm::vec3(0.0f, 0.0f, -1.0f), hit));
+    EXPECT_FALSE(bvh.raycast(glm::vec3(1.5f, 1.5f, 5.0f), glm::vec3(0.0f, 0.0f, 1.0f), hit));
+
+    // Back faces count too
+    EXPECT_TRUE(bvh.raycast(glm::vec3(1.5f, 1.5f, -5.0f), glm::vec3(0.0f, 0.0f, 1.0f), hit));
+}
+
+TEST_F(MeshBVHTest, MatchesBruteForceOnTriangleSoup) {
+    makeSoup(400, 7);
+    MeshBVH bvh;
+    bvh.build(vertices, indices);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coordinate(-12.0f, 12.0f);
+    int hits = 0;
+    for (int i = 0; i < 200; ++i) {
+        glm::vec3 origin(coordinate(rng), coordinate(rng), coordinate(rng));
+        glm::vec3 target(coordinate(rng) * 0.5f, coordinate(rng) * 0.5f, coordinate(rng) * 0.5f);
+        glm::vec3 direction = target - origin;
+
+        MeshRayHit expected;
+        MeshRayHit actual;
+        bool expectedHit = bruteForce(origin, direction, expected);
+        ASSERT_EQ(bvh.raycast(origin, direction, actual), expectedHit);
+        if (expectedHit) {
+            EXPECT_NEAR(actual.distance, expected.distance, 1e-5f);
+            EXPECT_EQ(actual.triangle, expected.triangle);
+            hits++;
+        }
+    }
+    EXPECT_GT(hits, 20);
+}
+
+TEST_F(MeshBVHTest, PartialPacketsMatchBruteForce) {
+    // Counts that leave padding lanes and leaves straddling packets
+    for (int triangles : {1, 5, 37}) {
+        vertices.clear();
+        indices.clear();
+        makeSoup(triangles, static_cast<unsigned>(triangles));
+        MeshBVH bvh;
+        bvh.build(vertices, indices);
+
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> coordinate(-12.0f, 12.0f);
+        for (int i = 0; i < 200; ++i) {
+            glm::vec3 origin(coordinate(rng), coordinate(rng), coordinate(rng));
+            glm::vec3 target(coordinate(rng) * 0.5f, coordinate(rng) * 0.5f,
+                             coordinate(rng) * 0.5f);
+
+            MeshRayHit expected;
+            MeshRayHit actual;
+            bool expectedHit = bruteForce(origin, target - origin, expected);
+            ASSERT_EQ(bvh.raycast(origin, target - origin, actual), expectedHit);
+            if (expectedHit) {
+                EXPECT_EQ(actual.triangle, expected.triangle);
+            }
+        }
+    }
+}
+
+TEST_F(MeshBVHTest, SplitsLargeMeshesIntoSmallLeaves) {
+    makeSoup(4096, 3);
+    MeshBVH bvh;
+    bvh.build(vertices, indices);
+
+    size_t leafTriangles = 0;
+    size_t leaves = 0;
+    for (const MeshBVH::Node& node : bvh.getNodes()) {
+        if (node.isLeaf()) {
+            leafTriangles += node.triangleCount;
+            leaves++;
+        }
+    }
+    EXPECT_EQ(leafTriangles, 4096u);
+    EXPECT_LT(double(leafTriangles) / double(leaves), 8.0);
+    EXPECT_NEAR(bvh.getBoundsMin().x, -11.0f, 1.0f);
+    EXPECT_NEAR(bvh.getBoundsMax().x, 11.0f, 1.0f);
+}
+
+}  // namespace test
+}  // namespace vde
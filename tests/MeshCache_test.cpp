@@ -0,0 +1,226 @@
+/**
+ * @file MeshCache_test.cpp
+ * @brief Unit tests for the .vdemesh binary mesh cache (GPU-free)
+ */
+
+#include <vde/MeshCache.h>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+namespace vde {
+namespace test {
+
+class MeshCacheTest : public ::testing::Test {
+  protected:
+    std::filesystem::path dir;
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / "vde_mesh_cache_test";
+        std::filesystem::remove_all(dir);
+
+        for (int i = 0; i < 5; ++i) {
+            Vertex v{};
+            v.position = glm::vec3(float(i), float(i * 2), -float(i));
+            v.color = glm::vec3(0.5f);
+            v.texCoord = glm::vec2(float(i) / 4.0f, 1.0f);
+            vertices.push_back(v);
+        }
+        indices = {0, 1, 2, 2, 3, 4};
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+};
+
+TEST_F(MeshCacheTest, RoundTripsMeshData) {
+    MeshCache cache(dir.string());
+    ASSERT_TRUE(cache.store(42, vertices, indices, glm::vec3(0, 0, -4), glm::vec3(4, 8, 0)))
+        << cache.getLastError();
+
+    std::vector<Vertex> loadedVertices;
+    std::vector<uint32_t> loadedIndices;
+    glm::vec3 boundsMin, boundsMax;
+    ASSERT_TRUE(cache.load(42, loadedVertices, loadedIndices, boundsMin, boundsMax))
+        << cache.getLastError();
+
+    ASSERT_EQ(loadedVertices.size(), vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        EXPECT_EQ(loadedVertices[i].position, vertices[i].position);
+        EXPECT_EQ(loadedVertices[i].texCoord, vertices[i].texCoord);
+    }
+    EXPECT_EQ(loadedIndices, indices);
+    EXPECT_EQ(boundsMin, glm::vec3(0, 0, -4));
+    EXPECT_EQ(boundsMax, glm::vec3(4, 8, 0));
+}
+
+TEST_F(MeshCacheTest, RoundTripsLODChain) {
+    std::vector<MeshCacheLOD> lods(2);
+    lods[0].vertices = {vertices[0], vertices[2], vertices[4]};
+    lods[0].indices = {0, 1, 2};
+    lods[0].error = 0.01f;
+    lods[1].vertices = {vertices[1], vertices[3], vertices[4]};
+    lods[1].indices = {2, 1, 0};
+    lods[1].error = 0.03f;
+
+    MeshCache cache(dir.string());
+    ASSERT_TRUE(cache.store(9, vertices, indices, glm::vec3(0), glm::vec3(1), lods));
+
+    std::vector<Vertex> v;
+    std::vector<uint32_t> i;
+    glm::vec3 lo, hi;
+    std::vector<MeshCacheLOD> loaded;
+    ASSERT_TRUE(cache.load(9, v, i, lo, hi, &loaded)) << cache.getLastError();
+    EXPECT_EQ(i, indices);
+    ASSERT_EQ(loaded.size(), 2u);
+    for (size_t level = 0; level < lods.size(); ++level) {
+        EXPECT_EQ(loaded[level].indices, lods[level].indices);
+        EXPECT_FLOAT_EQ(loaded[level].error, lods[level].error);
+        ASSERT_EQ(loaded[level].vertices.size(), 3u);
+        EXPECT_EQ(loaded[level].vertices[1].position, lods[level].vertices[1].position);
+    }
+
+    // A mesh stored without levels loads with none
+    ASSERT_TRUE(cache.store(10, vertices, indices, glm::vec3(0), glm::vec3(1)));
+    ASSERT_TRUE(cache.load(10, v, i, lo, hi, &loaded)) << cache.getLastError();
+    EXPECT_TRUE(loaded.empty());
+}
+
+TEST_F(MeshCacheTest, BlobsAreAlignedForUpload) {
+    MeshCache cache(dir.string());
+    ASSERT_TRUE(cache.store(7, vertices, indices, glm::vec3(0), glm::vec3(1)));
+
+    MeshFileHeader header{};
+    std::ifstream file(cache.getCachePath(7), std::ios::binary);
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    ASSERT_TRUE(file);
+
+    EXPECT_EQ(header.magic, MeshCache::MAGIC);
+    EXPECT_EQ(header.version, MeshCache::VERSION);
+    EXPECT_EQ(header.vertexStride, sizeof(Vertex));
+    EXPECT_EQ(header.attributeCount, 3u);
+    EXPECT_EQ(header.vertexOffset % MeshCache::BLOB_ALIGNMENT, 0u);
+    EXPECT_EQ(header.indexOffset % MeshCache::BLOB_ALIGNMENT, 0u);
+}
+
+TEST_F(MeshCacheTest, OtherSourceHashMisses) {
+    MeshCache cache(dir.string());
+    ASSERT_TRUE(cache.store(1, vertices, indices, glm::vec3(0), glm::vec3(1)));
+
+    std::vector<Vertex> v;
+    std::vector<uint32_t> i;
+    glm::vec3 lo, hi;
+    EXPECT_FALSE(cache.load(2, v, i, lo, hi));
+    EXPECT_FALSE(cache.getLastError().empty());
+}
+
+TEST_F(MeshCacheTest, RejectsTruncatedAndForeignFiles) {
+    MeshCache cache(dir.string());
+    ASSERT_TRUE(cache.store(3, vertices, indices, glm::vec3(0), glm::vec3(1)));
+    std::string path = cache.getCachePath(3);
+
+    std::vector<Vertex> v;
+    std::vector<uint32_t> i;
+    glm::vec3 lo, hi;
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+    EXPECT_FALSE(cache.load(3, v, i, lo, hi));
+    EXPECT_TRUE(v.empty());
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a mesh";
+    EXPECT_FALSE(cache.load(3, v, i, lo, hi));
+
+    // Same hash stored under another name (e.g. a copied file) is rejected too
+    ASSERT_TRUE(cache.store(4, vertices, indices, glm::vec3(0), glm::vec3(1)));
+    std::filesystem::copy_file(cache.getCachePath(4), path,
+                               std::filesystem::copy_options::overwrite_existing);
+    EXPECT_FALSE(cache.load(3, v, i, lo, hi));
+}
+
+TEST_F(MeshCacheTest, RejectsOutOfRangeIndices) {
+    std::vector<MeshCacheLOD> lods(1);
+    lods[0].vertices = {vertices[0], vertices[2], vertices[4]};
+    lods[0].indices = {0, 1, 2};
+
+    MeshCache cache(dir.string());
+    ASSERT_TRUE(cache.store(5, vertices, indices, glm::vec3(0), glm::vec3(1), lods));
+    std::string path = cache.getCachePath(5);
+
+    MeshFileHeader header{};
+    MeshFileLOD lod{};
+    {
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekg(static_cast<std::streamoff>(header.lodOffset));
+        file.read(reinterpret_cast<char*>(&lod), sizeof(lod));
+        ASSERT_TRUE(file);
+    }
+
+    // Overwrite one index in place with a value equal to the vertex count
+    auto corruptIndex = [&](uint64_t offset, uint32_t value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        ASSERT_TRUE(file);
+    };
+
+    std::vector<Vertex> v;
+    std::vector<uint32_t> i;
+    glm::vec3 lo, hi;
+    std::vector<MeshCacheLOD> loaded;
+
+    corruptIndex(lod.indexOffset + sizeof(uint32_t), lod.vertexCount);
+    EXPECT_FALSE(cache.load(5, v, i, lo, hi, &loaded));
+    EXPECT_FALSE(cache.getLastError().empty());
+
+    ASSERT_TRUE(cache.store(5, vertices, indices, glm::vec3(0), glm::vec3(1), lods));
+    corruptIndex(header.indexOffset, header.vertexCount);
+    EXPECT_FALSE(cache.load(5, v, i, lo, hi));
+}
+
+TEST_F(MeshCacheTest, RejectedFileLeavesOutputsUntouched) {
+    std::vector<MeshCacheLOD> lods(1);
+    lods[0].vertices = {vertices[0], vertices[2], vertices[4]};
+    lods[0].indices = {0, 1, 2};
+
+    MeshCache cache(dir.string());
+    ASSERT_TRUE(cache.store(6, vertices, indices, glm::vec3(0), glm::vec3(1), lods));
+    std::string path = cache.getCachePath(6);
+
+    // Corrupt only the LOD, so the base mesh decodes cleanly before the failure
+    MeshFileHeader header{};
+    MeshFileLOD lod{};
+    {
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekg(static_cast<std::streamoff>(header.lodOffset));
+        file.read(reinterpret_cast<char*>(&lod), sizeof(lod));
+        ASSERT_TRUE(file);
+    }
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(lod.indexOffset));
+        uint32_t bad = lod.vertexCount + 10;
+        file.write(reinterpret_cast<const char*>(&bad), sizeof(bad));
+        ASSERT_TRUE(file);
+    }
+
+    std::vector<Vertex> v = {vertices[3]};
+    std::vector<uint32_t> i = {7, 8, 9};
+    glm::vec3 lo(-1.0f), hi(2.0f);
+    std::vector<MeshCacheLOD> loaded(2);
+    EXPECT_FALSE(cache.load(6, v, i, lo, hi, &loaded));
+
+    ASSERT_EQ(v.size(), 1u);
+    EXPECT_EQ(v[0].position, vertices[3].position);
+    EXPECT_EQ(i, (std::vector<uint32_t>{7, 8, 9}));
+    EXPECT_EQ(lo, glm::vec3(-1.0f));
+    EXPECT_EQ(hi, glm::vec3(2.0f));
+    EXPECT_EQ(loaded.size(), 2u);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,106 @@
+/**
+ * @file MeshOptimizer_test.cpp
+ * @brief Unit tests for vde::MeshOptimizer (GPU-free)
+ */
+
+#include <vde/MeshOptimizer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+#include "TestGeometry.h"
+
+namespace vde {
+namespace test {
+
+class MeshOptimizerTest : public ::testing::Test {
+  protected:
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+
+    // Triangles as sorted position triples, independent of index and vertex order
+    static std::vector<std::array<float, 9>> triangleSet(const std::vector<Vertex>& verts,
+                                                         const std::vector<uint32_t>& idx) {
+        std::vector<std::array<float, 9>> triangles;
+        for (size_t t = 0; t + 2 < idx.size(); t += 3) {
+            std::array<std::array<float, 3>, 3> corners;
+            for (size_t k = 0; k < 3; ++k) {
+                const glm::vec3& p = verts[idx[t + k]].position;
+                corners[k] = {p.x, p.y, p.z};
+            }
+            std::sort(corners.begin(), corners.end());
+            std::array<float, 9> flat;
+            for (size_t k = 0; k < 9; ++k) {
+                flat[k] = corners[k / 3][k % 3];
+            }
+            triangles.push_back(flat);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+};
+
+TEST_F(MeshOptimizerTest, ACMRBounds) {
+    EXPECT_EQ(MeshOptimizer::computeACMR({}, 0), 0.0f);
+
+    std::vector<uint32_t> single = {0, 1, 2};
+    EXPECT_FLOAT_EQ(MeshOptimizer::computeACMR(single, 3), 3.0f);
+
+    std::vector<uint32_t> repeated = {0, 1, 2, 0, 1, 2};
+    EXPECT_FLOAT_EQ(MeshOptimizer::computeACMR(repeated, 3), 1.5f);
+}
+
+TEST_F(MeshOptimizerTest, VertexCacheOrderLowersACMR) {
+    makeGrid(64, vertices, indices);
+    float before = MeshOptimizer::computeACMR(indices, vertices.size());
+    auto optimized = MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+    float after = MeshOptimizer::computeACMR(optimized, vertices.size());
+
+    EXPECT_LT(after, before);
+    EXPECT_LT(after, 0.8f);
+    EXPECT_EQ(triangleSet(vertices, optimized), triangleSet(vertices, indices));
+}
+
+TEST_F(MeshOptimizerTest, OverdrawOrderKeepsTriangles) {
+    makeGrid(32, vertices, indices);
+    auto cacheOrder = MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+    auto overdrawOrder = MeshOptimizer::optimizeOverdraw(cacheOrder, vertices);
+
+    ASSERT_EQ(overdrawOrder.size(), indices.size());
+    EXPECT_EQ(triangleSet(vertices, overdrawOrder), triangleSet(vertices, indices));
+    // Clusters are only split where the cache cost stays within the threshold
+    float cacheAcmr = MeshOptimizer::computeACMR(cacheOrder, vertices.size());
+    EXPECT_LT(MeshOptimizer::computeACMR(overdrawOrder, vertices.size()), cacheAcmr * 1.5f);
+}
+
+TEST_F(MeshOptimizerTest, VertexFetchFollowsFirstUse) {
+    makeGrid(8, vertices, indices);
+    Vertex unused{};
+    unused.position = glm::vec3(-1.0f);
+    vertices.insert(vertices.begin(), unused);
+    for (uint32_t& index : indices) {
+        index++;
+    }
+    std::reverse(indices.begin(), indices.end());
+    auto before = triangleSet(vertices, indices);
+
+    MeshOptimizer::optimizeVertexFetch(vertices, indices);
+
+    uint32_t highest = 0;
+    for (uint32_t index : indices) {
+        EXPECT_LE(index, highest + 1);
+        highest = std::max(highest, index);
+    }
+    EXPECT_EQ(vertices.back().position, glm::vec3(-1.0f));
+    EXPECT_EQ(triangleSet(vertices, indices), before);
+}
+
+TEST_F(MeshOptimizerTest, InvalidInputIsReturnedUnchanged) {
+    std::vector<uint32_t> bad = {0, 1, 5};
+    EXPECT_EQ(MeshOptimizer::optimizeVertexCache(bad, 3), bad);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,130 @@
+/**
+ * @file MeshSimplifier_test.cpp
+ * @brief Unit tests for vde::MeshSimplifier (GPU-free)
+ */
+
+#include <vde/MeshSimplifier.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "TestGeometry.h"
+
+namespace vde {
+namespace test {
+
+class MeshSimplifierTest : public ::testing::Test {
+  protected:
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+
+    // UV sphere with a duplicated seam column, like Mesh::createSphere()
+    void makeSphere(int segments, int rings) {
+        const float pi = 3.14159265f;
+        for (int r = 0; r <= rings; ++r) {
+            float phi = pi * float(r) / float(rings);
+            for (int s = 0; s <= segments; ++s) {
+                float theta = 2.0f * pi * float(s) / float(segments);
+                Vertex v{};
+                v.position = glm::vec3(std::sin(phi) * std::cos(theta), std::cos(phi),
+                                       std::sin(phi) * std::sin(theta));
+                v.color = glm::abs(v.position);
+                v.texCoord = glm::vec2(float(s) / float(segments), float(r) / float(rings));
+                vertices.push_back(v);
+            }
+        }
+        uint32_t row = segments + 1;
+        for (int r = 0; r < rings; ++r) {
+            for (int s = 0; s < segments; ++s) {
+                uint32_t a = r * row + s;
+                indices.insert(indices.end(), {a, a + row, a + 1, a + 1, a + row, a + row + 1});
+            }
+        }
+    }
+
+    bool indicesValid(const std::vector<uint32_t>& result) const {
+        for (uint32_t index : result) {
+            if (index >= vertices.size()) {
+                return false;
+            }
+        }
+        return result.size() % 3 == 0;
+    }
+};
+
+TEST_F(MeshSimplifierTest, FlatGridReducesWithoutError) {
+    makeGrid(16, vertices, indices);
+    float error = -1.0f;
+    auto result = MeshSimplifier::simplify(vertices, indices, indices.size() / 4, 0.01f, &error);
+
+    ASSERT_TRUE(indicesValid(result));
+    EXPECT_LE(result.size(), indices.size() / 4);
+    EXPECT_GT(result.size(), 0u);
+    EXPECT_NEAR(error, 0.0f, 1e-4f);
+
+    // Remaining area still covers the whole grid (borders held in place)
+    float area = 0.0f;
+    for (size_t t = 0; t < result.size(); t += 3) {
+        glm::vec3 n = glm::cross(vertices[result[t + 1]].position - vertices[result[t]].position,
+                                 vertices[result[t + 2]].position - vertices[result[t]].position);
+        EXPECT_GT(n.z, 0.0f) << "triangle flipped";
+        area += 0.5f * glm::length(n);
+    }
+    EXPECT_NEAR(area, 256.0f, 1e-2f);
+}
+
+TEST_F(MeshSimplifierTest, SphereHalvesWithSmallError) {
+    makeSphere(32, 16);
+    float error = -1.0f;
+    auto result = MeshSimplifier::simplify(vertices, indices, indices.size() / 2, 0.05f, &error);
+
+    ASSERT_TRUE(indicesValid(result));
+    EXPECT_LE(result.size(), indices.size() / 2);
+    EXPECT_GT(result.size(), indices.size() / 4);
+    EXPECT_GT(error, 0.0f);
+    EXPECT_LT(error, 0.05f);
+
+    // Every kept corner still lies on the sphere
+    for (uint32_t index : result) {
+        EXPECT_NEAR(glm::length(vertices[index].position), 1.0f, 1e-4f);
+    }
+}
+
+TEST_F(MeshSimplifierTest, ErrorLimitStopsCollapses) {
+    makeSphere(32, 16);
+    auto loose = MeshSimplifier::simplify(vertices, indices, 0, 1.0f);
+    auto tight = MeshSimplifier::simplify(vertices, indices, 0, 1e-4f);
+
+    EXPECT_LT(loose.size(), tight.size());
+    EXPECT_GT(tight.size(), indices.size() / 2);
+}
+
+TEST_F(MeshSimplifierTest, SeamCornersKeepTheirAttributes) {
+    makeSphere(32, 16);
+    auto result = MeshSimplifier::simplify(vertices, indices, indices.size() / 2, 0.05f);
+
+    // No triangle may stretch across the u = 0 / u = 1 seam
+    for (size_t t = 0; t < result.size(); t += 3) {
+        float uMin = 1.0f, uMax = 0.0f;
+        for (size_t k = 0; k < 3; ++k) {
+            float u = vertices[result[t + k]].texCoord.x;
+            uMin = std::min(uMin, u);
+            uMax = std::max(uMax, u);
+        }
+        EXPECT_LT(uMax - uMin, 0.5f);
+    }
+}
+
+TEST_F(MeshSimplifierTest, InvalidInputIsReturnedUnchanged) {
+    makeGrid(2, vertices, indices);
+    indices.push_back(0);
+    EXPECT_EQ(MeshSimplifier::simplify(vertices, indices, 3), indices);
+
+    indices.pop_back();
+    indices[0] = 1000;
+    EXPECT_EQ(MeshSimplifier::simplify(vertices, indices, 3), indices);
+}
+
+}  // namespace test
+}  // namespace vde
@@ -3,12 +3,18 @@
  * @brief Unit tests for vde::Mesh class
  */
 
+#include <vde/MeshCache.h>
+#include <vde/ShaderCache.h>
 #include <vde/api/Mesh.h>
 
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 
 #include <gtest/gtest.h>
 
+#include "TestGeometry.h"
+
 using namespace vde;
 
 class MeshTest : public ::testing::Test {
@@ -356,6 +362,18 @@ TEST_F(MeshTest, UploadToGPUWithNullContextDoesNothing) {
     EXPECT_FALSE(mesh->isOnGPU());
 }
 
+TEST_F(MeshTest, GPUFormatDefaultsToFullLayout) {
+    auto mesh = Mesh::createCube(1.0f);
+
+    // Nothing uploaded yet: full vertices and 32-bit indices
+    EXPECT_EQ(mesh->getGPUVertexFormat(), VertexFormat::Full);
+    EXPECT_EQ(mesh->getIndexType(), VK_INDEX_TYPE_UINT32);
+    EXPECT_TRUE(mesh->isCompactVerticesAllowed());
+
+    mesh->setCompactVerticesAllowed(false);
+    EXPECT_FALSE(mesh->isCompactVerticesAllowed());
+}
+
 TEST_F(MeshTest, UploadEmptyMeshDoesNothing) {
     Mesh mesh;
 
@@ -516,6 +534,54 @@ TEST_F(MeshTest, CreateWireframeBoundsContainOriginal) {
     EXPECT_GE(wireMax.z, origMax.z - 0.02f);
 }
 
+TEST_F(MeshTest, ExtractEdgesDeduplicatesSharedEdges) {
+    // Two triangles sharing the 1-2 edge, plus a repeated triangle
+    std::vector<uint32_t> indices = {0, 1, 2, 2, 1, 3, 0, 1, 2};
+    auto edges = Mesh::extractEdges(indices);
+
+    std::vector<std::pair<uint32_t, uint32_t>> expected = {
+        {0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}};
+    EXPECT_EQ(edges, expected);
+}
+
+TEST_F(MeshTest, ExtractEdgesOfCubeFaces) {
+    // 6 faces with unshared vertices: 4 sides + 1 diagonal each
+    auto cube = Mesh::createCube(1.0f);
+    EXPECT_EQ(Mesh::extractEdges(cube->getIndices()).size(), 30u);
+}
+
+TEST_F(MeshTest, ExtractEdgesHandlesLargeIndices) {
+    std::vector<uint32_t> indices = {0x00FFFFFF, 0x01000000, 7, 7, 0x01000000, 0x00FFFFFF};
+    auto edges = Mesh::extractEdges(indices);
+
+    std::vector<std::pair<uint32_t, uint32_t>> expected = {
+        {7, 0x00FFFFFF}, {7, 0x01000000}, {0x00FFFFFF, 0x01000000}};
+    EXPECT_EQ(edges, expected);
+}
+
+TEST_F(MeshTest, CreateEdgeTubeIsUnitTube) {
+    auto tube = Mesh::createEdgeTube();
+    EXPECT_EQ(tube->getVertexCount(), 8u);
+    EXPECT_EQ(tube->getIndexCount(), 24u);
+    EXPECT_FALSE(tube->isCompactVerticesAllowed());
+    EXPECT_FLOAT_EQ(tube->getBoundsMin().z, 0.0f);
+    EXPECT_FLOAT_EQ(tube->getBoundsMax().z, 1.0f);
+}
+
+TEST_F(MeshTest, CreateEdgeInstancesMatchesBakedWireframe) {
+    auto sphere = Mesh::createSphere(0.5f, 8, 4);
+    auto instances = sphere->createEdgeInstances();
+    auto wireframe = Mesh::createWireframe(sphere, 0.01f);
+
+    // The baked wireframe has one 8-vertex tube per non-degenerate edge
+    EXPECT_GT(instances.size(), 0u);
+    EXPECT_EQ(instances.size() * 8, wireframe->getVertexCount());
+    for (const EdgeInstance& edge : instances) {
+        EXPECT_NEAR(glm::length(edge.start), 0.5f, 1e-4f);
+        EXPECT_NEAR(glm::length(edge.end), 0.5f, 1e-4f);
+    }
+}
+
 // ============================================================================
 // getBoundsCenter / getBoundingRadius Tests
 // ============================================================================
@@ -561,3 +627,82 @@ TEST_F(MeshTest, GetBoundsCenterOfPyramid) {
     EXPECT_NEAR(center.y, 0.25f, 0.01f);
     EXPECT_NEAR(center.z, 0.0f, 0.01f);
 }
+
+TEST_F(MeshTest, GenerateLODsBuildsShrinkingChain) {
+    auto mesh = Mesh::createSphere(1.0f, 64, 32);
+    EXPECT_EQ(mesh->getLODCount(), 1u);
+    EXPECT_EQ(mesh->getLOD(0), mesh.get());
+
+    size_t levels = mesh->generateLODs(4, 0.5f, 0.05f);
+    ASSERT_EQ(levels, 4u);
+    EXPECT_EQ(mesh->getLODCount(), 4u);
+
+    size_t previous = mesh->getIndexCount();
+    for (size_t level = 1; level < levels; ++level) {
+        Mesh* lod = mesh->getLOD(level);
+        ASSERT_NE(lod, nullptr);
+        EXPECT_LE(lod->getIndexCount(), previous / 2 + 3);
+        EXPECT_LT(lod->getVertexCount(), mesh->getVertexCount());
+        EXPECT_GE(mesh->getLODError(level), mesh->getLODError(level - 1));
+        EXPECT_LT(mesh->getLODError(level), 0.2f);
+        previous = lod->getIndexCount();
+    }
+
+    // Out-of-range levels clamp to the coarsest
+    EXPECT_EQ(mesh->getLOD(10), mesh->getLOD(3));
+}
+
+TEST_F(MeshTest, SetDataDiscardsLODs) {
+    auto mesh = Mesh::createSphere(1.0f, 32, 16);
+    ASSERT_GT(mesh->generateLODs(), 1u);
+
+    mesh->setData(mesh->getVertices(), mesh->getIndices());
+    EXPECT_EQ(mesh->getLODCount(), 1u);
+}
+
+TEST_F(MeshTest, GenerateLODsSkipsTinyMeshes) {
+    auto mesh = Mesh::createCube(1.0f);
+    EXPECT_EQ(mesh->generateLODs(), 1u);
+}
+
+TEST_F(MeshTest, LoadFromFileReadsLODsFromCache) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "vde_mesh_lod_cache_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    const std::string previousCache = Mesh::getCacheDirectory();
+    Mesh::setCacheDirectory((dir / "cache").string());
+
+    const std::string objPath = (dir / "grid.obj").string();
+    std::ofstream(objPath) << vde::test::makeObjGrid(24);
+
+    // The import stores its LOD chain with the mesh
+    Mesh imported;
+    ASSERT_TRUE(imported.loadFromFile(objPath));
+    ASSERT_GT(imported.getLODCount(), 1u);
+    Mesh cached;
+    ASSERT_TRUE(cached.loadFromFile(objPath));
+    ASSERT_EQ(cached.getLODCount(), imported.getLODCount());
+    for (size_t level = 1; level < imported.getLODCount(); ++level) {
+        EXPECT_EQ(cached.getLOD(level)->getIndices(), imported.getLOD(level)->getIndices());
+        EXPECT_FLOAT_EQ(cached.getLODError(level), imported.getLODError(level));
+    }
+
+    // A cache hit uses the stored levels as they are instead of simplifying
+    MeshCacheLOD single;
+    single.vertices.assign(imported.getVertices().begin(), imported.getVertices().begin() + 3);
+    single.indices = {0, 1, 2};
+    single.error = 0.5f;
+    MeshCache cache((dir / "cache").string());
+    ASSERT_TRUE(cache.store(ShaderHash::hashFile(objPath), imported.getVertices(),
+                            imported.getIndices(), imported.getBoundsMin(),
+                            imported.getBoundsMax(), {single}));
+    Mesh fromFile;
+    ASSERT_TRUE(fromFile.loadFromFile(objPath));
+    ASSERT_EQ(fromFile.getLODCount(), 2u);
+    EXPECT_EQ(fromFile.getLOD(1)->getIndexCount(), 3u);
+    EXPECT_FLOAT_EQ(fromFile.getLODError(1), 0.5f);
+
+    Mesh::setCacheDirectory(previousCache);
+    fs::remove_all(dir);
+}
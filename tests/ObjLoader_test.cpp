@@ -0,0 +1,115 @@
+/**
+ * @file ObjLoader_test.cpp
+ * @brief Unit tests for vde::ObjLoader (GPU-free)
+ */
+
+#include <vde/ObjLoader.h>
+#include <vde/api/ThreadPool.h>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "TestGeometry.h"
+
+namespace vde {
+namespace test {
+
+class ObjLoaderTest : public ::testing::Test {};
+
+TEST_F(ObjLoaderTest, SharedCornersAreDeduplicated) {
+    ObjMeshData data = ObjLoader::parse("v 0 0 0\n"
+                                        "v 1 0 0\n"
+                                        "v 1 1 0\n"
+                                        "v 0 1 0\n"
+                                        "f 1 2 3\n"
+                                        "f 1 3 4\n");
+
+    ASSERT_TRUE(data.isValid()) << data.error;
+    EXPECT_EQ(data.vertices.size(), 4u);
+    EXPECT_EQ(data.cornerCount, 6u);
+    EXPECT_EQ(data.indices, (std::vector<uint32_t>{0, 1, 2, 0, 2, 3}));
+    EXPECT_EQ(data.vertices[2].position, glm::vec3(1.0f, 1.0f, 0.0f));
+    EXPECT_EQ(data.vertices[0].color, glm::vec3(1.0f));
+}
+
+TEST_F(ObjLoaderTest, DistinctAttributesSplitVertices) {
+    ObjMeshData data = ObjLoader::parse("v 0 0 0\r\n"
+                                        "v 1 0 0\r\n"
+                                        "v 0 1 0\r\n"
+                                        "vt 0.25 0.75\r\n"
+                                        "vt 0.5 0.5\r\n"
+                                        "vn 0 0 -1\r\n"
+                                        "f 1/1/1 2/1/1 3/1/1\r\n"
+                                        "f 1/2/1 3/1/1 2/1\r\n");
+
+    ASSERT_TRUE(data.isValid()) << data.error;
+    // 1/2/1 and 2/1 differ from the first face's corners
+    EXPECT_EQ(data.vertices.size(), 5u);
+    EXPECT_EQ(data.vertices[0].texCoord, glm::vec2(0.25f, 0.75f));
+    EXPECT_EQ(data.vertices[0].color, glm::vec3(0.0f, 0.0f, 1.0f));
+    EXPECT_EQ(data.indices[3], 3u);
+    EXPECT_EQ(data.indices[4], 2u);
+    EXPECT_EQ(data.vertices[4].color, glm::vec3(1.0f));
+}
+
+TEST_F(ObjLoaderTest, PolygonsAreFanTriangulated) {
+    ObjMeshData data = ObjLoader::parse("v 0 0 0\nv 1 0 0\nv 2 1 0\nv 1 2 0\nv 0 1 0\n"
+                                        "f 1 2 3 4 5\n");
+
+    ASSERT_TRUE(data.isValid()) << data.error;
+    EXPECT_EQ(data.indices, (std::vector<uint32_t>{0, 1, 2, 0, 2, 3, 0, 3, 4}));
+}
+
+TEST_F(ObjLoaderTest, RelativeIndicesResolve) {
+    ObjMeshData relative = ObjLoader::parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf -3 -2 -1\n");
+    ObjMeshData absolute = ObjLoader::parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+
+    ASSERT_TRUE(relative.isValid()) << relative.error;
+    EXPECT_EQ(relative.indices, absolute.indices);
+    EXPECT_EQ(relative.vertices[1].position, absolute.vertices[1].position);
+}
+
+TEST_F(ObjLoaderTest, ParallelChunksMatchSerialParse) {
+    std::string text = makeObjGrid(40);
+    ObjMeshData serial = ObjLoader::parse(text);
+
+    ThreadPool pool(4);
+    ObjMeshData chunked = ObjLoader::parse(text, &pool, 512);
+
+    ASSERT_TRUE(serial.isValid()) << serial.error;
+    ASSERT_TRUE(chunked.isValid()) << chunked.error;
+    EXPECT_EQ(serial.vertices.size(), 41u * 41u);
+    EXPECT_EQ(serial.indices.size(), 40u * 40u * 6u);
+    EXPECT_EQ(chunked.indices, serial.indices);
+    ASSERT_EQ(chunked.vertices.size(), serial.vertices.size());
+    for (size_t i = 0; i < serial.vertices.size(); ++i) {
+        EXPECT_EQ(chunked.vertices[i].position, serial.vertices[i].position);
+    }
+}
+
+TEST_F(ObjLoaderTest, InvalidInputReportsError) {
+    EXPECT_FALSE(ObjLoader::parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n").isValid());
+    EXPECT_FALSE(ObjLoader::parse("v 0 zero 0\n").error.empty());
+    EXPECT_FALSE(ObjLoader::parse("v 0 0 0\nf 0 1 1\n").error.empty());
+    EXPECT_FALSE(ObjLoader::parse("# empty\n").isValid());
+}
+
+TEST_F(ObjLoaderTest, LoadsFromFile) {
+    auto path = std::filesystem::temp_directory_path() / "vde_obj_loader_test.obj";
+    std::ofstream(path, std::ios::binary) << "o tri\nv 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n";
+
+    ObjMeshData data = ObjLoader::load(path.string());
+    std::filesystem::remove(path);
+
+    ASSERT_TRUE(data.isValid()) << data.error;
+    EXPECT_EQ(data.positionCount, 3u);
+    EXPECT_EQ(data.indices.size(), 3u);
+
+    EXPECT_FALSE(ObjLoader::load(path.string()).error.empty());
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,142 @@
+/**
+ * @file PipelineCache_test.cpp
+ * @brief Unit tests for pipeline state hashing and the uninitialized cache (GPU-free)
+ */
+
+#include <vde/PipelineCache.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace vde {
+namespace test {
+
+class PipelineCacheTest : public ::testing::Test {
+  protected:
+    template <typename Handle>
+    static Handle fakeHandle(uintptr_t value) {
+        return reinterpret_cast<Handle>(value);
+    }
+
+    PipelineState makeState() {
+        PipelineState state;
+        state.vertexShader = fakeHandle<VkShaderModule>(0x10);
+        state.fragmentShader = fakeHandle<VkShaderModule>(0x20);
+        state.layout = fakeHandle<VkPipelineLayout>(0x30);
+        state.renderPass = fakeHandle<VkRenderPass>(0x40);
+
+        VkVertexInputBindingDescription binding{};
+        binding.binding = 0;
+        binding.stride = 32;
+        binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        state.vertexBindings = {binding};
+
+        for (uint32_t i = 0; i < 3; ++i) {
+            VkVertexInputAttributeDescription attribute{};
+            attribute.location = i;
+            attribute.binding = 0;
+            attribute.format = VK_FORMAT_R32G32B32_SFLOAT;
+            attribute.offset = i * 12;
+            state.vertexAttributes.push_back(attribute);
+        }
+        return state;
+    }
+};
+
+TEST_F(PipelineCacheTest, EqualStatesHashEqual) {
+    PipelineState a = makeState();
+    PipelineState b = makeState();
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_EQ(PipelineStateHash{}(a), PipelineStateHash{}(b));
+}
+
+TEST_F(PipelineCacheTest, PolygonModeDistinguishesVariants) {
+    PipelineState fill = makeState();
+    PipelineState wireframe = makeState();
+    wireframe.polygonMode = VK_POLYGON_MODE_LINE;
+
+    EXPECT_NE(fill, wireframe);
+    EXPECT_NE(fill.hash(), wireframe.hash());
+}
+
+TEST_F(PipelineCacheTest, BlendModeDistinguishesVariants) {
+    PipelineState opaque = makeState();
+    PipelineState alpha = makeState();
+    alpha.blendMode = PipelineBlendMode::Alpha;
+    PipelineState additive = makeState();
+    additive.blendMode = PipelineBlendMode::Additive;
+
+    EXPECT_NE(opaque, alpha);
+    EXPECT_NE(alpha, additive);
+    EXPECT_NE(opaque.hash(), alpha.hash());
+    EXPECT_NE(alpha.hash(), additive.hash());
+}
+
+TEST_F(PipelineCacheTest, VertexLayoutIsPartOfKey) {
+    PipelineState base = makeState();
+
+    PipelineState moved = makeState();
+    moved.vertexAttributes[2].offset = 28;
+    EXPECT_NE(base, moved);
+    EXPECT_NE(base.hash(), moved.hash());
+
+    PipelineState fewer = makeState();
+    fewer.vertexAttributes.pop_back();
+    EXPECT_NE(base, fewer);
+    EXPECT_NE(base.hash(), fewer.hash());
+
+    PipelineState instanced = makeState();
+    instanced.vertexBindings[0].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+    EXPECT_NE(base, instanced);
+}
+
+TEST_F(PipelineCacheTest, ShadersAndRenderPassArePartOfKey) {
+    PipelineState base = makeState();
+
+    PipelineState otherShader = makeState();
+    otherShader.fragmentShader = fakeHandle<VkShaderModule>(0x21);
+    EXPECT_NE(base, otherShader);
+
+    PipelineState otherPass = makeState();
+    otherPass.renderPass = fakeHandle<VkRenderPass>(0x41);
+    EXPECT_NE(base, otherPass);
+
+    PipelineState depth = makeState();
+    depth.depthTest = true;
+    EXPECT_NE(base, depth);
+}
+
+TEST_F(PipelineCacheTest, VariantsKeyUnorderedSet) {
+    std::unordered_set<PipelineState, PipelineStateHash> states;
+    PipelineState base = makeState();
+    states.insert(base);
+    states.insert(makeState());
+    EXPECT_EQ(states.size(), 1u);
+
+    base.cullMode = VK_CULL_MODE_NONE;
+    states.insert(base);
+    EXPECT_EQ(states.size(), 2u);
+}
+
+TEST_F(PipelineCacheTest, UninitializedCacheCreatesNothing) {
+    PipelineCache cache;
+    PipelineState state = makeState();
+
+    EXPECT_FALSE(cache.isInitialized());
+    EXPECT_EQ(cache.request(state), VK_NULL_HANDLE);
+    EXPECT_THROW(cache.get(state), std::runtime_error);
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.getStats().pipelinesCreated, 0u);
+
+    // Safe without a device
+    cache.waitIdle();
+    cache.shutdown();
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,89 @@
+/**
+ * @file PipelineDiskCache_test.cpp
+ * @brief Unit tests for pipeline cache header validation (GPU-free)
+ */
+
+#include <vde/PipelineDiskCache.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+namespace vde {
+namespace test {
+
+class PipelineDiskCacheTest : public ::testing::Test {
+  protected:
+    static constexpr uint32_t VENDOR_ID = 0x10DE;
+    static constexpr uint32_t DEVICE_ID = 0x2684;
+    uint8_t uuid[VK_UUID_SIZE] = {};
+
+    void SetUp() override {
+        for (uint8_t i = 0; i < VK_UUID_SIZE; ++i) {
+            uuid[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+    }
+
+    std::vector<uint8_t> makeBlob(uint32_t headerSize = PipelineDiskCache::HEADER_SIZE,
+                                  uint32_t version = VK_PIPELINE_CACHE_HEADER_VERSION_ONE,
+                                  uint32_t vendor = VENDOR_ID, uint32_t device = DEVICE_ID,
+                                  size_t payload = 64) {
+        std::vector<uint8_t> blob(PipelineDiskCache::HEADER_SIZE + payload, 0xAB);
+        std::memcpy(blob.data(), &headerSize, 4);
+        std::memcpy(blob.data() + 4, &version, 4);
+        std::memcpy(blob.data() + 8, &vendor, 4);
+        std::memcpy(blob.data() + 12, &device, 4);
+        std::memcpy(blob.data() + 16, uuid, VK_UUID_SIZE);
+        return blob;
+    }
+
+    bool validate(const std::vector<uint8_t>& blob) const {
+        return PipelineDiskCache::validateHeader(blob.data(), blob.size(), VENDOR_ID, DEVICE_ID,
+                                                 uuid);
+    }
+};
+
+TEST_F(PipelineDiskCacheTest, AcceptsMatchingHeader) {
+    EXPECT_TRUE(validate(makeBlob()));
+}
+
+TEST_F(PipelineDiskCacheTest, RejectsTruncatedBlob) {
+    auto blob = makeBlob();
+    blob.resize(PipelineDiskCache::HEADER_SIZE - 1);
+    EXPECT_FALSE(validate(blob));
+    EXPECT_FALSE(PipelineDiskCache::validateHeader(nullptr, 0, VENDOR_ID, DEVICE_ID, uuid));
+}
+
+TEST_F(PipelineDiskCacheTest, RejectsBadHeaderSize) {
+    EXPECT_FALSE(validate(makeBlob(8)));
+    EXPECT_FALSE(validate(makeBlob(100000)));
+}
+
+TEST_F(PipelineDiskCacheTest, RejectsUnknownHeaderVersion) {
+    EXPECT_FALSE(validate(makeBlob(PipelineDiskCache::HEADER_SIZE, 2)));
+}
+
+TEST_F(PipelineDiskCacheTest, RejectsOtherVendorOrDevice) {
+    EXPECT_FALSE(validate(makeBlob(PipelineDiskCache::HEADER_SIZE,
+                                   VK_PIPELINE_CACHE_HEADER_VERSION_ONE, 0x1002)));
+    EXPECT_FALSE(validate(makeBlob(PipelineDiskCache::HEADER_SIZE,
+                                   VK_PIPELINE_CACHE_HEADER_VERSION_ONE, VENDOR_ID, 0x1234)));
+}
+
+TEST_F(PipelineDiskCacheTest, RejectsDifferentDriverUuid) {
+    auto blob = makeBlob();
+    blob[16 + 5] ^= 0xFF;
+    EXPECT_FALSE(validate(blob));
+}
+
+TEST_F(PipelineDiskCacheTest, UninitializedCacheHasNoHandle) {
+    PipelineDiskCache cache("cache/test_pipeline_cache.bin");
+    EXPECT_EQ(cache.getHandle(), VK_NULL_HANDLE);
+    EXPECT_FALSE(cache.wasLoadedFromDisk());
+    EXPECT_FALSE(cache.save());
+    EXPECT_EQ(cache.getPath(), "cache/test_pipeline_cache.bin");
+}
+
+}  // namespace test
+}  // namespace vde
@@ -0,0 +1,382 @@
+/**
+ * @file RenderQueue_test.cpp
+ * @brief Unit tests for the sort-keyed RenderQueue
+ *
+ * All tests run without a GPU: fake handles are used for pipelines and
+ * descriptor sets, and flush() is given VK_NULL_HANDLE so that only the
+ * sort order and bind statistics are exercised.
+ */
+
+#include <vde/api/Mesh.h>
+#include <vde/api/RenderQueue.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace vde {
+namespace test {
+
+namespace {
+
+template <typename Handle>
+Handle fakeHandle(uintptr_t value) {
+    return reinterpret_cast<Handle>(value);
+}
+
+}  // namespace
+
+class RenderQueueTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        m_cube = Mesh::createCube();
+        m_sphere = Mesh::createSphere();
+        m_pipelineA = fakeHandle<VkPipeline>(0x1000);
+        m_pipelineB = fakeHandle<VkPipeline>(0x2000);
+        m_layout = fakeHandle<VkPipelineLayout>(0x3000);
+        m_setCamera = fakeHandle<VkDescriptorSet>(0x4000);
+        m_setLighting = fakeHandle<VkDescriptorSet>(0x5000);
+    }
+
+    RenderCommand makeCommand(VkPipeline pipeline, const Mesh* mesh, uint64_t key) {
+        RenderCommand command;
+        command.pipeline = pipeline;
+        command.pipelineLayout = m_layout;
+        command.descriptorSets[0] = m_setCamera;
+        command.descriptorSets[1] = m_setLighting;
+        command.descriptorSetCount = 2;
+        command.mesh = mesh;
+        command.sortKey = key;
+        return command;
+    }
+
+    ResourcePtr<Mesh> m_cube;
+    ResourcePtr<Mesh> m_sphere;
+    VkPipeline m_pipelineA = VK_NULL_HANDLE;
+    VkPipeline m_pipelineB = VK_NULL_HANDLE;
+    VkPipelineLayout m_layout = VK_NULL_HANDLE;
+    VkDescriptorSet m_setCamera = VK_NULL_HANDLE;
+    VkDescriptorSet m_setLighting = VK_NULL_HANDLE;
+};
+
+// ============================================================================
+// Sort key packing
+// ============================================================================
+
+TEST_F(RenderQueueTest, BucketOccupiesTopBits) {
+    uint64_t opaque = RenderSortKey::makeStateSorted(RenderPassBucket::Opaque, m_pipelineB,
+                                                     nullptr, m_cube.get(), 0xFFFFF);
+    uint64_t ordered =
+        RenderSortKey::makeOrdered(RenderPassBucket::Ordered, 0, m_pipelineA, nullptr);
+
+    EXPECT_LT(opaque, ordered);
+    EXPECT_EQ(RenderSortKey::getBucket(opaque), RenderPassBucket::Opaque);
+    EXPECT_EQ(RenderSortKey::getBucket(ordered), RenderPassBucket::Ordered);
+}
+
+TEST_F(RenderQueueTest, DepthIsLeastSignificantInStateSortedKey) {
+    uint64_t nearKey = RenderSortKey::makeStateSorted(RenderPassBucket::Opaque, m_pipelineA,
+                                                      nullptr, m_cube.get(), 10);
+    uint64_t farKey = RenderSortKey::makeStateSorted(RenderPassBucket::Opaque, m_pipelineA,
+                                                     nullptr, m_cube.get(), 20);
+    EXPECT_LT(nearKey, farKey);
+    EXPECT_EQ(farKey - nearKey, 10u);
+}
+
+TEST_F(RenderQueueTest, TransparentSortsAfterOpaqueFarToNear) {
+    const float farPlane = 100.0f;
+    uint64_t opaqueFar = RenderSortKey::makeStateSorted(
+        RenderPassBucket::Opaque, m_pipelineB, nullptr, m_sphere.get(),
+        RenderSortKey::quantizeDepth(90.0f, farPlane));
+    uint64_t glassNear = RenderSortKey::makeDepthSorted(
+        RenderPassBucket::Transparent, RenderSortKey::quantizeDepth(5.0f, farPlane, true),
+        m_pipelineA, nullptr, m_cube.get());
+    uint64_t glassFar = RenderSortKey::makeDepthSorted(
+        RenderPassBucket::Transparent, RenderSortKey::quantizeDepth(50.0f, farPlane, true),
+        m_pipelineB, nullptr, m_sphere.get());
+
+    RenderQueue queue;
+    queue.begin();
+    queue.submit(makeCommand(m_pipelineA, m_cube.get(), glassNear));
+    queue.submit(makeCommand(m_pipelineB, m_sphere.get(), opaqueFar));
+    queue.submit(makeCommand(m_pipelineB, m_sphere.get(), glassFar));
+    queue.sort();
+
+    // Depth outranks state among blended draws, farthest first
+    const auto& commands = queue.getCommands();
+    ASSERT_EQ(commands.size(), 3u);
+    EXPECT_EQ(commands[0].sortKey, opaqueFar);
+    EXPECT_EQ(commands[1].sortKey, glassFar);
+    EXPECT_EQ(commands[2].sortKey, glassNear);
+    EXPECT_EQ(RenderSortKey::getBucket(glassFar), RenderPassBucket::Transparent);
+}
+
+TEST_F(RenderQueueTest, SequenceDominatesOrderedKey) {
+    uint64_t first =
+        RenderSortKey::makeOrdered(RenderPassBucket::Ordered, 1, m_pipelineB, m_sphere.get());
+    uint64_t second =
+        RenderSortKey::makeOrdered(RenderPassBucket::Ordered, 2, m_pipelineA, m_cube.get());
+    EXPECT_LT(first, second);
+}
+
+TEST_F(RenderQueueTest, QuantizeDepthClampsAndInverts) {
+    constexpr uint32_t maxValue = (1u << RenderSortKey::DEPTH_BITS) - 1;
+    EXPECT_EQ(RenderSortKey::quantizeDepth(0.0f, 100.0f), 0u);
+    EXPECT_EQ(RenderSortKey::quantizeDepth(500.0f, 100.0f), maxValue);
+    EXPECT_EQ(RenderSortKey::quantizeDepth(-5.0f, 100.0f), 0u);
+    EXPECT_EQ(RenderSortKey::quantizeDepth(0.0f, 100.0f, true), maxValue);
+    EXPECT_LT(RenderSortKey::quantizeDepth(10.0f, 100.0f),
+              RenderSortKey::quantizeDepth(20.0f, 100.0f));
+    EXPECT_EQ(RenderSortKey::quantizeDepth(10.0f, 0.0f), 0u);
+}
+
+TEST_F(RenderQueueTest, FoldHandleFitsRequestedBits) {
+    for (uintptr_t i = 1; i < 1000; ++i) {
+        uint64_t folded = RenderSortKey::foldHandle(reinterpret_cast<const void*>(i * 64), 10);
+        EXPECT_LT(folded, 1u << 10);
+    }
+    EXPECT_EQ(RenderSortKey::foldHandle(nullptr, 10), 0u);
+}
+
+// ============================================================================
+// Radix sort
+// ============================================================================
+
+TEST_F(RenderQueueTest, RadixSortMatchesStableSort) {
+    std::mt19937_64 rng(1234);
+    std::vector<uint64_t> keys(2000);
+    for (auto& key : keys) {
+        // Limited range so duplicates exercise stability
+        key = rng() % 500;
+        key |= (rng() & 0x3) << 62;
+    }
+
+    std::vector<uint32_t> order;
+    RenderQueue::radixSort(keys, order);
+
+    std::vector<uint32_t> expected(keys.size());
+    std::iota(expected.begin(), expected.end(), 0u);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+
+    EXPECT_EQ(order, expected);
+}
+
+TEST_F(RenderQueueTest, RadixSortHandlesEmptyAndSingle) {
+    std::vector<uint32_t> order;
+    RenderQueue::radixSort({}, order);
+    EXPECT_TRUE(order.empty());
+
+    RenderQueue::radixSort({42}, order);
+    ASSERT_EQ(order.size(), 1u);
+    EXPECT_EQ(order[0], 0u);
+}
+
+TEST_F(RenderQueueTest, SortOrdersCommandsByKey) {
+    RenderQueue queue;
+    queue.begin();
+    queue.submit(makeCommand(m_pipelineA, m_cube.get(), 30));
+    queue.submit(makeCommand(m_pipelineA, m_cube.get(), 10));
+    queue.submit(makeCommand(m_pipelineA, m_cube.get(), 20));
+    queue.sort();
+
+    const auto& commands = queue.getCommands();
+    ASSERT_EQ(commands.size(), 3u);
+    EXPECT_EQ(commands[0].sortKey, 10u);
+    EXPECT_EQ(commands[1].sortKey, 20u);
+    EXPECT_EQ(commands[2].sortKey, 30u);
+}
+
+// ============================================================================
+// Emission statistics
+// ============================================================================
+
+TEST_F(RenderQueueTest, IdenticalStateIsBoundOnce) {
+    RenderQueue queue;
+    queue.begin();
+    for (uint32_t i = 0; i < 10; ++i) {
+        queue.submit(makeCommand(m_pipelineA, m_cube.get(),
+                                 RenderSortKey::makeOrdered(RenderPassBucket::Ordered,
+                                                            queue.nextSequence(), m_pipelineA,
+                                                            m_cube.get())));
+    }
+    queue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+
+    const RenderQueueStats& stats = queue.getStats();
+    EXPECT_EQ(stats.commandsSubmitted, 10u);
+    EXPECT_EQ(stats.drawCalls, 10u);
+    EXPECT_EQ(stats.triangles, 10 * m_cube->getIndexCount() / 3);
+    EXPECT_EQ(stats.pipelineBinds, 1u);
+    EXPECT_EQ(stats.pipelineBindsSkipped, 9u);
+    EXPECT_EQ(stats.descriptorSetBinds, 2u);
+    EXPECT_EQ(stats.descriptorSetBindsSkipped, 18u);
+    EXPECT_EQ(stats.meshBinds, 1u);
+    EXPECT_EQ(stats.meshBindsSkipped, 9u);
+    EXPECT_EQ(stats.getBindsIssued(), 4u);
+    EXPECT_EQ(stats.getBindsSkipped(), 36u);
+}
+
+TEST_F(RenderQueueTest, DynamicOffsetChangeRebindsSet) {
+    RenderQueue queue;
+    queue.begin();
+    for (uint32_t i = 0; i < 4; ++i) {
+        RenderCommand command = makeCommand(
+            m_pipelineA, m_cube.get(),
+            RenderSortKey::makeOrdered(RenderPassBucket::Ordered, queue.nextSequence(),
+                                       m_pipelineA, m_cube.get()));
+        // Two draws per view slot; only the camera set moves between them
+        command.dynamicOffsetMask = 0b11;
+        command.dynamicOffsets = {(i / 2) * 256u, 0u};
+        queue.submit(command);
+    }
+    queue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+
+    const RenderQueueStats& stats = queue.getStats();
+    EXPECT_EQ(stats.descriptorSetBinds, 3u);
+    EXPECT_EQ(stats.descriptorSetBindsSkipped, 5u);
+}
+
+TEST_F(RenderQueueTest, InstancedDrawCountsEveryInstance) {
+    RenderQueue queue;
+    queue.begin();
+    RenderCommand command = makeCommand(m_pipelineA, m_cube.get(), 0);
+    command.instanceBuffer = fakeHandle<VkBuffer>(0x6000);
+    command.instanceCount = 1000;
+    queue.submit(command);
+    command.instanceCount = 0;
+    queue.submit(command);
+    queue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+
+    const RenderQueueStats& stats = queue.getStats();
+    EXPECT_EQ(stats.drawCalls, 1u);
+    EXPECT_EQ(stats.triangles, 1000 * m_cube->getIndexCount() / 3);
+}
+
+TEST_F(RenderQueueTest, StateSortingGroupsInterleavedSubmissions) {
+    RenderQueue queue;
+    queue.begin();
+    for (uint32_t i = 0; i < 8; ++i) {
+        VkPipeline pipeline = (i % 2 == 0) ? m_pipelineA : m_pipelineB;
+        const Mesh* mesh = (i % 4 < 2) ? m_cube.get() : m_sphere.get();
+        queue.submit(makeCommand(pipeline, mesh,
+                                 RenderSortKey::makeStateSorted(RenderPassBucket::Opaque,
+                                                                pipeline, nullptr, mesh, i)));
+    }
+    queue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+
+    const RenderQueueStats& stats = queue.getStats();
+    EXPECT_EQ(stats.drawCalls, 8u);
+    EXPECT_EQ(stats.pipelineBinds, 2u);
+    // Each pipeline group contains both meshes, one bind per mesh per group
+    EXPECT_EQ(stats.meshBinds, 4u);
+}
+
+TEST_F(RenderQueueTest, SubmissionOrderKeepsInterleavedBinds) {
+    RenderQueue queue;
+    queue.begin();
+    for (uint32_t i = 0; i < 8; ++i) {
+        VkPipeline pipeline = (i % 2 == 0) ? m_pipelineA : m_pipelineB;
+        queue.submit(makeCommand(pipeline, m_cube.get(),
+                                 RenderSortKey::makeOrdered(RenderPassBucket::Ordered,
+                                                            queue.nextSequence(), pipeline,
+                                                            m_cube.get())));
+    }
+    queue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+
+    EXPECT_EQ(queue.getStats().pipelineBinds, 8u);
+    EXPECT_EQ(queue.getStats().meshBinds, 1u);
+}
+
+TEST_F(RenderQueueTest, FlushClearsQueueAndEndsRecording) {
+    RenderQueue queue;
+    queue.begin();
+    EXPECT_TRUE(queue.isRecording());
+    queue.submit(makeCommand(m_pipelineA, m_cube.get(), 0));
+    EXPECT_EQ(queue.size(), 1u);
+
+    queue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+    EXPECT_FALSE(queue.isRecording());
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST_F(RenderQueueTest, RecordRangesAreSelfContained) {
+    RenderQueue queue;
+    queue.begin();
+    for (uint32_t i = 0; i < 10; ++i) {
+        queue.submit(makeCommand(m_pipelineA, m_cube.get(), i));
+    }
+    queue.end();
+    EXPECT_FALSE(queue.isRecording());
+    EXPECT_EQ(queue.size(), 10u);
+
+    // Two chunks, as recorded into two secondary command buffers
+    RenderQueueStats first;
+    RenderQueueStats second;
+    queue.record(VK_NULL_HANDLE, VkViewport{}, VkRect2D{}, 0, 6, first);
+    queue.record(VK_NULL_HANDLE, VkViewport{}, VkRect2D{}, 6, 100, second);
+
+    EXPECT_EQ(first.drawCalls, 6u);
+    EXPECT_EQ(second.drawCalls, 4u);
+    // Each chunk starts with no bound state
+    EXPECT_EQ(first.pipelineBinds, 1u);
+    EXPECT_EQ(second.pipelineBinds, 1u);
+    EXPECT_EQ(second.meshBinds, 1u);
+
+    // Recording does not consume the queue; clear() does
+    EXPECT_EQ(queue.size(), 10u);
+    queue.clear();
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST_F(RenderQueueTest, RecordOutOfRangeIsNoOp) {
+    RenderQueue queue;
+    queue.begin();
+    queue.submit(makeCommand(m_pipelineA, m_cube.get(), 0));
+    queue.end();
+
+    RenderQueueStats stats;
+    queue.record(VK_NULL_HANDLE, VkViewport{}, VkRect2D{}, 5, 1, stats);
+    queue.record(VK_NULL_HANDLE, VkViewport{}, VkRect2D{}, 0, 0, stats);
+    EXPECT_EQ(stats.drawCalls, 0u);
+}
+
+TEST_F(RenderQueueTest, CommandsWithoutPipelineAreDropped) {
+    RenderQueue queue;
+    queue.begin();
+    queue.submit(makeCommand(VK_NULL_HANDLE, m_cube.get(), 0));
+    queue.flush(VK_NULL_HANDLE, VkViewport{}, VkRect2D{});
+
+    EXPECT_EQ(queue.getStats().commandsSubmitted, 1u);
+    EXPECT_EQ(queue.getStats().drawCalls, 0u);
+}
+
+TEST_F(RenderQueueTest, PushConstantsRejectOversizedData) {
+    RenderCommand command;
+    uint8_t data[RenderCommand::MAX_PUSH_CONSTANT_SIZE + 1] = {};
+    EXPECT_FALSE(command.setPushConstants(VK_SHADER_STAGE_VERTEX_BIT, data, sizeof(data)));
+    EXPECT_TRUE(command.setPushConstants(VK_SHADER_STAGE_VERTEX_BIT, data, 112));
+    EXPECT_EQ(command.pushConstantSize, 112u);
+}
+
+TEST_F(RenderQueueTest, StatsAccumulate) {
+    RenderQueueStats a;
+    a.drawCalls = 3;
+    a.triangles = 30;
+    a.pipelineBindsSkipped = 2;
+    RenderQueueStats b;
+    b.drawCalls = 4;
+    b.triangles = 12;
+    b.meshBinds = 1;
+    a += b;
+    EXPECT_EQ(a.drawCalls, 7u);
+    EXPECT_EQ(a.triangles, 42u);
+    EXPECT_EQ(a.getBindsSkipped(), 2u);
+    EXPECT_EQ(a.getBindsIssued(), 1u);
+}
+
+}  // namespace test
+}  // namespace vde
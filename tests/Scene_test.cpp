@@ -9,6 +9,7 @@
 #include <vde/api/Entity.h>
 #include <vde/api/GameCamera.h>
 #include <vde/api/LightBox.h>
+#include <vde/api/Mesh.h>
 #include <vde/api/Scene.h>
 #include <vde/api/ViewportRect.h>
 #include <vde/api/WorldBounds.h>
@@ -144,6 +145,50 @@ TEST_F(SceneTest, GetCameraDefaultNull) {
     EXPECT_EQ(scene->getCamera(), nullptr);
 }
 
+// ============================================================================
+// Picking Tests
+// ============================================================================
+
+TEST_F(SceneTest, RaycastReturnsNearestMeshTriangle) {
+    auto cube = Mesh::createCube(1.0f);
+    auto far = scene->addEntity<MeshEntity>();
+    far->setMesh(cube);
+    far->setPosition(0.0f, 0.0f, -5.0f);
+    auto near = scene->addEntity<MeshEntity>();
+    near->setMesh(cube);
+    near->setScale(2.0f);
+
+    Ray ray;
+    ray.origin = glm::vec3(0.1f, 0.2f, 10.0f);
+    ray.direction = glm::vec3(0.0f, 0.0f, -2.0f);
+
+    SceneRayHit hit;
+    ASSERT_TRUE(scene->raycast(ray, hit));
+    EXPECT_EQ(hit.entity, near.get());
+    EXPECT_NEAR(hit.point.z, 1.0f, 1e-4f);
+    EXPECT_NEAR(hit.distance, 9.0f, 1e-4f);
+    EXPECT_LT(hit.triangle, cube->getIndexCount() / 3);
+
+    // Hidden entities and short rays miss
+    near->setVisible(false);
+    ASSERT_TRUE(scene->raycast(ray, hit));
+    EXPECT_EQ(hit.entity, far.get());
+    EXPECT_NEAR(hit.point.z, -4.5f, 1e-4f);
+    EXPECT_FALSE(scene->raycast(ray, hit, 10.0f));
+}
+
+TEST_F(SceneTest, PickThroughCamera) {
+    auto entity = scene->addEntity<MeshEntity>();
+    entity->setMesh(Mesh::createCube(1.0f));
+    scene->setCamera(new SimpleCamera(Position(0.0f, 0.0f, 5.0f), Direction(0.0f, 0.0f, -1.0f)));
+
+    SceneRayHit hit;
+    ASSERT_TRUE(scene->pick(400.0f, 300.0f, 800.0f, 600.0f, hit));
+    EXPECT_EQ(hit.entity, entity.get());
+    EXPECT_NEAR(hit.point.z, 0.5f, 1e-3f);
+    EXPECT_FALSE(scene->pick(0.0f, 0.0f, 800.0f, 600.0f, hit));
+}
+
 // ============================================================================
 // Lighting Tests
 // ============================================================================
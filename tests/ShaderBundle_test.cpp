@@ -0,0 +1,57 @@
+/**
+ * @file ShaderBundle_test.cpp
+ * @brief Unit tests for the embedded shader lookup (GPU-free)
+ *
+ * Holds whether or not the library was configured with VDE_EMBED_SHADERS.
+ */
+
+#include <vde/ShaderBundle.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace vde {
+namespace test {
+
+class ShaderBundleTest : public ::testing::Test {
+  protected:
+    static constexpr uint32_t SPIRV_MAGIC = 0x07230203;
+};
+
+TEST_F(ShaderBundleTest, UnknownShaderIsEmpty) {
+    EXPECT_TRUE(ShaderBundle::find("does_not_exist.vert").empty());
+    EXPECT_TRUE(ShaderBundle::find("").empty());
+    EXPECT_FALSE(ShaderBundle::contains("does_not_exist.vert"));
+}
+
+TEST_F(ShaderBundleTest, TableIsSortedByName) {
+    auto shaders = ShaderBundle::getShaders();
+    EXPECT_TRUE(std::is_sorted(
+        shaders.begin(), shaders.end(),
+        [](const EmbeddedShader& a, const EmbeddedShader& b) { return a.name < b.name; }));
+    EXPECT_EQ(ShaderBundle::isEmbedded(), !shaders.empty());
+}
+
+TEST_F(ShaderBundleTest, EveryEmbeddedShaderIsFoundAsValidSpirv) {
+    for (const EmbeddedShader& shader : ShaderBundle::getShaders()) {
+        auto spirv = ShaderBundle::find(shader.name);
+        ASSERT_EQ(spirv.size(), shader.wordCount) << shader.name;
+        EXPECT_EQ(spirv.data(), shader.code) << shader.name;
+        ASSERT_FALSE(spirv.empty()) << shader.name;
+        EXPECT_EQ(spirv[0], SPIRV_MAGIC) << shader.name;
+    }
+}
+
+TEST_F(ShaderBundleTest, EngineShadersPresentWhenEmbedded) {
+    if (!ShaderBundle::isEmbedded()) {
+        GTEST_SKIP() << "Built without VDE_EMBED_SHADERS";
+    }
+    EXPECT_TRUE(ShaderBundle::contains("mesh.vert"));
+    EXPECT_TRUE(ShaderBundle::contains("mesh.frag"));
+    EXPECT_TRUE(ShaderBundle::contains("simple_sprite.vert"));
+    EXPECT_TRUE(ShaderBundle::contains("simple_sprite.frag"));
+}
+
+}  // namespace test
+}  // namespace vde
@@ -1,12 +1,15 @@
 /**
  * @file ShaderCache_test.cpp
- * @brief Unit tests for vde::ShaderHash class.
+ * @brief Unit tests for vde::ShaderHash and batch ShaderCache loading.
  */
 
 #include <vde/ShaderCache.h>
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+
 namespace vde {
 namespace test {
 
@@ -36,8 +39,31 @@ TEST_F(ShaderHashTest, DifferentContentProducesDifferentHash) {
 
 TEST_F(ShaderHashTest, EmptyStringProducesValidHash) {
     uint64_t hash = hasher.hash("");
-    // FNV-1a basis should be returned for empty string
-    EXPECT_NE(hash, 0);
+    // XXH64 of empty input with seed 0
+    EXPECT_EQ(hash, 0xEF46DB3751D8E999ULL);
+}
+
+TEST_F(ShaderHashTest, MatchesXXH64ReferenceValue) {
+    EXPECT_EQ(hasher.hash("abc"), 0x44BC2CF5AD770999ULL);
+}
+
+TEST_F(ShaderHashTest, PointerAndStringOverloadsAgree) {
+    // Long enough to exercise the 32-byte stripe loop and every tail path
+    std::string content(1000 + 13, 'x');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>('a' + (i * 7) % 26);
+    }
+    EXPECT_EQ(hasher.hash(content), hasher.hash(content.data(), content.size()));
+}
+
+TEST_F(ShaderHashTest, HashFileMatchesContentHash) {
+    auto path = std::filesystem::temp_directory_path() / "vde_shader_hash_test.frag";
+    std::string content = "#version 450\nvoid main() {}\n";
+    std::ofstream(path, std::ios::binary) << content;
+
+    EXPECT_EQ(ShaderHash::hashFile(path.string()), ShaderHash::hash(content));
+    std::filesystem::remove(path);
+    EXPECT_EQ(ShaderHash::hashFile(path.string()), 0u);
 }
 
 TEST_F(ShaderHashTest, WhitespaceChangesHash) {
@@ -76,5 +102,126 @@ TEST_F(ShaderHashTest, SpecialCharactersHashCorrectly) {
     EXPECT_NE(hash, 0);
 }
 
+// ============================================================================
+// ShaderCache::loadShaders (cache hits only; no glslang compilation needed)
+// ============================================================================
+
+class ShaderCacheBatchTest : public ::testing::Test {
+  protected:
+    std::filesystem::path root;
+    std::string cacheDir;
+
+    void SetUp() override {
+        root = std::filesystem::temp_directory_path() / "vde_shader_cache_batch_test";
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+        cacheDir = (root / "cache").string();
+        std::filesystem::create_directories(cacheDir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(root); }
+
+    // Write a source file plus a matching cached .spv, return the source path
+    std::string addCachedShader(const std::string& name, uint32_t marker,
+                                std::string& manifestEntries) {
+        std::string sourcePath = (root / name).string();
+        std::string source = "// " + name + "\nvoid main() {}\n";
+        std::ofstream(sourcePath, std::ios::binary) << source;
+
+        uint64_t hash = ShaderHash::hash(source);
+        std::string spvFile = ShaderHash::toHexString(hash) + ".spv";
+        uint32_t words[2] = {0x07230203, marker};
+        std::ofstream spv(cacheDir + "/" + spvFile, std::ios::binary);
+        spv.write(reinterpret_cast<const char*>(words), sizeof(words));
+
+        if (!manifestEntries.empty()) {
+            manifestEntries += ",\n";
+        }
+        manifestEntries += "{ \"sourcePath\": \"" + sourcePath + "\", \"sourceHash\": \"" +
+                           ShaderHash::toHexString(hash) + "\", \"spvFile\": \"" + spvFile +
+                           "\", \"stage\": \"fragment\" }";
+        return sourcePath;
+    }
+
+    void writeManifest(const std::string& entries) {
+        std::ofstream(cacheDir + "/manifest.json")
+            << "{ \"version\": 1, \"entries\": [\n" << entries << "\n] }\n";
+    }
+};
+
+TEST_F(ShaderCacheBatchTest, LoadsCachedShadersInInputOrder) {
+    std::string entries;
+    std::string a = addCachedShader("a.frag", 1, entries);
+    std::string b = addCachedShader("b.frag", 2, entries);
+    std::string c = addCachedShader("c.frag", 3, entries);
+    writeManifest(entries);
+
+    ShaderCache cache(cacheDir);
+    ASSERT_TRUE(cache.initialize());
+    ASSERT_EQ(cache.getCacheEntryCount(), 3u);
+
+    std::vector<std::string> paths = {c, a, b};
+    auto results = cache.loadShaders(paths);
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0][1], 3u);
+    EXPECT_EQ(results[1][1], 1u);
+    EXPECT_EQ(results[2][1], 2u);
+    EXPECT_EQ(cache.getCacheHits(), 3u);
+    EXPECT_EQ(cache.getCacheMisses(), 0u);
+}
+
+TEST_F(ShaderCacheBatchTest, DuplicatePathsLoadOnce) {
+    std::string entries;
+    std::string a = addCachedShader("a.frag", 7, entries);
+    writeManifest(entries);
+
+    ShaderCache cache(cacheDir);
+    std::vector<std::string> paths = {a, a, a};
+    auto results = cache.loadShaders(paths);
+
+    ASSERT_EQ(results.size(), 3u);
+    for (const auto& spirv : results) {
+        ASSERT_EQ(spirv.size(), 2u);
+        EXPECT_EQ(spirv[1], 7u);
+    }
+    EXPECT_EQ(cache.getCacheHits(), 1u);
+}
+
+TEST_F(ShaderCacheBatchTest, TouchedButUnchangedSourceIsStillCurrent) {
+    std::string entries;
+    std::string a = addCachedShader("a.frag", 1, entries);
+    writeManifest(entries);
+
+    ShaderCache cache(cacheDir);
+    ASSERT_TRUE(cache.initialize());
+    EXPECT_FALSE(cache.hasSourceChanged(a));
+
+    // New write time, same bytes: falls back to hashing and still matches
+    std::filesystem::last_write_time(
+        a, std::filesystem::last_write_time(a) + std::chrono::seconds(5));
+    EXPECT_FALSE(cache.hasSourceChanged(a));
+
+    std::ofstream(a, std::ios::binary | std::ios::app) << "// edited\n";
+    EXPECT_TRUE(cache.hasSourceChanged(a));
+}
+
+TEST_F(ShaderCacheBatchTest, MissingSourceCountsAsMiss) {
+    std::string entries;
+    std::string a = addCachedShader("a.frag", 1, entries);
+    writeManifest(entries);
+
+    ShaderCache cache(cacheDir);
+    std::vector<std::string> paths = {a, (root / "missing.frag").string()};
+    auto results = cache.loadShaders(paths);
+
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_FALSE(results[0].empty());
+    EXPECT_TRUE(results[1].empty());
+    EXPECT_EQ(cache.getCacheHits(), 1u);
+    EXPECT_EQ(cache.getCacheMisses(), 1u);
+    EXPECT_FALSE(cache.getLastError().empty());
+}
+
 }  // namespace test
 }  // namespace vde
@@ -0,0 +1,168 @@
+/**
+ * @file StaticBatch_test.cpp
+ * @brief Unit tests for static geometry batching (GPU-free)
+ */
+
+#include <vde/Camera.h>
+#include <vde/api/Entity.h>
+#include <vde/api/Material.h>
+#include <vde/api/Mesh.h>
+#include <vde/api/Scene.h>
+#include <vde/api/StaticBatch.h>
+
+#include <gtest/gtest.h>
+
+using namespace vde;
+
+class StaticBatchTest : public ::testing::Test {
+  protected:
+    std::unique_ptr<Scene> scene;
+    std::shared_ptr<Mesh> cube;
+
+    void SetUp() override {
+        scene = std::make_unique<Scene>();
+        cube = Mesh::createCube(1.0f);
+    }
+
+    std::shared_ptr<MeshEntity> addProp(const glm::vec3& position, bool isStatic = true) {
+        auto entity = scene->addEntity<MeshEntity>();
+        entity->setMesh(cube);
+        entity->setPosition(position);
+        entity->setStatic(isStatic);
+        return entity;
+    }
+};
+
+TEST_F(StaticBatchTest, MergesPropsSharingMaterialAndCell) {
+    for (int i = 0; i < 10; ++i) {
+        addProp(glm::vec3(float(i), 0.0f, 0.0f));
+    }
+
+    EXPECT_EQ(scene->buildStaticBatches(32.0f), 1u);
+    const StaticBatch& batch = scene->getStaticBatch();
+    ASSERT_EQ(batch.getChunkCount(), 1u);
+    EXPECT_EQ(batch.getSourceCount(), 10u);
+
+    const StaticBatch::Chunk& chunk = batch.getChunks()[0];
+    EXPECT_EQ(chunk.sources.size(), 10u);
+    EXPECT_EQ(chunk.entity->getMesh()->getIndexCount(), 10 * cube->getIndexCount());
+    EXPECT_EQ(chunk.entity->getMesh()->getVertexCount(), 10 * cube->getVertexCount());
+}
+
+TEST_F(StaticBatchTest, BakesWorldTransform) {
+    addProp(glm::vec3(100.0f, 5.0f, -20.0f));
+    scene->buildStaticBatches();
+
+    const StaticBatch::Chunk& chunk = scene->getStaticBatch().getChunks()[0];
+    EXPECT_NEAR(chunk.boundsMin.x, 99.5f, 1e-4f);
+    EXPECT_NEAR(chunk.boundsMax.x, 100.5f, 1e-4f);
+    EXPECT_NEAR(chunk.boundsMin.y, 4.5f, 1e-4f);
+    EXPECT_NEAR(chunk.boundsMin.z, -20.5f, 1e-4f);
+
+    // The chunk entity draws with an identity transform
+    EXPECT_EQ(chunk.entity->getModelMatrix(), glm::mat4(1.0f));
+}
+
+TEST_F(StaticBatchTest, SplitsByCellMaterialAndColor) {
+    addProp(glm::vec3(0.0f));
+    addProp(glm::vec3(100.0f, 0.0f, 0.0f));  // another cell
+    addProp(glm::vec3(1.0f, 0.0f, 0.0f))->setColor(Color(1.0f, 0.0f, 0.0f, 1.0f));
+    addProp(glm::vec3(2.0f, 0.0f, 0.0f))->setMaterial(std::make_shared<Material>());
+
+    EXPECT_EQ(scene->buildStaticBatches(32.0f), 4u);
+}
+
+TEST_F(StaticBatchTest, OnlyStaticVisibleEntitiesAreBatched) {
+    auto prop = addProp(glm::vec3(0.0f));
+    auto dynamic = addProp(glm::vec3(1.0f), false);
+    auto hidden = addProp(glm::vec3(2.0f));
+    hidden->setVisible(false);
+
+    scene->buildStaticBatches();
+    EXPECT_TRUE(prop->isStaticBatched());
+    EXPECT_FALSE(dynamic->isStaticBatched());
+    EXPECT_FALSE(hidden->isStaticBatched());
+    EXPECT_EQ(scene->getStaticBatch().getSourceCount(), 1u);
+}
+
+TEST_F(StaticBatchTest, VertexColorAlbedoEntitiesStayUnbatched) {
+    auto prop = addProp(glm::vec3(0.0f));
+    auto blackColor = addProp(glm::vec3(1.0f));
+    blackColor->setColor(Color(0.0f, 0.0f, 0.0f, 1.0f));
+    auto blackMaterial = addProp(glm::vec3(2.0f));
+    blackMaterial->setMaterial(std::make_shared<Material>(Color(0.0f, 0.0f, 0.0f, 1.0f)));
+
+    EXPECT_EQ(scene->buildStaticBatches(), 1u);
+    EXPECT_TRUE(prop->isStaticBatched());
+    EXPECT_FALSE(blackColor->isStaticBatched());
+    EXPECT_FALSE(blackMaterial->isStaticBatched());
+    EXPECT_EQ(scene->getStaticBatch().getSourceCount(), 1u);
+}
+
+TEST_F(StaticBatchTest, EntitiesStayAddressable) {
+    auto prop = addProp(glm::vec3(0.0f));
+    prop->setName("crate");
+    addProp(glm::vec3(1.0f));
+    scene->buildStaticBatches();
+
+    EXPECT_EQ(scene->getEntities().size(), 2u);
+    EXPECT_EQ(scene->getEntityByName("crate"), prop.get());
+    EXPECT_TRUE(scene->getStaticBatch().contains(prop->getId()));
+
+    // Removing a batched entity rebuilds without it
+    scene->removeEntity(prop->getId());
+    EXPECT_FALSE(scene->getStaticBatch().contains(prop->getId()));
+    EXPECT_EQ(scene->getStaticBatch().getSourceCount(), 1u);
+
+    scene->clearStaticBatches();
+    EXPECT_EQ(scene->getStaticBatch().getChunkCount(), 0u);
+    for (const auto& entity : scene->getEntities()) {
+        EXPECT_FALSE(std::static_pointer_cast<MeshEntity>(entity)->isStaticBatched());
+    }
+}
+
+TEST_F(StaticBatchTest, ChunksAreLedByTheirFirstSceneEntity) {
+    auto first = addProp(glm::vec3(0.0f));
+    auto dynamic = addProp(glm::vec3(2.0f), false);
+    auto second = addProp(glm::vec3(1.0f));
+    auto far = addProp(glm::vec3(100.0f, 0.0f, 0.0f));
+    StaticBatch batch;
+    ASSERT_EQ(batch.build({first, second, far}, scene.get(), 32.0f), 2u);
+
+    const StaticBatch::Chunk* chunk = batch.findChunkLedBy(first->getId());
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ(chunk->sources.front(), first->getId());
+    EXPECT_EQ(batch.findChunkLedBy(second->getId()), nullptr);
+    EXPECT_EQ(batch.findChunkLedBy(dynamic->getId()), nullptr);
+    EXPECT_NE(batch.findChunkLedBy(far->getId()), nullptr);
+
+    // Culling decides which leaders submit a chunk in submission order
+    Camera camera;
+    camera.setPosition(glm::vec3(0.0f, 0.0f, 10.0f));
+    camera.setTarget(glm::vec3(0.0f));
+    camera.setPerspective(60.0f, 1.0f, 0.1f, 50.0f);
+    glm::mat4 viewProjection = camera.getViewProjectionMatrix();
+    batch.cull(&viewProjection);
+    EXPECT_EQ(batch.getVisibleChunkCount(), 1u);
+    EXPECT_TRUE(chunk->visible);
+    EXPECT_FALSE(batch.findChunkLedBy(far->getId())->visible);
+    EXPECT_TRUE(batch.renderChunkLedBy(first->getId()));
+    EXPECT_FALSE(batch.renderChunkLedBy(far->getId()));
+    EXPECT_FALSE(batch.renderChunkLedBy(dynamic->getId()));
+}
+
+TEST_F(StaticBatchTest, FrustumRejectsBoxesBehindCamera) {
+    Camera camera;
+    camera.setPosition(glm::vec3(0.0f, 0.0f, 10.0f));
+    camera.setTarget(glm::vec3(0.0f));
+    camera.setPerspective(60.0f, 1.0f, 0.1f, 100.0f);
+    glm::mat4 viewProjection = camera.getViewProjectionMatrix();
+
+    EXPECT_TRUE(StaticBatch::intersectsFrustum(viewProjection, glm::vec3(-1.0f), glm::vec3(1.0f)));
+    EXPECT_FALSE(StaticBatch::intersectsFrustum(viewProjection, glm::vec3(-1.0f, -1.0f, 20.0f),
+                                                glm::vec3(1.0f, 1.0f, 22.0f)));
+    EXPECT_FALSE(StaticBatch::intersectsFrustum(viewProjection, glm::vec3(50.0f, -1.0f, -1.0f),
+                                                glm::vec3(52.0f, 1.0f, 1.0f)));
+    EXPECT_FALSE(StaticBatch::intersectsFrustum(viewProjection, glm::vec3(-1.0f, -1.0f, -200.0f),
+                                                glm::vec3(1.0f, 1.0f, -150.0f)));
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file TestGeometry.h
+ * @brief Procedural geometry shared by the mesh processing tests
+ */
+
+#include <vde/Types.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vde {
+namespace test {
+
+/**
+ * @brief Append a flat n x n quad grid in the XY plane at z = 0.
+ *
+ * Vertices run row by row with UVs across [0, 1]; quads are emitted in
+ * the same order, which thrashes a small post-transform cache.
+ */
+inline void makeGrid(int n, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    const uint32_t base = static_cast<uint32_t>(vertices.size());
+    for (int y = 0; y <= n; ++y) {
+        for (int x = 0; x <= n; ++x) {
+            Vertex v{};
+            v.position = glm::vec3(float(x), float(y), 0.0f);
+            v.color = glm::vec3(0.0f, 0.0f, 1.0f);
+            v.texCoord = glm::vec2(float(x) / float(n), float(y) / float(n));
+            vertices.push_back(v);
+        }
+    }
+    const uint32_t row = n + 1;
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            uint32_t a = base + y * row + x;
+            indices.insert(indices.end(), {a, a + 1, a + row, a + 1, a + row + 1, a + row});
+        }
+    }
+}
+
+/**
+ * @brief A flat n x n quad grid as OBJ text: shared corners, one normal, quad faces.
+ *
+ * One corner per face uses a relative normal index to cover that syntax.
+ */
+inline std::string makeObjGrid(int n) {
+    std::string text = "# grid\nvn 0 0 1\n";
+    for (int y = 0; y <= n; ++y) {
+        for (int x = 0; x <= n; ++x) {
+            text += "v " + std::to_string(x) + " " + std::to_string(y) + " 0\n";
+        }
+    }
+    const int row = n + 1;
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            int a = y * row + x + 1;
+            text += "f " + std::to_string(a) + "//1 " + std::to_string(a + 1) + "//1 " +
+                    std::to_string(a + row + 1) + "//-1 " + std::to_string(a + row) + "//1\n";
+        }
+    }
+    return text;
+}
+
+}  // namespace test
+}  // namespace vde
@@ -11,6 +11,7 @@
 #include <chrono>
 #include <mutex>
 #include <set>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -178,6 +179,44 @@ TEST_F(ThreadPoolTest, RepeatedSubmitWaitCycles) {
     }
 }
 
+// ---------- parallelFor ----------
+
+TEST_F(ThreadPoolTest, ParallelForRunsEveryIndexOnce) {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> hits(50);
+    ThreadPool::parallelFor(&pool, hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+}
+
+TEST_F(ThreadPoolTest, ParallelForWithoutPoolUsesTemporaryWorkers) {
+    std::atomic<int> counter{0};
+    ThreadPool::parallelFor(nullptr, 8, [&](size_t) { counter.fetch_add(1); });
+    EXPECT_EQ(counter.load(), 8);
+}
+
+TEST_F(ThreadPoolTest, ParallelForRunsSingleTaskInline) {
+    std::thread::id ranOn;
+    ThreadPool pool(2);
+    ThreadPool::parallelFor(&pool, 1, [&](size_t) { ranOn = std::this_thread::get_id(); });
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
+
+TEST_F(ThreadPoolTest, ParallelForRethrowsAfterEveryTaskFinishes) {
+    ThreadPool pool(2);
+    std::atomic<int> finished{0};
+    auto task = [&](size_t i) {
+        if (i == 0) {
+            throw std::runtime_error("task 0 failed");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        finished.fetch_add(1);
+    };
+    EXPECT_THROW(ThreadPool::parallelFor(&pool, 6, task), std::runtime_error);
+    EXPECT_EQ(finished.load(), 5);
+}
+
 // ============================================================================
 // Scheduler + ThreadPool Integration Tests
 // ============================================================================
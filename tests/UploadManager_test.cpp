@@ -0,0 +1,70 @@
+/**
+ * @file UploadManager_test.cpp
+ * @brief Unit tests for UploadManager (GPU-free paths)
+ */
+
+#include <vde/UploadManager.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace vde {
+namespace test {
+
+class UploadManagerTest : public ::testing::Test {
+  protected:
+    UploadManager uploads;
+};
+
+TEST_F(UploadManagerTest, DefaultHandleIsInvalid) {
+    UploadHandle handle;
+    EXPECT_FALSE(handle.isValid());
+    EXPECT_TRUE(UploadHandle{1}.isValid());
+}
+
+TEST_F(UploadManagerTest, StartsUninitialized) {
+    EXPECT_FALSE(uploads.isInitialized());
+    EXPECT_EQ(uploads.getTimelineSemaphore(), VK_NULL_HANDLE);
+    EXPECT_EQ(uploads.getSubmittedValue(), 0u);
+    EXPECT_EQ(uploads.getRingSize(), 0u);
+    EXPECT_FALSE(uploads.usesDedicatedQueue());
+    EXPECT_TRUE(uploads.getSharedQueueFamilies().empty());
+}
+
+TEST_F(UploadManagerTest, UninitializedHandlesAreReady) {
+    EXPECT_TRUE(uploads.isReady(UploadHandle{}));
+    EXPECT_TRUE(uploads.isReady(UploadHandle{42}));
+    uploads.wait(UploadHandle{42});  // must not block
+    uploads.waitIdle();
+}
+
+TEST_F(UploadManagerTest, FlushWithoutDeviceIsNoOp) {
+    EXPECT_FALSE(uploads.flush().isValid());
+    uploads.poll();
+    uploads.shutdown();
+    EXPECT_FALSE(uploads.isInitialized());
+}
+
+TEST_F(UploadManagerTest, EmptyUploadsReturnEmptyHandle) {
+    EXPECT_FALSE(uploads.uploadBuffer(VK_NULL_HANDLE, nullptr, 0).isValid());
+    EXPECT_FALSE(uploads.uploadImage(VK_NULL_HANDLE, 1, 1, nullptr, 0).isValid());
+}
+
+TEST_F(UploadManagerTest, StatsStartAtZero) {
+    UploadStats stats = uploads.getStats();
+    EXPECT_EQ(stats.uploadCount, 0u);
+    EXPECT_EQ(stats.bytesUploaded, 0u);
+    EXPECT_EQ(stats.batchesSubmitted, 0u);
+    EXPECT_EQ(stats.ringStalls, 0u);
+    EXPECT_EQ(stats.oversizedStagingBuffers, 0u);
+}
+
+TEST_F(UploadManagerTest, UploadingWithoutInitThrows) {
+    uint32_t value = 7;
+    EXPECT_THROW(uploads.uploadBuffer(VK_NULL_HANDLE, &value, sizeof(value)),
+                 std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace vde
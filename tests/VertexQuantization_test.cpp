@@ -0,0 +1,114 @@
+/**
+ * @file VertexQuantization_test.cpp
+ * @brief Unit tests for compact vertex and 16-bit index conversion (GPU-free)
+ */
+
+#include <vde/VertexQuantization.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace vde {
+namespace test {
+
+class VertexQuantizationTest : public ::testing::Test {
+  protected:
+    std::vector<Vertex> vertices;
+    glm::vec3 boundsMin{-2.0f, 0.0f, 10.0f};
+    glm::vec3 boundsMax{2.0f, 1.0f, 50.0f};
+
+    void SetUp() override {
+        for (int i = 0; i <= 10; ++i) {
+            float t = float(i) / 10.0f;
+            Vertex v{};
+            v.position = boundsMin + (boundsMax - boundsMin) * t;
+            v.color = glm::vec3(t, 1.0f - t, 0.5f);
+            v.texCoord = glm::vec2(t, t * t);
+            vertices.push_back(v);
+        }
+    }
+};
+
+TEST_F(VertexQuantizationTest, CompactLayoutMatchesVertexLocations) {
+    EXPECT_EQ(sizeof(CompactVertex), sizeof(Vertex) / 2);
+
+    auto binding = CompactVertex::getBindingDescription();
+    EXPECT_EQ(binding.stride, sizeof(CompactVertex));
+
+    auto full = Vertex::getAttributeDescriptions();
+    auto compact = CompactVertex::getAttributeDescriptions();
+    ASSERT_EQ(full.size(), compact.size());
+    for (size_t i = 0; i < full.size(); ++i) {
+        EXPECT_EQ(compact[i].location, full[i].location);
+    }
+    EXPECT_EQ(compact[0].format, VK_FORMAT_R16G16B16A16_UNORM);
+    EXPECT_EQ(compact[1].format, VK_FORMAT_R8G8B8A8_UNORM);
+    EXPECT_EQ(compact[2].format, VK_FORMAT_R16G16_UNORM);
+}
+
+TEST_F(VertexQuantizationTest, RoundTripStaysWithinQuantizationError) {
+    ASSERT_TRUE(VertexQuantization::canCompact(vertices));
+
+    auto compact = VertexQuantization::compact(vertices, boundsMin, boundsMax);
+    auto expanded = VertexQuantization::expand(compact, boundsMin, boundsMax);
+    ASSERT_EQ(expanded.size(), vertices.size());
+
+    glm::vec3 extent = boundsMax - boundsMin;
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        for (int axis = 0; axis < 3; ++axis) {
+            EXPECT_NEAR(expanded[i].position[axis], vertices[i].position[axis],
+                        extent[axis] / 65535.0f);
+            EXPECT_NEAR(expanded[i].color[axis], vertices[i].color[axis], 1.0f / 255.0f);
+        }
+        EXPECT_NEAR(expanded[i].texCoord.x, vertices[i].texCoord.x, 1.0f / 65535.0f);
+        EXPECT_NEAR(expanded[i].texCoord.y, vertices[i].texCoord.y, 1.0f / 65535.0f);
+    }
+
+    // Bounds corners are exact
+    EXPECT_EQ(expanded.front().position, boundsMin);
+    EXPECT_EQ(expanded.back().position, boundsMax);
+}
+
+TEST_F(VertexQuantizationTest, FlatAxisStoresZero) {
+    for (auto& v : vertices) {
+        v.position.y = 3.0f;
+    }
+    auto compact = VertexQuantization::compact(vertices, glm::vec3(-2.0f, 3.0f, 10.0f),
+                                               glm::vec3(2.0f, 3.0f, 50.0f));
+    auto expanded = VertexQuantization::expand(compact, glm::vec3(-2.0f, 3.0f, 10.0f),
+                                               glm::vec3(2.0f, 3.0f, 50.0f));
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        EXPECT_EQ(compact[i].position[1], 0);
+        EXPECT_EQ(expanded[i].position.y, 3.0f);
+    }
+}
+
+TEST_F(VertexQuantizationTest, RejectsDataOutsideUnitRange) {
+    std::vector<Vertex> signedNormal = vertices;
+    signedNormal[3].color = glm::vec3(0.0f, -1.0f, 0.0f);
+    EXPECT_FALSE(VertexQuantization::canCompact(signedNormal));
+
+    std::vector<Vertex> tiledUV = vertices;
+    tiledUV[5].texCoord = glm::vec2(4.0f, 0.0f);
+    EXPECT_FALSE(VertexQuantization::canCompact(tiledUV));
+
+    std::vector<Vertex> badPosition = vertices;
+    badPosition[0].position.x = std::numeric_limits<float>::infinity();
+    EXPECT_FALSE(VertexQuantization::canCompact(badPosition));
+}
+
+TEST_F(VertexQuantizationTest, NarrowsIndicesUpTo65536Vertices) {
+    EXPECT_TRUE(VertexQuantization::canUse16BitIndices(65536));
+    EXPECT_FALSE(VertexQuantization::canUse16BitIndices(65537));
+
+    std::vector<uint32_t> indices = {0, 1, 2, 65535, 40000, 7};
+    auto narrow = VertexQuantization::narrowIndices(indices);
+    ASSERT_EQ(narrow.size(), indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        EXPECT_EQ(narrow[i], indices[i]);
+    }
+}
+
+}  // namespace test
+}  // namespace vde